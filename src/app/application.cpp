@@ -1,5 +1,8 @@
 #include "app/application.hpp"
 
+#include "app/startup_snapshot.hpp"
+#include "app/trace_writer.hpp"
+#include "core/content_cache.hpp"
 #include "core/content_loader.hpp"
 #include "frontend/utils/font_loader.hpp"
 #include "frontend/views/dashboard_page.hpp"
@@ -9,7 +12,15 @@
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
 #include "utils/font_manager.hpp"
+#include "utils/glow_cache.hpp"
+#include "utils/glyph_atlas.hpp"
+#include "utils/surface_pool.hpp"
 #include "utils/text.hpp"
+#include "utils/text_texture_cache.hpp"
+#include "utils/texture_accounting.hpp"
+#include "utils/texture_pool.hpp"
+#include "utils/text_wrapping.hpp"
+#include "utils/utf8.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -18,10 +29,12 @@
 #include <filesystem>
 #include <fstream>
 #include <ctime>
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <stdexcept>
@@ -29,6 +42,7 @@
 #include <thread>
 #include <vector>
 #include <cstdlib>
+#include <csignal>
 #if !defined(_WIN32)
 #include <unistd.h>
 #endif
@@ -37,6 +51,96 @@ namespace colony
 {
 namespace
 {
+// Upper bound on how long the idle loop blocks waiting for an event before
+// re-evaluating whether anything needs rendering.
+constexpr int kIdleWaitTimeoutMs = 250;
+
+// A live resize is considered settled once no size event has arrived for
+// this long; the settled frame rewraps everything deferred during the drag.
+constexpr Uint64 kResizeSettleMilliseconds = 150;
+
+// Wait granularity while the window is minimized or hidden. Longer than the
+// idle timeout because no deadline short of window restoration matters; short
+// enough that the background pumps still tick regularly.
+constexpr int kHiddenWaitTimeoutMs = 1000;
+
+// Poll granularity while parked in resident mode. The summon signal cannot
+// wake SDL's event wait, so the parked loop polls its flag; this keeps the
+// idle cost negligible while bounding summon latency at around one frame.
+constexpr int kResidentSummonPollMs = 25;
+
+#if !defined(_WIN32)
+// Set from the SIGUSR1 handler; a flag write is all that is
+// async-signal-safe there.
+volatile std::sig_atomic_t gSummonRequested = 0;
+
+extern "C" void HandleSummonSignal(int)
+{
+    gSummonRequested = 1;
+}
+#endif
+
+// How many background-task completions may apply per frame. Completions are
+// cheap state swaps; the budget just keeps a burst of finished tasks from
+// stretching one frame.
+constexpr std::size_t kWorkCompletionFrameBudget = 4;
+
+// How long the startup snapshot cross-fades over the live UI once the first
+// real frame renders. Long enough to read as a transition rather than a pop,
+// short enough that a stale snapshot never lingers.
+constexpr double kStartupSnapshotFadeSeconds = 0.35;
+
+// How often the metrics snapshot handed to the endpoint is refreshed.
+// Scrapers see counters at most this stale; publishing faster would just
+// serialize JSON nobody reads.
+constexpr double kMetricsPublishIntervalSeconds = 1.0;
+
+// How often the content file's mtime is polled for hot reload. A stat once a
+// second is invisible next to a frame; catalog pushes still land within a
+// second or two of hitting disk.
+constexpr double kContentWatchIntervalSeconds = 1.0;
+
+// Settings changes are persisted write-behind: this is how long a change can
+// sit dirty before the serialized document is handed to the writer thread.
+constexpr double kSettingsSaveDelaySeconds = 1.0;
+
+// Cap on matches returned by a recursive "*" search in the Add App dialog.
+constexpr std::size_t kMaxGlobalSearchResults = 512;
+
+// Chrome panels pulse their active element from the animation clock. Folding
+// the raw clock into a panel's cache version would defeat caching entirely, so
+// the version carries a coarse phase instead: panels with a pulsing element
+// redraw at this rate rather than at frame rate, and stop redrawing altogether
+// under reduced motion because the animation clock is frozen.
+constexpr double kPanelCachePhaseHz = 30.0;
+
+std::uint64_t QuantizedAnimationPhase(double timeSeconds)
+{
+    return static_cast<std::uint64_t>(timeSeconds * kPanelCachePhaseHz);
+}
+
+// Byte budget for resident program visuals. The count cap alone lets texture
+// memory balloon on long-description catalogs, so eviction also enforces this
+// limit; seats with little VRAM can tighten it via COLONY_TEXTURE_BUDGET_MB.
+std::size_t ProgramVisualsBudgetBytes()
+{
+    static const std::size_t budget = [] {
+        constexpr std::size_t kDefaultMb = 256;
+        std::size_t megabytes = kDefaultMb;
+        if (const char* overrideValue = std::getenv("COLONY_TEXTURE_BUDGET_MB");
+            overrideValue != nullptr && overrideValue[0] != '\0')
+        {
+            const long parsed = std::strtol(overrideValue, nullptr, 10);
+            if (parsed > 0)
+            {
+                megabytes = static_cast<std::size_t>(parsed);
+            }
+        }
+        return megabytes * 1024 * 1024;
+    }();
+    return budget;
+}
+
 bool SDLCallSucceeded(int result)
 {
     if (result < 0)
@@ -47,22 +151,6 @@ bool SDLCallSucceeded(int result)
     return true;
 }
 
-void RemoveLastUtf8Codepoint(std::string& value)
-{
-    if (value.empty())
-    {
-        return;
-    }
-
-    auto it = value.end();
-    do
-    {
-        --it;
-    } while (it != value.begin() && ((*it & 0xC0) == 0x80));
-
-    value.erase(it, value.end());
-}
-
 float ComputeCustomizationSliderValue(const SDL_Rect& rect, int mouseX)
 {
     const int knobSize = ui::Scale(28);
@@ -76,6 +164,28 @@ float ComputeCustomizationSliderValue(const SDL_Rect& rect, int mouseX)
     return static_cast<float>(relative) / static_cast<float>(knobTravel);
 }
 
+// True when the catalog root is a manifest with at least one externalized
+// channel shard. The startup cache is skipped for these: its source hash
+// covers only the root file, so cached merged shards could go stale.
+bool IsShardedCatalog(const AppContent& content)
+{
+    return std::any_of(content.channels.begin(), content.channels.end(), [](const Channel& channel) {
+        return !channel.shardPath.empty();
+    });
+}
+
+// Merges one channel's lazily loaded shard into the catalog. Shard views are
+// authoritative for their programs; unrelated views are untouched.
+void MergeChannelShard(AppContent& content, Channel& channel, ChannelShard&& shard)
+{
+    channel.programs = std::move(shard.programs);
+    channel.shardLoaded = true;
+    for (auto& [viewId, view] : shard.views)
+    {
+        content.views.insert_or_assign(viewId, std::move(view));
+    }
+}
+
 } // namespace
 
 namespace
@@ -87,6 +197,11 @@ inline int AddDialogRowHeight()
 
 constexpr int kAddDialogCornerRadius = 18;
 
+// Upper bound on retained Add App row textures before the cache is dropped
+// wholesale; enough for several screens of scrollback without letting a huge
+// listing accumulate texture memory indefinitely.
+constexpr std::size_t kAddDialogRowCacheCap = 256;
+
 struct AddDialogSortOption
 {
     const char* label;
@@ -124,9 +239,7 @@ const std::vector<AddDialogFileTypeFilter>& GetAddDialogFileTypeFilters()
                 {
                     value.insert(value.begin(), '.');
                 }
-                std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-                    return static_cast<char>(std::tolower(ch));
-                });
+                text::ToLowerAsciiInPlace(value);
                 normalized.emplace_back(std::move(value));
             }
             return AddDialogFileTypeFilter{label, std::move(normalized), true, false, false};
@@ -217,7 +330,13 @@ Application::Application() = default;
 
 int Application::Run()
 {
-    if (!InitializeSDL())
+    // Each startup phase shows up as a named block in a COLONY_TRACE capture.
+    const auto traced = [](const char* name, auto&& phase) {
+        COLONY_TRACE_SCOPE(name);
+        return phase();
+    };
+
+    if (!traced("InitializeSDL", [this] { return InitializeSDL(); }))
     {
         return EXIT_FAILURE;
     }
@@ -227,35 +346,96 @@ int Application::Run()
         ~TtfGuard() { TTF_Quit(); }
     } ttfGuard;
 
-    if (!CreateWindowAndRenderer())
+    if (!traced("CreateWindowAndRenderer", [this] { return CreateWindowAndRenderer(); }))
     {
         SDL_Quit();
         return EXIT_FAILURE;
     }
 
-    if (!InitializeFonts())
+    // Pick up the DPI of whichever display the window opened on before any
+    // font is sized or texture rasterized.
+    traced("RefreshDisplayDpi", [this] { RefreshDisplayDpi(); });
+
+    // Splash last session's final frame before any heavy initialization so
+    // power-on shows the launcher immediately instead of a black window.
+    traced("PresentStartupSnapshot", [this] { PresentStartupSnapshot(); });
+
+    // Jank budget: two refresh intervals of the window's display. A frame
+    // that long guarantees at least one missed vsync, which is exactly the
+    // stutter seats report.
+    {
+        double refreshHz = 60.0;
+        SDL_DisplayMode mode{};
+        const int displayIndex = std::max(0, SDL_GetWindowDisplayIndex(window_.get()));
+        if (SDL_GetCurrentDisplayMode(displayIndex, &mode) == 0 && mode.refresh_rate > 0)
+        {
+            refreshHz = static_cast<double>(mode.refresh_rate);
+        }
+        jankBudgetMs_ = 2.0 * 1000.0 / refreshHz;
+        if (const char* budgetText = std::getenv("COLONY_JANK_BUDGET_MS");
+            budgetText != nullptr && *budgetText != '\0')
+        {
+            char* end = nullptr;
+            const double budget = std::strtod(budgetText, &end);
+            if (end != budgetText && *end == '\0' && budget >= 0.0)
+            {
+                jankBudgetMs_ = budget;
+            }
+            else
+            {
+                std::cerr << "Ignoring invalid COLONY_JANK_BUDGET_MS value: " << budgetText << '\n';
+            }
+        }
+    }
+
+    if (!traced("InitializeFonts", [this] { return InitializeFonts(); }))
     {
         SDL_Quit();
         return EXIT_FAILURE;
     }
 
-    if (!LoadContent())
+    const auto contentLoadStart = std::chrono::steady_clock::now();
+    if (!traced("LoadContent", [this] { return LoadContent(); }))
     {
         SDL_Quit();
         return EXIT_FAILURE;
     }
+    contentLoadMs_ =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - contentLoadStart).count();
+
+    // Settings subscribers: a toggle flip invalidates the frame so gated
+    // work (animations, idle skipping) reacts on the next pass instead of
+    // being re-checked per frame.
+    basicToggles_.OnChanged([this](ui::BasicToggle, bool) { InvalidateFrame(); });
+    traced("LoadSettings", [this] { LoadSettings(); });
+    iconArtPipeline_.SetCacheDirectory(ResolveSettingsPath().parent_path() / "art_cache");
+    jankRecorder_.SetDirectory(ResolveSettingsPath().parent_path() / "jank");
+    // The renderer comes up vsynced before settings are read; apply the
+    // persisted presentation policy now that it is known.
+    ApplyPresentationMode();
+    metricsServer_.StartFromEnvironment();
+    eventRecorder_.StartFromEnvironment();
+    contentSync_.StartFromEnvironment(ResolveContentPath());
+#if !defined(_WIN32)
+    // Kiosk resident mode: closing the window parks the warm process and the
+    // session's hotkey daemon summons it back with SIGUSR1.
+    if (const char* resident = std::getenv("COLONY_RESIDENT");
+        resident != nullptr && std::strcmp(resident, "0") != 0)
+    {
+        residentMode_ = true;
+        std::signal(SIGUSR1, HandleSummonSignal);
+    }
+#endif
 
-    LoadSettings();
-
-    if (!InitializeLocalization())
+    if (!traced("InitializeLocalization", [this] { return InitializeLocalization(); }))
     {
         SDL_Quit();
         return EXIT_FAILURE;
     }
 
-    InitializeNavigation();
-    InitializeViews();
-    RebuildTheme();
+    traced("InitializeNavigation", [this] { InitializeNavigation(); });
+    traced("InitializeViews", [this] { InitializeViews(); });
+    traced("RebuildTheme", [this] { RebuildTheme(); });
 
     channelButtonRects_.assign(content_.channels.size(), SDL_Rect{});
 
@@ -263,9 +443,25 @@ int Application::Run()
     SDL_Event event{};
     lastFrameCounter_ = SDL_GetPerformanceCounter();
     animationTimeSeconds_ = 0.0;
+    frameDamage_.MarkFullFrame();
+
+    if (const char* replayPath = std::getenv("COLONY_REPLAY_EVENTS");
+        replayPath != nullptr && *replayPath != '\0')
+    {
+        auto recorded = EventRecorder::Load(replayPath);
+        if (!recorded.has_value())
+        {
+            SDL_Quit();
+            return EXIT_FAILURE;
+        }
+        const int result = RunReplay(std::move(*recorded));
+        SDL_Quit();
+        return result;
+    }
 
     while (running)
     {
+        eventRecorder_.AdvanceFrame();
         const Uint64 now = SDL_GetPerformanceCounter();
         const Uint64 elapsedTicks = now - lastFrameCounter_;
         lastFrameCounter_ = now;
@@ -277,26 +473,194 @@ int Application::Run()
         }
         deltaSeconds = std::min(deltaSeconds, 0.25);
 
-        const auto reduceMotionIt = basicToggleStates_.find("reduced_motion");
-        const bool reduceMotion = reduceMotionIt != basicToggleStates_.end() && reduceMotionIt->second;
+        const bool reduceMotion = IsReduceMotionEnabled();
         if (!reduceMotion)
         {
             animationTimeSeconds_ += deltaSeconds;
         }
 
-        while (SDL_PollEvent(&event))
+        frameProfiler_.BeginFrame();
+
+        {
+            ScopedPhaseTimer eventTimer{frameProfiler_, FramePhase::Events};
+            DispatchPendingEvents(running);
+        }
+
+        PumpAddAppDialogScan();
+        PumpFontDownload();
+        PumpSettingsAutosave();
+        PumpLaunchResults();
+        PumpContentHotReload();
+        PublishMetricsIfDue();
+        UpdateScrollAnimations(deltaSeconds);
+
+        if (interactiveResizeActive_ && SDL_GetTicks64() - lastResizeEventAtTicks_ >= kResizeSettleMilliseconds)
+        {
+            // The size events stopped: leave resize mode and repaint once at
+            // the final size, rewrapping everything that was deferred.
+            interactiveResizeActive_ = false;
+            InvalidateFrame();
+        }
+
+#if !defined(_WIN32)
+        if (residentMode_ && gSummonRequested != 0)
         {
-            HandleEvent(event, running);
+            gSummonRequested = 0;
+            SummonFromResidentPark();
+        }
+#endif
+
+        if (!windowVisible_)
+        {
+            // Minimized or hidden: rendering is pure waste. Park in an event
+            // wait — the pumps above still run each pass, so autosave and
+            // downloads keep making progress. Restore/expose invalidates the
+            // frame, so the first visible pass repaints in full. A resident
+            // park polls faster so the summon flag is noticed promptly.
+            const int hiddenTimeoutMs = residentParked_ ? kResidentSummonPollMs : kHiddenWaitTimeoutMs;
+            if (SDL_WaitEventTimeout(&event, hiddenTimeoutMs) == 1)
+            {
+                HandleEvent(event, running);
+                DispatchPendingEvents(running);
+            }
+            continue;
+        }
+
+        if (profilerHudVisible_)
+        {
+            // The HUD shows live numbers; keep frames flowing while it is up.
+            InvalidateFrame();
+        }
+
+        if (ShouldSkipIdleFrame(reduceMotion))
+        {
+            // Nothing changed and no animation is advancing: keep the last
+            // presented frame on screen and block until input arrives.
+            if (SDL_WaitEventTimeout(&event, kIdleWaitTimeoutMs) == 1)
+            {
+                HandleEvent(event, running);
+                DispatchPendingEvents(running);
+            }
+            continue;
         }
 
+        const auto frameStartTime = std::chrono::steady_clock::now();
         RenderFrame(reduceMotion ? 0.0 : deltaSeconds);
+        frameProfiler_.EndFrame();
+        MaybeRecordJankIncident();
+        frameDamage_.Clear();
+        PacePresentation(frameStartTime);
+
+        // Warm visuals for the programs next to the current selection, one
+        // build per frame, so channel browsing lands on resident textures.
+        PrewarmAdjacentProgramVisuals(1);
+
+        // Same one-build-per-frame pacing for the tiles queued by the
+        // channel prefetcher; already-resident programs are skipped free.
+        while (!queuedVisualPrewarms_.empty())
+        {
+            const std::string prewarmId = std::move(queuedVisualPrewarms_.front());
+            queuedVisualPrewarms_.pop_front();
+            if (programVisuals_.find(prewarmId) == programVisuals_.end())
+            {
+                EnsureProgramVisuals(prewarmId);
+                break;
+            }
+        }
     }
 
+    // Render one last frame with the pre-present readback armed; it becomes
+    // next launch's instant-on splash.
+    captureStartupSnapshotOnPresent_ = true;
+    InvalidateFrame();
+    RenderFrame(0.0);
+
     SaveSettings();
     SDL_Quit();
     return EXIT_SUCCESS;
 }
 
+int Application::RunReplay(std::vector<EventRecorder::TimedEvent> events)
+{
+    // The recording groups events by the main-loop pass they arrived in.
+    // Replay injects each group and renders exactly one frame for it, using
+    // the captured wall-clock gaps as animation deltas — timed behaviour
+    // matches the original session while the real clock runs flat out.
+    std::vector<double> frameMs;
+    frameMs.reserve(events.size());
+
+    bool running = true;
+    std::uint64_t previousAtMs = events.empty() ? 0 : events.front().atMs;
+    std::size_t next = 0;
+    const auto replayStart = std::chrono::steady_clock::now();
+
+    while (running && next < events.size())
+    {
+        const std::uint64_t frameIndex = events[next].frameIndex;
+        const std::uint64_t frameAtMs = events[next].atMs;
+        double deltaSeconds = static_cast<double>(frameAtMs - previousAtMs) / 1000.0;
+        deltaSeconds = std::min(deltaSeconds, 0.25);
+        previousAtMs = frameAtMs;
+
+        const auto frameStart = std::chrono::steady_clock::now();
+        while (next < events.size() && events[next].frameIndex == frameIndex)
+        {
+            HandleEvent(events[next].event, running);
+            ++next;
+        }
+        if (!running)
+        {
+            break;
+        }
+
+        animationTimeSeconds_ += deltaSeconds;
+        frameProfiler_.BeginFrame();
+        InvalidateFrame();
+        RenderFrame(deltaSeconds);
+        frameProfiler_.EndFrame();
+        frameDamage_.Clear();
+        frameMs.push_back(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart)
+                .count());
+    }
+
+    const double totalMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - replayStart).count();
+
+    double sumMs = 0.0;
+    for (const double ms : frameMs)
+    {
+        sumMs += ms;
+    }
+    std::vector<double> sorted = frameMs;
+    std::sort(sorted.begin(), sorted.end());
+    const auto percentile = [&sorted](double fraction) {
+        if (sorted.empty())
+        {
+            return 0.0;
+        }
+        const auto index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1));
+        return sorted[index];
+    };
+
+    std::printf("replayed %zu frames in %.1f ms\n", frameMs.size(), totalMs);
+    std::printf(
+        "frame ms: mean %.3f  p50 %.3f  p95 %.3f  p99 %.3f  max %.3f\n",
+        frameMs.empty() ? 0.0 : sumMs / static_cast<double>(frameMs.size()),
+        percentile(0.50),
+        percentile(0.95),
+        percentile(0.99),
+        sorted.empty() ? 0.0 : sorted.back());
+    std::printf(
+        "text cache: %zu hits, %zu misses\n",
+        TextTextureCache::Shared().HitCount(),
+        TextTextureCache::Shared().MissCount());
+    std::printf(
+        "texture memory: %.1f MiB resident\n",
+        static_cast<double>(TextureAccounting::Shared().TotalBytes()) / (1024.0 * 1024.0));
+    return EXIT_SUCCESS;
+}
+
 void Application::ShowHub()
 {
     interfaceState_ = InterfaceState::Hub;
@@ -365,7 +729,14 @@ bool Application::CreateWindowAndRenderer()
 
 bool Application::InitializeFonts()
 {
-    const fonts::FontConfiguration fontConfiguration = fonts::BuildFontConfiguration(activeLanguageId_);
+    const fonts::FontConfiguration fontConfiguration =
+        fonts::BuildFontConfiguration(activeLanguageId_, ResolveFontResolutionCachePath());
+    if (fontConfiguration.bundledFontMissing)
+    {
+        // Come up with whatever face resolved and swap in the preferred one
+        // once the download lands; see PumpFontDownload.
+        fontDownloadTask_.Start();
+    }
     if (fontConfiguration.primaryFontPath.empty())
     {
         std::cerr << "Unable to locate a usable font file. Provide JetBrainsMono-Regular.ttf in assets/fonts or set COLONY_FONT_PATH." << '\n';
@@ -375,10 +746,10 @@ bool Application::InitializeFonts()
     const ui::Typography typography = themeManager_.ActiveScheme().typography;
     frontend::fonts::LoadFontSetParams fontParams{typography, fontConfiguration};
 
-    const auto openRoleFont = [&](frontend::fonts::FontRole role, int size) -> sdl::FontHandle {
+    const auto openRoleFont = [&](frontend::fonts::FontRole role, int size) -> TTF_Font* {
         if (size <= 0)
         {
-            return {};
+            return nullptr;
         }
 
         std::filesystem::path path = frontend::fonts::ResolveFontForRole(role, fontParams);
@@ -387,15 +758,11 @@ bool Application::InitializeFonts()
             path = fontConfiguration.primaryFontPath;
         }
 
-        return sdl::FontHandle{TTF_OpenFont(path.string().c_str(), ui::ScaleDynamic(size))};
+        return fontCache_.Acquire(path.string(), ui::ScaleDynamic(size));
     };
 
-    const auto openFontPath = [&](const std::string& path, int size) -> sdl::FontHandle {
-        if (size <= 0 || path.empty())
-        {
-            return {};
-        }
-        return sdl::FontHandle{TTF_OpenFont(path.c_str(), ui::ScaleDynamic(size))};
+    const auto openFontPath = [&](const std::string& path, int size) -> TTF_Font* {
+        return fontCache_.Acquire(path, ui::ScaleDynamic(size));
     };
 
     fonts_.brand = openRoleFont(frontend::fonts::FontRole::Headline, typography.headline.size);
@@ -431,30 +798,56 @@ bool Application::InitializeFonts()
             continue;
         }
 
-        sdl::FontHandle fontHandle = openFontPath(fontPath, kBodyFontPointSize);
-        if (!fontHandle)
+        TTF_Font* languageFont = openFontPath(fontPath, kBodyFontPointSize);
+        if (languageFont == nullptr)
         {
             std::cerr << "Warning: failed to load language font for '" << languageId << "' from " << fontPath << ": "
                       << TTF_GetError() << '\n';
             continue;
         }
 
-        languageFonts_.emplace(languageId, std::move(fontHandle));
+        languageFonts_.emplace(languageId, languageFont);
+    }
+
+    std::vector<TTF_Font*> statusChain;
+    statusChain.reserve(languageFonts_.size() + 1);
+    statusChain.push_back(fonts_.status);
+    for (const auto& [languageId, languageFont] : languageFonts_)
+    {
+        statusChain.push_back(languageFont);
     }
+    statusFallbackChain_.SetFonts(std::move(statusChain));
 
     return true;
 }
 
 bool Application::LoadContent()
 {
-    try
+    const std::filesystem::path contentPath = ResolveContentPath();
+
+    if (auto cached = TryLoadContentCache(contentPath))
     {
-        content_ = LoadContentFromFile(ResolveContentPath().string());
+        content_ = std::move(*cached);
     }
-    catch (const std::exception& ex)
+    else
     {
-        std::cerr << ex.what() << '\n';
-        return false;
+        try
+        {
+            content_ = LoadContentFromFile(contentPath.string());
+        }
+        catch (const std::exception& ex)
+        {
+            std::cerr << ex.what() << '\n';
+            return false;
+        }
+
+        // Best effort: a failed cache write just means the next startup
+        // parses the JSON again. Manifest catalogs are never cached — the
+        // source hash covers only the root file, not the shards.
+        if (!IsShardedCatalog(content_))
+        {
+            WriteContentCache(contentPath, content_);
+        }
     }
 
     if (content_.channels.empty())
@@ -463,15 +856,261 @@ bool Application::LoadContent()
         return false;
     }
 
+    // A manifest startup pays for one channel: the shard for the first rail
+    // entry loads inline so the initial frame has tiles; the rest of the
+    // catalog streams in on first visit via ActivateChannel.
+    if (Channel& startupChannel = content_.channels.front();
+        !startupChannel.shardPath.empty() && !startupChannel.shardLoaded)
+    {
+        try
+        {
+            MergeChannelShard(
+                content_,
+                startupChannel,
+                LoadChannelShardFromFile((contentPath.parent_path() / startupChannel.shardPath).string()));
+        }
+        catch (const std::exception& ex)
+        {
+            std::cerr << ex.what() << '\n';
+            return false;
+        }
+    }
+
     channelSelections_.assign(content_.channels.size(), 0);
     EnsureLocalAppsChannel();
+    programIndex_.Rebuild(content_);
+
+    std::error_code watchEc;
+    contentWriteTime_ = std::filesystem::last_write_time(contentPath, watchEc);
     return true;
 }
 
+void Application::PumpContentHotReload()
+{
+    const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+    if (contentReloadInFlight_ || nowSeconds - contentWatchedAtSeconds_ < kContentWatchIntervalSeconds)
+    {
+        return;
+    }
+    contentWatchedAtSeconds_ = nowSeconds;
+
+    const std::filesystem::path contentPath = ResolveContentPath();
+    std::error_code ec;
+    const auto writeTime = std::filesystem::last_write_time(contentPath, ec);
+    if (ec || writeTime == contentWriteTime_)
+    {
+        return;
+    }
+    contentWriteTime_ = writeTime;
+    contentReloadInFlight_ = true;
+
+    workScheduler_.Submit(WorkScheduler::Priority::Normal, [this, contentPath]() -> WorkScheduler::Completion {
+        std::shared_ptr<AppContent> reloaded;
+        try
+        {
+            reloaded = std::make_shared<AppContent>(LoadContentFromFile(contentPath.string()));
+            // Hot reload diffs the whole catalog, so a manifest root loads
+            // all of its shards here — still off the UI thread, and reloads
+            // are rare enough that laziness buys nothing.
+            for (Channel& channel : reloaded->channels)
+            {
+                if (!channel.shardPath.empty() && !channel.shardLoaded)
+                {
+                    MergeChannelShard(
+                        *reloaded,
+                        channel,
+                        LoadChannelShardFromFile((contentPath.parent_path() / channel.shardPath).string()));
+                }
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            const std::string message = ex.what();
+            return [this, message] {
+                contentReloadInFlight_ = false;
+                std::cerr << "Content reload failed, keeping previous catalog: " << message << '\n';
+            };
+        }
+
+        // Keep the startup cache in step so the next launch does not
+        // re-parse the document this reload already paid for. Manifest
+        // catalogs stay uncached; see LoadContent.
+        if (!IsShardedCatalog(*reloaded))
+        {
+            WriteContentCache(contentPath, *reloaded);
+        }
+
+        return [this, reloaded] {
+            contentReloadInFlight_ = false;
+            ApplyReloadedContent(std::move(*reloaded));
+        };
+    });
+}
+
+void Application::ApplyReloadedContent(AppContent updated)
+{
+    if (updated.channels.empty())
+    {
+        std::cerr << "Content reload dropped: no channels defined in content file." << '\n';
+        return;
+    }
+
+    const bool hubChanged = updated.hub != content_.hub;
+    const bool chromeChanged = updated.brandName != content_.brandName || updated.user != content_.user;
+
+    // Views are applied per program so an edited description re-rasterizes
+    // one program's visuals instead of the whole catalog.
+    std::vector<std::string> changedPrograms;
+    std::vector<std::string> addedPrograms;
+    for (auto& [id, view] : updated.views)
+    {
+        const auto existing = content_.views.find(id);
+        if (existing == content_.views.end())
+        {
+            addedPrograms.push_back(id);
+        }
+        else if (existing->second == view)
+        {
+            continue;
+        }
+        changedPrograms.push_back(id);
+        content_.views.insert_or_assign(id, std::move(view));
+    }
+    for (auto it = content_.views.begin(); it != content_.views.end();)
+    {
+        // User-added applications exist only in memory and settings; the
+        // content file never mentions them, so they survive the reload.
+        if (updated.views.contains(it->first) || userAppExecutables_.contains(it->first))
+        {
+            ++it;
+            continue;
+        }
+        changedPrograms.push_back(it->first);
+        it = content_.views.erase(it);
+    }
+
+    // The synthesized local apps channel (and its program list) is owned by
+    // the launcher, not the file, so it is carried across wholesale.
+    std::vector<Channel> desiredChannels = std::move(updated.channels);
+    const auto isLocalChannel = [](const Channel& channel) { return channel.id == kLocalAppsChannelId; };
+    const auto previousLocal = std::find_if(content_.channels.begin(), content_.channels.end(), isLocalChannel);
+    if (previousLocal != content_.channels.end()
+        && std::find_if(desiredChannels.begin(), desiredChannels.end(), isLocalChannel) == desiredChannels.end())
+    {
+        desiredChannels.push_back(*previousLocal);
+    }
+
+    const bool channelsChanged = desiredChannels != content_.channels;
+    if (channelsChanged)
+    {
+        // Selections and the active entry are positional; carry them across
+        // by channel id so a reordered catalog does not jump the seat to an
+        // unrelated channel.
+        std::unordered_map<std::string, int> selectionsById;
+        for (std::size_t index = 0; index < content_.channels.size() && index < channelSelections_.size(); ++index)
+        {
+            selectionsById.emplace(content_.channels[index].id, channelSelections_[index]);
+        }
+        const std::string previousChannelId = activeChannelIndex_ >= 0
+                && activeChannelIndex_ < static_cast<int>(content_.channels.size())
+            ? content_.channels[static_cast<std::size_t>(activeChannelIndex_)].id
+            : std::string{};
+
+        content_.channels = std::move(desiredChannels);
+        channelSelections_.assign(content_.channels.size(), 0);
+        for (std::size_t index = 0; index < content_.channels.size(); ++index)
+        {
+            if (const auto it = selectionsById.find(content_.channels[index].id); it != selectionsById.end())
+            {
+                channelSelections_[index] = it->second;
+            }
+        }
+        EnsureLocalAppsChannel();
+        SyncNavigationEntries();
+
+        int targetChannel = 0;
+        for (std::size_t index = 0; index < content_.channels.size(); ++index)
+        {
+            if (content_.channels[index].id == previousChannelId)
+            {
+                targetChannel = static_cast<int>(index);
+                break;
+            }
+        }
+        if (!navigationController_.Activate(targetChannel))
+        {
+            // Same rail index as before: re-activate directly so the program
+            // selection is re-clamped against the new channel contents.
+            ActivateChannel(navigationController_.ActiveIndex());
+        }
+    }
+
+    if (hubChanged)
+    {
+        content_.hub = std::move(updated.hub);
+        hubCatalogValid_ = false;
+        BuildHubPanel();
+    }
+
+    if (chromeChanged)
+    {
+        content_.brandName = std::move(updated.brandName);
+        content_.user = std::move(updated.user);
+        topBarCache_.Invalidate();
+    }
+
+    if (!changedPrograms.empty() || channelsChanged)
+    {
+        for (const auto& programId : changedPrograms)
+        {
+            if (auto it = programVisuals_.find(programId); it != programVisuals_.end())
+            {
+                const std::size_t bytes = ui::EstimateProgramVisualsBytes(it->second);
+                TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::ProgramVisuals, bytes);
+                accountedProgramVisualsBytes_ -= std::min(accountedProgramVisualsBytes_, bytes);
+                programVisuals_.erase(it);
+            }
+            programVisualsLru_.remove(programId);
+        }
+
+        for (const auto& programId : addedPrograms)
+        {
+            if (!IsSettingsProgramId(programId))
+            {
+                viewRegistry_.RegisterLazy(
+                    programId, [this](const std::string& id) { return viewFactory_.CreateSimpleTextView(id); });
+            }
+        }
+        viewRegistry_.BindContent(content_);
+
+        programIndex_.Rebuild(content_);
+        libraryViewModel_.InvalidateProgramList();
+
+        if (!activeProgramId_.empty() && !IsSettingsProgramId(activeProgramId_)
+            && !content_.views.contains(activeProgramId_))
+        {
+            ActivateChannel(std::clamp(activeChannelIndex_, 0, static_cast<int>(content_.channels.size()) - 1));
+        }
+        else if (std::find(changedPrograms.begin(), changedPrograms.end(), activeProgramId_)
+            != changedPrograms.end())
+        {
+            ActivateProgram(activeProgramId_);
+        }
+    }
+
+    if (!changedPrograms.empty() || channelsChanged || hubChanged || chromeChanged)
+    {
+        InvalidateFrame();
+    }
+}
+
 bool Application::InitializeLocalization()
 {
     localizationManager_.SetResourceDirectory(ResolveLocalizationDirectory());
     localizationManager_.SetFallbackLanguage("en");
+    // Compiled once (and again whenever a source file changes), then every
+    // language switch is served straight from the mapping.
+    localizationManager_.UseCompiledBundle(ResolveLocalizationBundlePath());
 
     if (!localizationManager_.LoadLanguage(activeLanguageId_))
     {
@@ -511,44 +1150,38 @@ void Application::InitializeNavigation()
 
 void Application::InitializeViews()
 {
+    // Handles only: each entry is a reserved id plus a factory thunk, and
+    // the view object is materialized on first activation. On a large
+    // catalog this turns startup from thousands of heap objects into one
+    // map insert per program.
+    const auto makeView = [this](const std::string& id) { return viewFactory_.CreateSimpleTextView(id); };
     for (const auto& [id, view] : content_.views)
     {
         if (IsSettingsProgramId(id))
         {
             continue;
         }
-        viewRegistry_.Register(viewFactory_.CreateSimpleTextView(id));
+        viewRegistry_.RegisterLazy(id, makeView);
     }
     viewRegistry_.BindContent(content_);
 }
 
-void Application::RebuildTheme()
+void Application::RebuildLocalizedChrome()
 {
+    // The subset of RebuildTheme that consumes localized strings: panel
+    // chrome built through the localize lambda, the hub catalog, the status
+    // bar and the add-app dialog labels. A language switch that resolves to
+    // the same font handles runs only this, leaving program visuals, view
+    // textures and the text caches untouched.
     const int previousSettingsScrollOffset = settingsScrollOffset_;
+    const auto localize = [this](std::string_view key) { return GetLocalizedString(key); };
 
-    const ui::ColorScheme& activeScheme = themeManager_.ActiveScheme();
-    theme_ = activeScheme.colors;
-    typography_ = activeScheme.typography;
-    interactions_ = activeScheme.interactions;
-    motion_ = activeScheme.motion;
-
-    ApplyInterfaceDensity();
-    ApplyAppearanceCustomizations();
-    RebuildInteractionPalette();
-
-    const auto localize = [this](std::string_view key) { return GetLocalizedString(key); };
-
-    navigationRail_.Build(
-        renderer_.get(),
-        fonts_.brand.get(),
-        fonts_.navigation.get(),
-        fonts_.tileMeta.get(),
-        content_,
-        theme_,
-        typography_);
+    libraryViewModel_.InvalidateSortChips();
+    topBarCache_.Invalidate();
+    libraryPanelCache_.Invalidate();
 
-    libraryPanel_.Build(renderer_.get(), fonts_.tileMeta.get(), theme_, localize);
-    heroPanel_.Build(renderer_.get(), fonts_.tileMeta.get(), theme_, localize);
+    libraryPanel_.Build(renderer_.get(), fonts_.tileMeta, theme_, localize);
+    heroPanel_.Build(renderer_.get(), fonts_.tileMeta, theme_, localize);
 
     std::string searchPlaceholder = localize("library.filter_placeholder");
     if (searchPlaceholder.empty())
@@ -562,8 +1195,8 @@ void Application::RebuildTheme()
 
     topBar_.Build(
         renderer_.get(),
-        fonts_.heroSubtitle.get(),
-        fonts_.tileMeta.get(),
+        fonts_.heroSubtitle,
+        fonts_.tileMeta,
         theme_,
         typography_,
         searchPlaceholder,
@@ -571,8 +1204,8 @@ void Application::RebuildTheme()
     UpdateTopBarTitle();
     settingsPanel_.Build(
         renderer_.get(),
-        fonts_.heroTitle.get(),
-        fonts_.heroBody.get(),
+        fonts_.heroTitle,
+        fonts_.heroBody,
         theme_.heroTitle,
         theme_.heroBody,
         themeManager_,
@@ -581,24 +1214,84 @@ void Application::RebuildTheme()
             const auto it = languageFonts_.find(std::string{languageId});
             if (it != languageFonts_.end())
             {
-                return it->second.get();
+                return it->second;
             }
-            return fonts_.heroBody.get();
+            return fonts_.heroBody;
         });
     settingsScrollOffset_ = std::max(0, previousSettingsScrollOffset);
 
+    // Localized hub strings depend on the language and accent colors on the
+    // theme, so the catalog is rebuilt along with the rest of the chrome.
+    hubCatalogValid_ = false;
     BuildHubPanel();
-    RebuildProgramVisuals();
     UpdateStatusMessage(statusBuffer_.empty() && !activeProgramId_.empty()
             ? content_.views.at(activeProgramId_).statusMessage
             : statusBuffer_);
 
+    if (addAppDialog_.visible)
+    {
+        RefreshAddAppDialogEntries();
+    }
+}
+
+void Application::RebuildTheme()
+{
+    ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::ThemeRebuild};
+
+    // Theme colors (and possibly font handles, after a language change) feed
+    // into every cached text run; drop them so stale rasterizations cannot
+    // alias reopened fonts.
+    TextTextureCache::Shared().Clear();
+    GlyphAtlas::Shared().ReleaseTextures();
+    ClearWrapCaches();
+    libraryViewModel_.InvalidateSortChips();
+
+    // Panel cache versions only track per-frame state; theme, font and
+    // localization swaps invalidate the cached chrome textures directly.
+    navRailCache_.Invalidate();
+    topBarCache_.Invalidate();
+    libraryPanelCache_.Invalidate();
+    addAppRowCaches_.clear();
+    for (ui::RowTargetCache& cache : customThemeFieldCaches_)
+    {
+        cache.Invalidate();
+    }
+
+    // Atlas art is keyed by the scaled tile size, so a density or DPI swap
+    // must re-pack; decodes replay from the on-disk cache, not the sources.
+    iconArtPipeline_.ReleaseTextures();
+
+    const ui::ColorScheme& activeScheme = themeManager_.ActiveScheme();
+    theme_ = activeScheme.colors;
+    typography_ = activeScheme.typography;
+    interactions_ = activeScheme.interactions;
+    motion_ = activeScheme.motion;
+
+    ApplyInterfaceDensity();
+    ApplyAppearanceCustomizations();
+    RebuildInteractionPalette();
+
+    navigationRail_.Build(
+        renderer_.get(),
+        fonts_.brand,
+        fonts_.navigation,
+        fonts_.tileMeta,
+        content_,
+        theme_,
+        typography_);
+
+    RebuildLocalizedChrome();
+    RebuildProgramVisuals();
+
     viewContext_.renderer = renderer_.get();
-    viewContext_.headingFont = fonts_.heroTitle.get();
-    viewContext_.paragraphFont = fonts_.heroBody.get();
-    viewContext_.buttonFont = fonts_.button.get();
+    viewContext_.headingFont = fonts_.heroTitle;
+    viewContext_.paragraphFont = fonts_.heroBody;
+    viewContext_.buttonFont = fonts_.button;
     viewContext_.primaryColor = theme_.heroTitle;
     viewContext_.mutedColor = theme_.heroBody;
+    // Invalidates the warm views' retained textures: anything rasterized
+    // under the previous theme or font set rebuilds on its next activation.
+    ++viewContext_.themeGeneration;
     UpdateViewContextAccent();
 
     if (!activeProgramId_.empty() && !IsSettingsProgramId(activeProgramId_))
@@ -610,42 +1303,318 @@ void Application::RebuildTheme()
         viewRegistry_.DeactivateActive();
     }
 
-    if (addAppDialog_.visible)
+    InvalidateFrame();
+}
+
+void Application::RefreshThemeDerivedColors()
+{
+    // Recomputes everything that depends on the appearance customization
+    // values without re-rasterizing any textures: the base scheme colors,
+    // the UI scale, the customization mixes and the interaction palette.
+    // Panels pick the new colors up on the next frame because fills and
+    // chrome are drawn immediate-mode; baked text keeps its previous tint
+    // until the deferred full rebuild runs.
+    const ui::ColorScheme& activeScheme = themeManager_.ActiveScheme();
+    theme_ = activeScheme.colors;
+
+    ApplyInterfaceDensity();
+    ApplyAppearanceCustomizations();
+    RebuildInteractionPalette();
+    InvalidateFrame();
+}
+
+void Application::FinishCustomizationDrag()
+{
+    const bool dragEnded = activeCustomizationDragId_.has_value();
+    activeCustomizationDragId_.reset();
+    if (themeRebuildPendingAfterDrag_)
     {
-        RefreshAddAppDialogEntries();
+        themeRebuildPendingAfterDrag_ = false;
+        RebuildTheme();
+    }
+    if (dragEnded)
+    {
+        QueueSettingsSave();
     }
 }
 
 void Application::RebuildProgramVisuals()
 {
+    // Visuals are built lazily: dropping everything here means a theme or
+    // language change re-rasterizes only the programs the user actually
+    // visits afterwards, instead of the whole catalog up front.
     programVisuals_.clear();
+    programVisualsLru_.clear();
+    TextureAccounting::Shared().Remove(
+        TextureAccounting::Subsystem::ProgramVisuals, accountedProgramVisualsBytes_);
+    accountedProgramVisualsBytes_ = 0;
+
+    if (!activeProgramId_.empty())
+    {
+        EnsureProgramVisuals(activeProgramId_);
+    }
+}
+
+ui::ProgramVisuals Application::CreateProgramVisuals(const ViewContent& view)
+{
     const SDL_Color heroSubtitleColor = color::Mix(theme_.heroBody, theme_.heroTitle, 0.35f);
 
-    for (const auto& [id, view] : content_.views)
+    return ui::BuildProgramVisuals(
+        view,
+        renderer_.get(),
+        fonts_.heroTitle,
+        fonts_.heroSubtitle,
+        fonts_.heroBody,
+        fonts_.button,
+        fonts_.tileTitle,
+        fonts_.tileSubtitle,
+        fonts_.tileMeta,
+        fonts_.patchTitle,
+        fonts_.patchBody,
+        fonts_.status,
+        theme_.heroTitle,
+        theme_.heroBody,
+        heroSubtitleColor,
+        theme_.muted,
+        theme_.statusBarText,
+        theme_.heroGradientFallbackStart,
+        theme_.heroGradientFallbackEnd);
+}
+
+ui::ProgramVisuals* Application::EnsureProgramVisuals(const std::string& programId)
+{
+    if (programId.empty())
+    {
+        return nullptr;
+    }
+
+    if (auto it = programVisuals_.find(programId); it != programVisuals_.end())
+    {
+        if (auto lruIt = std::find(programVisualsLru_.begin(), programVisualsLru_.end(), programId);
+            lruIt != programVisualsLru_.end())
+        {
+            programVisualsLru_.splice(programVisualsLru_.begin(), programVisualsLru_, lruIt);
+        }
+        return &it->second;
+    }
+
+    const auto viewIt = content_.views.find(programId);
+    if (viewIt == content_.views.end())
+    {
+        return nullptr;
+    }
+
+    auto [it, inserted] = programVisuals_.emplace(programId, CreateProgramVisuals(viewIt->second));
+    programVisualsLru_.push_front(programId);
+
+    // Evict the least-recently-used visuals beyond the residency cap or the
+    // texture byte budget; the active program is never dropped since the hero
+    // area reads it each frame.
+    std::size_t totalBytes = RefreshProgramVisualsAccounting();
+    while (programVisualsLru_.size() > 1
+        && (programVisualsLru_.size() > kMaxResidentProgramVisuals || totalBytes > ProgramVisualsBudgetBytes()))
+    {
+        auto candidate = std::prev(programVisualsLru_.end());
+        if (*candidate == activeProgramId_)
+        {
+            if (candidate == programVisualsLru_.begin())
+            {
+                break;
+            }
+            --candidate;
+        }
+        if (auto evictIt = programVisuals_.find(*candidate); evictIt != programVisuals_.end())
+        {
+            const std::size_t evictedBytes = ui::EstimateProgramVisualsBytes(evictIt->second);
+            TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::ProgramVisuals, evictedBytes);
+            accountedProgramVisualsBytes_ -= std::min(accountedProgramVisualsBytes_, evictedBytes);
+            totalBytes -= std::min(totalBytes, evictedBytes);
+            programVisuals_.erase(evictIt);
+        }
+        programVisualsLru_.erase(candidate);
+    }
+
+    return &it->second;
+}
+
+std::size_t Application::RefreshProgramVisualsAccounting()
+{
+    // Visuals grow after creation — descriptions, highlights and patch
+    // sections rasterize lazily on first hero render — so the tally is
+    // recomputed from current contents rather than recorded once at insert.
+    std::size_t totalBytes = 0;
+    for (const auto& [programId, visuals] : programVisuals_)
+    {
+        totalBytes += ui::EstimateProgramVisualsBytes(visuals);
+    }
+    TextureAccounting::Shared().Remove(
+        TextureAccounting::Subsystem::ProgramVisuals, accountedProgramVisualsBytes_);
+    TextureAccounting::Shared().Add(TextureAccounting::Subsystem::ProgramVisuals, totalBytes);
+    accountedProgramVisualsBytes_ = totalBytes;
+    return totalBytes;
+}
+
+void Application::PrewarmAdjacentProgramVisuals(int maxBuilds)
+{
+    if (maxBuilds <= 0 || activeChannelIndex_ < 0
+        || activeChannelIndex_ >= static_cast<int>(content_.channels.size()))
+    {
+        return;
+    }
+
+    const auto& programs = content_.channels[activeChannelIndex_].programs;
+    if (programs.empty() || activeChannelIndex_ >= static_cast<int>(channelSelections_.size()))
+    {
+        return;
+    }
+
+    const int selection = std::clamp(channelSelections_[activeChannelIndex_], 0, static_cast<int>(programs.size()) - 1);
+    int builds = 0;
+    for (const int offset : {1, -1, 2, -2})
+    {
+        const int index = selection + offset;
+        if (index < 0 || index >= static_cast<int>(programs.size()))
+        {
+            continue;
+        }
+        if (programVisuals_.find(programs[index]) != programVisuals_.end())
+        {
+            continue;
+        }
+        EnsureProgramVisuals(programs[index]);
+        if (++builds >= maxBuilds)
+        {
+            return;
+        }
+    }
+}
+
+void Application::PrefetchAdjacentChannelLists()
+{
+    // Pre-sort the library lists for the channels the user is most likely to
+    // switch to next — the neighbours of the active channel and the one just
+    // left — so Activate lands on warm data instead of sorting a large
+    // catalog on click. The snapshot is a plain copy, so the worker never
+    // reads content_ while the UI thread may be mutating it.
+    const int channelCount = static_cast<int>(content_.channels.size());
+    std::array<int, 3> candidates{activeChannelIndex_ - 1, activeChannelIndex_ + 1, previousChannelIndex_};
+    for (std::size_t slot = 0; slot < candidates.size(); ++slot)
+    {
+        const int candidate = candidates[slot];
+        if (candidate < 0 || candidate >= channelCount || candidate == activeChannelIndex_)
+        {
+            continue;
+        }
+        if (std::find(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(slot), candidate)
+            != candidates.begin() + static_cast<std::ptrdiff_t>(slot))
+        {
+            continue;
+        }
+
+        // A neighbour whose shard has not loaded yet gets the shard warmed
+        // instead; prefetching its list now would just cache emptiness.
+        const Channel& candidateChannel = content_.channels[static_cast<std::size_t>(candidate)];
+        if (!candidateChannel.shardPath.empty() && !candidateChannel.shardLoaded)
+        {
+            RequestChannelShard(candidate, WorkScheduler::Priority::Idle);
+            continue;
+        }
+
+        auto snapshot = frontend::models::LibraryViewModel::SnapshotChannel(
+            content_,
+            candidate,
+            libraryViewModel_.SortOption(),
+            libraryViewModel_.NormalizedFilter(),
+            libraryViewModel_.RecencyOrder());
+        workScheduler_.Submit(
+            WorkScheduler::Priority::Idle,
+            [this,
+             candidate,
+             sortOption = libraryViewModel_.SortOption(),
+             filter = libraryViewModel_.NormalizedFilter(),
+             snapshot = std::move(snapshot)]() mutable -> WorkScheduler::Completion {
+                auto entries = frontend::models::LibraryViewModel::BuildEntriesFromSnapshot(
+                    std::move(snapshot), sortOption, filter);
+                return [this,
+                        candidate,
+                        sortOption,
+                        filter = std::move(filter),
+                        entries = std::move(entries)]() mutable {
+                    // Queue the first visible page of tiles for paced visual
+                    // warming before the entries are handed over.
+                    constexpr std::size_t kFirstPageTileCount = 6;
+                    for (std::size_t i = 0; i < std::min(entries.size(), kFirstPageTileCount); ++i)
+                    {
+                        queuedVisualPrewarms_.push_back(entries[i].programId);
+                    }
+                    libraryViewModel_.StorePrefetchedList(
+                        candidate, sortOption, std::move(filter), std::move(entries));
+                };
+            });
+    }
+}
+
+void Application::RequestChannelShard(int index, WorkScheduler::Priority priority)
+{
+    if (index < 0 || index >= static_cast<int>(content_.channels.size()))
+    {
+        return;
+    }
+    const Channel& channel = content_.channels[static_cast<std::size_t>(index)];
+    if (channel.shardPath.empty() || channel.shardLoaded || channelShardLoadsInFlight_.contains(channel.id))
+    {
+        return;
+    }
+    channelShardLoadsInFlight_.insert(channel.id);
+
+    // Keyed by channel id, not index: the rail can reorder (reload, local
+    // apps synthesis) while the parse is in flight.
+    const std::filesystem::path shardPath = ResolveContentPath().parent_path() / channel.shardPath;
+    workScheduler_.Submit(priority, [this, channelId = channel.id, shardPath]() -> WorkScheduler::Completion {
+        std::shared_ptr<ChannelShard> shard;
+        try
+        {
+            shard = std::make_shared<ChannelShard>(LoadChannelShardFromFile(shardPath.string()));
+        }
+        catch (const std::exception& ex)
+        {
+            const std::string message = ex.what();
+            return [this, channelId, message] {
+                channelShardLoadsInFlight_.erase(channelId);
+                std::cerr << "Channel shard load failed for \"" << channelId << "\": " << message << '\n';
+            };
+        }
+
+        return [this, channelId, shard] {
+            channelShardLoadsInFlight_.erase(channelId);
+            ApplyChannelShard(channelId, std::move(*shard));
+        };
+    });
+}
+
+void Application::ApplyChannelShard(const std::string& channelId, ChannelShard shard)
+{
+    const auto channelIt = std::find_if(
+        content_.channels.begin(), content_.channels.end(), [&](const Channel& channel) {
+            return channel.id == channelId;
+        });
+    if (channelIt == content_.channels.end() || channelIt->shardLoaded)
     {
-        programVisuals_.emplace(
-            id,
-            ui::BuildProgramVisuals(
-                view,
-                renderer_.get(),
-                fonts_.heroTitle.get(),
-                fonts_.heroSubtitle.get(),
-                fonts_.heroBody.get(),
-                fonts_.button.get(),
-                fonts_.tileTitle.get(),
-                fonts_.tileSubtitle.get(),
-                fonts_.tileMeta.get(),
-                fonts_.patchTitle.get(),
-                fonts_.patchBody.get(),
-                fonts_.status.get(),
-                theme_.heroTitle,
-                theme_.heroBody,
-                heroSubtitleColor,
-                theme_.muted,
-                theme_.statusBarText,
-                theme_.heroGradientFallbackStart,
-                theme_.heroGradientFallbackEnd));
+        return;
     }
+
+    MergeChannelShard(content_, *channelIt, std::move(shard));
+    programIndex_.Rebuild(content_);
+    libraryViewModel_.InvalidateProgramList();
+
+    const int index = static_cast<int>(std::distance(content_.channels.begin(), channelIt));
+    if (index == activeChannelIndex_)
+    {
+        // Re-activate so the program selection clamps against the now-real
+        // list and the hero view leaves its empty state.
+        ActivateChannel(index);
+    }
+    InvalidateFrame();
 }
 
 void Application::RebuildInteractionPalette()
@@ -695,9 +1664,18 @@ void Application::ActivateChannel(int index)
         return;
     }
 
+    if (index != activeChannelIndex_)
+    {
+        previousChannelIndex_ = activeChannelIndex_;
+    }
     activeChannelIndex_ = index;
+    // First visit to a manifest channel: its shard parses in the background
+    // while the (empty) channel renders; ApplyChannelShard re-activates once
+    // the programs land.
+    RequestChannelShard(index, WorkScheduler::Priority::Normal);
     const std::string programId = GetActiveProgramId();
     ActivateProgram(programId);
+    PrefetchAdjacentChannelLists();
 }
 
 void Application::ActivateProgram(const std::string& programId)
@@ -759,6 +1737,8 @@ void Application::ActivateProgram(const std::string& programId)
 
     pendingSettingsSectionId_.reset();
 
+    EnsureProgramVisuals(activeProgramId_);
+
     if (const auto visualsIt = programVisuals_.find(activeProgramId_); visualsIt != programVisuals_.end())
     {
         UpdateStatusMessage(visualsIt->second.content->statusMessage);
@@ -814,8 +1794,17 @@ std::string Application::GetActiveProgramId() const
 
 void Application::HandleEvent(const SDL_Event& event, bool& running)
 {
+    eventRecorder_.Record(event);
+
     if (event.type == SDL_QUIT)
     {
+        if (residentMode_)
+        {
+            // Closing parks the warm process; only the service manager (or a
+            // terminating signal) actually ends it.
+            ParkResident();
+            return;
+        }
         running = false;
         return;
     }
@@ -831,30 +1820,233 @@ void Application::HandleEvent(const SDL_Event& event, bool& running)
         {
             HandleMouseRightClick(event.button.x, event.button.y);
         }
+        InvalidateFrame();
         break;
     case SDL_MOUSEBUTTONUP:
         if (event.button.button == SDL_BUTTON_LEFT)
         {
             HandleMouseButtonUp(event.button.x, event.button.y);
         }
+        InvalidateFrame();
         break;
     case SDL_MOUSEMOTION:
         HandleMouseMotion(event.motion);
+        // Hover feedback can move anywhere on screen; until panels report
+        // finer rects, motion invalidates the whole frame.
+        InvalidateFrame();
         break;
     case SDL_MOUSEWHEEL:
+        // Wheel handling invalidates just the scrolled viewport (or the full
+        // frame for hub/dialog scrolling) so kinetic scrolling composes with
+        // the dirty-region pipeline instead of forcing full redraws.
         HandleMouseWheel(event.wheel);
         break;
     case SDL_KEYDOWN:
         HandleKeyDown(event.key.keysym.sym);
+        InvalidateFrame();
         break;
     case SDL_TEXTINPUT:
         HandleTextInput(event.text);
+        InvalidateFrame();
+        break;
+    case SDL_WINDOWEVENT:
+        HandleWindowEvent(event.window);
+        break;
+    default:
+        break;
+    }
+}
+
+void Application::HandleWindowEvent(const SDL_WindowEvent& window)
+{
+    switch (window.event)
+    {
+    case SDL_WINDOWEVENT_MINIMIZED:
+    case SDL_WINDOWEVENT_HIDDEN:
+        // Nothing we draw can be seen; Run parks in a pure event wait until
+        // the window comes back.
+        windowVisible_ = false;
+        break;
+    case SDL_WINDOWEVENT_RESTORED:
+    case SDL_WINDOWEVENT_SHOWN:
+    case SDL_WINDOWEVENT_MAXIMIZED:
+        windowVisible_ = true;
+        InvalidateFrame();
+        break;
+    case SDL_WINDOWEVENT_EXPOSED:
+        // The compositor discarded our backbuffer contents; repaint even if
+        // no state changed.
+        InvalidateFrame();
+        break;
+    case SDL_WINDOWEVENT_SIZE_CHANGED:
+        // Live resize: relayout is already clamped to once per frame, and
+        // the wrap-width texture rebuilds stay deferred until the events
+        // stop arriving for kResizeSettleMilliseconds.
+        interactiveResizeActive_ = true;
+        lastResizeEventAtTicks_ = SDL_GetTicks64();
+        InvalidateFrame();
+        break;
+    case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+        // Dragged onto another monitor; rescale for its DPI so text is
+        // neither blurry nor tiny until the next restart.
+        RefreshDisplayDpi();
         break;
     default:
         break;
     }
 }
 
+void Application::ParkResident()
+{
+    if (residentParked_)
+    {
+        return;
+    }
+    residentParked_ = true;
+    windowVisible_ = false;
+    if (window_)
+    {
+        SDL_HideWindow(window_.get());
+    }
+    TrimResidentMemory();
+}
+
+void Application::SummonFromResidentPark()
+{
+    if (window_)
+    {
+        SDL_ShowWindow(window_.get());
+        SDL_RaiseWindow(window_.get());
+    }
+    residentParked_ = false;
+    windowVisible_ = true;
+    InvalidateFrame();
+}
+
+void Application::TrimResidentMemory()
+{
+    // Content, fonts and the text caches stay warm — they are what make the
+    // next summon land in under a frame. What goes is what rebuilds lazily
+    // on first use: off-screen program visuals and dialog row targets.
+    RebuildProgramVisuals();
+    addAppRowCaches_.clear();
+    for (auto& cache : customThemeFieldCaches_)
+    {
+        cache = ui::RowTargetCache{};
+    }
+    drawing::GlowCache::Shared().ReleaseTextures();
+    TexturePool::Shared().ReleaseTextures();
+    SurfacePool::Shared().Clear();
+}
+
+void Application::RefreshDisplayDpi()
+{
+    if (!window_)
+    {
+        return;
+    }
+
+    const int displayIndex = SDL_GetWindowDisplayIndex(window_.get());
+    if (displayIndex < 0 || displayIndex == windowDisplayIndex_)
+    {
+        return;
+    }
+    const bool firstQuery = windowDisplayIndex_ < 0;
+    windowDisplayIndex_ = displayIndex;
+
+    // 96 DPI is the traditional 1:1 desktop baseline. Drivers that cannot
+    // report DPI (common under X11 without a scaled desktop) get 1.0, which
+    // matches the previous fixed-scale behaviour.
+    constexpr float kBaselineDpi = 96.0f;
+    float diagonalDpi = 0.0f;
+    float dpiScale = 1.0f;
+    if (SDL_GetDisplayDPI(displayIndex, &diagonalDpi, nullptr, nullptr) == 0 && diagonalDpi > 0.0f)
+    {
+        dpiScale = diagonalDpi / kBaselineDpi;
+    }
+
+    if (std::fabs(dpiScale - ui::GetUiDpiScale()) < 0.01f)
+    {
+        return;
+    }
+    ui::SetUiDpiScale(dpiScale);
+
+    if (!firstQuery)
+    {
+        // RebuildTheme is the repaint-the-world path: it bumps the theme
+        // generation, clears the text and panel caches, and reopens fonts
+        // through the font cache at the new Scale(size) keys, so only
+        // textures whose logical size actually changed are re-rasterized on
+        // their next use.
+        RebuildTheme();
+        InvalidateFrame();
+    }
+}
+
+void Application::DispatchPendingEvents(bool& running)
+{
+    // Drains the SDL queue with burst coalescing: consecutive mouse motions
+    // collapse into the final position (relative deltas summed) and
+    // consecutive same-direction wheel events sum their deltas, so per-frame
+    // dispatch work is bounded regardless of input rate. Only runs of the
+    // same type merge — the relative order of clicks, key presses and the
+    // motions around them is preserved exactly.
+    SDL_Event event{};
+    SDL_Event pending{};
+    bool hasPending = false;
+
+    const auto flushPending = [&]() {
+        if (hasPending)
+        {
+            HandleEvent(pending, running);
+            hasPending = false;
+        }
+    };
+
+    while (SDL_PollEvent(&event))
+    {
+        if (event.type == SDL_MOUSEMOTION)
+        {
+            if (hasPending && pending.type == SDL_MOUSEMOTION
+                && pending.motion.windowID == event.motion.windowID)
+            {
+                event.motion.xrel += pending.motion.xrel;
+                event.motion.yrel += pending.motion.yrel;
+            }
+            else
+            {
+                flushPending();
+            }
+            pending = event;
+            hasPending = true;
+            continue;
+        }
+
+        if (event.type == SDL_MOUSEWHEEL)
+        {
+            if (hasPending && pending.type == SDL_MOUSEWHEEL
+                && pending.wheel.windowID == event.wheel.windowID
+                && pending.wheel.direction == event.wheel.direction)
+            {
+                event.wheel.x += pending.wheel.x;
+                event.wheel.y += pending.wheel.y;
+            }
+            else
+            {
+                flushPending();
+            }
+            pending = event;
+            hasPending = true;
+            continue;
+        }
+
+        flushPending();
+        HandleEvent(event, running);
+    }
+
+    flushPending();
+}
+
 void Application::HandleMouseClick(int x, int y)
 {
     activeCustomizationDragId_.reset();
@@ -928,8 +2120,6 @@ void Application::HandleMouseClick(int x, int y)
     {
         libraryFilterFocused_ = false;
         UpdateTextInputState();
-        const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
-        libraryFilterDebouncer_.Flush(nowSeconds);
     }
 
     for (std::size_t i = 0; i < channelButtonRects_.size(); ++i)
@@ -944,15 +2134,8 @@ void Application::HandleMouseClick(int x, int y)
     if (addAppButtonRect_.has_value() && activeChannelIndex_ >= 0
         && activeChannelIndex_ < static_cast<int>(content_.channels.size()))
     {
-        auto toLower = [](std::string value) {
-            std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-                return static_cast<char>(std::tolower(ch));
-            });
-            return value;
-        };
-
-        const std::string channelIdLower = toLower(content_.channels[activeChannelIndex_].id);
-        const std::string localIdLower = toLower(std::string(kLocalAppsChannelId));
+        const std::string channelIdLower = text::ToLowerAscii(content_.channels[activeChannelIndex_].id);
+        const std::string localIdLower = text::ToLowerAscii(std::string(kLocalAppsChannelId));
         if (channelIdLower == localIdLower && PointInRect(*addAppButtonRect_, x, y))
         {
             ShowAddAppDialog();
@@ -964,36 +2147,30 @@ void Application::HandleMouseClick(int x, int y)
     {
         if (PointInRect(chip.rect, x, y))
         {
-            const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
-            libraryFilterDebouncer_.Flush(nowSeconds);
             libraryViewModel_.SetSortOption(chip.option);
             return;
         }
     }
 
-    for (std::size_t i = 0; i < programTileRects_.size(); ++i)
+    if (const int tileIndex = programTileHitIndex_.FindFirst(x, y); tileIndex >= 0)
     {
-        if (PointInRect(programTileRects_[i], x, y))
+        if (static_cast<std::size_t>(tileIndex) < programTileHandles_.size())
         {
-            if (i < programTileProgramIds_.size())
+            const ProgramHandle programHandle = programTileHandles_[tileIndex];
+            if (activeChannelIndex_ >= 0 && activeChannelIndex_ < static_cast<int>(content_.channels.size()))
             {
-                const std::string& programId = programTileProgramIds_[i];
-                if (activeChannelIndex_ >= 0 && activeChannelIndex_ < static_cast<int>(content_.channels.size()))
+                const int index =
+                    programIndex_.IndexInChannel(static_cast<std::size_t>(activeChannelIndex_), programHandle);
+                if (index >= 0)
                 {
-                    const auto& channel = content_.channels[activeChannelIndex_];
-                    auto it = std::find(channel.programs.begin(), channel.programs.end(), programId);
-                    if (it != channel.programs.end())
-                    {
-                        const int index = static_cast<int>(std::distance(channel.programs.begin(), it));
-                        ActivateProgramInChannel(index);
-                        return;
-                    }
+                    ActivateProgramInChannel(index);
+                    return;
                 }
-
-                ActivateProgram(programId);
             }
-            return;
+
+            ActivateProgram(programIndex_.IdFor(programHandle));
         }
+        return;
     }
 
     if (IsSettingsProgramId(activeProgramId_))
@@ -1011,6 +2188,7 @@ void Application::HandleMouseClick(int x, int y)
                 if (themeManager_.SetActiveScheme(region.id))
                 {
                     RebuildTheme();
+                    QueueSettingsSave();
                 }
                 break;
             case ui::SettingsPanel::RenderResult::InteractionType::ThemeCreation:
@@ -1020,9 +2198,9 @@ void Application::HandleMouseClick(int x, int y)
                 ChangeLanguage(region.id);
                 break;
             case ui::SettingsPanel::RenderResult::InteractionType::Toggle:
-                if (auto it = basicToggleStates_.find(region.id); it != basicToggleStates_.end())
+                if (basicToggles_.ToggleByKey(region.id))
                 {
-                    it->second = !it->second;
+                    QueueSettingsSave();
                 }
                 break;
             case ui::SettingsPanel::RenderResult::InteractionType::Customization:
@@ -1030,7 +2208,8 @@ void Application::HandleMouseClick(int x, int y)
                 const float newValue = ComputeCustomizationSliderValue(region.rect, x);
                 if (SetAppearanceCustomizationValue(region.id, newValue))
                 {
-                    RebuildTheme();
+                    RefreshThemeDerivedColors();
+                    themeRebuildPendingAfterDrag_ = true;
                 }
                 activeCustomizationDragId_ = region.id;
                 break;
@@ -1093,19 +2272,14 @@ void Application::HandleMouseRightClick(int x, int y)
         return;
     }
 
-    for (std::size_t i = 0; i < programTileRects_.size(); ++i)
+    if (const int tileIndex = programTileHitIndex_.FindFirst(x, y); tileIndex >= 0)
     {
-        if (!PointInRect(programTileRects_[i], x, y))
-        {
-            continue;
-        }
-
-        if (i >= programTileProgramIds_.size())
+        if (static_cast<std::size_t>(tileIndex) >= programTileHandles_.size())
         {
             return;
         }
 
-        const std::string& programId = programTileProgramIds_[i];
+        const std::string& programId = programIndex_.IdFor(programTileHandles_[tileIndex]);
         if (userAppExecutables_.find(programId) != userAppExecutables_.end())
         {
             ShowEditUserAppDialog(programId);
@@ -1119,7 +2293,7 @@ void Application::HandleMouseButtonUp(int x, int y)
     (void)x;
     (void)y;
 
-    activeCustomizationDragId_.reset();
+    FinishCustomizationDrag();
 
     if (interfaceState_ == InterfaceState::Hub)
     {
@@ -1144,7 +2318,7 @@ void Application::HandleMouseMotion(const SDL_MouseMotionEvent& motion)
     {
         if ((motion.state & SDL_BUTTON_LMASK) == 0)
         {
-            activeCustomizationDragId_.reset();
+            FinishCustomizationDrag();
         }
         else
         {
@@ -1165,11 +2339,13 @@ void Application::HandleMouseWheel(const SDL_MouseWheelEvent& wheel)
     if (interfaceState_ == InterfaceState::Hub)
     {
         HandleHubMouseWheel(wheel);
+        InvalidateFrame();
         return;
     }
 
     if (HandleCustomThemeDialogMouseWheel(wheel))
     {
+        InvalidateFrame();
         return;
     }
 
@@ -1180,6 +2356,7 @@ void Application::HandleMouseWheel(const SDL_MouseWheelEvent& wheel)
 
     if (addAppDialog_.visible && HandleAddAppDialogMouseWheel(wheel))
     {
+        InvalidateFrame();
         return;
     }
 
@@ -1217,7 +2394,15 @@ void Application::HandleMouseWheel(const SDL_MouseWheelEvent& wheel)
 
         constexpr int kScrollStep = 48;
         const int delta = -wheelY * kScrollStep;
-        settingsScrollOffset_ = std::clamp(settingsScrollOffset_ + delta, 0, maxScroll);
+        if (IsReduceMotionEnabled())
+        {
+            settingsScrollOffset_ = std::clamp(settingsScrollOffset_ + delta, 0, maxScroll);
+        }
+        else
+        {
+            settingsScrollAnimation_.AddImpulse(static_cast<float>(delta));
+        }
+        InvalidateFrameRect(settingsRenderResult_.viewport);
         return;
     }
 
@@ -1261,7 +2446,70 @@ void Application::HandleMouseWheel(const SDL_MouseWheelEvent& wheel)
 
     const int scrollStep = ui::Scale(40);
     const int delta = -wheelY * scrollStep;
-    visuals.sectionsScrollOffset = std::clamp(visuals.sectionsScrollOffset + delta, 0, maxScroll);
+    if (IsReduceMotionEnabled())
+    {
+        visuals.sectionsScrollOffset = std::clamp(visuals.sectionsScrollOffset + delta, 0, maxScroll);
+    }
+    else
+    {
+        if (sectionsScrollProgramId_ != activeProgramId_)
+        {
+            sectionsScrollAnimation_.Stop();
+            sectionsScrollProgramId_ = activeProgramId_;
+        }
+        sectionsScrollAnimation_.AddImpulse(static_cast<float>(delta));
+    }
+    InvalidateFrameRect(visuals.sectionsViewport);
+}
+
+void Application::UpdateScrollAnimations(double deltaSeconds)
+{
+    if (settingsScrollAnimation_.Active())
+    {
+        if (!IsSettingsProgramId(activeProgramId_))
+        {
+            settingsScrollAnimation_.Stop();
+        }
+        else
+        {
+            const int delta = settingsScrollAnimation_.Step(deltaSeconds);
+            const int maxScroll =
+                std::max(0, settingsRenderResult_.contentHeight - settingsRenderResult_.viewport.h);
+            const int target = std::clamp(settingsScrollOffset_ + delta, 0, maxScroll);
+            if (delta != 0 && target == settingsScrollOffset_)
+            {
+                // Ran into an edge; the remaining travel has nowhere to go.
+                settingsScrollAnimation_.Stop();
+            }
+            settingsScrollOffset_ = target;
+            // Only the scrolled viewport changed; the damage tracker composes
+            // it with whatever else this frame dirtied.
+            InvalidateFrameRect(settingsRenderResult_.viewport);
+        }
+    }
+
+    if (sectionsScrollAnimation_.Active())
+    {
+        const auto visualsIt = programVisuals_.find(sectionsScrollProgramId_);
+        if (sectionsScrollProgramId_ != activeProgramId_ || visualsIt == programVisuals_.end())
+        {
+            sectionsScrollAnimation_.Stop();
+        }
+        else
+        {
+            auto& visuals = visualsIt->second;
+            const int delta = sectionsScrollAnimation_.Step(deltaSeconds);
+            const int viewportHeight = std::max(0, visuals.sectionsViewportContentHeight);
+            const int maxScroll = std::max(0, visuals.sectionsContentHeight - viewportHeight);
+            const int target = std::clamp(visuals.sectionsScrollOffset + delta, 0, maxScroll);
+            if (delta != 0 && target == visuals.sectionsScrollOffset)
+            {
+                sectionsScrollAnimation_.Stop();
+            }
+            visuals.sectionsScrollOffset = target;
+            InvalidateFrameRect(visuals.sectionsViewport);
+        }
+    }
 }
 
 bool Application::UpdateCustomizationValueFromPosition(const std::string& id, int mouseX)
@@ -1281,7 +2529,10 @@ bool Application::UpdateCustomizationValueFromPosition(const std::string& id, in
     const float newValue = ComputeCustomizationSliderValue(it->rect, mouseX);
     if (SetAppearanceCustomizationValue(id, newValue))
     {
-        RebuildTheme();
+        // While the slider is being dragged only the cheap color derivation
+        // runs; the full texture rebuild is deferred to the drag release.
+        RefreshThemeDerivedColors();
+        themeRebuildPendingAfterDrag_ = true;
         return true;
     }
 
@@ -1404,6 +2655,42 @@ void Application::UpdateLayoutForOutputWidth(int outputWidth)
 
 void Application::HandleKeyDown(SDL_Keycode key)
 {
+    if (key == SDLK_F3)
+    {
+        // Frame profiler HUD; handled before any state-specific dispatch so
+        // jank can be inspected from every screen and dialog.
+        profilerHudVisible_ = !profilerHudVisible_;
+        profilerHudRefreshedAtSeconds_ = 0.0;
+        InvalidateFrame();
+        return;
+    }
+
+    if (key == SDLK_F4)
+    {
+        // Cycle the presentation policy; like the HUD it works from every
+        // screen so a kiosk can be capped without digging through dialogs.
+        switch (presentationMode_)
+        {
+        case PresentationMode::Vsync:
+            presentationMode_ = PresentationMode::CappedFps;
+            break;
+        case PresentationMode::CappedFps:
+            presentationMode_ = PresentationMode::Uncapped;
+            break;
+        case PresentationMode::Uncapped:
+            presentationMode_ = PresentationMode::Vsync;
+            break;
+        }
+        ApplyPresentationMode();
+        UpdateStatusMessage(
+            presentationMode_ == PresentationMode::Vsync ? "Presentation: vsync"
+                : presentationMode_ == PresentationMode::CappedFps
+                ? "Presentation: capped " + std::to_string(presentationCapFps_) + " fps"
+                : "Presentation: uncapped");
+        QueueSettingsSave();
+        return;
+    }
+
     if (interfaceState_ == InterfaceState::Hub)
     {
         HandleHubKeyDown(key);
@@ -1432,18 +2719,18 @@ void Application::HandleKeyDown(SDL_Keycode key)
         case SDLK_BACKSPACE:
             if (!libraryFilterDraft_.empty())
             {
-                RemoveLastUtf8Codepoint(libraryFilterDraft_);
+                text::RemoveLastCodepoint(libraryFilterDraft_);
                 QueueLibraryFilterUpdate();
             }
             return;
         case SDLK_ESCAPE:
             libraryFilterFocused_ = false;
             UpdateTextInputState();
-            libraryFilterDebouncer_.Flush(static_cast<double>(SDL_GetTicks64()) / 1000.0);
             return;
         case SDLK_RETURN:
         case SDLK_KP_ENTER:
-            libraryFilterDebouncer_.Flush(static_cast<double>(SDL_GetTicks64()) / 1000.0);
+            // The filter applies on every keystroke; enter just swallows the
+            // key so it never falls through to program activation.
             return;
         default:
             break;
@@ -1529,11 +2816,78 @@ bool Application::HandleTextInput(const SDL_TextInputEvent& event)
         return true;
     }
 
-    return false;
+    return false;
+}
+
+void Application::InvalidateFrame()
+{
+    frameDamage_.MarkFullFrame();
+}
+
+void Application::InvalidateFrameRect(const SDL_Rect& rect)
+{
+    frameDamage_.AddRect(rect);
+}
+
+bool Application::IsReduceMotionEnabled() const
+{
+    return basicToggles_.Get(ui::BasicToggle::ReducedMotion);
+}
+
+bool Application::ShouldSkipIdleFrame(bool reduceMotion) const
+{
+    if (!frameDamage_.Empty())
+    {
+        return false;
+    }
+
+    // A directory scan is streaming entries in; keep rendering so each batch
+    // shows up as soon as it is drained.
+    if (addAppScanner_.Active())
+    {
+        return false;
+    }
+
+    // Finished background tasks are waiting to apply their results.
+    if (workScheduler_.HasPendingCompletions())
+    {
+        return false;
+    }
+
+    // Ambient animations (gradient pulses, hub motion) advance every frame
+    // unless the user has asked for reduced motion.
+    if (!reduceMotion)
+    {
+        return false;
+    }
+
+    return true;
 }
 
 void Application::RenderFrame(double deltaSeconds)
 {
+    // Fixed drain point for background-task completions: their state swaps
+    // land here, before any panel reads the state, never mid-traversal.
+    workScheduler_.DrainCompletions(kWorkCompletionFrameBudget);
+    if (workScheduler_.HasPendingCompletions())
+    {
+        InvalidateFrame();
+    }
+
+    // Cover art packs at the same fixed point so tiles see a consistent
+    // atlas for the whole frame; new arrivals force a repaint.
+    if (iconArtPipeline_.PumpCompletions(renderer_.get(), kWorkCompletionFrameBudget) > 0)
+    {
+        InvalidateFrame();
+    }
+
+    // Coalesced status updates rasterize here, at most once per frame.
+    FlushStatusMessageTexture();
+
+    UpdateStartupSnapshotFade(deltaSeconds);
+
+    frameArena_.Reset();
+
     switch (interfaceState_)
     {
     case InterfaceState::Hub:
@@ -1570,40 +2924,47 @@ void Application::RenderHubFrame(double deltaSeconds)
         activeBranchIndex = content_.hub.branches.empty() ? -1 : 0;
     }
 
-    ui::HubRenderResult renderResult = hubPanel_.Render(
-        renderer_.get(),
-        theme_,
-        bounds,
-        timeSeconds,
-        hoveredHubBranchIndex_,
-        activeBranchIndex,
-        focusedHubBranchIndex_,
-        hubScrollOffset_,
-        isHubHeroCollapsed_,
-        hubSearchQuery_,
-        hubSearchFocused_,
-        hubWidgetPage_,
-        hubWidgetsPerPage_);
-
-    hubBranchHitboxes_ = renderResult.branchHitboxes;
-    hubWidgetPagerHitboxes_ = renderResult.widgetPagerHitboxes;
-    hubScrollViewport_ = renderResult.scrollViewport;
+    hubPanel_.SetInteractiveResize(interactiveResizeActive_);
+
+    {
+        ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::Hub};
+        hubPanel_.Render(
+            renderer_.get(),
+            theme_,
+            bounds,
+            timeSeconds,
+            hoveredHubBranchIndex_,
+            activeBranchIndex,
+            focusedHubBranchIndex_,
+            hubScrollOffset_,
+            isHubHeroCollapsed_,
+            hubSearchQuery_,
+            hubSearchFocused_,
+            hubWidgetPage_,
+            hubWidgetsPerPage_,
+            frameArena_,
+            hubRenderResult_);
+    }
+
+    hubBranchHitboxes_ = hubRenderResult_.branchHitboxes;
+    hubWidgetPagerHitboxes_ = hubRenderResult_.widgetPagerHitboxes;
+    hubScrollViewport_ = hubRenderResult_.scrollViewport;
     hubScrollViewportValid_ = hubScrollViewport_.w > 0 && hubScrollViewport_.h > 0;
-    hubScrollMaxOffset_ = std::max(0, renderResult.scrollableContentHeight - renderResult.visibleContentHeight);
+    hubScrollMaxOffset_ = std::max(0, hubRenderResult_.scrollableContentHeight - hubRenderResult_.visibleContentHeight);
     EnsureHubScrollWithinBounds();
-    hubHeroToggleRect_ = (renderResult.heroToggleRect.w > 0 && renderResult.heroToggleRect.h > 0)
-        ? std::optional<SDL_Rect>(renderResult.heroToggleRect)
+    hubHeroToggleRect_ = (hubRenderResult_.heroToggleRect.w > 0 && hubRenderResult_.heroToggleRect.h > 0)
+        ? std::optional<SDL_Rect>(hubRenderResult_.heroToggleRect)
         : std::nullopt;
-    hubSearchInputRect_ = (renderResult.searchInputRect.w > 0 && renderResult.searchInputRect.h > 0)
-        ? std::optional<SDL_Rect>(renderResult.searchInputRect)
+    hubSearchInputRect_ = (hubRenderResult_.searchInputRect.w > 0 && hubRenderResult_.searchInputRect.h > 0)
+        ? std::optional<SDL_Rect>(hubRenderResult_.searchInputRect)
         : std::nullopt;
-    hubSearchClearRect_ = (renderResult.searchClearRect.w > 0 && renderResult.searchClearRect.h > 0)
-        ? std::optional<SDL_Rect>(renderResult.searchClearRect)
+    hubSearchClearRect_ = (hubRenderResult_.searchClearRect.w > 0 && hubRenderResult_.searchClearRect.h > 0)
+        ? std::optional<SDL_Rect>(hubRenderResult_.searchClearRect)
         : std::nullopt;
-    hubDetailActionRect_ = (renderResult.detailActionRect.w > 0 && renderResult.detailActionRect.h > 0)
-        ? std::optional<SDL_Rect>(renderResult.detailActionRect)
+    hubDetailActionRect_ = (hubRenderResult_.detailActionRect.w > 0 && hubRenderResult_.detailActionRect.h > 0)
+        ? std::optional<SDL_Rect>(hubRenderResult_.detailActionRect)
         : std::nullopt;
-    hubWidgetPageCount_ = renderResult.widgetPageCount;
+    hubWidgetPageCount_ = hubRenderResult_.widgetPageCount;
     if (hubWidgetPageCount_ == 0)
     {
         hubWidgetPage_ = 0;
@@ -1613,7 +2974,18 @@ void Application::RenderHubFrame(double deltaSeconds)
         hubWidgetPage_ = std::clamp(hubWidgetPage_, 0, hubWidgetPageCount_ - 1);
     }
 
-    SDL_RenderPresent(renderer_.get());
+    if (profilerHudVisible_)
+    {
+        RenderProfilerHud();
+    }
+
+    ComposeStartupSnapshotOverlay();
+    CaptureStartupSnapshotBeforePresent();
+
+    {
+        ScopedPhaseTimer presentTimer{frameProfiler_, FramePhase::Present};
+        SDL_RenderPresent(renderer_.get());
+    }
 }
 
 void Application::RenderMainInterfaceFrame(double deltaSeconds)
@@ -1631,8 +3003,6 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
     SDL_RenderClear(renderer_.get());
 
     const double timeSeconds = animationTimeSeconds_;
-    const double realtimeSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
-    libraryFilterDebouncer_.Flush(realtimeSeconds);
 
     if (!layoutSizesInitialized_)
     {
@@ -1642,9 +3012,14 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
 
     UpdateLayoutForOutputWidth(outputWidth);
 
+    // Chrome panels are cached as render targets keyed on the state they draw
+    // from. The mouse position gates the caches: a hovered panel animates its
+    // hover affordances every frame, so it renders directly until the pointer
+    // leaves and the cached texture becomes representative again.
+    SDL_Point mousePosition{0, 0};
+    SDL_GetMouseState(&mousePosition.x, &mousePosition.y);
+
     SDL_Rect navRailRect{0, 0, std::max(0, navRailWidth_), outputHeight};
-    SDL_SetRenderDrawColor(renderer_.get(), theme_.navRail.r, theme_.navRail.g, theme_.navRail.b, theme_.navRail.a);
-    SDL_RenderFillRect(renderer_.get(), &navRailRect);
     navRailRect_ = navRailRect;
 
     const SDL_Rect contentRect{navRailRect.w, 0, std::max(0, outputWidth - navRailRect.w), outputHeight};
@@ -1659,72 +3034,163 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
 
     const int statusBarHeight = ui::Scale(kStatusBarHeight);
 
-    ui::NavigationRenderResult navigationRender = navigationRail_.Render(
-        renderer_.get(),
-        theme_,
-        typography_,
-        interactions_,
-        navRailRect,
-        statusBarHeight,
-        content_,
-        channelSelections_,
-        activeChannelIndex_,
-        programVisuals_,
-        timeSeconds);
-    channelButtonRects_ = std::move(navigationRender.channelButtonRects);
-    hubButtonRect_ = navigationRender.hubButtonRect;
-
-    auto topBarResult = topBar_.Render(
-        renderer_.get(),
-        theme_,
-        typography_,
-        interactions_,
-        layout.topBar,
-        libraryFilterDraft_,
-        libraryFilterFocused_,
-        timeSeconds);
-    libraryFilterInputRect_ = topBarResult.searchFieldRect;
+    // Panels keep their last cached texture through a live resize and
+    // stretch it to the new bounds; views hold their current wrap widths.
+    // The settled frame redraws everything at the final size.
+    viewContext_.interactiveResize = interactiveResizeActive_;
+
+    const bool navRailHovered = SDL_PointInRect(&mousePosition, &navRailRect) != 0;
+    bool drawNavRail = true;
+    if (interactiveResizeActive_ && navRailCache_.BlitStretched(renderer_.get(), navRailRect))
+    {
+        drawNavRail = false;
+    }
+    else if (!navRailHovered)
+    {
+        ui::PanelStateHash navHash;
+        navHash.Mix(statusBarHeight).Mix(activeChannelIndex_);
+        for (const int selection : channelSelections_)
+        {
+            navHash.Mix(selection);
+        }
+        for (const auto& channel : content_.channels)
+        {
+            navHash.Mix(std::string_view{channel.id});
+        }
+        // The active item pulses continuously; see QuantizedAnimationPhase.
+        navHash.Mix(QuantizedAnimationPhase(timeSeconds));
+        drawNavRail = navRailCache_.Begin(renderer_.get(), navRailRect, theme_.background, navHash.Value());
+    }
+    if (drawNavRail)
+    {
+        ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::NavRail};
+        SDL_SetRenderDrawColor(renderer_.get(), theme_.navRail.r, theme_.navRail.g, theme_.navRail.b, theme_.navRail.a);
+        SDL_RenderFillRect(renderer_.get(), &navRailRect);
+        ui::NavigationRenderResult navigationRender = navigationRail_.Render(
+            renderer_.get(),
+            theme_,
+            typography_,
+            interactions_,
+            navRailRect,
+            statusBarHeight,
+            content_,
+            channelSelections_,
+            activeChannelIndex_,
+            programVisuals_,
+            timeSeconds);
+        channelButtonRects_ = std::move(navigationRender.channelButtonRects);
+        hubButtonRect_ = navigationRender.hubButtonRect;
+        if (!navRailHovered)
+        {
+            navRailCache_.End(renderer_.get());
+        }
+    }
+
+    const bool topBarHovered = SDL_PointInRect(&mousePosition, &layout.topBar) != 0;
+    const bool topBarCacheable = !topBarHovered && !libraryFilterFocused_;
+    bool drawTopBar = true;
+    if (interactiveResizeActive_ && topBarCache_.BlitStretched(renderer_.get(), layout.topBar))
+    {
+        drawTopBar = false;
+    }
+    else if (topBarCacheable)
+    {
+        ui::PanelStateHash topBarHash;
+        topBarHash.Mix(std::string_view{libraryFilterDraft_});
+        drawTopBar = topBarCache_.Begin(renderer_.get(), layout.topBar, theme_.background, topBarHash.Value());
+    }
+    if (drawTopBar)
+    {
+        ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::TopBar};
+        auto topBarResult = topBar_.Render(
+            renderer_.get(),
+            theme_,
+            typography_,
+            interactions_,
+            layout.topBar,
+            libraryFilterDraft_,
+            libraryFilterFocused_,
+            timeSeconds);
+        libraryFilterInputRect_ = topBarResult.searchFieldRect;
+        if (topBarCacheable)
+        {
+            topBarCache_.End(renderer_.get());
+        }
+    }
 
     bool showAddButton = false;
     if (activeChannelIndex_ >= 0 && activeChannelIndex_ < static_cast<int>(content_.channels.size()))
     {
-        auto toLower = [](std::string value) {
-            std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-                return static_cast<char>(std::tolower(ch));
-            });
-            return value;
-        };
-
-        const std::string channelIdLower = toLower(content_.channels[activeChannelIndex_].id);
-        const std::string localIdLower = toLower(std::string(kLocalAppsChannelId));
+        const std::string channelIdLower = text::ToLowerAscii(content_.channels[activeChannelIndex_].id);
+        const std::string localIdLower = text::ToLowerAscii(std::string(kLocalAppsChannelId));
         showAddButton = channelIdLower == localIdLower;
     }
 
-    const auto sortChips = libraryViewModel_.BuildSortChips([this](std::string_view key) {
+    const auto& sortChips = libraryViewModel_.BuildSortChips([this](std::string_view key) {
         return GetLocalizedString(key);
     });
-    auto programEntries = libraryViewModel_.BuildProgramList(content_, activeChannelIndex_, channelSelections_);
+    const auto& programEntries = libraryViewModel_.BuildProgramList(content_, activeChannelIndex_, channelSelections_);
 
-    auto libraryResult = libraryPanel_.Render(
-        renderer_.get(),
-        theme_,
-        interactions_,
-        layout.libraryArea,
-        content_,
-        activeChannelIndex_,
-        programVisuals_,
-        fonts_.channel.get(),
-        fonts_.tileMeta.get(),
-        showAddButton,
-        timeSeconds,
-        deltaSeconds,
-        libraryFilterDraft_,
-        libraryFilterFocused_,
-        programEntries,
-        sortChips);
-    programTileRects_ = libraryResult.tileRects;
-    addAppButtonRect_ = libraryResult.addButtonRect;
-    programTileProgramIds_ = libraryResult.programIds;
+    const bool libraryHovered = SDL_PointInRect(&mousePosition, &layout.libraryArea) != 0;
+    bool drawLibrary = true;
+    if (interactiveResizeActive_ && libraryPanelCache_.BlitStretched(renderer_.get(), layout.libraryArea))
+    {
+        drawLibrary = false;
+    }
+    else if (!libraryHovered)
+    {
+        ui::PanelStateHash libraryHash;
+        libraryHash.Mix(activeChannelIndex_).Mix(showAddButton);
+        // Newly packed cover art must repaint cached tiles.
+        libraryHash.Mix(iconArtPipeline_.PackedVersion());
+        bool anyTilePulsing = false;
+        for (const auto& entry : programEntries)
+        {
+            libraryHash.Mix(std::string_view{entry.programId}).Mix(entry.selected);
+            anyTilePulsing = anyTilePulsing || entry.selected;
+        }
+        if (anyTilePulsing)
+        {
+            libraryHash.Mix(QuantizedAnimationPhase(timeSeconds));
+        }
+        drawLibrary = libraryPanelCache_.Begin(renderer_.get(), layout.libraryArea, theme_.background, libraryHash.Value());
+    }
+    if (drawLibrary)
+    {
+        ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::Library};
+        libraryPanel_.Render(
+            renderer_.get(),
+            theme_,
+            interactions_,
+            layout.libraryArea,
+            content_,
+            activeChannelIndex_,
+            programVisuals_,
+            fonts_.channel,
+            fonts_.tileMeta,
+            showAddButton,
+            timeSeconds,
+            deltaSeconds,
+            libraryFilterDraft_,
+            libraryFilterFocused_,
+            programEntries,
+            sortChips,
+            &iconArtPipeline_,
+            libraryRenderResult_);
+        if (!libraryHovered)
+        {
+            libraryPanelCache_.End(renderer_.get());
+        }
+        programTileRects_ = libraryRenderResult_.tileRects;
+        programTileHitIndex_.Rebuild(programTileRects_);
+        addAppButtonRect_ = libraryRenderResult_.addButtonRect;
+        programTileHandles_.clear();
+        programTileHandles_.reserve(libraryRenderResult_.programIds.size());
+        for (const auto& tileProgramId : libraryRenderResult_.programIds)
+        {
+            programTileHandles_.push_back(programIndex_.HandleFor(tileProgramId));
+        }
+    }
     librarySortChipHitboxes_.clear();
 
     navResizeHandleRect_ = SDL_Rect{0, 0, 0, 0};
@@ -1732,6 +3198,7 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
 
     const auto visualsIt = programVisuals_.find(activeProgramId_);
     const ui::ProgramVisuals* activeVisuals = visualsIt != programVisuals_.end() ? &visualsIt->second : nullptr;
+    std::optional<ScopedPhaseTimer> heroTimer{std::in_place, frameProfiler_, FramePhase::Hero};
     if (activeVisuals != nullptr)
     {
         const float gradientPulse = static_cast<float>(0.5 + 0.5 * std::sin(timeSeconds * 0.6));
@@ -1770,7 +3237,7 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
             activeLanguageId_,
             settingsSectionStates_,
             appearanceCustomizationValues_,
-            basicToggleStates_,
+            basicToggles_,
             settingsRenderResult_,
             timeSeconds);
 
@@ -1807,9 +3274,9 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
             theme_,
             heroRect_,
             visualsIt->second,
-            fonts_.heroBody.get(),
-            fonts_.patchTitle.get(),
-            fonts_.patchBody.get(),
+            fonts_.heroBody,
+            fonts_.patchTitle,
+            fonts_.patchBody,
             timeSeconds,
             deltaSeconds);
         heroActionRect_ = heroResult.actionButtonRect;
@@ -1821,6 +3288,7 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
     }
 
     heroPanel_.RenderStatusBar(renderer_.get(), theme_, heroRect_, statusBarHeight, activeVisuals, timeSeconds);
+    heroTimer.reset();
 
     if (customThemeDialog_.visible)
     {
@@ -1837,9 +3305,332 @@ void Application::RenderMainInterfaceFrame(double deltaSeconds)
         RenderEditUserAppDialog(timeSeconds);
     }
 
+    if (profilerHudVisible_)
+    {
+        RenderProfilerHud();
+    }
+
+    ComposeStartupSnapshotOverlay();
+    CaptureStartupSnapshotBeforePresent();
+
+    {
+        ScopedPhaseTimer presentTimer{frameProfiler_, FramePhase::Present};
+        SDL_RenderPresent(renderer_.get());
+    }
+}
+
+void Application::RenderProfilerHud()
+{
+    if (!renderer_ || fonts_.status == nullptr)
+    {
+        return;
+    }
+
+    // Refresh the percentile summary at HUD rate; sorting a few thousand
+    // samples per phase every frame would show up in its own numbers.
+    const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+    if (profilerHudRefreshedAtSeconds_ == 0.0 || nowSeconds - profilerHudRefreshedAtSeconds_ >= 0.25)
+    {
+        profilerHudSummary_ = frameProfiler_.BuildSummary();
+        profilerHudRefreshedAtSeconds_ = nowSeconds;
+    }
+
+    int outputWidth = 0;
+    int outputHeight = 0;
+    SDL_GetRendererOutputSize(renderer_.get(), &outputWidth, &outputHeight);
+    (void)outputHeight;
+
+    std::vector<std::string> lines;
+    lines.reserve(FrameProfiler::kPhaseCount + 2);
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%zu frames (ms)      p50    p95    p99", profilerHudSummary_.frameCount);
+    lines.emplace_back(buffer);
+    const auto appendRow = [&](std::string_view label, const FrameProfiler::PhaseSummary& phase) {
+        std::snprintf(
+            buffer,
+            sizeof(buffer),
+            "%-10.*s %6.2f %6.2f %6.2f",
+            static_cast<int>(label.size()),
+            label.data(),
+            phase.p50Ms,
+            phase.p95Ms,
+            phase.p99Ms);
+        lines.emplace_back(buffer);
+    };
+    appendRow("total", profilerHudSummary_.total);
+    for (std::size_t phase = 0; phase < FrameProfiler::kPhaseCount; ++phase)
+    {
+        appendRow(FramePhaseLabel(static_cast<FramePhase>(phase)), profilerHudSummary_.phases[phase]);
+    }
+
+    const auto& accounting = TextureAccounting::Shared();
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "textures %.1f MB (budget %.0f MB)",
+        static_cast<double>(accounting.TotalBytes()) / (1024.0 * 1024.0),
+        static_cast<double>(ProgramVisualsBudgetBytes()) / (1024.0 * 1024.0));
+    lines.emplace_back(buffer);
+    for (std::size_t subsystem = 0; subsystem < static_cast<std::size_t>(TextureAccounting::Subsystem::Count);
+         ++subsystem)
+    {
+        const auto which = static_cast<TextureAccounting::Subsystem>(subsystem);
+        const std::string_view label = TextureAccounting::SubsystemLabel(which);
+        std::snprintf(
+            buffer,
+            sizeof(buffer),
+            "  %-16.*s %8.1f MB",
+            static_cast<int>(label.size()),
+            label.data(),
+            static_cast<double>(accounting.Bytes(which)) / (1024.0 * 1024.0));
+        lines.emplace_back(buffer);
+    }
+
+    // Cache references are only valid until the next Acquire, so the layout
+    // pass re-acquires each line; between summary refreshes every lookup is
+    // a hit.
+    auto& textCache = TextTextureCache::Shared();
+    const int padding = ui::Scale(12);
+    const int lineSpacing = ui::Scale(2);
+    int panelWidth = 0;
+    int panelHeight = padding * 2;
+    for (const auto& line : lines)
+    {
+        const TextTexture& texture = textCache.Acquire(renderer_.get(), fonts_.status, line, theme_.statusBarText);
+        panelWidth = std::max(panelWidth, texture.width);
+        panelHeight += texture.height + lineSpacing;
+    }
+    panelWidth += padding * 2;
+
+    const SDL_Rect panelRect{outputWidth - panelWidth - ui::Scale(16), ui::Scale(16), panelWidth, panelHeight};
+    SDL_SetRenderDrawBlendMode(renderer_.get(), SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer_.get(), 10, 12, 18, 215);
+    drawing::RenderFilledRoundedRect(renderer_.get(), panelRect, ui::Scale(10));
+    SDL_SetRenderDrawColor(renderer_.get(), theme_.border.r, theme_.border.g, theme_.border.b, 160);
+    drawing::RenderRoundedRect(renderer_.get(), panelRect, ui::Scale(10));
+
+    int cursorY = panelRect.y + padding;
+    for (const auto& line : lines)
+    {
+        const TextTexture& texture = textCache.Acquire(renderer_.get(), fonts_.status, line, theme_.statusBarText);
+        SDL_Rect lineRect{panelRect.x + padding, cursorY, texture.width, texture.height};
+        RenderTexture(renderer_.get(), texture, lineRect);
+        cursorY += lineRect.h + lineSpacing;
+    }
+}
+
+void Application::PublishMetricsIfDue()
+{
+    if (!metricsServer_.Enabled())
+    {
+        return;
+    }
+
+    const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+    if (metricsPublishedAtSeconds_ != 0.0 && nowSeconds - metricsPublishedAtSeconds_ < kMetricsPublishIntervalSeconds)
+    {
+        return;
+    }
+    metricsPublishedAtSeconds_ = nowSeconds;
+
+    // Labels are shared with the HUD; the scrape format just wants them as
+    // identifiers rather than display strings.
+    const auto jsonKey = [](std::string_view label) {
+        std::string key{label};
+        for (char& character : key)
+        {
+            if (character == ' ')
+            {
+                character = '_';
+            }
+        }
+        return key;
+    };
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    const auto percentiles = [&json](const FrameProfiler::PhaseSummary& phase) {
+        json << "{\"p50_ms\":" << phase.p50Ms << ",\"p95_ms\":" << phase.p95Ms << ",\"p99_ms\":" << phase.p99Ms
+             << '}';
+    };
+
+    json << "{\"uptime_seconds\":" << nowSeconds;
+    json << ",\"content_load_ms\":" << contentLoadMs_;
+    json << ",\"event_queue_depth\":"
+         << SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    const FrameProfiler::Summary summary = frameProfiler_.BuildSummary();
+    json << ",\"frames\":{\"recorded\":" << summary.frameCount << ",\"total\":";
+    percentiles(summary.total);
+    json << ",\"phases\":{";
+    for (std::size_t phase = 0; phase < FrameProfiler::kPhaseCount; ++phase)
+    {
+        if (phase != 0)
+        {
+            json << ',';
+        }
+        json << '"' << jsonKey(FramePhaseLabel(static_cast<FramePhase>(phase))) << "\":";
+        percentiles(summary.phases[phase]);
+    }
+    json << "}}";
+
+    const auto& accounting = TextureAccounting::Shared();
+    json << ",\"texture_bytes\":{\"total\":" << accounting.TotalBytes();
+    for (std::size_t subsystem = 0; subsystem < static_cast<std::size_t>(TextureAccounting::Subsystem::Count);
+         ++subsystem)
+    {
+        const auto which = static_cast<TextureAccounting::Subsystem>(subsystem);
+        json << ",\"" << jsonKey(TextureAccounting::SubsystemLabel(which)) << "\":" << accounting.Bytes(which);
+    }
+    json << '}';
+
+    const auto& textCache = TextTextureCache::Shared();
+    const std::size_t lookups = textCache.HitCount() + textCache.MissCount();
+    json << ",\"text_cache\":{\"entries\":" << textCache.EntryCount() << ",\"bytes\":" << textCache.TotalBytes()
+         << ",\"hits\":" << textCache.HitCount() << ",\"misses\":" << textCache.MissCount() << ",\"hit_rate\":"
+         << (lookups == 0 ? 0.0 : static_cast<double>(textCache.HitCount()) / static_cast<double>(lookups)) << '}';
+    json << '}';
+
+    metricsServer_.Publish(json.str());
+}
+
+void Application::ApplyPresentationMode()
+{
+    if (!renderer_)
+    {
+        return;
+    }
+
+    // Vsync toggles in place on SDL 2.0.18+, so a mode switch costs nothing
+    // — no renderer recreation, no texture rebuild. Backends that refuse the
+    // toggle keep vsync on; capped mode still paces correctly on top of it
+    // as long as the cap is below the refresh rate.
+    if (SDL_RenderSetVSync(renderer_.get(), presentationMode_ == PresentationMode::Vsync ? 1 : 0) != 0)
+    {
+        std::cerr << "Renderer does not support toggling vsync at runtime." << '\n';
+    }
+    InvalidateFrame();
+}
+
+void Application::PacePresentation(std::chrono::steady_clock::time_point frameStart)
+{
+    if (presentationMode_ != PresentationMode::CappedFps || presentationCapFps_ <= 0)
+    {
+        return;
+    }
+
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / static_cast<double>(presentationCapFps_)));
+    const auto target = frameStart + interval;
+
+    // Coarse sleep first — the scheduler can overshoot by a millisecond or
+    // two — then spin out the remainder so the cadence stays precise.
+    constexpr auto kSpinWindow = std::chrono::milliseconds{2};
+    const auto now = std::chrono::steady_clock::now();
+    if (target - now > kSpinWindow)
+    {
+        std::this_thread::sleep_for(target - now - kSpinWindow);
+    }
+    while (std::chrono::steady_clock::now() < target)
+    {
+    }
+}
+
+std::filesystem::path Application::ResolveStartupSnapshotPath() const
+{
+    return ResolveSettingsPath().parent_path() / "startup_snapshot.bmp";
+}
+
+void Application::PresentStartupSnapshot()
+{
+    startupSnapshot_ = LoadStartupSnapshot(renderer_.get(), ResolveStartupSnapshotPath());
+    if (!startupSnapshot_)
+    {
+        return;
+    }
+
+    // One immediate present: fonts, content and theme all initialize behind
+    // the previous session's final frame from here on.
+    SDL_SetRenderDrawColor(renderer_.get(), 0, 0, 0, 255);
+    SDL_RenderClear(renderer_.get());
+    SDL_SetTextureAlphaMod(startupSnapshot_.get(), 255);
+    SDL_RenderCopy(renderer_.get(), startupSnapshot_.get(), nullptr, nullptr);
     SDL_RenderPresent(renderer_.get());
+    startupSnapshotFadeSeconds_ = kStartupSnapshotFadeSeconds;
+}
+
+void Application::UpdateStartupSnapshotFade(double deltaSeconds)
+{
+    if (!startupSnapshot_)
+    {
+        return;
+    }
+
+    if (IsReduceMotionEnabled())
+    {
+        // The fade is a pure flourish; reduce-motion seats cut straight to
+        // the live UI.
+        startupSnapshotFadeSeconds_ = 0.0;
+    }
+    else
+    {
+        startupSnapshotFadeSeconds_ -= deltaSeconds;
+    }
+
+    if (startupSnapshotFadeSeconds_ <= 0.0)
+    {
+        startupSnapshot_.reset();
+        return;
+    }
+
+    // Keep frames flowing so the fade animates even with no input.
+    InvalidateFrame();
+}
+
+void Application::ComposeStartupSnapshotOverlay()
+{
+    if (!startupSnapshot_ || startupSnapshotFadeSeconds_ <= 0.0)
+    {
+        return;
+    }
+
+    const double alpha = std::clamp(startupSnapshotFadeSeconds_ / kStartupSnapshotFadeSeconds, 0.0, 1.0);
+    SDL_SetTextureAlphaMod(startupSnapshot_.get(), static_cast<Uint8>(alpha * 255.0));
+    SDL_RenderCopy(renderer_.get(), startupSnapshot_.get(), nullptr, nullptr);
+}
+
+void Application::CaptureStartupSnapshotBeforePresent()
+{
+    if (!captureStartupSnapshotOnPresent_)
+    {
+        return;
+    }
+    captureStartupSnapshotOnPresent_ = false;
+    SaveStartupSnapshot(renderer_.get(), ResolveStartupSnapshotPath());
 }
 
+void Application::MaybeRecordJankIncident()
+{
+    // Steady state is this one comparison; everything below only runs for a
+    // frame that already missed vsync.
+    const FrameProfiler::Sample& frame = frameProfiler_.LastFrame();
+    if (jankBudgetMs_ <= 0.0 || static_cast<double>(frame[FrameProfiler::kPhaseCount]) < jankBudgetMs_)
+    {
+        return;
+    }
+
+    JankRecorder::Incident incident;
+    incident.atSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+    incident.budgetMs = jankBudgetMs_;
+    incident.frame = frame;
+    incident.interfaceState = interfaceState_ == InterfaceState::Hub ? "hub" : "main";
+    incident.activeProgramId = activeProgramId_;
+    incident.fullFrameDamage = frameDamage_.HasFullFrame();
+    incident.damageRects = frameDamage_.Rects();
+    incident.textCacheHits = TextTextureCache::Shared().HitCount();
+    incident.textCacheMisses = TextTextureCache::Shared().MissCount();
+    jankRecorder_.Record(incident);
+}
 
 void Application::LaunchArcadeApp()
 {
@@ -1872,6 +3663,7 @@ void Application::LaunchArcadeApp()
     }
 
     UpdateStatusMessage("Orbital Arcade is running in a separate window. Close it to return to Colony.");
+    RecordProgramLaunch(kOrbitalArcadeProgramId);
 
     const Uint32 arcadeWindowId = SDL_GetWindowID(arcadeWindow);
     bool running = true;
@@ -1926,20 +3718,48 @@ void Application::LaunchArcadeApp()
 
 void Application::UpdateStatusMessage(const std::string& statusText)
 {
+    if (statusBuffer_ == statusText)
+    {
+        return;
+    }
+    // Rasterization is deferred to FlushStatusMessageTexture: activation
+    // paths and dialog flows often set the status several times on the way
+    // to one frame, and only the final string should cost a text render.
     statusBuffer_ = statusText;
+    statusTextureDirty_ = true;
+    InvalidateFrame();
+}
+
+void Application::FlushStatusMessageTexture()
+{
+    if (!statusTextureDirty_)
+    {
+        return;
+    }
+    statusTextureDirty_ = false;
     if (activeProgramId_.empty())
     {
         return;
     }
 
-    if (auto it = programVisuals_.find(activeProgramId_); it != programVisuals_.end())
+    const auto it = programVisuals_.find(activeProgramId_);
+    if (it == programVisuals_.end())
     {
-        it->second.statusBar = CreateTextTexture(
-            renderer_.get(),
-            fonts_.status.get(),
-            statusBuffer_,
-            theme_.statusBarText);
+        return;
     }
+
+    // Frequent callers pass the identical string (TriggerPrimaryAction,
+    // re-activations); the hash compare keeps those free of texture churn.
+    const std::size_t textHash = std::hash<std::string>{}(statusBuffer_);
+    if (textHash == it->second.statusBarTextHash && it->second.statusBar.texture)
+    {
+        return;
+    }
+    // Fallback chain rather than the bare status font: program titles echoed
+    // into the status line carry whatever scripts the catalog does.
+    it->second.statusBar =
+        CreateFallbackTextTexture(renderer_.get(), statusFallbackChain_, statusBuffer_, theme_.statusBarText);
+    it->second.statusBarTextHash = textHash;
 }
 
 void Application::UpdateViewContextAccent()
@@ -2025,139 +3845,144 @@ void Application::ApplyAppearanceCustomizations()
         const SDL_Color lightTarget{255, 255, 255, SDL_ALPHA_OPAQUE};
         const SDL_Color target = depthDelta > 0.0f ? darkTarget : lightTarget;
 
-        auto adjust = [&](SDL_Color color) {
-            return color::Mix(color, target, depthAmount);
+        // Every surface shifts toward the same target by the same amount, so
+        // the whole depth pass is one batched mix instead of eight Mix calls.
+        SDL_Color surfaces[] = {
+            theme_.background,
+            theme_.libraryBackground,
+            theme_.navRail,
+            theme_.libraryCard,
+            theme_.libraryCardHover,
+            theme_.libraryCardActive,
+            theme_.heroGradientFallbackStart,
+            theme_.heroGradientFallbackEnd,
         };
-
-        theme_.background = adjust(theme_.background);
-        theme_.libraryBackground = adjust(theme_.libraryBackground);
-        theme_.navRail = adjust(theme_.navRail);
-        theme_.libraryCard = adjust(theme_.libraryCard);
-        theme_.libraryCardHover = adjust(theme_.libraryCardHover);
-        theme_.libraryCardActive = adjust(theme_.libraryCardActive);
-        theme_.heroGradientFallbackStart = adjust(theme_.heroGradientFallbackStart);
-        theme_.heroGradientFallbackEnd = adjust(theme_.heroGradientFallbackEnd);
+        color::MixInPlace(surfaces, std::size(surfaces), target, depthAmount);
+        theme_.background = surfaces[0];
+        theme_.libraryBackground = surfaces[1];
+        theme_.navRail = surfaces[2];
+        theme_.libraryCard = surfaces[3];
+        theme_.libraryCardHover = surfaces[4];
+        theme_.libraryCardActive = surfaces[5];
+        theme_.heroGradientFallbackStart = surfaces[6];
+        theme_.heroGradientFallbackEnd = surfaces[7];
     }
 }
 
 void Application::QueueLibraryFilterUpdate()
 {
-    const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
-    libraryFilterDebouncer_.Schedule(nowSeconds, [this, draft = libraryFilterDraft_]() {
-        libraryViewModel_.SetFilter(draft);
-        libraryFilterDraft_ = libraryViewModel_.Filter();
-    });
+    // Applied synchronously on every keystroke: with precomputed match keys
+    // a rescore is cheap enough that the old debounce delay just made the
+    // list feel laggy. The draft keeps the user's exact text (including a
+    // trailing space mid-phrase); the view model trims its own copy.
+    libraryViewModel_.SetFilter(libraryFilterDraft_);
+    InvalidateFrame();
 }
 
-void Application::BuildHubPanel()
+void Application::RebuildHubCatalog()
 {
-    if (!renderer_)
-    {
-        return;
-    }
-
     const auto& hubConfig = content_.hub;
 
-    hubSearchTokens_ = TokenizeHubSearch(hubSearchQuery_);
+    hubCatalog_ = HubCatalog{};
 
-    ui::HubContent hubContent;
-    hubContent.searchPlaceholder = GetLocalizedString("hub.search.placeholder", "Rechercher une destination");
+    ui::HubContent& base = hubCatalog_.base;
+    base.searchPlaceholder = GetLocalizedString("hub.search.placeholder", "Rechercher une destination");
 
     if (!hubConfig.headlineLocalizationKey.empty())
     {
-        hubContent.headline = GetLocalizedString(hubConfig.headlineLocalizationKey, hubConfig.headlineLocalizationKey);
+        base.headline = GetLocalizedString(hubConfig.headlineLocalizationKey, hubConfig.headlineLocalizationKey);
     }
-    if (hubContent.headline.empty())
+    if (base.headline.empty())
     {
-        hubContent.headline = content_.brandName.empty() ? std::string{"COLONY"} : content_.brandName;
+        base.headline = content_.brandName.empty() ? std::string{"COLONY"} : content_.brandName;
     }
 
     if (!hubConfig.descriptionLocalizationKey.empty())
     {
-        hubContent.description = GetLocalizedString(
+        base.description = GetLocalizedString(
             hubConfig.descriptionLocalizationKey,
             hubConfig.descriptionLocalizationKey);
     }
-    if (hubContent.description.empty())
+    if (base.description.empty())
     {
-        hubContent.description = GetLocalizedString("hub.status", "Select a destination to continue.");
+        base.description = GetLocalizedString("hub.status", "Select a destination to continue.");
     }
 
     for (const auto& highlightKey : hubConfig.highlightLocalizationKeys)
     {
         if (!highlightKey.empty())
         {
-            hubContent.highlights.push_back(GetLocalizedString(highlightKey, highlightKey));
+            base.highlights.push_back(GetLocalizedString(highlightKey, highlightKey));
+        }
+    }
+
+    if (!hubConfig.primaryActionLocalizationKey.empty())
+    {
+        base.primaryActionLabel =
+            GetLocalizedString(hubConfig.primaryActionLocalizationKey, hubConfig.primaryActionLocalizationKey);
+    }
+    if (!hubConfig.primaryActionDescriptionLocalizationKey.empty())
+    {
+        base.primaryActionDescription = GetLocalizedString(
+            hubConfig.primaryActionDescriptionLocalizationKey,
+            hubConfig.primaryActionDescriptionLocalizationKey);
+    }
+
+    base.widgets.reserve(hubConfig.widgets.size());
+    for (const auto& widget : hubConfig.widgets)
+    {
+        ui::HubWidgetContent widgetContent;
+        widgetContent.id = widget.id;
+        widgetContent.title = widget.titleLocalizationKey.empty() ? widget.id
+                                                                  : GetLocalizedString(widget.titleLocalizationKey, widget.id);
+        widgetContent.description = widget.descriptionLocalizationKey.empty()
+            ? std::string{}
+            : GetLocalizedString(widget.descriptionLocalizationKey, widget.descriptionLocalizationKey);
+        for (const auto& itemKey : widget.itemLocalizationKeys)
+        {
+            if (!itemKey.empty())
+            {
+                widgetContent.items.push_back(GetLocalizedString(itemKey, itemKey));
+            }
         }
+        widgetContent.accent = widget.accentColor.empty() ? theme_.channelBadge
+                                                          : color::ParseHexColor(widget.accentColor, theme_.channelBadge);
+        base.widgets.emplace_back(std::move(widgetContent));
     }
 
-    hubRenderedBranchIds_.clear();
-    hubContent.branches.reserve(hubConfig.branches.size());
+    hubCatalog_.branches.reserve(hubConfig.branches.size());
+    hubCatalog_.branchIds.reserve(hubConfig.branches.size());
+    std::vector<std::string> haystacks;
+    haystacks.reserve(hubConfig.branches.size());
 
-    for (std::size_t index = 0; index < hubConfig.branches.size(); ++index)
+    for (const auto& branch : hubConfig.branches)
     {
-        const auto& branch = hubConfig.branches[index];
-
-        std::string title = branch.titleLocalizationKey.empty()
+        ui::HubBranchContent branchContent;
+        branchContent.id = branch.id;
+        branchContent.title = branch.titleLocalizationKey.empty()
             ? branch.id
             : GetLocalizedString(branch.titleLocalizationKey, branch.id);
-        std::string description = branch.descriptionLocalizationKey.empty()
+        branchContent.description = branch.descriptionLocalizationKey.empty()
             ? branch.id
             : GetLocalizedString(branch.descriptionLocalizationKey, branch.descriptionLocalizationKey);
+        branchContent.accent = branch.accentColor.empty() ? theme_.channelBadge
+                                                         : color::ParseHexColor(branch.accentColor, theme_.channelBadge);
 
-        std::vector<std::string> tags;
-        tags.reserve(branch.tagLocalizationKeys.size());
+        branchContent.tags.reserve(branch.tagLocalizationKeys.size());
         for (const auto& tagKey : branch.tagLocalizationKeys)
         {
             if (!tagKey.empty())
             {
-                tags.push_back(GetLocalizedString(tagKey, tagKey));
-            }
-        }
-
-        std::string metricsText = branch.metricsLocalizationKey.empty()
-            ? std::string{}
-            : GetLocalizedString(branch.metricsLocalizationKey, branch.metricsLocalizationKey);
-
-        std::string haystack = title;
-        haystack.push_back(' ');
-        haystack += description;
-        for (const auto& tag : tags)
-        {
-            haystack.push_back(' ');
-            haystack += tag;
-        }
-        if (!metricsText.empty())
-        {
-            haystack.push_back(' ');
-            haystack += metricsText;
-        }
-        const std::string normalizedHaystack = NormalizeHubSearchString(haystack);
-        bool matchesQuery = true;
-        for (const auto& token : hubSearchTokens_)
-        {
-            if (normalizedHaystack.find(token) == std::string::npos)
-            {
-                matchesQuery = false;
-                break;
+                branchContent.tags.push_back(GetLocalizedString(tagKey, tagKey));
             }
         }
-        if (!matchesQuery)
-        {
-            continue;
-        }
 
-        ui::HubBranchContent branchContent;
-        branchContent.id = branch.id;
-        branchContent.title = title;
-        branchContent.description = description;
-        branchContent.accent = branch.accentColor.empty() ? theme_.channelBadge
-                                                         : color::ParseHexColor(branch.accentColor, theme_.channelBadge);
-        branchContent.tags = tags;
         branchContent.actionLabel = branch.actionLocalizationKey.empty()
             ? GetLocalizedString("hub.branch.default_action", "Open")
             : GetLocalizedString(branch.actionLocalizationKey, branchContent.title);
-        branchContent.metrics = metricsText;
+        branchContent.metrics = branch.metricsLocalizationKey.empty()
+            ? std::string{}
+            : GetLocalizedString(branch.metricsLocalizationKey, branch.metricsLocalizationKey);
 
         if (!branch.channelId.empty())
         {
@@ -2182,56 +4007,66 @@ void Application::BuildHubPanel()
             branchContent.detailBullets.push_back(std::string{"#"} + tag);
         }
 
-        hubContent.branches.emplace_back(std::move(branchContent));
-        hubRenderedBranchIds_.push_back(branch.id);
-    }
-
-    if (hubContent.highlights.empty())
-    {
-        const int count = static_cast<int>(hubContent.branches.size());
-        if (!hubSearchTokens_.empty())
+        std::string haystack = branchContent.title;
+        haystack.push_back(' ');
+        haystack += branchContent.description;
+        for (const auto& tag : branchContent.tags)
         {
-            hubContent.highlights.push_back(std::to_string(count) + (count == 1 ? " résultat" : " résultats"));
+            haystack.push_back(' ');
+            haystack += tag;
         }
-        else
+        if (!branchContent.metrics.empty())
         {
-            const int total = static_cast<int>(hubConfig.branches.size());
-            hubContent.highlights.push_back(std::to_string(total) + (total == 1 ? " destination" : " destinations"));
+            haystack.push_back(' ');
+            haystack += branchContent.metrics;
         }
+        haystacks.push_back(HubSearchIndex::Normalize(haystack));
+
+        hubCatalog_.branchIds.push_back(branch.id);
+        hubCatalog_.branches.emplace_back(std::move(branchContent));
     }
 
-    if (!hubConfig.primaryActionLocalizationKey.empty())
+    hubSearchIndex_.Rebuild(std::move(haystacks));
+    hubCatalogValid_ = true;
+}
+
+void Application::BuildHubPanel()
+{
+    if (!renderer_)
     {
-        hubContent.primaryActionLabel =
-            GetLocalizedString(hubConfig.primaryActionLocalizationKey, hubConfig.primaryActionLocalizationKey);
+        return;
     }
-    if (!hubConfig.primaryActionDescriptionLocalizationKey.empty())
+
+    if (!hubCatalogValid_)
     {
-        hubContent.primaryActionDescription = GetLocalizedString(
-            hubConfig.primaryActionDescriptionLocalizationKey,
-            hubConfig.primaryActionDescriptionLocalizationKey);
+        RebuildHubCatalog();
     }
 
-    hubContent.widgets.reserve(hubConfig.widgets.size());
-    for (const auto& widget : hubConfig.widgets)
+    ui::HubContent hubContent = hubCatalog_.base;
+
+    const std::vector<std::size_t>& matches = hubSearchIndex_.Query(hubSearchQuery_);
+    const bool searchActive = !HubSearchIndex::Normalize(hubSearchQuery_).empty();
+
+    hubRenderedBranchIds_.clear();
+    hubContent.branches.reserve(matches.size());
+    for (const std::size_t branchIndex : matches)
     {
-        ui::HubWidgetContent widgetContent;
-        widgetContent.id = widget.id;
-        widgetContent.title = widget.titleLocalizationKey.empty() ? widget.id
-                                                                  : GetLocalizedString(widget.titleLocalizationKey, widget.id);
-        widgetContent.description = widget.descriptionLocalizationKey.empty()
-            ? std::string{}
-            : GetLocalizedString(widget.descriptionLocalizationKey, widget.descriptionLocalizationKey);
-        for (const auto& itemKey : widget.itemLocalizationKeys)
+        hubContent.branches.push_back(hubCatalog_.branches[branchIndex]);
+        hubRenderedBranchIds_.push_back(hubCatalog_.branchIds[branchIndex]);
+    }
+
+    if (hubContent.highlights.empty())
+    {
+        const int count = static_cast<int>(hubContent.branches.size());
+        if (searchActive)
         {
-            if (!itemKey.empty())
-            {
-                widgetContent.items.push_back(GetLocalizedString(itemKey, itemKey));
-            }
+            hubContent.highlights.push_back(std::to_string(count) + (count == 1 ? " résultat" : " résultats"));
+        }
+        else
+        {
+            const int total = static_cast<int>(hubCatalog_.branches.size());
+            hubContent.highlights.push_back(std::to_string(total) + (total == 1 ? " destination" : " destinations"));
         }
-        widgetContent.accent = widget.accentColor.empty() ? theme_.channelBadge
-                                                          : color::ParseHexColor(widget.accentColor, theme_.channelBadge);
-        hubContent.widgets.emplace_back(std::move(widgetContent));
     }
 
     const int widgetPageCount = hubContent.widgets.empty()
@@ -2259,10 +4094,10 @@ void Application::BuildHubPanel()
     hubPanel_.Build(
         renderer_.get(),
         hubContent,
-        fonts_.heroTitle.get(),
-        fonts_.heroBody.get(),
-        fonts_.tileTitle.get(),
-        fonts_.tileSubtitle.get(),
+        fonts_.heroTitle,
+        fonts_.heroBody,
+        fonts_.tileTitle,
+        fonts_.tileSubtitle,
         theme_);
 
     EnsureHubScrollWithinBounds();
@@ -2274,7 +4109,6 @@ void Application::ResetHubInteractionState()
     focusedHubBranchIndex_ = -1;
     hubBranchHitboxes_.clear();
     hubRenderedBranchIds_.clear();
-    hubSearchTokens_.clear();
     hubScrollOffset_ = 0;
     hubScrollMaxOffset_ = 0;
     hubScrollViewportValid_ = false;
@@ -2289,70 +4123,6 @@ void Application::ResetHubInteractionState()
     hubDetailActionRect_.reset();
 }
 
-std::vector<std::string> Application::TokenizeHubSearch(std::string_view value) const
-{
-    std::vector<std::string> tokens;
-    std::string normalized = NormalizeHubSearchString(value);
-    std::string current;
-    current.reserve(normalized.size());
-    for (char ch : normalized)
-    {
-        if (ch == ' ')
-        {
-            if (!current.empty())
-            {
-                tokens.push_back(current);
-                current.clear();
-            }
-        }
-        else
-        {
-            current.push_back(ch);
-        }
-    }
-    if (!current.empty())
-    {
-        tokens.push_back(current);
-    }
-    return tokens;
-}
-
-std::string Application::NormalizeHubSearchString(std::string_view value) const
-{
-    std::string normalized;
-    normalized.reserve(value.size());
-    bool previousSpace = false;
-    for (unsigned char raw : value)
-    {
-        if (std::isalnum(raw) != 0)
-        {
-            normalized.push_back(static_cast<char>(std::tolower(raw)));
-            previousSpace = false;
-        }
-        else if (std::isspace(raw) != 0)
-        {
-            if (!previousSpace && !normalized.empty())
-            {
-                normalized.push_back(' ');
-                previousSpace = true;
-            }
-        }
-        else
-        {
-            if (!previousSpace && !normalized.empty())
-            {
-                normalized.push_back(' ');
-                previousSpace = true;
-            }
-        }
-    }
-    if (!normalized.empty() && normalized.back() == ' ')
-    {
-        normalized.pop_back();
-    }
-    return normalized;
-}
-
 void Application::EnsureHubScrollWithinBounds()
 {
     hubScrollOffset_ = std::clamp(hubScrollOffset_, 0, std::max(0, hubScrollMaxOffset_));
@@ -2367,7 +4137,6 @@ void Application::FocusHubSearch()
 void Application::ClearHubSearchQuery()
 {
     hubSearchQuery_.clear();
-    hubSearchTokens_.clear();
     hubScrollOffset_ = 0;
 }
 
@@ -2734,22 +4503,11 @@ void Application::ActivateHubBranch(const std::string& branchId)
         }
     }
 
-    auto findChannelForProgram = [&](const std::string& programId) {
-        for (std::size_t i = 0; i < content_.channels.size(); ++i)
-        {
-            const auto& channel = content_.channels[i];
-            if (std::find(channel.programs.begin(), channel.programs.end(), programId) != channel.programs.end())
-            {
-                return static_cast<int>(i);
-            }
-        }
-        return -1;
-    };
-
+    const ProgramHandle branchProgramHandle = programIndex_.HandleFor(branch.programId);
     const bool hasProgramTarget = !branch.programId.empty();
     if (targetChannelIndex == -1 && hasProgramTarget)
     {
-        targetChannelIndex = findChannelForProgram(branch.programId);
+        targetChannelIndex = programIndex_.ChannelForProgram(branchProgramHandle);
     }
 
     if (targetChannelIndex != -1)
@@ -2757,13 +4515,12 @@ void Application::ActivateHubBranch(const std::string& branchId)
         navigationController_.Activate(targetChannelIndex);
         if (hasProgramTarget)
         {
-            auto& channel = content_.channels[static_cast<std::size_t>(targetChannelIndex)];
-            auto it = std::find(channel.programs.begin(), channel.programs.end(), branch.programId);
-            if (it != channel.programs.end())
+            const int programPosition =
+                programIndex_.IndexInChannel(static_cast<std::size_t>(targetChannelIndex), branchProgramHandle);
+            if (programPosition >= 0)
             {
-                const int programIndex = static_cast<int>(std::distance(channel.programs.begin(), it));
-                channelSelections_[targetChannelIndex] = programIndex;
-                ActivateProgramInChannel(programIndex);
+                channelSelections_[targetChannelIndex] = programPosition;
+                ActivateProgramInChannel(programPosition);
             }
             else
             {
@@ -2920,6 +4677,10 @@ void Application::HideCustomThemeDialog()
         customThemeDialog_.colorFieldContentOffsets.begin(),
         customThemeDialog_.colorFieldContentOffsets.end(),
         0);
+    for (ui::RowTargetCache& cache : customThemeFieldCaches_)
+    {
+        cache.Invalidate();
+    }
     UpdateTextInputState();
 }
 
@@ -2958,6 +4719,8 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
         panelHeight};
     customThemeDialog_.panelRect = panelRect;
 
+    drawing::GlowCache::Shared().Render(
+        renderer, panelRect, kAddDialogCornerRadius, ui::Scale(22), interactions_.subtleGlow);
     SDL_Color panelFill = color::Mix(theme_.libraryCardActive, theme_.background, 0.38f);
     SDL_SetRenderDrawColor(renderer, panelFill.r, panelFill.g, panelFill.b, panelFill.a);
     colony::drawing::RenderFilledRoundedRect(renderer, panelRect, kAddDialogCornerRadius);
@@ -2968,7 +4731,7 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     int cursorY = panelRect.y + panelPadding;
 
     std::string titleText = GetLocalizedString("settings.appearance.custom_theme.dialog.title", "Create custom colors");
-    TextTexture titleTexture = CreateTextTexture(renderer, fonts_.heroTitle.get(), titleText, theme_.heroTitle);
+    const TextTexture& titleTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.heroTitle, titleText, theme_.heroTitle);
     if (titleTexture.texture)
     {
         SDL_Rect titleRect{cursorX, cursorY, titleTexture.width, titleTexture.height};
@@ -2979,7 +4742,7 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     std::string subtitleText = GetLocalizedString(
         "settings.appearance.custom_theme.button.description",
         "Define each interface color manually.");
-    TextTexture subtitleTexture = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), subtitleText, theme_.muted);
+    const TextTexture& subtitleTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, subtitleText, theme_.muted);
     if (subtitleTexture.texture)
     {
         SDL_Rect subtitleRect{cursorX, cursorY, subtitleTexture.width, subtitleTexture.height};
@@ -2990,7 +4753,7 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     std::string nameLabelText = GetLocalizedString(
         "settings.appearance.custom_theme.dialog.name_label",
         "Scheme name");
-    TextTexture nameLabel = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), nameLabelText, theme_.muted);
+    const TextTexture& nameLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, nameLabelText, theme_.muted);
     if (nameLabel.texture)
     {
         SDL_Rect labelRect{cursorX, cursorY, nameLabel.width, nameLabel.height};
@@ -3020,9 +4783,9 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     std::string namePlaceholder = GetLocalizedString(
         "settings.appearance.custom_theme.dialog.name_placeholder",
         "Enter a name");
-    TextTexture nameValueTexture = CreateTextTexture(
+    const TextTexture& nameValueTexture = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.tileSubtitle.get(),
+        fonts_.tileSubtitle,
         hasName ? customThemeDialog_.nameInput : namePlaceholder,
         hasName ? theme_.heroTitle : theme_.muted);
     if (nameValueTexture.texture)
@@ -3069,7 +4832,7 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     const int buttonAreaTop = panelRect.y + panelRect.h - panelPadding - buttonHeight;
     const int viewportBottomPadding = ui::Scale(32);
     const int availableViewportHeight = std::max(0, buttonAreaTop - viewportBottomPadding - cursorY);
-    const int labelHeightEstimate = fonts_.tileSubtitle ? TTF_FontHeight(fonts_.tileSubtitle.get()) : ui::Scale(18);
+    const int labelHeightEstimate = fonts_.tileSubtitle ? TTF_FontHeight(fonts_.tileSubtitle) : ui::Scale(18);
     const int estimatedRowHeight = labelHeightEstimate + ui::Scale(6) + fieldHeight + ui::Scale(20);
     int fieldsViewportHeight = availableViewportHeight;
     if (estimatedRowHeight > 0)
@@ -3114,16 +4877,7 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
         int localOffset = columnOffsets[column];
 
         std::string labelText = GetLocalizedString(field.localizationKey, field.id);
-        TextTexture labelTexture = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), labelText, theme_.muted);
-        if (viewportValid && labelTexture.texture)
-        {
-            SDL_Rect labelRect{
-                fieldX,
-                fieldsViewport.y + localOffset - customThemeDialog_.scrollOffset,
-                labelTexture.width,
-                labelTexture.height};
-            RenderTexture(renderer, labelTexture, labelRect);
-        }
+        const TextTexture& labelTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, labelText, theme_.muted);
 
         int fieldLocalTop = localOffset;
         if (labelTexture.texture)
@@ -3137,101 +4891,124 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
             fieldsViewport.y + fieldLocalTop - customThemeDialog_.scrollOffset,
             columnWidth,
             fieldHeight};
+        SDL_Rect rowRect{
+            fieldX,
+            fieldsViewport.y + localOffset - customThemeDialog_.scrollOffset,
+            columnWidth,
+            fieldLocalTop - localOffset + fieldHeight};
+
+        columnOffsets[column] = fieldLocalTop + fieldHeight + ui::Scale(20);
 
-        if (viewportValid)
+        if (!viewportValid)
         {
-            SDL_Rect visibleRect{};
-            if (SDL_IntersectRect(&fieldRect, &fieldsViewport, &visibleRect) == SDL_TRUE)
+            continue;
+        }
+
+        SDL_Rect visibleRect{};
+        if (SDL_IntersectRect(&fieldRect, &fieldsViewport, &visibleRect) == SDL_TRUE)
+        {
+            customThemeDialog_.colorFieldRects[index] = visibleRect;
+        }
+
+        SDL_Rect rowVisible{};
+        if (SDL_IntersectRect(&rowRect, &fieldsViewport, &rowVisible) != SDL_TRUE)
+        {
+            continue;
+        }
+
+        const bool colorFocused = customThemeDialog_.focusedIndex == static_cast<int>(index) + 1;
+        const std::string& fieldValue = customThemeDialog_.colorInputs[index];
+        const bool hasValue = !fieldValue.empty();
+
+        const int previewSize = ui::Scale(22);
+        SDL_Rect textClip{
+            fieldRect.x + ui::Scale(10),
+            fieldRect.y,
+            fieldRect.w - previewSize - ui::Scale(28),
+            fieldRect.h};
+
+        // Each field row (label, box, swatch, hex value) is retained as a
+        // position-independent texture; editing one hex value re-renders one
+        // row. The viewport clip trims partially scrolled rows at blit time
+        // and the blinking caret is stamped on top immediate-mode.
+        ui::PanelStateHash rowHash;
+        rowHash.Mix(colorFocused).Mix(fieldValue).Mix(rowRect.w).Mix(rowRect.h);
+        ui::RowTargetCache& rowCache = customThemeFieldCaches_[index];
+        if (rowCache.Begin(renderer, rowRect, rowHash.Value()))
+        {
+            if (labelTexture.texture)
             {
-                customThemeDialog_.colorFieldRects[index] = visibleRect;
-                const bool colorFocused = customThemeDialog_.focusedIndex == static_cast<int>(index) + 1;
-                SDL_Color colorFill = colorFocused ? color::Mix(theme_.libraryCardActive, theme_.background, 0.6f)
-                                                   : color::Mix(theme_.libraryCard, theme_.background, 0.55f);
-                SDL_SetRenderDrawColor(renderer, colorFill.r, colorFill.g, colorFill.b, colorFill.a);
-                colony::drawing::RenderFilledRoundedRect(renderer, fieldRect, 12);
-                SDL_Color colorBorder = colorFocused ? theme_.channelBadge : theme_.border;
-                SDL_SetRenderDrawColor(renderer, colorBorder.r, colorBorder.g, colorBorder.b, colorBorder.a);
-                colony::drawing::RenderRoundedRect(renderer, fieldRect, 12);
-
-                const int previewSize = ui::Scale(22);
-                SDL_Rect previewRect{
-                    fieldRect.x + fieldRect.w - previewSize - ui::Scale(8),
-                    fieldRect.y + (fieldRect.h - previewSize) / 2,
-                    previewSize,
-                    previewSize};
-                SDL_Color previewColor = color::ParseHexColor(customThemeDialog_.colorInputs[index], theme_.channelBadge);
-                SDL_SetRenderDrawColor(renderer, previewColor.r, previewColor.g, previewColor.b, previewColor.a);
-                colony::drawing::RenderFilledRoundedRect(renderer, previewRect, 8);
-                SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
-                colony::drawing::RenderRoundedRect(renderer, previewRect, 8);
-
-                SDL_Rect textClip{
-                    fieldRect.x + ui::Scale(10),
-                    fieldRect.y,
-                    fieldRect.w - previewSize - ui::Scale(28),
-                    fieldRect.h};
-                SDL_Rect textClipIntersection{};
-                if (SDL_IntersectRect(&textClip, &fieldsViewport, &textClipIntersection) == SDL_TRUE)
-                {
-                    SDL_RenderSetClipRect(renderer, &textClipIntersection);
+                SDL_Rect labelRect{fieldX, rowRect.y, labelTexture.width, labelTexture.height};
+                RenderTexture(renderer, labelTexture, labelRect);
+            }
 
-                    const std::string& fieldValue = customThemeDialog_.colorInputs[index];
-                    const bool hasValue = !fieldValue.empty();
-                    TextTexture valueTexture = CreateTextTexture(
-                        renderer,
-                        fonts_.tileSubtitle.get(),
-                        hasValue ? fieldValue : std::string{"#RRGGBB"},
-                        hasValue ? theme_.heroTitle : theme_.muted);
-                    if (valueTexture.texture)
-                    {
-                        SDL_Rect valueRect{
-                            textClipIntersection.x,
-                            fieldRect.y + (fieldRect.h - valueTexture.height) / 2,
-                            valueTexture.width,
-                            valueTexture.height};
-                        RenderTexture(renderer, valueTexture, valueRect);
-                    }
+            SDL_Color colorFill = colorFocused ? color::Mix(theme_.libraryCardActive, theme_.background, 0.6f)
+                                               : color::Mix(theme_.libraryCard, theme_.background, 0.55f);
+            SDL_SetRenderDrawColor(renderer, colorFill.r, colorFill.g, colorFill.b, colorFill.a);
+            colony::drawing::RenderFilledRoundedRect(renderer, fieldRect, 12);
+            SDL_Color colorBorder = colorFocused ? theme_.channelBadge : theme_.border;
+            SDL_SetRenderDrawColor(renderer, colorBorder.r, colorBorder.g, colorBorder.b, colorBorder.a);
+            colony::drawing::RenderRoundedRect(renderer, fieldRect, 12);
+
+            SDL_Rect previewRect{
+                fieldRect.x + fieldRect.w - previewSize - ui::Scale(8),
+                fieldRect.y + (fieldRect.h - previewSize) / 2,
+                previewSize,
+                previewSize};
+            SDL_Color previewColor = color::ParseHexColor(fieldValue, theme_.channelBadge);
+            SDL_SetRenderDrawColor(renderer, previewColor.r, previewColor.g, previewColor.b, previewColor.a);
+            colony::drawing::RenderFilledRoundedRect(renderer, previewRect, 8);
+            SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
+            colony::drawing::RenderRoundedRect(renderer, previewRect, 8);
 
-                    if (colorFocused)
-                    {
-                        const bool caretVisible = std::fmod(timeSeconds, 1.0) < 0.5;
-                        if (caretVisible)
-                        {
-                            const int caretOffset = (!customThemeDialog_.colorInputs[index].empty() && valueTexture.texture)
-                                                        ? valueTexture.width
-                                                        : 0;
-                            const int caretX = textClip.x + caretOffset + ui::Scale(2);
-                            SDL_Rect caretClip{
-                                textClip.x,
-                                fieldRect.y + ui::Scale(6),
-                                textClip.w,
-                                fieldRect.h - ui::Scale(12)};
-                            SDL_Rect caretClipIntersection{};
-                            if (SDL_IntersectRect(&caretClip, &fieldsViewport, &caretClipIntersection) == SDL_TRUE)
-                            {
-                                SDL_RenderSetClipRect(renderer, &caretClipIntersection);
-                                SDL_SetRenderDrawColor(
-                                    renderer,
-                                    theme_.heroTitle.r,
-                                    theme_.heroTitle.g,
-                                    theme_.heroTitle.b,
-                                    theme_.heroTitle.a);
-                                SDL_RenderDrawLine(
-                                    renderer,
-                                    caretX,
-                                    caretClipIntersection.y,
-                                    caretX,
-                                    caretClipIntersection.y + caretClipIntersection.h);
-                            }
-                        }
-                    }
+            // Hex values churn per keystroke while editing, so they draw
+            // through the glyph atlas instead of the whole-string cache.
+            SDL_RenderSetClipRect(renderer, &textClip);
+            const int valueY = fieldRect.y + (fieldRect.h - TTF_FontHeight(fonts_.tileSubtitle)) / 2;
+            GlyphAtlas::Shared().RenderText(
+                renderer,
+                fonts_.tileSubtitle,
+                hasValue ? std::string_view{fieldValue} : std::string_view{"#RRGGBB"},
+                textClip.x,
+                valueY,
+                hasValue ? theme_.heroTitle : theme_.muted);
+            SDL_RenderSetClipRect(renderer, nullptr);
+            rowCache.End(renderer);
+        }
 
+        if (colorFocused)
+        {
+            const bool caretVisible = std::fmod(timeSeconds, 1.0) < 0.5;
+            if (caretVisible)
+            {
+                const int caretOffset =
+                    hasValue ? GlyphAtlas::Shared().MeasureWidth(fonts_.tileSubtitle, fieldValue) : 0;
+                const int caretX = textClip.x + caretOffset + ui::Scale(2);
+                SDL_Rect caretClip{
+                    textClip.x,
+                    fieldRect.y + ui::Scale(6),
+                    textClip.w,
+                    fieldRect.h - ui::Scale(12)};
+                SDL_Rect caretClipIntersection{};
+                if (SDL_IntersectRect(&caretClip, &fieldsViewport, &caretClipIntersection) == SDL_TRUE)
+                {
+                    SDL_RenderSetClipRect(renderer, &caretClipIntersection);
+                    SDL_SetRenderDrawColor(
+                        renderer,
+                        theme_.heroTitle.r,
+                        theme_.heroTitle.g,
+                        theme_.heroTitle.b,
+                        theme_.heroTitle.a);
+                    SDL_RenderDrawLine(
+                        renderer,
+                        caretX,
+                        caretClipIntersection.y,
+                        caretX,
+                        caretClipIntersection.y + caretClipIntersection.h);
                     SDL_RenderSetClipRect(renderer, &fieldsViewport);
                 }
             }
         }
-
-        columnOffsets[column] = fieldLocalTop + fieldHeight + ui::Scale(20);
     }
 
     if (viewportValid)
@@ -3266,9 +5043,9 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
 
     if (!customThemeDialog_.errorMessage.empty())
     {
-        TextTexture errorTexture = CreateTextTexture(
+        const TextTexture& errorTexture = TextTextureCache::Shared().Acquire(
             renderer,
-            fonts_.tileSubtitle.get(),
+            fonts_.tileSubtitle,
             customThemeDialog_.errorMessage,
             theme_.channelBadge);
         if (errorTexture.texture)
@@ -3302,9 +5079,9 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
     SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
     colony::drawing::RenderRoundedRect(renderer, customThemeDialog_.cancelButtonRect, 14);
 
-    TextTexture saveLabel = CreateTextTexture(
+    const TextTexture& saveLabel = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.button.get(),
+        fonts_.button,
         GetLocalizedString("settings.appearance.custom_theme.dialog.save", "Save palette"),
         theme_.heroTitle);
     if (saveLabel.texture)
@@ -3319,9 +5096,9 @@ void Application::RenderCustomThemeDialog(double timeSeconds)
         RenderTexture(renderer, saveLabel, saveRect);
     }
 
-    TextTexture cancelLabel = CreateTextTexture(
+    const TextTexture& cancelLabel = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.button.get(),
+        fonts_.button,
         GetLocalizedString("settings.appearance.custom_theme.dialog.cancel", "Cancel"),
         theme_.heroTitle);
     if (cancelLabel.texture)
@@ -3377,7 +5154,7 @@ bool Application::HandleCustomThemeDialogMouseWheel(const SDL_MouseWheelEvent& w
     }
 
     const int fieldHeight = ui::Scale(44);
-    const int labelHeightEstimate = fonts_.tileSubtitle ? TTF_FontHeight(fonts_.tileSubtitle.get()) : ui::Scale(18);
+    const int labelHeightEstimate = fonts_.tileSubtitle ? TTF_FontHeight(fonts_.tileSubtitle) : ui::Scale(18);
     const int rowStride = labelHeightEstimate + ui::Scale(6) + fieldHeight + ui::Scale(20);
     const int scrollStep = std::max(rowStride, ui::Scale(40));
 
@@ -3699,11 +5476,7 @@ bool Application::ApplyCustomThemeDialog()
     }
 
     auto normalizedLower = [](std::string value) {
-        value = TrimString(std::move(value));
-        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-            return static_cast<char>(std::tolower(ch));
-        });
-        return value;
+        return text::ToLowerAscii(TrimString(std::move(value)));
     };
 
     std::string normalizedName = normalizedLower(trimmedName);
@@ -3776,7 +5549,7 @@ bool Application::ApplyCustomThemeDialog()
     themeManager_.AddCustomScheme(std::move(scheme), true);
     HideCustomThemeDialog();
     RebuildTheme();
-    SaveSettings();
+    QueueSettingsSave();
     return true;
 }
 
@@ -3831,9 +5604,14 @@ void Application::ShowAddAppDialog()
 
 void Application::HideAddAppDialog()
 {
+    addAppScanner_.Cancel();
+    addAppDialog_.rawEntries.clear();
+    addAppDialog_.scanComplete = false;
+    addAppDialog_.scanErrorMessage.clear();
     addAppDialog_.visible = false;
     addAppDialog_.entries.clear();
     addAppDialog_.entryRects.clear();
+    addAppRowCaches_.clear();
     addAppDialog_.errorMessage.clear();
     addAppDialog_.parentAvailable = false;
     addAppDialog_.selectedIndex = -1;
@@ -3853,15 +5631,21 @@ void Application::HideAddAppDialog()
 
 void Application::RefreshAddAppDialogEntries()
 {
-    const int previousScroll = addAppDialog_.scrollOffset;
-    std::filesystem::path previouslySelectedPath;
+    addAppDialog_.preservedScrollOffset = addAppDialog_.scrollOffset;
+    addAppDialog_.pendingSelectionPath.clear();
     if (addAppDialog_.selectedIndex >= 0 && addAppDialog_.selectedIndex < static_cast<int>(addAppDialog_.entries.size()))
     {
-        previouslySelectedPath = addAppDialog_.entries[addAppDialog_.selectedIndex].path;
+        addAppDialog_.pendingSelectionPath = addAppDialog_.entries[addAppDialog_.selectedIndex].path;
     }
 
+    addAppScanner_.Cancel();
+    addAppDialog_.rawEntries.clear();
+    addAppDialog_.scanComplete = false;
+    addAppDialog_.scanErrorMessage.clear();
+
     addAppDialog_.entries.clear();
     addAppDialog_.entryRects.clear();
+    addAppRowCaches_.clear();
     addAppDialog_.filterDropdownOpen = false;
     addAppDialog_.filterDropdownRect = SDL_Rect{0, 0, 0, 0};
     addAppDialog_.filterDropdownOptionRects.clear();
@@ -3879,7 +5663,7 @@ void Application::RefreshAddAppDialogEntries()
     }
 
     SDL_Renderer* renderer = renderer_.get();
-    TTF_Font* font = fonts_.heroBody.get();
+    TTF_Font* font = fonts_.heroBody;
     if (renderer == nullptr || font == nullptr)
     {
         return;
@@ -3890,31 +5674,19 @@ void Application::RefreshAddAppDialogEntries()
     if (directory.empty())
     {
         addAppDialog_.errorMessage = "Directory unavailable.";
+        addAppDialog_.scanComplete = true;
         return;
     }
 
     if (!std::filesystem::exists(directory, ec) || !std::filesystem::is_directory(directory, ec))
     {
         addAppDialog_.errorMessage = "Directory unavailable.";
+        addAppDialog_.scanComplete = true;
         return;
     }
 
     addAppDialog_.parentAvailable = directory.has_parent_path() && directory.parent_path() != directory;
 
-    struct RawEntry
-    {
-        std::filesystem::path path;
-        bool isDirectory = false;
-        std::filesystem::file_time_type lastWriteTime{};
-        bool hasWriteTime = false;
-        bool isExecutable = false;
-        bool hasExecutableInfo = false;
-    };
-
-    std::vector<RawEntry> directories;
-    std::vector<RawEntry> files;
-    bool enumeratedAny = false;
-
     std::string searchFilter = addAppDialog_.searchQuery;
     bool globalSearch = false;
     if (!searchFilter.empty() && searchFilter.front() == '*')
@@ -3927,15 +5699,147 @@ void Application::RefreshAddAppDialogEntries()
         }
     }
 
-    std::transform(searchFilter.begin(), searchFilter.end(), searchFilter.begin(), [](unsigned char ch) {
-        return static_cast<char>(std::tolower(ch));
-    });
-    const bool hasFilter = !searchFilter.empty();
-    if (globalSearch && !hasFilter)
+    text::ToLowerAsciiInPlace(searchFilter);
+    const bool hasFilter = !searchFilter.empty();
+    if (globalSearch && !hasFilter)
+    {
+        globalSearch = false;
+    }
+
+    addAppDialog_.globalSearch = globalSearch;
+    addAppDialog_.normalizedSearchFilter = searchFilter;
+
+    DirectoryScanner::Request request;
+    if (globalSearch)
+    {
+        std::filesystem::path searchRoot = directory;
+        if (searchRoot.has_root_path())
+        {
+            searchRoot = searchRoot.root_path();
+            if (searchRoot.empty())
+            {
+                searchRoot = directory;
+            }
+        }
+        else if (!searchRoot.is_absolute())
+        {
+            std::error_code rootError;
+            searchRoot = std::filesystem::current_path(rootError);
+            if (rootError)
+            {
+                searchRoot = directory;
+            }
+        }
+
+        request.directory = searchRoot;
+        request.recursive = true;
+        request.lowercaseFilter = searchFilter;
+        request.maxResults = kMaxGlobalSearchResults;
+        addAppDialog_.scanDirectory.clear();
+    }
+    else
+    {
+        // A directory we indexed before and whose mtime is unchanged needs
+        // no walk at all — every keystroke in the search field re-filters
+        // from the cached entries.
+        if (const auto* cachedEntries = directoryIndex_.Lookup(directory))
+        {
+            addAppDialog_.rawEntries = *cachedEntries;
+            addAppDialog_.scanComplete = true;
+            RebuildAddAppDialogEntryList();
+            return;
+        }
+
+        request.directory = directory;
+        addAppDialog_.scanDirectory = directory;
+    }
+
+    // Enumeration happens off-thread; batches stream back through
+    // PumpAddAppDialogScan, so the first page is visible within a frame even
+    // on slow network mounts.
+    addAppScanner_.Start(std::move(request));
+    RebuildAddAppDialogEntryList();
+}
+
+void Application::PumpFontDownload()
+{
+    bool succeeded = false;
+    if (!fontDownloadTask_.Drain(succeeded) || !succeeded)
+    {
+        return;
+    }
+
+    // The preferred face landed: re-resolve the font set and rebuild the
+    // chrome around it. The font cache keeps the interim faces open, so
+    // nothing currently rendered dangles.
+    if (InitializeFonts())
+    {
+        RebuildTheme();
+        InvalidateFrame();
+    }
+}
+
+void Application::PumpAddAppDialogScan()
+{
+    if (!addAppDialog_.visible || !addAppScanner_.Active())
+    {
+        return;
+    }
+
+    std::vector<DirectoryScanner::Entry> batch;
+    std::string scanError;
+    const bool finished = addAppScanner_.Drain(batch, scanError);
+    if (batch.empty() && !finished)
+    {
+        return;
+    }
+
+    addAppDialog_.rawEntries.insert(
+        addAppDialog_.rawEntries.end(),
+        std::make_move_iterator(batch.begin()),
+        std::make_move_iterator(batch.end()));
+    if (finished)
+    {
+        addAppDialog_.scanComplete = true;
+        addAppDialog_.scanErrorMessage = scanError;
+
+        // Index clean, non-recursive scans so revisiting or re-filtering the
+        // directory skips the walk while its mtime is unchanged.
+        if (scanError.empty() && !addAppDialog_.scanDirectory.empty())
+        {
+            directoryIndex_.Store(addAppDialog_.scanDirectory, addAppDialog_.rawEntries);
+            addAppDialog_.scanDirectory.clear();
+        }
+    }
+
+    RebuildAddAppDialogEntryList();
+    InvalidateFrame();
+}
+
+void Application::RebuildAddAppDialogEntryList()
+{
+    addAppDialog_.entries.clear();
+    addAppDialog_.entryRects.clear();
+    addAppDialog_.errorMessage.clear();
+    addAppDialog_.selectedIndex = -1;
+    addAppDialog_.contentHeight = 0;
+
+    if (!addAppDialog_.visible)
+    {
+        return;
+    }
+
+    SDL_Renderer* renderer = renderer_.get();
+    TTF_Font* font = fonts_.heroBody;
+    if (renderer == nullptr || font == nullptr)
     {
-        globalSearch = false;
+        return;
     }
 
+    const bool globalSearch = addAppDialog_.globalSearch;
+    const std::string& searchFilter = addAppDialog_.normalizedSearchFilter;
+    const bool hasFilter = !searchFilter.empty();
+
     auto normalizedKey = [globalSearch](const std::filesystem::path& path) {
         std::string key;
         if (globalSearch)
@@ -3950,174 +5854,26 @@ void Application::RefreshAddAppDialogEntries()
         {
             key = path.string();
         }
-        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char ch) {
-            return static_cast<char>(std::tolower(ch));
-        });
+        text::ToLowerAsciiInPlace(key);
         return key;
     };
 
-    if (globalSearch && hasFilter)
-    {
-        constexpr std::size_t kMaxResults = 512;
-        std::filesystem::path searchRoot = directory;
-        if (searchRoot.has_root_path())
-        {
-            searchRoot = searchRoot.root_path();
-            if (searchRoot.empty())
-            {
-                searchRoot = directory;
-            }
-        }
-        else if (!searchRoot.is_absolute())
-        {
-            std::error_code rootError;
-            searchRoot = std::filesystem::current_path(rootError);
-            if (rootError)
-            {
-                searchRoot = directory;
-            }
-        }
-
-        std::error_code iteratorError;
-        std::filesystem::recursive_directory_iterator iterator(
-            searchRoot,
-            std::filesystem::directory_options::skip_permission_denied,
-            iteratorError);
-        std::filesystem::recursive_directory_iterator end;
-        if (iteratorError)
-        {
-            addAppDialog_.errorMessage = "Unable to enumerate directory.";
-            return;
-        }
-
-        for (; iterator != end && (directories.size() + files.size()) < kMaxResults; iterator.increment(iteratorError))
-        {
-            if (iteratorError)
-            {
-                iteratorError.clear();
-                continue;
-            }
-
-            RawEntry entry;
-            entry.path = iterator->path();
-            std::error_code statusError;
-            std::filesystem::file_status status = iterator->status(statusError);
-            if (statusError)
-            {
-                statusError.clear();
-                status = iterator->symlink_status(statusError);
-            }
-            if (!statusError)
-            {
-                entry.isDirectory = std::filesystem::is_directory(status);
-            }
-            else
-            {
-                statusError.clear();
-                std::error_code dirError;
-                entry.isDirectory = std::filesystem::is_directory(entry.path, dirError);
-                if (dirError)
-                {
-                    entry.isDirectory = false;
-                }
-            }
-
-            if (!entry.isDirectory)
-            {
-                entry.hasExecutableInfo = true;
-#if !defined(_WIN32)
-                entry.isExecutable = (::access(entry.path.c_str(), X_OK) == 0);
-#endif
-            }
-
-            std::error_code timeError;
-            entry.lastWriteTime = std::filesystem::last_write_time(entry.path, timeError);
-            entry.hasWriteTime = !timeError;
-
-            enumeratedAny = true;
-
-            const std::string key = normalizedKey(entry.path);
-            if (key.find(searchFilter) == std::string::npos)
-            {
-                continue;
-            }
-
-            if (entry.isDirectory)
-            {
-                directories.emplace_back(std::move(entry));
-            }
-            else
-            {
-                files.emplace_back(std::move(entry));
-            }
-        }
-    }
-    else
+    std::vector<const DirectoryScanner::Entry*> directories;
+    std::vector<const DirectoryScanner::Entry*> files;
+    directories.reserve(addAppDialog_.rawEntries.size());
+    files.reserve(addAppDialog_.rawEntries.size());
+    for (const auto& raw : addAppDialog_.rawEntries)
     {
-        std::filesystem::directory_iterator iterator{directory, ec};
-        if (ec)
+        if (raw.isDirectory)
         {
-            addAppDialog_.errorMessage = "Unable to open directory.";
-            return;
+            directories.push_back(&raw);
         }
-
-        const auto end = std::filesystem::directory_iterator{};
-        for (; iterator != end; iterator.increment(ec))
+        else
         {
-            if (ec)
-            {
-                addAppDialog_.errorMessage = "Unable to enumerate directory.";
-                return;
-            }
-
-            RawEntry entry;
-            entry.path = iterator->path();
-            std::error_code statusError;
-            std::filesystem::file_status status = iterator->status(statusError);
-            if (statusError)
-            {
-                statusError.clear();
-                status = iterator->symlink_status(statusError);
-            }
-            if (!statusError)
-            {
-                entry.isDirectory = std::filesystem::is_directory(status);
-            }
-            else
-            {
-                statusError.clear();
-                std::error_code dirError;
-                entry.isDirectory = std::filesystem::is_directory(entry.path, dirError);
-                if (dirError)
-                {
-                    entry.isDirectory = false;
-                }
-            }
-
-            if (!entry.isDirectory)
-            {
-                entry.hasExecutableInfo = true;
-#if !defined(_WIN32)
-                entry.isExecutable = (::access(entry.path.c_str(), X_OK) == 0);
-#endif
-            }
-
-            std::error_code timeError;
-            entry.lastWriteTime = std::filesystem::last_write_time(entry.path, timeError);
-            entry.hasWriteTime = !timeError;
-
-            enumeratedAny = true;
-
-            if (entry.isDirectory)
-            {
-                directories.emplace_back(entry);
-            }
-            else
-            {
-                files.emplace_back(entry);
-            }
+            files.push_back(&raw);
         }
     }
+    const bool enumeratedAny = !addAppDialog_.rawEntries.empty();
 
     const auto& sortOptions = GetAddDialogSortOptions();
     int sortModeIndex = addAppDialog_.sortModeIndex;
@@ -4126,7 +5882,7 @@ void Application::RefreshAddAppDialogEntries()
         sortModeIndex = 0;
     }
 
-    const auto compareByNameAscending = [&](const RawEntry& lhs, const RawEntry& rhs) {
+    const auto compareByNameAscending = [&](const DirectoryScanner::Entry& lhs, const DirectoryScanner::Entry& rhs) {
         const std::string lhsKey = normalizedKey(lhs.path);
         const std::string rhsKey = normalizedKey(rhs.path);
         if (lhsKey == rhsKey)
@@ -4138,11 +5894,11 @@ void Application::RefreshAddAppDialogEntries()
         return lhsKey < rhsKey;
     };
 
-    const auto compareByNameDescending = [&](const RawEntry& lhs, const RawEntry& rhs) {
+    const auto compareByNameDescending = [&](const DirectoryScanner::Entry& lhs, const DirectoryScanner::Entry& rhs) {
         return compareByNameAscending(rhs, lhs);
     };
 
-    const auto compareByModified = [&](const RawEntry& lhs, const RawEntry& rhs, bool newestFirst) {
+    const auto compareByModified = [&](const DirectoryScanner::Entry& lhs, const DirectoryScanner::Entry& rhs, bool newestFirst) {
         if (lhs.hasWriteTime && rhs.hasWriteTime && lhs.lastWriteTime != rhs.lastWriteTime)
         {
             if (newestFirst)
@@ -4164,21 +5920,24 @@ void Application::RefreshAddAppDialogEntries()
         return compareByNameAscending(lhs, rhs);
     };
 
-    auto sortEntries = [&](std::vector<RawEntry>& entries) {
-        std::sort(entries.begin(), entries.end(), [&](const RawEntry& lhs, const RawEntry& rhs) {
-            switch (sortModeIndex)
-            {
-            case 1:
-                return compareByNameDescending(lhs, rhs);
-            case 2:
-                return compareByModified(lhs, rhs, true);
-            case 3:
-                return compareByModified(lhs, rhs, false);
-            case 0:
-            default:
-                return compareByNameAscending(lhs, rhs);
-            }
-        });
+    auto sortEntries = [&](std::vector<const DirectoryScanner::Entry*>& entries) {
+        std::sort(
+            entries.begin(),
+            entries.end(),
+            [&](const DirectoryScanner::Entry* lhs, const DirectoryScanner::Entry* rhs) {
+                switch (sortModeIndex)
+                {
+                case 1:
+                    return compareByNameDescending(*lhs, *rhs);
+                case 2:
+                    return compareByModified(*lhs, *rhs, true);
+                case 3:
+                    return compareByModified(*lhs, *rhs, false);
+                case 0:
+                default:
+                    return compareByNameAscending(*lhs, *rhs);
+                }
+            });
     };
 
     sortEntries(directories);
@@ -4200,7 +5959,7 @@ void Application::RefreshAddAppDialogEntries()
     const bool filterHasExtensions = !selectedFilter.extensions.empty();
     const bool requireExecutablePermission = selectedFilter.requireExecutablePermission;
 
-    auto passesFileTypeFilter = [&](const RawEntry& raw) {
+    auto passesFileTypeFilter = [&](const DirectoryScanner::Entry& raw) {
         if (raw.isDirectory)
         {
             return allowDirectories;
@@ -4225,9 +5984,7 @@ void Application::RefreshAddAppDialogEntries()
         }
 
         std::string extension = raw.path.extension().string();
-        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char ch) {
-            return static_cast<char>(std::tolower(ch));
-        });
+        text::ToLowerAsciiInPlace(extension);
 
         for (const auto& allowed : selectedFilter.extensions)
         {
@@ -4239,9 +5996,10 @@ void Application::RefreshAddAppDialogEntries()
         return false;
     };
 
-    auto appendEntries = [&](const std::vector<RawEntry>& source) {
-        for (const auto& raw : source)
+    auto appendEntries = [&](const std::vector<const DirectoryScanner::Entry*>& source) {
+        for (const auto* rawPointer : source)
         {
+            const auto& raw = *rawPointer;
             if (filterDuringAppend)
             {
                 const std::string key = normalizedKey(raw.path);
@@ -4288,25 +6046,35 @@ void Application::RefreshAddAppDialogEntries()
     addAppDialog_.contentHeight = static_cast<int>(addAppDialog_.entries.size()) * AddDialogRowHeight();
     addAppDialog_.entryRects.assign(addAppDialog_.entries.size(), SDL_Rect{0, 0, 0, 0});
 
-    if (addAppDialog_.entries.empty())
+    // Empty-state messages wait for the scan to finish so a slow directory
+    // does not flash "Directory is empty." while batches are still arriving.
+    if (addAppDialog_.entries.empty() && addAppDialog_.scanComplete)
     {
-        const bool searchActive = hasFilter && (globalSearch || filterDuringAppend);
-        const bool anyFilterActive = searchActive || fileTypeFilterActive;
-        if (globalSearch)
+        if (!addAppDialog_.scanErrorMessage.empty())
         {
-            addAppDialog_.errorMessage = anyFilterActive ? "No items match your filters." : "Directory is empty.";
+            addAppDialog_.errorMessage = addAppDialog_.scanErrorMessage;
         }
         else
         {
-            addAppDialog_.errorMessage = anyFilterActive && enumeratedAny ? "No items match your filters." : "Directory is empty.";
+            const bool searchActive = hasFilter && (globalSearch || filterDuringAppend);
+            const bool anyFilterActive = searchActive || fileTypeFilterActive;
+            if (globalSearch)
+            {
+                addAppDialog_.errorMessage = anyFilterActive ? "No items match your filters." : "Directory is empty.";
+            }
+            else
+            {
+                addAppDialog_.errorMessage =
+                    anyFilterActive && enumeratedAny ? "No items match your filters." : "Directory is empty.";
+            }
         }
     }
 
-    if (!previouslySelectedPath.empty())
+    if (!addAppDialog_.pendingSelectionPath.empty())
     {
         for (std::size_t index = 0; index < addAppDialog_.entries.size(); ++index)
         {
-            if (addAppDialog_.entries[index].path == previouslySelectedPath)
+            if (addAppDialog_.entries[index].path == addAppDialog_.pendingSelectionPath)
             {
                 addAppDialog_.selectedIndex = static_cast<int>(index);
                 break;
@@ -4315,7 +6083,7 @@ void Application::RefreshAddAppDialogEntries()
     }
 
     const int maxScroll = std::max(0, addAppDialog_.contentHeight - addAppDialog_.listViewport.h);
-    addAppDialog_.scrollOffset = std::clamp(previousScroll, 0, maxScroll);
+    addAppDialog_.scrollOffset = std::clamp(addAppDialog_.preservedScrollOffset, 0, maxScroll);
 }
 
 void Application::RenderAddAppDialog(double timeSeconds)
@@ -4356,6 +6124,8 @@ void Application::RenderAddAppDialog(double timeSeconds)
         panelHeight};
     addAppDialog_.panelRect = panelRect;
 
+    drawing::GlowCache::Shared().Render(
+        renderer, panelRect, kAddDialogCornerRadius, ui::Scale(22), interactions_.subtleGlow);
     SDL_Color panelFill = color::Mix(theme_.libraryCardActive, theme_.background, 0.35f);
     SDL_SetRenderDrawColor(renderer, panelFill.r, panelFill.g, panelFill.b, panelFill.a);
     colony::drawing::RenderFilledRoundedRect(renderer, panelRect, kAddDialogCornerRadius);
@@ -4366,7 +6136,7 @@ void Application::RenderAddAppDialog(double timeSeconds)
     int cursorY = panelRect.y + panelPadding;
 
     const std::string titleText = "Add Application";
-    TextTexture titleTexture = CreateTextTexture(renderer, fonts_.heroTitle.get(), titleText, theme_.heroTitle);
+    const TextTexture& titleTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.heroTitle, titleText, theme_.heroTitle);
     if (titleTexture.texture)
     {
         SDL_Rect titleRect{cursorX, cursorY, titleTexture.width, titleTexture.height};
@@ -4383,7 +6153,7 @@ void Application::RenderAddAppDialog(double timeSeconds)
         parentButtonHeight};
 
     std::string directoryString = addAppDialog_.currentDirectory.string();
-    TextTexture directoryTexture = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), directoryString, theme_.muted);
+    const TextTexture& directoryTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, directoryString, theme_.muted);
 
     const int pathAvailableWidth = addAppDialog_.parentButtonRect.x - ui::Scale(12) - cursorX;
     if (directoryTexture.texture && pathAvailableWidth > 0)
@@ -4402,9 +6172,9 @@ void Application::RenderAddAppDialog(double timeSeconds)
     SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
     colony::drawing::RenderRoundedRect(renderer, addAppDialog_.parentButtonRect, 12);
 
-    TextTexture parentLabel = CreateTextTexture(
+    const TextTexture& parentLabel = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.tileSubtitle.get(),
+        fonts_.tileSubtitle,
         addAppDialog_.parentAvailable ? "Up one level" : "Top level",
         addAppDialog_.parentAvailable ? theme_.heroTitle : theme_.muted);
     if (parentLabel.texture)
@@ -4454,9 +6224,9 @@ void Application::RenderAddAppDialog(double timeSeconds)
     SDL_RenderSetClipRect(renderer, &searchTextClip);
 
     const bool hasSearchText = !addAppDialog_.searchQuery.empty();
-    TextTexture searchTextTexture = hasSearchText
-        ? CreateTextTexture(renderer, fonts_.tileSubtitle.get(), addAppDialog_.searchQuery, theme_.heroTitle)
-        : CreateTextTexture(renderer, fonts_.tileSubtitle.get(), "Search files", theme_.muted);
+    const TextTexture& searchTextTexture = hasSearchText
+        ? TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, addAppDialog_.searchQuery, theme_.heroTitle)
+        : TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, "Search files", theme_.muted);
 
     if (searchTextTexture.texture)
     {
@@ -4533,7 +6303,7 @@ void Application::RenderAddAppDialog(double timeSeconds)
             SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
             colony::drawing::RenderRoundedRect(renderer, rect, 12);
 
-            TextTexture text = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), label, theme_.heroTitle);
+            const TextTexture& text = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, label, theme_.heroTitle);
             if (text.texture)
             {
                 SDL_Rect clipRect = rect;
@@ -4662,55 +6432,61 @@ void Application::RenderAddAppDialog(double timeSeconds)
             continue;
         }
 
-        SDL_Rect clippedRow{
-            rowRect.x,
-            std::max(rowRect.y, listViewport.y),
-            rowRect.w,
-            std::min(rowRect.y + rowRect.h, listViewport.y + listViewport.h) - std::max(rowRect.y, listViewport.y)};
-
+        const auto& entry = addAppDialog_.entries[index];
         const bool isSelected = static_cast<int>(index) == addAppDialog_.selectedIndex;
-        SDL_Color rowColor = isSelected ? color::Mix(theme_.libraryCardActive, theme_.channelBadge, 0.35f)
-                                        : color::Mix(theme_.libraryBackground, theme_.libraryCard, 0.45f);
-        SDL_SetRenderDrawColor(renderer, rowColor.r, rowColor.g, rowColor.b, rowColor.a);
-        colony::drawing::RenderFilledRoundedRect(renderer, clippedRow, rowRadius);
 
-        SDL_Color borderColor = isSelected ? theme_.channelBadge : theme_.border;
-        SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-        colony::drawing::RenderRoundedRect(renderer, clippedRow, rowRadius);
-
-        const int glyphSize = ui::Scale(16);
-        SDL_Rect glyphRect{
-            rowRect.x + ui::Scale(14),
-            rowRect.y + (rowRect.h - glyphSize) / 2,
-            glyphSize,
-            glyphSize};
-        if (glyphRect.y + glyphRect.h > listViewport.y + listViewport.h)
-        {
-            glyphRect.y = std::min(glyphRect.y, listViewport.y + listViewport.h - glyphRect.h);
-        }
-        if (glyphRect.y < listViewport.y)
-        {
-            glyphRect.y = listViewport.y;
+        // Rows are retained as position-independent textures keyed by entry
+        // path: a scroll re-blits, only a selection or layout change redraws.
+        // The viewport clip on the backbuffer trims partially visible rows at
+        // blit time, so the full row (corners included) is drawn here.
+        ui::PanelStateHash rowHash;
+        rowHash.Mix(isSelected).Mix(rowRect.w).Mix(rowRect.h);
+        ui::RowTargetCache& rowCache = addAppRowCaches_[entry.path.string()];
+        if (rowCache.Begin(renderer, rowRect, rowHash.Value()))
+        {
+            const int glyphSize = ui::Scale(16);
+            SDL_Rect glyphRect{
+                rowRect.x + ui::Scale(14),
+                rowRect.y + (rowRect.h - glyphSize) / 2,
+                glyphSize,
+                glyphSize};
+
+            // Both fills carry their color per vertex, so the row background
+            // and the type glyph land in a single geometry batch.
+            SDL_Color rowColor = isSelected ? color::Mix(theme_.libraryCardActive, theme_.channelBadge, 0.35f)
+                                            : color::Mix(theme_.libraryBackground, theme_.libraryCard, 0.45f);
+            dialogDrawList_.FillRoundedRect(rowRect, rowRadius, rowColor);
+            SDL_Color glyphColor = entry.isDirectory ? theme_.channelBadge : theme_.muted;
+            dialogDrawList_.FillRoundedRect(glyphRect, ui::Scale(4), glyphColor);
+            dialogDrawList_.Submit(renderer);
+
+            SDL_Color borderColor = isSelected ? theme_.channelBadge : theme_.border;
+            SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+            colony::drawing::RenderRoundedRect(renderer, rowRect, rowRadius);
+
+            int textX = glyphRect.x + glyphRect.w + ui::Scale(12);
+            if (entry.label.texture)
+            {
+                SDL_Rect textRect{textX, rowRect.y + (rowRect.h - entry.label.height) / 2, entry.label.width, entry.label.height};
+                SDL_Rect clipRect{
+                    rowRect.x + ui::Scale(12),
+                    rowRect.y,
+                    rowRect.w - ui::Scale(24),
+                    rowRect.h};
+                SDL_RenderSetClipRect(renderer, &clipRect);
+                RenderTexture(renderer, entry.label, textRect);
+                SDL_RenderSetClipRect(renderer, nullptr);
+            }
+            rowCache.End(renderer);
         }
+    }
 
-        const auto& entry = addAppDialog_.entries[index];
-        SDL_Color glyphColor = entry.isDirectory ? theme_.channelBadge : theme_.muted;
-        SDL_SetRenderDrawColor(renderer, glyphColor.r, glyphColor.g, glyphColor.b, glyphColor.a);
-        colony::drawing::RenderFilledRoundedRect(renderer, glyphRect, ui::Scale(4));
-
-        int textX = glyphRect.x + glyphRect.w + ui::Scale(12);
-        if (entry.label.texture)
-        {
-            SDL_Rect textRect{textX, rowRect.y + (rowRect.h - entry.label.height) / 2, entry.label.width, entry.label.height};
-            SDL_Rect clipRect{
-                listViewport.x + ui::Scale(12),
-                listViewport.y,
-                listViewport.w - ui::Scale(24),
-                listViewport.h};
-            SDL_RenderSetClipRect(renderer, &clipRect);
-            RenderTexture(renderer, entry.label, textRect);
-            SDL_RenderSetClipRect(renderer, &contentClip);
-        }
+    // Scrolling a deep listing (or a global search) can touch far more rows
+    // than are ever visible at once; past this point the map is dropped
+    // wholesale rather than tracking per-row recency.
+    if (addAppRowCaches_.size() > kAddDialogRowCacheCap)
+    {
+        addAppRowCaches_.clear();
     }
 
     SDL_RenderSetClipRect(renderer, nullptr);
@@ -4721,10 +6497,10 @@ void Application::RenderAddAppDialog(double timeSeconds)
         && addAppDialog_.selectedIndex < static_cast<int>(addAppDialog_.entries.size())
         && !addAppDialog_.entries[addAppDialog_.selectedIndex].isDirectory;
 
-    TextTexture errorTexture;
     if (!addAppDialog_.errorMessage.empty())
     {
-        errorTexture = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), addAppDialog_.errorMessage, theme_.channelBadge);
+        const TextTexture& errorTexture = TextTextureCache::Shared().Acquire(
+            renderer, fonts_.tileSubtitle, addAppDialog_.errorMessage, theme_.channelBadge);
         if (errorTexture.texture)
         {
             SDL_Rect errorRect{cursorX, cursorY, errorTexture.width, errorTexture.height};
@@ -4760,9 +6536,9 @@ void Application::RenderAddAppDialog(double timeSeconds)
     SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
     colony::drawing::RenderRoundedRect(renderer, addAppDialog_.cancelButtonRect, 14);
 
-    TextTexture confirmLabel = CreateTextTexture(
+    const TextTexture& confirmLabel = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.button.get(),
+        fonts_.button,
         "Add to library",
         canConfirm ? theme_.heroTitle : theme_.muted);
     if (confirmLabel.texture)
@@ -4775,7 +6551,7 @@ void Application::RenderAddAppDialog(double timeSeconds)
         RenderTexture(renderer, confirmLabel, confirmLabelRect);
     }
 
-    TextTexture cancelLabel = CreateTextTexture(renderer, fonts_.button.get(), "Cancel", theme_.heroTitle);
+    const TextTexture& cancelLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.button, "Cancel", theme_.heroTitle);
     if (cancelLabel.texture)
     {
         SDL_Rect cancelLabelRect{
@@ -4833,7 +6609,7 @@ void Application::RenderAddAppDialog(double timeSeconds)
 
                 if (index < static_cast<int>(fileFilters.size()))
                 {
-                    TextTexture optionLabel = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), fileFilters[index].label, theme_.heroTitle);
+                    const TextTexture& optionLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, fileFilters[index].label, theme_.heroTitle);
                     if (optionLabel.texture)
                     {
                         SDL_Rect textRect{
@@ -4885,6 +6661,8 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
         panelHeight};
     editAppDialog_.panelRect = panelRect;
 
+    drawing::GlowCache::Shared().Render(
+        renderer, panelRect, kAddDialogCornerRadius, ui::Scale(22), interactions_.subtleGlow);
     SDL_Color panelFill = color::Mix(theme_.libraryCardActive, theme_.background, 0.4f);
     SDL_SetRenderDrawColor(renderer, panelFill.r, panelFill.g, panelFill.b, panelFill.a);
     colony::drawing::RenderFilledRoundedRect(renderer, panelRect, kAddDialogCornerRadius);
@@ -4894,7 +6672,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
     int cursorX = panelRect.x + panelPadding;
     int cursorY = panelRect.y + panelPadding;
 
-    TextTexture titleTexture = CreateTextTexture(renderer, fonts_.heroTitle.get(), "Customize Application", theme_.heroTitle);
+    const TextTexture& titleTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.heroTitle, "Customize Application", theme_.heroTitle);
     if (titleTexture.texture)
     {
         SDL_Rect titleRect{cursorX, cursorY, titleTexture.width, titleTexture.height};
@@ -4902,9 +6680,9 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
         cursorY += titleRect.h + ui::Scale(8);
     }
 
-    TextTexture subtitleTexture = CreateTextTexture(
+    const TextTexture& subtitleTexture = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.tileSubtitle.get(),
+        fonts_.tileSubtitle,
         "Rename your shortcut and set an accent color.",
         theme_.muted);
     if (subtitleTexture.texture)
@@ -4914,7 +6692,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
         cursorY += subtitleRect.h + ui::Scale(16);
     }
 
-    TextTexture nameLabel = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), "Display name", theme_.muted);
+    const TextTexture& nameLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, "Display name", theme_.muted);
     if (nameLabel.texture)
     {
         SDL_Rect labelRect{cursorX, cursorY, nameLabel.width, nameLabel.height};
@@ -4940,9 +6718,9 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
     SDL_RenderSetClipRect(renderer, &nameTextClip);
 
     const bool hasName = !editAppDialog_.nameInput.empty();
-    TextTexture nameValueTexture = hasName
-        ? CreateTextTexture(renderer, fonts_.tileSubtitle.get(), editAppDialog_.nameInput, theme_.heroTitle)
-        : CreateTextTexture(renderer, fonts_.tileSubtitle.get(), "Enter a name", theme_.muted);
+    const TextTexture& nameValueTexture = hasName
+        ? TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, editAppDialog_.nameInput, theme_.heroTitle)
+        : TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, "Enter a name", theme_.muted);
     if (nameValueTexture.texture)
     {
         SDL_Rect valueRect{
@@ -4977,7 +6755,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
 
     cursorY += fieldHeight + ui::Scale(18);
 
-    TextTexture colorLabel = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), "Accent color", theme_.muted);
+    const TextTexture& colorLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, "Accent color", theme_.muted);
     if (colorLabel.texture)
     {
         SDL_Rect colorLabelRect{cursorX, cursorY, colorLabel.width, colorLabel.height};
@@ -5015,9 +6793,9 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
     SDL_RenderSetClipRect(renderer, &colorTextClip);
 
     const bool hasColor = !editAppDialog_.colorInput.empty();
-    TextTexture colorValueTexture = hasColor
-        ? CreateTextTexture(renderer, fonts_.tileSubtitle.get(), editAppDialog_.colorInput, theme_.heroTitle)
-        : CreateTextTexture(renderer, fonts_.tileSubtitle.get(), "#RRGGBB", theme_.muted);
+    const TextTexture& colorValueTexture = hasColor
+        ? TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, editAppDialog_.colorInput, theme_.heroTitle)
+        : TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, "#RRGGBB", theme_.muted);
     if (colorValueTexture.texture)
     {
         SDL_Rect colorValueRect{
@@ -5052,9 +6830,9 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
 
     cursorY += fieldHeight + ui::Scale(12);
 
-    TextTexture hintTexture = CreateTextTexture(
+    const TextTexture& hintTexture = TextTextureCache::Shared().Acquire(
         renderer,
-        fonts_.tileSubtitle.get(),
+        fonts_.tileSubtitle,
         "Accepts #RGB or #RRGGBB values.",
         theme_.muted);
     if (hintTexture.texture)
@@ -5066,7 +6844,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
 
     if (!editAppDialog_.errorMessage.empty())
     {
-        TextTexture errorTexture = CreateTextTexture(renderer, fonts_.tileSubtitle.get(), editAppDialog_.errorMessage, theme_.channelBadge);
+        const TextTexture& errorTexture = TextTextureCache::Shared().Acquire(renderer, fonts_.tileSubtitle, editAppDialog_.errorMessage, theme_.channelBadge);
         if (errorTexture.texture)
         {
             SDL_Rect errorRect{cursorX, cursorY, errorTexture.width, errorTexture.height};
@@ -5102,7 +6880,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
     SDL_SetRenderDrawColor(renderer, theme_.border.r, theme_.border.g, theme_.border.b, theme_.border.a);
     colony::drawing::RenderRoundedRect(renderer, editAppDialog_.cancelButtonRect, 14);
 
-    TextTexture saveLabel = CreateTextTexture(renderer, fonts_.button.get(), "Save changes", theme_.heroTitle);
+    const TextTexture& saveLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.button, "Save changes", theme_.heroTitle);
     if (saveLabel.texture)
     {
         SDL_Rect saveRect{
@@ -5113,7 +6891,7 @@ void Application::RenderEditUserAppDialog(double timeSeconds)
         RenderTexture(renderer, saveLabel, saveRect);
     }
 
-    TextTexture cancelLabel = CreateTextTexture(renderer, fonts_.button.get(), "Cancel", theme_.heroTitle);
+    const TextTexture& cancelLabel = TextTextureCache::Shared().Acquire(renderer, fonts_.button, "Cancel", theme_.heroTitle);
     if (cancelLabel.texture)
     {
         SDL_Rect cancelRect{
@@ -5787,10 +7565,7 @@ std::string Application::TrimString(std::string value)
 int Application::EnsureLocalAppsChannel()
 {
     auto toLower = [](std::string value) {
-        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-            return static_cast<char>(std::tolower(ch));
-        });
-        return value;
+        return text::ToLowerAscii(std::move(value));
     };
 
     const std::string localIdLower = toLower(std::string(kLocalAppsChannelId));
@@ -5920,7 +7695,8 @@ bool Application::AddUserApplication(const std::filesystem::path& executablePath
 
     content_.views[programId] = viewContent;
 
-    viewRegistry_.Register(viewFactory_.CreateSimpleTextView(programId));
+    viewRegistry_.RegisterLazy(
+        programId, [this](const std::string& id) { return viewFactory_.CreateSimpleTextView(id); });
     viewRegistry_.BindContent(content_);
 
     userAppExecutables_[programId] = resolvedPath;
@@ -5941,6 +7717,8 @@ bool Application::AddUserApplication(const std::filesystem::path& executablePath
 
     channelSelections_[targetChannelIndex] = static_cast<int>(targetChannel.programs.size()) - 1;
 
+    programIndex_.Rebuild(content_);
+    libraryViewModel_.InvalidateProgramList();
     RebuildProgramVisuals();
 
     if (targetChannelIndex == activeChannelIndex_)
@@ -5970,14 +7748,14 @@ void Application::LaunchUserApp(const std::filesystem::path& executablePath, con
     const std::string displayName = viewIt != content_.views.end() ? viewIt->second.heading : executablePath.filename().string();
     UpdateStatusMessage("Launching " + displayName + "...");
 
-#if defined(_WIN32)
-    std::string command = "start \"\" \"" + executablePath.string() + "\"";
-#else
-    std::string command = "\"" + executablePath.string() + "\" &";
-#endif
+    // Spawned directly (no shell) and supervised: the exit status comes back
+    // through PumpLaunchResults instead of blocking the click handler.
+    if (!launchService_.Launch(programId, displayName, executablePath))
+    {
+        return;
+    }
 
-    std::thread launcherThread([command]() { std::system(command.c_str()); });
-    launcherThread.detach();
+    RecordProgramLaunch(programId);
 
     if (viewIt != content_.views.end())
     {
@@ -6013,16 +7791,77 @@ void Application::ChangeLanguage(const std::string& languageId)
     }
 
     activeLanguageId_ = languageId;
+    const FontResources previousFonts = fonts_;
     if (!InitializeFonts())
     {
         std::cerr << "Failed to reload fonts for language '" << languageId << "'." << '\n';
         return;
     }
-    RebuildTheme();
+
+    // The font cache dedupes by (path, size), so when the new language
+    // resolves to the same faces every role handle comes back unchanged.
+    // Then nothing rasterized from content or theme data is stale and only
+    // the localized chrome needs rebuilding; program visuals, view textures
+    // and the text caches all survive the switch.
+    const bool roleFontsUnchanged = previousFonts.brand == fonts_.brand
+        && previousFonts.navigation == fonts_.navigation && previousFonts.channel == fonts_.channel
+        && previousFonts.tileTitle == fonts_.tileTitle && previousFonts.tileSubtitle == fonts_.tileSubtitle
+        && previousFonts.tileMeta == fonts_.tileMeta && previousFonts.heroTitle == fonts_.heroTitle
+        && previousFonts.heroSubtitle == fonts_.heroSubtitle && previousFonts.heroBody == fonts_.heroBody
+        && previousFonts.patchTitle == fonts_.patchTitle && previousFonts.patchBody == fonts_.patchBody
+        && previousFonts.button == fonts_.button && previousFonts.status == fonts_.status;
+    if (roleFontsUnchanged)
+    {
+        ScopedPhaseTimer phaseTimer{frameProfiler_, FramePhase::ThemeRebuild};
+        RebuildLocalizedChrome();
+        InvalidateFrame();
+    }
+    else
+    {
+        RebuildTheme();
+    }
+    QueueSettingsSave();
 }
 
 void Application::LoadSettings()
 {
+    // Parsing the directory index is pure disk work; run it off the startup
+    // path and swap the result in on the UI thread. A Store() that races the
+    // load just loses its snapshot, which only costs a future rescan.
+    workScheduler_.Submit(
+        WorkScheduler::Priority::Idle,
+        [this, indexPath = ResolveDirectoryIndexPath()]() -> WorkScheduler::Completion {
+            auto loaded = std::make_shared<DirectoryIndex>();
+            if (!loaded->LoadFromFile(indexPath))
+            {
+                return {};
+            }
+            return [this, loaded] { directoryIndex_ = std::move(*loaded); };
+        });
+
+    // Launch history lives next to settings.json and is likewise pure disk
+    // work; parse it at idle and hand the recency order to the view model
+    // when it lands.
+    workScheduler_.Submit(
+        WorkScheduler::Priority::Idle,
+        [this, historyPath = ResolveLaunchHistoryPath()]() -> WorkScheduler::Completion {
+            auto loaded = std::make_shared<LaunchHistory>();
+            if (!loaded->LoadFromFile(historyPath))
+            {
+                return {};
+            }
+            return [this, loaded] {
+                // A launch recorded before the load landed wins; replaying
+                // the stale file over it would drop that event.
+                if (launchHistory_.Version() != 0)
+                {
+                    return;
+                }
+                launchHistory_ = std::move(*loaded);
+                libraryViewModel_.SetRecencyOrder(launchHistory_.RecencyOrder());
+            };
+        });
+
     const std::filesystem::path settingsPath = ResolveSettingsPath();
     if (settingsPath.empty())
     {
@@ -6058,20 +7897,15 @@ void Application::LoadSettings()
 
         if (document.contains("toggles") && document["toggles"].is_object())
         {
-            for (const auto& [key, value] : document["toggles"].items())
+            const auto& toggles = document["toggles"];
+            // Only keys from the toggle table are honored; stale entries in
+            // the settings file are dropped on the next save.
+            for (const auto& descriptor : ui::kBasicToggleTable)
             {
-                if (!value.is_boolean())
-                {
-                    continue;
-                }
-
-                if (auto it = basicToggleStates_.find(key); it != basicToggleStates_.end())
-                {
-                    it->second = value.get<bool>();
-                }
-                else
+                const std::string key{descriptor.key};
+                if (toggles.contains(key) && toggles[key].is_boolean())
                 {
-                    basicToggleStates_.emplace(key, value.get<bool>());
+                    basicToggles_.Set(descriptor.toggle, toggles[key].get<bool>());
                 }
             }
         }
@@ -6135,6 +7969,31 @@ void Application::LoadSettings()
                 SetAppearanceCustomizationValue(key, static_cast<float>(value.get<double>()));
             }
         }
+
+        if (document.contains("presentation") && document["presentation"].is_object())
+        {
+            const auto& presentation = document["presentation"];
+            if (presentation.contains("mode") && presentation["mode"].is_string())
+            {
+                const std::string mode = presentation["mode"].get<std::string>();
+                if (mode == "vsync")
+                {
+                    presentationMode_ = PresentationMode::Vsync;
+                }
+                else if (mode == "capped")
+                {
+                    presentationMode_ = PresentationMode::CappedFps;
+                }
+                else if (mode == "uncapped")
+                {
+                    presentationMode_ = PresentationMode::Uncapped;
+                }
+            }
+            if (presentation.contains("capFps") && presentation["capFps"].is_number_integer())
+            {
+                presentationCapFps_ = std::clamp(presentation["capFps"].get<int>(), 10, 1000);
+            }
+        }
     }
     catch (const std::exception& ex)
     {
@@ -6150,25 +8009,22 @@ void Application::SaveSettings() const
         return;
     }
 
-    const std::filesystem::path directory = settingsPath.parent_path();
-    std::error_code error;
-    if (!directory.empty() && !std::filesystem::exists(directory, error))
-    {
-        std::filesystem::create_directories(directory, error);
-        if (error)
-        {
-            std::cerr << "Unable to create settings directory: " << directory << '\n';
-            return;
-        }
-    }
+    settingsWriter_.Queue(settingsPath, SerializeSettings());
+    settingsWriter_.Flush();
+    launchHistoryWriter_.Flush();
+
+    directoryIndex_.SaveToFile(ResolveDirectoryIndexPath());
+}
 
+std::string Application::SerializeSettings() const
+{
     nlohmann::json document;
     document["theme"] = themeManager_.ActiveScheme().id;
     document["language"] = activeLanguageId_;
     nlohmann::json toggles = nlohmann::json::object();
-    for (const auto& [key, value] : basicToggleStates_)
+    for (const auto& descriptor : ui::kBasicToggleTable)
     {
-        toggles[key] = value;
+        toggles[std::string{descriptor.key}] = basicToggles_.Get(descriptor.toggle);
     }
     document["toggles"] = std::move(toggles);
 
@@ -6179,6 +8035,13 @@ void Application::SaveSettings() const
     }
     document["appearance"] = std::move(appearance);
 
+    nlohmann::json presentation = nlohmann::json::object();
+    presentation["mode"] = presentationMode_ == PresentationMode::Vsync ? "vsync"
+        : presentationMode_ == PresentationMode::CappedFps              ? "capped"
+                                                                        : "uncapped";
+    presentation["capFps"] = presentationCapFps_;
+    document["presentation"] = std::move(presentation);
+
     nlohmann::json customThemes = nlohmann::json::array();
     for (const auto& scheme : themeManager_.Schemes())
     {
@@ -6205,14 +8068,64 @@ void Application::SaveSettings() const
         document["customThemes"] = std::move(customThemes);
     }
 
-    std::ofstream output{settingsPath};
-    if (!output.is_open())
+    return document.dump(2) + '\n';
+}
+
+void Application::QueueSettingsSave()
+{
+    settingsSaveQueued_ = true;
+    settingsSaveQueuedAtSeconds_ = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+}
+
+void Application::PumpSettingsAutosave()
+{
+    if (!settingsSaveQueued_)
+    {
+        return;
+    }
+
+    const double nowSeconds = static_cast<double>(SDL_GetTicks64()) / 1000.0;
+    if (nowSeconds - settingsSaveQueuedAtSeconds_ < kSettingsSaveDelaySeconds)
     {
-        std::cerr << "Unable to write settings file: " << settingsPath << '\n';
         return;
     }
 
-    output << document.dump(2) << '\n';
+    settingsSaveQueued_ = false;
+    const std::filesystem::path settingsPath = ResolveSettingsPath();
+    if (!settingsPath.empty())
+    {
+        settingsWriter_.Queue(settingsPath, SerializeSettings());
+    }
+}
+
+void Application::PumpLaunchResults()
+{
+    for (auto& result : launchService_.TakeFinished())
+    {
+        if (!result.spawned)
+        {
+            UpdateStatusMessage("Failed to launch " + result.displayName + ": " + result.error);
+            continue;
+        }
+
+        char latencyText[48];
+        std::snprintf(latencyText, sizeof(latencyText), " (started in %.0f ms)", result.launchLatencyMs);
+        if (result.signalled)
+        {
+            UpdateStatusMessage(
+                result.displayName + " terminated by signal " + std::to_string(result.signalNumber) + latencyText);
+        }
+        else
+        {
+            UpdateStatusMessage(
+                result.displayName + " exited with code " + std::to_string(result.exitCode) + latencyText);
+        }
+
+        if (const auto viewIt = content_.views.find(result.programId); viewIt != content_.views.end())
+        {
+            viewIt->second.statusMessage = statusBuffer_;
+        }
+    }
 }
 
 std::filesystem::path Application::ResolveContentPath()
@@ -6282,6 +8195,65 @@ std::filesystem::path Application::ResolveSettingsPath() const
     return std::filesystem::path{kSettingsFileName};
 }
 
+std::filesystem::path Application::ResolveDirectoryIndexPath() const
+{
+    constexpr char kIndexFileName[] = "directory_index.cache";
+
+    const std::filesystem::path settingsPath = ResolveSettingsPath();
+    if (settingsPath.has_parent_path())
+    {
+        return settingsPath.parent_path() / kIndexFileName;
+    }
+
+    return std::filesystem::path{kIndexFileName};
+}
+
+std::filesystem::path Application::ResolveFontResolutionCachePath() const
+{
+    constexpr char kCacheFileName[] = "font_paths.cache";
+
+    const std::filesystem::path settingsPath = ResolveSettingsPath();
+    if (settingsPath.has_parent_path())
+    {
+        return settingsPath.parent_path() / kCacheFileName;
+    }
+
+    return std::filesystem::path{kCacheFileName};
+}
+
+std::filesystem::path Application::ResolveLocalizationBundlePath() const
+{
+    constexpr char kBundleFileName[] = "localization.bundle";
+
+    const std::filesystem::path settingsPath = ResolveSettingsPath();
+    if (settingsPath.has_parent_path())
+    {
+        return settingsPath.parent_path() / kBundleFileName;
+    }
+
+    return std::filesystem::path{kBundleFileName};
+}
+
+std::filesystem::path Application::ResolveLaunchHistoryPath() const
+{
+    constexpr char kHistoryFileName[] = "launch_history.json";
+
+    const std::filesystem::path settingsPath = ResolveSettingsPath();
+    if (settingsPath.has_parent_path())
+    {
+        return settingsPath.parent_path() / kHistoryFileName;
+    }
+
+    return std::filesystem::path{kHistoryFileName};
+}
+
+void Application::RecordProgramLaunch(const std::string& programId)
+{
+    launchHistory_.RecordLaunch(programId);
+    libraryViewModel_.SetRecencyOrder(launchHistory_.RecencyOrder());
+    launchHistoryWriter_.Queue(ResolveLaunchHistoryPath(), launchHistory_.Serialize());
+}
+
 bool Application::PointInRect(const SDL_Rect& rect, int x, int y) const
 {
     if (rect.w <= 0 || rect.h <= 0)
@@ -1,18 +1,41 @@
 #pragma once
 
+#include "app/directory_index.hpp"
+#include "app/directory_scanner.hpp"
+#include "app/frame_damage.hpp"
+#include "app/kinetic_scroll.hpp"
+#include "app/launch_history.hpp"
+#include "app/launch_service.hpp"
+#include "app/content_sync.hpp"
+#include "app/event_recorder.hpp"
+#include "app/metrics_server.hpp"
+#include "app/work_scheduler.hpp"
+#include "app/frame_profiler.hpp"
+#include "app/hub_search_index.hpp"
+#include "app/jank_recorder.hpp"
+#include "app/settings_writer.hpp"
 #include "controllers/navigation_controller.hpp"
 #include "core/content.hpp"
+#include "core/content_loader.hpp"
 #include "core/localization_manager.hpp"
+#include "core/program_index.hpp"
 #include "frontend/models/library_view_model.hpp"
-#include "frontend/utils/debounce.hpp"
+#include "frontend/utils/font_cache.hpp"
+#include "frontend/utils/icon_pipeline.hpp"
 #include "ui/hero_panel.hpp"
+#include "ui/hit_test_index.hpp"
 #include "ui/hub_panel.hpp"
 #include "ui/layout.hpp"
 #include "ui/library_panel.hpp"
 #include "ui/navigation.hpp"
+#include "ui/panel_cache.hpp"
 #include "ui/program_visuals.hpp"
 #include "ui/settings_panel.hpp"
 #include "ui/theme.hpp"
+#include "utils/drawing.hpp"
+#include "utils/font_fallback.hpp"
+#include "utils/font_manager.hpp"
+#include "utils/frame_arena.hpp"
 #include "utils/sdl_wrappers.hpp"
 #include "utils/text.hpp"
 #include "views/view_factory.hpp"
@@ -22,11 +45,15 @@
 #include <SDL2/SDL_ttf.h>
 
 #include <array>
+#include <chrono>
+#include <deque>
 #include <filesystem>
+#include <list>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace colony
@@ -47,32 +74,58 @@ class Application
         MainInterface
     };
 
+    // How frames are presented: synced to the display, paced to a fixed
+    // cap (battery kiosks), or unthrottled (VRR seats). Persisted in
+    // settings.json and cycled at runtime with F4.
+    enum class PresentationMode
+    {
+        Vsync,
+        CappedFps,
+        Uncapped
+    };
+
+    // Non-owning views into fontCache_, which deduplicates faces by
+    // (path, size) and owns every handle.
     struct FontResources
     {
-        sdl::FontHandle brand;
-        sdl::FontHandle navigation;
-        sdl::FontHandle channel;
-        sdl::FontHandle tileTitle;
-        sdl::FontHandle tileSubtitle;
-        sdl::FontHandle tileMeta;
-        sdl::FontHandle heroTitle;
-        sdl::FontHandle heroSubtitle;
-        sdl::FontHandle heroBody;
-        sdl::FontHandle patchTitle;
-        sdl::FontHandle patchBody;
-        sdl::FontHandle button;
-        sdl::FontHandle status;
+        TTF_Font* brand = nullptr;
+        TTF_Font* navigation = nullptr;
+        TTF_Font* channel = nullptr;
+        TTF_Font* tileTitle = nullptr;
+        TTF_Font* tileSubtitle = nullptr;
+        TTF_Font* tileMeta = nullptr;
+        TTF_Font* heroTitle = nullptr;
+        TTF_Font* heroSubtitle = nullptr;
+        TTF_Font* heroBody = nullptr;
+        TTF_Font* patchTitle = nullptr;
+        TTF_Font* patchBody = nullptr;
+        TTF_Font* button = nullptr;
+        TTF_Font* status = nullptr;
     };
 
     [[nodiscard]] bool InitializeSDL();
     [[nodiscard]] bool CreateWindowAndRenderer();
     [[nodiscard]] bool InitializeFonts();
     [[nodiscard]] bool LoadContent();
+    void PumpContentHotReload();
+    void ApplyReloadedContent(AppContent updated);
     [[nodiscard]] bool InitializeLocalization();
     void InitializeNavigation();
     void InitializeViews();
     void RebuildTheme();
+    // Rebuilds only the artifacts that consume localized strings; the fast
+    // path for a language switch that keeps the same font handles.
+    void RebuildLocalizedChrome();
+    void RefreshThemeDerivedColors();
+    void FinishCustomizationDrag();
     void RebuildProgramVisuals();
+    [[nodiscard]] ui::ProgramVisuals CreateProgramVisuals(const ViewContent& view);
+    ui::ProgramVisuals* EnsureProgramVisuals(const std::string& programId);
+    std::size_t RefreshProgramVisualsAccounting();
+    void PrewarmAdjacentProgramVisuals(int maxBuilds);
+    void PrefetchAdjacentChannelLists();
+    void RequestChannelShard(int index, WorkScheduler::Priority priority);
+    void ApplyChannelShard(const std::string& channelId, ChannelShard shard);
     void RebuildInteractionPalette();
     void ActivateChannel(int index);
     void ActivateProgram(const std::string& programId);
@@ -81,23 +134,54 @@ class Application
     int EnsureLocalAppsChannel();
     [[nodiscard]] std::string GetActiveProgramId() const;
     void HandleEvent(const SDL_Event& event, bool& running);
+    void DispatchPendingEvents(bool& running);
     void HandleMouseClick(int x, int y);
     void HandleMouseButtonUp(int x, int y);
     void HandleMouseMotion(const SDL_MouseMotionEvent& motion);
     void HandleMouseWheel(const SDL_MouseWheelEvent& wheel);
+    void UpdateScrollAnimations(double deltaSeconds);
     void HandleKeyDown(SDL_Keycode key);
     void HandleMouseRightClick(int x, int y);
+    void HandleWindowEvent(const SDL_WindowEvent& window);
+    // Resident (kiosk) mode: park keeps the process warm with the window
+    // hidden; summon re-shows it instantly on the hotkey daemon's signal.
+    void ParkResident();
+    void SummonFromResidentPark();
+    void TrimResidentMemory();
+    void RefreshDisplayDpi();
     bool HandleTextInput(const SDL_TextInputEvent& event);
     bool UpdateCustomizationValueFromPosition(const std::string& id, int mouseX);
     void RenderFrame(double deltaSeconds);
     void RenderHubFrame(double deltaSeconds);
     void RenderMainInterfaceFrame(double deltaSeconds);
+    void RenderProfilerHud();
+    void PublishMetricsIfDue();
+    void MaybeRecordJankIncident();
+    // Headless replay loop for COLONY_REPLAY_EVENTS; runs a recorded session
+    // at maximum speed and reports per-frame times and work counters.
+    int RunReplay(std::vector<EventRecorder::TimedEvent> events);
+    void ApplyPresentationMode();
+    void PacePresentation(std::chrono::steady_clock::time_point frameStart);
+    void PresentStartupSnapshot();
+    void UpdateStartupSnapshotFade(double deltaSeconds);
+    void ComposeStartupSnapshotOverlay();
+    void CaptureStartupSnapshotBeforePresent();
+    [[nodiscard]] std::filesystem::path ResolveStartupSnapshotPath() const;
+    void InvalidateFrame();
+    void InvalidateFrameRect(const SDL_Rect& rect);
+    [[nodiscard]] bool ShouldSkipIdleFrame(bool reduceMotion) const;
+    [[nodiscard]] bool IsReduceMotionEnabled() const;
     void UpdateStatusMessage(const std::string& statusText);
+    void FlushStatusMessageTexture();
     void UpdateViewContextAccent();
     void ChangeLanguage(const std::string& languageId);
     void LaunchArcadeApp();
     void LoadSettings();
     void SaveSettings() const;
+    [[nodiscard]] std::string SerializeSettings() const;
+    void QueueSettingsSave();
+    void PumpSettingsAutosave();
+    void PumpLaunchResults();
     bool SetAppearanceCustomizationValue(const std::string& id, float value);
     [[nodiscard]] float GetAppearanceCustomizationValue(std::string_view id) const;
     void ApplyInterfaceDensity() const;
@@ -112,8 +196,7 @@ class Application
     void ActivateHubBranchByIndex(int index);
     [[nodiscard]] int FindHubBranchIndexById(const std::string& branchId) const;
     void ResetHubInteractionState();
-    [[nodiscard]] std::string NormalizeHubSearchString(std::string_view value) const;
-    [[nodiscard]] std::vector<std::string> TokenizeHubSearch(std::string_view value) const;
+    void RebuildHubCatalog();
     void EnsureHubScrollWithinBounds();
     void FocusHubSearch();
     void ClearHubSearchQuery();
@@ -125,12 +208,20 @@ class Application
     [[nodiscard]] static std::filesystem::path ResolveContentPath();
     [[nodiscard]] static std::filesystem::path ResolveLocalizationDirectory();
     [[nodiscard]] std::filesystem::path ResolveSettingsPath() const;
+    [[nodiscard]] std::filesystem::path ResolveDirectoryIndexPath() const;
+    [[nodiscard]] std::filesystem::path ResolveFontResolutionCachePath() const;
+    [[nodiscard]] std::filesystem::path ResolveLocalizationBundlePath() const;
+    [[nodiscard]] std::filesystem::path ResolveLaunchHistoryPath() const;
+    void RecordProgramLaunch(const std::string& programId);
     [[nodiscard]] bool PointInRect(const SDL_Rect& rect, int x, int y) const;
     [[nodiscard]] std::string GetLocalizedString(std::string_view key) const;
     [[nodiscard]] std::string GetLocalizedString(std::string_view key, std::string_view fallback) const;
     void ShowAddAppDialog();
     void HideAddAppDialog();
     void RefreshAddAppDialogEntries();
+    void PumpAddAppDialogScan();
+    void PumpFontDownload();
+    void RebuildAddAppDialogEntryList();
     void RenderAddAppDialog(double timeSeconds);
     bool HandleAddAppDialogMouseClick(int x, int y);
     bool HandleAddAppDialogMouseWheel(const SDL_MouseWheelEvent& wheel);
@@ -170,9 +261,29 @@ class Application
     sdl::WindowHandle window_;
     sdl::RendererHandle renderer_;
     FontResources fonts_;
-    std::unordered_map<std::string, sdl::FontHandle> languageFonts_;
+    frontend::fonts::FontCache fontCache_;
+    fonts::FontDownloadTask fontDownloadTask_;
+    mutable SettingsWriter settingsWriter_;
+    LaunchService launchService_;
+    LaunchHistory launchHistory_;
+    // Separate writer so a queued history payload never displaces a pending
+    // settings payload (each writer keeps only its latest).
+    mutable SettingsWriter launchHistoryWriter_;
+    bool settingsSaveQueued_ = false;
+    double settingsSaveQueuedAtSeconds_ = 0.0;
+    std::unordered_map<std::string, TTF_Font*> languageFonts_;
+    // Status font first, then every loaded language face: catalog-supplied
+    // status strings can carry scripts the UI font does not cover. Rebuilt
+    // alongside the fonts in InitializeFonts.
+    FontFallbackChain statusFallbackChain_;
 
     AppContent content_;
+    // Hot-reload watch state for the content file: the run loop polls the
+    // mtime at a low rate and hands re-parsing to the work scheduler, so an
+    // edited catalog lands without restarting the seat.
+    std::filesystem::file_time_type contentWriteTime_{};
+    double contentWatchedAtSeconds_ = 0.0;
+    bool contentReloadInFlight_ = false;
     LocalizationManager localizationManager_{};
     ui::ThemeManager themeManager_;
     ui::ThemeColors theme_{};
@@ -187,10 +298,25 @@ class Application
     ui::HubPanelRenderer hubPanel_;
     ui::SettingsPanel settingsPanel_;
 
+    // Decodes library cover art off-thread and packs it into shared atlas
+    // pages; the library panel requests and resolves regions per tile.
+    frontend::icons::IconArtPipeline iconArtPipeline_;
+
     std::unordered_map<std::string, ui::ProgramVisuals> programVisuals_;
+    std::list<std::string> programVisualsLru_; // Front is most recently used.
+    std::size_t accountedProgramVisualsBytes_ = 0;
     frontend::models::LibraryViewModel libraryViewModel_{};
     std::vector<int> channelSelections_;
     int activeChannelIndex_ = 0;
+    // The channel the user came from; it is the most likely back-switch
+    // target, so the idle prefetcher keeps its list warm too.
+    int previousChannelIndex_ = -1;
+    // Program visuals queued by the channel prefetcher, rasterized at most
+    // one per frame so warming never costs a visible hitch.
+    std::deque<std::string> queuedVisualPrewarms_;
+    // Channel ids whose catalog shard is being parsed off-thread; guards
+    // against double-submitting a load while the first is still running.
+    std::unordered_set<std::string> channelShardLoadsInFlight_;
     std::string activeProgramId_;
     InterfaceState interfaceState_ = InterfaceState::Hub;
 
@@ -216,8 +342,15 @@ class Application
         int initialLibraryWidth = 0;
     } resizeState_{};
 
+    FrameArena frameArena_;
+    ui::LibraryRenderResult libraryRenderResult_;
+    ui::HubRenderResult hubRenderResult_;
+    ui::PanelTargetCache navRailCache_;
+    ui::PanelTargetCache topBarCache_;
+    ui::PanelTargetCache libraryPanelCache_;
     std::vector<SDL_Rect> channelButtonRects_;
     std::vector<SDL_Rect> programTileRects_;
+    ui::HitTestIndex programTileHitIndex_;
     std::optional<SDL_Rect> addAppButtonRect_;
     std::optional<SDL_Rect> libraryFilterInputRect_;
     std::vector<ui::LibraryRenderResult::SortChipHitbox> librarySortChipHitboxes_;
@@ -227,7 +360,18 @@ class Application
     int hoveredHubBranchIndex_ = -1;
     int focusedHubBranchIndex_ = -1;
     std::vector<std::string> hubRenderedBranchIds_;
-    std::vector<std::string> hubSearchTokens_;
+
+    // Localized hub content, prebuilt once per language/theme change so a
+    // search keystroke only filters and never relocalizes.
+    struct HubCatalog
+    {
+        ui::HubContent base;
+        std::vector<ui::HubBranchContent> branches;
+        std::vector<std::string> branchIds;
+    };
+    HubCatalog hubCatalog_;
+    bool hubCatalogValid_ = false;
+    HubSearchIndex hubSearchIndex_;
     int hubScrollOffset_ = 0;
     int hubScrollMaxOffset_ = 0;
     SDL_Rect hubScrollViewport_{0, 0, 0, 0};
@@ -245,16 +389,18 @@ class Application
     std::vector<ui::HubRenderResult::WidgetPagerHitbox> hubWidgetPagerHitboxes_;
     ui::SettingsPanel::RenderResult settingsRenderResult_{};
     int settingsScrollOffset_ = 0;
+    KineticScroll settingsScrollAnimation_;
+    KineticScroll sectionsScrollAnimation_;
+    // Program whose section list the kinetic animation is driving; switching
+    // programs drops the motion instead of carrying it across views.
+    std::string sectionsScrollProgramId_;
     ui::SettingsPanel::SectionStates settingsSectionStates_{};
     std::optional<std::string> pendingSettingsSectionId_{};
     std::optional<std::string> activeCustomizationDragId_{};
+    bool themeRebuildPendingAfterDrag_ = false;
     std::string activeLanguageId_ = "en";
-    std::unordered_map<std::string, bool> basicToggleStates_{
-        {"notifications", true},
-        {"sound", true},
-        {"auto_updates", true},
-        {"reduced_motion", false},
-    };
+    // Typed toggle state; ids and defaults come from ui::kBasicToggleTable.
+    ui::BasicToggleSettings basicToggles_;
     std::unordered_map<std::string, float> appearanceCustomizationValues_{
         {"accent_intensity", 0.5f},
         {"background_depth", 0.5f},
@@ -263,7 +409,6 @@ class Application
 
     std::string libraryFilterDraft_;
     bool libraryFilterFocused_ = false;
-    frontend::utils::Debouncer libraryFilterDebouncer_{0.2};
 
     struct AddAppDialogState
     {
@@ -301,8 +446,28 @@ class Application
         int filterDropdownOptionHeight = 0;
         int filterDropdownOptionCount = 0;
         std::vector<SDL_Rect> filterDropdownOptionRects;
+
+        // Raw entries streamed in from the background scanner; the visible
+        // entry list is rebuilt from them as each batch arrives.
+        std::vector<colony::DirectoryScanner::Entry> rawEntries;
+        bool scanComplete = false;
+        bool globalSearch = false;
+        std::string normalizedSearchFilter;
+        std::string scanErrorMessage;
+        std::filesystem::path pendingSelectionPath;
+        std::filesystem::path scanDirectory;
+        int preservedScrollOffset = 0;
     } addAppDialog_{};
 
+    // Retained row textures for the Add App listing, keyed by entry path.
+    // Rows re-render only when their selection state or size changes;
+    // scrolling just re-blits. Cleared on refresh, close and theme rebuilds.
+    std::unordered_map<std::string, ui::RowTargetCache> addAppRowCaches_;
+
+    // Command buffer reused across dialog row renders; its scratch vectors
+    // keep their capacity, so steady-state recording never allocates.
+    drawing::DrawList dialogDrawList_;
+
     struct EditAppDialogState
     {
         bool visible = false;
@@ -339,21 +504,76 @@ class Application
         SDL_Rect cancelButtonRect{0, 0, 0, 0};
     } customThemeDialog_{};
 
+    // Retained textures for the custom theme field rows (label, field box,
+    // swatch and hex value). A row redraws only when its draft value, focus
+    // state or layout changes, so typing into one hex field touches one row.
+    // Cleared on dialog close and theme rebuilds; the blinking caret is drawn
+    // immediate-mode on top of the cached row.
+    std::array<ui::RowTargetCache, CustomThemeDialogState::kColorFieldCount> customThemeFieldCaches_{};
+
     NavigationController navigationController_;
     ViewRegistry viewRegistry_;
     ViewFactory viewFactory_;
     RenderContext viewContext_{};
     std::string statusBuffer_;
+    // Set by UpdateStatusMessage, cleared by FlushStatusMessageTexture;
+    // rapid successive updates coalesce into one rasterization per frame.
+    bool statusTextureDirty_ = false;
+
+    // Last session's final frame, splashed up before initialization and
+    // cross-faded out once the live UI renders. Empty when no snapshot was
+    // on disk.
+    sdl::TextureHandle startupSnapshot_;
+    double startupSnapshotFadeSeconds_ = 0.0;
+    // Arms the pre-present readback that writes next launch's snapshot.
+    bool captureStartupSnapshotOnPresent_ = false;
 
     double animationTimeSeconds_ = 0.0;
     Uint64 lastFrameCounter_ = 0;
-
-    std::vector<std::string> programTileProgramIds_;
+    DamageTracker frameDamage_;
+    bool windowVisible_ = true;
+    // COLONY_RESIDENT: closing the window parks instead of exiting.
+    bool residentMode_ = false;
+    bool residentParked_ = false;
+    // Display the window was last seen on; -1 until the first DPI query.
+    int windowDisplayIndex_ = -1;
+    // Set by SDL_WINDOWEVENT_SIZE_CHANGED and cleared once no size event has
+    // arrived for the settle interval. While set, panels stretch-blit their
+    // cached textures and views defer wrap-width texture rebuilds.
+    bool interactiveResizeActive_ = false;
+    Uint64 lastResizeEventAtTicks_ = 0;
+    FrameProfiler frameProfiler_;
+    JankRecorder jankRecorder_;
+    EventRecorder eventRecorder_;
+    // Over-budget frames get captured; twice the display's refresh interval
+    // by default, COLONY_JANK_BUDGET_MS overrides. Zero disables capture.
+    double jankBudgetMs_ = 0.0;
+    PresentationMode presentationMode_ = PresentationMode::Vsync;
+    int presentationCapFps_ = 60;
+    FrameProfiler::Summary profilerHudSummary_{};
+    double profilerHudRefreshedAtSeconds_ = 0.0;
+    bool profilerHudVisible_ = false;
+    MetricsServer metricsServer_;
+    double metricsPublishedAtSeconds_ = 0.0;
+    // Replaces the content file from a configured URL; the hot-reload
+    // watcher applies whatever it writes.
+    ContentSyncService contentSync_;
+    double contentLoadMs_ = 0.0;
+
+    ProgramIndex programIndex_;
+    DirectoryScanner addAppScanner_;
+    DirectoryIndex directoryIndex_;
+    std::vector<ProgramHandle> programTileHandles_;
     bool textInputActive_ = false;
 
     std::unordered_map<std::string, std::filesystem::path> userAppExecutables_;
     int nextCustomProgramId_ = 1;
 
+    // Declared after the state its tasks read: destruction joins the worker
+    // pool before any of that state goes away.
+    WorkScheduler workScheduler_;
+
+    static constexpr std::size_t kMaxResidentProgramVisuals = 64;
     static constexpr int kWindowWidth = 1600;
     static constexpr int kWindowHeight = 900;
     static constexpr int kStatusBarHeight = 52;
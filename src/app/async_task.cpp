@@ -0,0 +1,134 @@
+#include "app/async_task.hpp"
+
+#include "cpp-httplib/httplib.h"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+namespace colony
+{
+namespace
+{
+
+std::optional<std::string> ReadFileBlocking(const std::filesystem::path& path)
+{
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream.is_open())
+    {
+        return std::nullopt;
+    }
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    if (stream.bad())
+    {
+        return std::nullopt;
+    }
+    return buffer.str();
+}
+
+std::optional<std::string> HttpGetBlocking(const std::string& url, const CancellationToken& token, int timeoutSeconds)
+{
+    const auto protocolSeparator = url.find("://");
+    if (protocolSeparator == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    const std::string scheme = url.substr(0, protocolSeparator);
+    std::string remainder = url.substr(protocolSeparator + 3);
+    const auto pathSeparator = remainder.find('/');
+    std::string host;
+    std::string path = "/";
+    if (pathSeparator == std::string::npos)
+    {
+        host = std::move(remainder);
+    }
+    else
+    {
+        host = remainder.substr(0, pathSeparator);
+        path = remainder.substr(pathSeparator);
+        if (path.empty())
+        {
+            path = "/";
+        }
+    }
+
+    std::unique_ptr<httplib::Client> client;
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+    if (scheme == "https" || scheme == "http")
+    {
+        client = std::make_unique<httplib::Client>(scheme + "://" + host);
+    }
+    else
+    {
+        return std::nullopt;
+    }
+#else
+    if (scheme != "http")
+    {
+        return std::nullopt;
+    }
+    client = std::make_unique<httplib::Client>(host);
+#endif
+
+    client->set_follow_location(true);
+    client->set_read_timeout(timeoutSeconds, 0);
+    client->set_connection_timeout(timeoutSeconds, 0);
+
+    if (token.IsCancelled())
+    {
+        return std::nullopt;
+    }
+
+    const auto response = client->Get(path.c_str());
+    if (!response || response->status >= 400)
+    {
+        return std::nullopt;
+    }
+    return response->body;
+}
+
+} // namespace
+
+Task<std::optional<std::string>> ReadFileAsync(
+    WorkScheduler& scheduler, std::filesystem::path path, CancellationToken token)
+{
+    auto bytes = co_await RunOnWorker(
+        scheduler,
+        WorkScheduler::Priority::Normal,
+        [path = std::move(path), token]() -> std::optional<std::string> {
+            if (token.IsCancelled())
+            {
+                return std::nullopt;
+            }
+            return ReadFileBlocking(path);
+        });
+    if (token.IsCancelled())
+    {
+        co_return std::nullopt;
+    }
+    co_return bytes;
+}
+
+Task<std::optional<std::string>> HttpGetAsync(
+    WorkScheduler& scheduler, std::string url, CancellationToken token, int timeoutSeconds)
+{
+    auto body = co_await RunOnWorker(
+        scheduler,
+        WorkScheduler::Priority::Normal,
+        [url = std::move(url), token, timeoutSeconds]() -> std::optional<std::string> {
+            if (token.IsCancelled())
+            {
+                return std::nullopt;
+            }
+            return HttpGetBlocking(url, token, timeoutSeconds);
+        });
+    if (token.IsCancelled())
+    {
+        co_return std::nullopt;
+    }
+    co_return body;
+}
+
+} // namespace colony
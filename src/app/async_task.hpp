@@ -0,0 +1,332 @@
+#pragma once
+
+#include "app/work_scheduler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace colony
+{
+
+// Coroutine layer over WorkScheduler for async features that need
+// cancellation, a main-thread continuation and a timeout — directory scans,
+// content sync, icon decode, prefetch. The contract that keeps it simple:
+// coroutine bodies only ever run on the UI thread. Awaiting RunOnWorker
+// ships a plain function to the pool and parks the coroutine; the resumption
+// rides the scheduler's completion queue and lands at the fixed drain point
+// in RenderFrame, like every other background result. With every resumption
+// on one thread, tasks compose without locks.
+
+namespace detail
+{
+
+struct CancellationState
+{
+    std::atomic<bool> cancelled{false};
+    // steady_clock rep of the deadline; zero means no timeout is armed.
+    std::atomic<std::chrono::steady_clock::rep> deadline{0};
+};
+
+} // namespace detail
+
+// Cooperative cancellation. Cheap to copy; workers and coroutines poll
+// IsCancelled at their natural checkpoints. A deadline arms a timeout
+// through the same token, so "cancelled" and "timed out" share one code
+// path on the consuming side.
+class CancellationToken
+{
+  public:
+    CancellationToken() = default;
+    explicit CancellationToken(std::shared_ptr<const detail::CancellationState> state) noexcept
+        : state_{std::move(state)}
+    {
+    }
+
+    [[nodiscard]] bool IsCancelled() const noexcept
+    {
+        if (!state_)
+        {
+            return false;
+        }
+        if (state_->cancelled.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        const auto deadline = state_->deadline.load(std::memory_order_relaxed);
+        return deadline != 0 && std::chrono::steady_clock::now().time_since_epoch().count() >= deadline;
+    }
+
+  private:
+    std::shared_ptr<const detail::CancellationState> state_;
+};
+
+class CancellationSource
+{
+  public:
+    CancellationSource() : state_{std::make_shared<detail::CancellationState>()} {}
+
+    void RequestCancel() noexcept { state_->cancelled.store(true, std::memory_order_relaxed); }
+
+    // Arms a timeout: the token reads as cancelled once the duration passes.
+    void CancelAfter(std::chrono::steady_clock::duration duration) noexcept
+    {
+        state_->deadline.store(
+            (std::chrono::steady_clock::now() + duration).time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] CancellationToken Token() const noexcept { return CancellationToken{state_}; }
+
+  private:
+    std::shared_ptr<detail::CancellationState> state_;
+};
+
+namespace detail
+{
+
+// Splits the value/void difference out of the promise so Task<T> itself
+// needs no specialization.
+template <typename T>
+struct TaskPromiseStorage
+{
+    std::optional<T> value;
+    void return_value(T result) { value = std::move(result); }
+    [[nodiscard]] T TakeResult() { return std::move(*value); }
+};
+
+template <>
+struct TaskPromiseStorage<void>
+{
+    void return_void() noexcept {}
+    void TakeResult() noexcept {}
+};
+
+} // namespace detail
+
+// Lazy coroutine task. Awaiting one starts it and resumes the awaiter when
+// it finishes (symmetric transfer, no queue hop); root tasks are started and
+// kept alive by an AsyncScope instead. Exceptions propagate to the awaiter
+// when the result is consumed, the same as a synchronous call.
+template <typename T>
+class [[nodiscard]] Task
+{
+  public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(Handle handle) const noexcept
+        {
+            promise_type& promise = handle.promise();
+            if (promise.continuation)
+            {
+                return promise.continuation;
+            }
+            if (promise.onDone)
+            {
+                // Root task: the callback reaps the frame, so it must be the
+                // last thing here that touches it.
+                const auto onDone = std::move(promise.onDone);
+                onDone();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type : detail::TaskPromiseStorage<T>
+    {
+        std::coroutine_handle<> continuation;
+        // Set by AsyncScope on root tasks; runs at completion in place of a
+        // continuation and owns destroying the frame.
+        std::function<void()> onDone;
+        std::exception_ptr exception;
+
+        Task get_return_object() { return Task{Handle::from_promise(*this)}; }
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+        [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+        void unhandled_exception() { exception = std::current_exception(); }
+    };
+
+    Task() = default;
+    explicit Task(Handle handle) noexcept : handle_{handle} {}
+    Task(Task&& other) noexcept : handle_{std::exchange(other.handle_, nullptr)} {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    // Detaches the frame; the caller (AsyncScope) becomes responsible for
+    // destroying it.
+    [[nodiscard]] Handle Release() noexcept { return std::exchange(handle_, nullptr); }
+
+    [[nodiscard]] auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            Handle handle;
+
+            [[nodiscard]] bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> parent) const noexcept
+            {
+                handle.promise().continuation = parent;
+                return handle;
+            }
+
+            T await_resume() const
+            {
+                if (handle.promise().exception)
+                {
+                    std::rethrow_exception(handle.promise().exception);
+                }
+                return handle.promise().TakeResult();
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+  private:
+    Handle handle_ = nullptr;
+};
+
+// Owns running root coroutines. Launch starts a task and keeps its frame
+// alive until it finishes; completion callbacks run on the UI thread like
+// everything else in this layer, so the scope needs no lock. The owner must
+// outlive its tasks — cancel and drain before destroying a scope, the same
+// discipline the worker pools already follow.
+class AsyncScope
+{
+  public:
+    void Launch(Task<void> task)
+    {
+        auto handle = task.Release();
+        if (!handle)
+        {
+            return;
+        }
+        active_.insert(handle.address());
+        handle.promise().onDone = [this, address = handle.address()]() {
+            active_.erase(address);
+            std::coroutine_handle<>::from_address(address).destroy();
+        };
+        handle.resume();
+    }
+
+    [[nodiscard]] std::size_t ActiveCount() const noexcept { return active_.size(); }
+
+  private:
+    std::unordered_set<void*> active_;
+};
+
+// Awaitable that runs work on a pool thread at the given priority and
+// resumes the coroutine on the UI thread through the completion queue. The
+// work callable must not touch SDL or UI state — same rule as a raw
+// WorkScheduler task.
+template <typename Fn>
+[[nodiscard]] auto RunOnWorker(WorkScheduler& scheduler, WorkScheduler::Priority priority, Fn work)
+{
+    using Result = std::invoke_result_t<Fn>;
+
+    struct Awaiter
+    {
+        WorkScheduler& scheduler;
+        WorkScheduler::Priority priority;
+        Fn work;
+        // The awaiter lives in the suspended coroutine frame, so the worker
+        // can write the result straight into it.
+        std::optional<std::conditional_t<std::is_void_v<Result>, std::nullptr_t, Result>> result;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            scheduler.Submit(priority, [this, handle]() -> WorkScheduler::Completion {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    work();
+                }
+                else
+                {
+                    result = work();
+                }
+                return [handle] { handle.resume(); };
+            });
+        }
+
+        Result await_resume()
+        {
+            if constexpr (!std::is_void_v<Result>)
+            {
+                return std::move(*result);
+            }
+        }
+    };
+
+    return Awaiter{scheduler, priority, std::move(work), {}};
+}
+
+// Parks the coroutine until the next completion drain. Everything in this
+// layer already resumes on the UI thread; awaiting this spreads a long
+// UI-thread task across frames instead of blocking one.
+[[nodiscard]] inline auto ResumeOnMain(WorkScheduler& scheduler)
+{
+    struct Awaiter
+    {
+        WorkScheduler& scheduler;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const
+        {
+            scheduler.PostCompletion([handle] { handle.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{scheduler};
+}
+
+// Reads a file on a pool thread. Returns nullopt when the file cannot be
+// read or the token fires; a cancellation observed after the read completes
+// still drops the bytes, so callers never apply stale results.
+[[nodiscard]] Task<std::optional<std::string>> ReadFileAsync(
+    WorkScheduler& scheduler, std::filesystem::path path, CancellationToken token);
+
+// Fetches a URL body on a pool thread, following the httplib client pattern
+// the font downloader uses. timeoutSeconds bounds both connect and read;
+// returns nullopt on any transport or HTTP error, cancellation or timeout.
+[[nodiscard]] Task<std::optional<std::string>> HttpGetAsync(
+    WorkScheduler& scheduler, std::string url, CancellationToken token, int timeoutSeconds = 20);
+
+} // namespace colony
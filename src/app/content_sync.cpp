@@ -0,0 +1,231 @@
+#include "app/content_sync.hpp"
+
+#include "cpp-httplib/httplib.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+namespace colony
+{
+namespace
+{
+
+// Floor on the poll period: anything faster would hammer the share for a
+// catalog that changes a few times a day at most.
+constexpr double kMinimumIntervalSeconds = 5.0;
+constexpr double kDefaultIntervalSeconds = 300.0;
+
+// Reads the whole file, or an empty string when it does not exist. Used to
+// skip the rename (and the hot reload it would trigger) when the fetched
+// body matches what is already on disk.
+std::string ReadFileOrEmpty(const std::filesystem::path& path)
+{
+    std::ifstream input{path, std::ios::binary};
+    if (!input.is_open())
+    {
+        return {};
+    }
+    std::ostringstream buffer;
+    buffer << input.rdbuf();
+    return std::move(buffer).str();
+}
+
+} // namespace
+
+ContentSyncService::~ContentSyncService()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (syncThread_.joinable())
+    {
+        syncThread_.join();
+    }
+}
+
+bool ContentSyncService::StartFromEnvironment(std::filesystem::path destination)
+{
+    const char* urlText = std::getenv("COLONY_CONTENT_SYNC_URL");
+    if (urlText == nullptr || *urlText == '\0')
+    {
+        return false;
+    }
+
+    const std::string url{urlText};
+    const auto schemeEnd = url.find("://");
+    if (schemeEnd == std::string::npos)
+    {
+        std::cerr << "Ignoring invalid COLONY_CONTENT_SYNC_URL value: " << url << '\n';
+        return false;
+    }
+    scheme_ = url.substr(0, schemeEnd);
+    std::string remainder = url.substr(schemeEnd + 3);
+    const auto pathSeparator = remainder.find('/');
+    if (pathSeparator == std::string::npos)
+    {
+        host_ = std::move(remainder);
+        path_ = "/";
+    }
+    else
+    {
+        host_ = remainder.substr(0, pathSeparator);
+        path_ = remainder.substr(pathSeparator);
+    }
+    if (host_.empty() || (scheme_ != "http" && scheme_ != "https"))
+    {
+        std::cerr << "Ignoring invalid COLONY_CONTENT_SYNC_URL value: " << url << '\n';
+        return false;
+    }
+
+    if (const char* intervalText = std::getenv("COLONY_CONTENT_SYNC_INTERVAL");
+        intervalText != nullptr && *intervalText != '\0')
+    {
+        char* end = nullptr;
+        const double interval = std::strtod(intervalText, &end);
+        if (end == intervalText || *end != '\0' || interval < kMinimumIntervalSeconds)
+        {
+            std::cerr << "Ignoring invalid COLONY_CONTENT_SYNC_INTERVAL value: " << intervalText << '\n';
+        }
+        else
+        {
+            intervalSeconds_ = interval;
+        }
+    }
+    else
+    {
+        intervalSeconds_ = kDefaultIntervalSeconds;
+    }
+
+    destination_ = std::move(destination);
+    enabled_ = true;
+    syncThread_ = std::thread{&ContentSyncService::SyncLoop, this};
+    return true;
+}
+
+void ContentSyncService::SyncLoop()
+{
+    // First fetch immediately so a seat started after a catalog push
+    // converges without waiting a full interval.
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (stopping_)
+            {
+                return;
+            }
+        }
+
+        FetchOnce();
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        wake_.wait_for(lock, std::chrono::duration<double>(intervalSeconds_), [this]() { return stopping_; });
+        if (stopping_)
+        {
+            return;
+        }
+    }
+}
+
+void ContentSyncService::FetchOnce()
+{
+    std::unique_ptr<httplib::Client> client;
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+    client = std::make_unique<httplib::Client>(scheme_ + "://" + host_);
+#else
+    if (scheme_ != "http")
+    {
+        if (!lastFetchFailed_)
+        {
+            std::cerr << "Content sync: https requires an OpenSSL-enabled build." << '\n';
+        }
+        lastFetchFailed_ = true;
+        return;
+    }
+    client = std::make_unique<httplib::Client>(host_);
+#endif
+
+    client->set_follow_location(true);
+    client->set_connection_timeout(20, 0);
+    client->set_read_timeout(20, 0);
+
+    httplib::Headers headers;
+    if (!etag_.empty())
+    {
+        headers.emplace("If-None-Match", etag_);
+    }
+    if (!lastModified_.empty())
+    {
+        headers.emplace("If-Modified-Since", lastModified_);
+    }
+
+    const auto response = client->Get(path_.c_str(), headers);
+    if (!response || (response->status != 200 && response->status != 304))
+    {
+        // Log on the edge into failure only; a share that is down for an
+        // hour should not write a line every poll.
+        if (!lastFetchFailed_)
+        {
+            std::cerr << "Content sync fetch failed"
+                      << (response ? " with status " + std::to_string(response->status) : "") << '\n';
+        }
+        lastFetchFailed_ = true;
+        return;
+    }
+    lastFetchFailed_ = false;
+
+    if (response->status == 304)
+    {
+        return;
+    }
+
+    etag_ = response->get_header_value("ETag");
+    lastModified_ = response->get_header_value("Last-Modified");
+
+    // Servers without validator support return 200 every poll; comparing
+    // against the file keeps those from triggering a reload per interval.
+    if (response->body == ReadFileOrEmpty(destination_))
+    {
+        return;
+    }
+
+    // Temp-and-rename so the hot-reload watcher can never observe a torn
+    // document; the rename bumps the mtime it polls.
+    const std::filesystem::path temporary = destination_.string() + ".sync-tmp";
+    {
+        std::ofstream output{temporary, std::ios::binary | std::ios::trunc};
+        if (!output.is_open())
+        {
+            std::cerr << "Content sync: failed to open " << temporary << " for writing." << '\n';
+            return;
+        }
+        output.write(response->body.data(), static_cast<std::streamsize>(response->body.size()));
+        if (!output.good())
+        {
+            output.close();
+            std::error_code removeEc;
+            std::filesystem::remove(temporary, removeEc);
+            std::cerr << "Content sync: failed to write " << temporary << '\n';
+            return;
+        }
+    }
+
+    std::error_code renameEc;
+    std::filesystem::rename(temporary, destination_, renameEc);
+    if (renameEc)
+    {
+        std::error_code removeEc;
+        std::filesystem::remove(temporary, removeEc);
+        std::cerr << "Content sync: failed to replace " << destination_ << ": " << renameEc.message() << '\n';
+    }
+}
+
+} // namespace colony
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace colony
+{
+
+// Opt-in background catalog sync for fleet seats. When the
+// COLONY_CONTENT_SYNC_URL environment variable holds an http(s) URL, a
+// background thread periodically issues a conditional GET (If-None-Match /
+// If-Modified-Since from the previous response) and, when the catalog
+// actually changed, writes the new document next to the running content file
+// via temp-and-rename. The hot-reload watcher then picks it up and the
+// existing diff path applies only the views that changed — no restart, and
+// bandwidth proportional to change frequency, not catalog size.
+//
+// The sync thread never touches application state; its only output is the
+// atomically replaced file.
+class ContentSyncService
+{
+  public:
+    ContentSyncService() = default;
+    ~ContentSyncService();
+
+    ContentSyncService(const ContentSyncService&) = delete;
+    ContentSyncService& operator=(const ContentSyncService&) = delete;
+
+    // Starts syncing destination from COLONY_CONTENT_SYNC_URL if set.
+    // COLONY_CONTENT_SYNC_INTERVAL overrides the poll period in seconds.
+    // Returns whether the service is running; a malformed URL logs and
+    // leaves the application running unsynced, as if the variable were
+    // unset.
+    bool StartFromEnvironment(std::filesystem::path destination);
+
+    [[nodiscard]] bool Enabled() const noexcept { return enabled_; }
+
+  private:
+    void SyncLoop();
+    void FetchOnce();
+
+    std::filesystem::path destination_;
+    std::string scheme_;
+    std::string host_;
+    std::string path_ = "/";
+    double intervalSeconds_ = 300.0;
+
+    // Validators from the previous 200 response; sent back so an unchanged
+    // catalog costs a 304 and no body.
+    std::string etag_;
+    std::string lastModified_;
+    bool lastFetchFailed_ = false;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+    bool enabled_ = false;
+    std::thread syncThread_;
+};
+
+} // namespace colony
@@ -0,0 +1,259 @@
+#include "app/directory_index.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+namespace colony
+{
+namespace
+{
+constexpr std::uint32_t kIndexMagic = 0x49444C43; // "CLDI"
+constexpr std::uint32_t kIndexFormatVersion = 1;
+
+constexpr std::uint8_t kFlagIsDirectory = 1u << 0;
+constexpr std::uint8_t kFlagHasWriteTime = 1u << 1;
+constexpr std::uint8_t kFlagIsExecutable = 1u << 2;
+constexpr std::uint8_t kFlagHasExecutableInfo = 1u << 3;
+
+void WriteU32(std::ofstream& output, std::uint32_t value)
+{
+    output.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteU64(std::ofstream& output, std::uint64_t value)
+{
+    output.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteI64(std::ofstream& output, std::int64_t value)
+{
+    output.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteString(std::ofstream& output, const std::string& value)
+{
+    WriteU64(output, static_cast<std::uint64_t>(value.size()));
+    output.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+bool ReadU32(std::ifstream& input, std::uint32_t& value)
+{
+    input.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return input.good();
+}
+
+bool ReadU64(std::ifstream& input, std::uint64_t& value)
+{
+    input.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return input.good();
+}
+
+bool ReadI64(std::ifstream& input, std::int64_t& value)
+{
+    input.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return input.good();
+}
+
+bool ReadU8(std::ifstream& input, std::uint8_t& value)
+{
+    input.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return input.good();
+}
+
+bool ReadString(std::ifstream& input, std::string& value)
+{
+    std::uint64_t length = 0;
+    if (!ReadU64(input, length))
+    {
+        return false;
+    }
+    // Reject absurd lengths instead of trying to allocate them; a corrupt
+    // index is discarded wholesale.
+    if (length > (1ull << 20))
+    {
+        return false;
+    }
+    value.resize(static_cast<std::size_t>(length));
+    input.read(value.data(), static_cast<std::streamsize>(length));
+    return input.good();
+}
+
+std::int64_t ToTimestamp(std::filesystem::file_time_type time)
+{
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+}
+
+std::filesystem::file_time_type FromTimestamp(std::int64_t value)
+{
+    return std::filesystem::file_time_type{
+        std::filesystem::file_time_type::duration{static_cast<std::filesystem::file_time_type::rep>(value)}};
+}
+
+} // namespace
+
+const std::vector<DirectoryScanner::Entry>* DirectoryIndex::Lookup(const std::filesystem::path& directory) const
+{
+    const auto it = snapshots_.find(directory.string());
+    if (it == snapshots_.end())
+    {
+        return nullptr;
+    }
+
+    std::error_code timeError;
+    const auto currentMtime = std::filesystem::last_write_time(directory, timeError);
+    if (timeError || currentMtime != it->second.directoryMtime)
+    {
+        return nullptr;
+    }
+
+    return &it->second.entries;
+}
+
+void DirectoryIndex::Store(const std::filesystem::path& directory, std::vector<DirectoryScanner::Entry> entries)
+{
+    std::error_code timeError;
+    const auto directoryMtime = std::filesystem::last_write_time(directory, timeError);
+    if (timeError)
+    {
+        return;
+    }
+
+    std::string key = directory.string();
+    if (snapshots_.find(key) == snapshots_.end() && snapshots_.size() >= kMaxIndexedDirectories)
+    {
+        snapshots_.erase(snapshots_.begin());
+    }
+
+    auto& snapshot = snapshots_[std::move(key)];
+    snapshot.directoryMtime = directoryMtime;
+    snapshot.entries = std::move(entries);
+}
+
+bool DirectoryIndex::LoadFromFile(const std::filesystem::path& indexPath)
+{
+    snapshots_.clear();
+
+    std::ifstream input{indexPath, std::ios::binary};
+    if (!input.is_open())
+    {
+        return false;
+    }
+
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    if (!ReadU32(input, magic) || magic != kIndexMagic || !ReadU32(input, version) || version != kIndexFormatVersion)
+    {
+        return false;
+    }
+
+    std::uint64_t directoryCount = 0;
+    if (!ReadU64(input, directoryCount) || directoryCount > kMaxIndexedDirectories)
+    {
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < directoryCount; ++i)
+    {
+        std::string directoryKey;
+        std::int64_t directoryMtime = 0;
+        std::uint64_t entryCount = 0;
+        if (!ReadString(input, directoryKey) || !ReadI64(input, directoryMtime) || !ReadU64(input, entryCount)
+            || entryCount > (1ull << 20))
+        {
+            snapshots_.clear();
+            return false;
+        }
+
+        Snapshot snapshot;
+        snapshot.directoryMtime = FromTimestamp(directoryMtime);
+        snapshot.entries.reserve(static_cast<std::size_t>(entryCount));
+        for (std::uint64_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            std::string pathString;
+            std::uint8_t flags = 0;
+            std::int64_t entryMtime = 0;
+            if (!ReadString(input, pathString) || !ReadU8(input, flags) || !ReadI64(input, entryMtime))
+            {
+                snapshots_.clear();
+                return false;
+            }
+
+            DirectoryScanner::Entry entry;
+            entry.path = std::filesystem::path{std::move(pathString)};
+            entry.isDirectory = (flags & kFlagIsDirectory) != 0;
+            entry.hasWriteTime = (flags & kFlagHasWriteTime) != 0;
+            entry.isExecutable = (flags & kFlagIsExecutable) != 0;
+            entry.hasExecutableInfo = (flags & kFlagHasExecutableInfo) != 0;
+            entry.lastWriteTime = FromTimestamp(entryMtime);
+            snapshot.entries.emplace_back(std::move(entry));
+        }
+
+        snapshots_.emplace(std::move(directoryKey), std::move(snapshot));
+    }
+
+    return true;
+}
+
+bool DirectoryIndex::SaveToFile(const std::filesystem::path& indexPath) const
+{
+    if (indexPath.empty())
+    {
+        return false;
+    }
+
+    // Write-then-rename so a crash mid-save cannot leave a torn index.
+    std::filesystem::path temporaryPath = indexPath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream output{temporaryPath, std::ios::binary | std::ios::trunc};
+        if (!output.is_open())
+        {
+            return false;
+        }
+
+        WriteU32(output, kIndexMagic);
+        WriteU32(output, kIndexFormatVersion);
+        WriteU64(output, static_cast<std::uint64_t>(snapshots_.size()));
+        for (const auto& [directoryKey, snapshot] : snapshots_)
+        {
+            WriteString(output, directoryKey);
+            WriteI64(output, ToTimestamp(snapshot.directoryMtime));
+            WriteU64(output, static_cast<std::uint64_t>(snapshot.entries.size()));
+            for (const auto& entry : snapshot.entries)
+            {
+                std::uint8_t flags = 0;
+                flags |= entry.isDirectory ? kFlagIsDirectory : 0;
+                flags |= entry.hasWriteTime ? kFlagHasWriteTime : 0;
+                flags |= entry.isExecutable ? kFlagIsExecutable : 0;
+                flags |= entry.hasExecutableInfo ? kFlagHasExecutableInfo : 0;
+
+                WriteString(output, entry.path.string());
+                output.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+                WriteI64(output, ToTimestamp(entry.lastWriteTime));
+            }
+        }
+
+        if (!output.good())
+        {
+            std::error_code removeError;
+            std::filesystem::remove(temporaryPath, removeError);
+            return false;
+        }
+    }
+
+    std::error_code renameError;
+    std::filesystem::rename(temporaryPath, indexPath, renameError);
+    if (renameError)
+    {
+        std::error_code removeError;
+        std::filesystem::remove(temporaryPath, removeError);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace colony
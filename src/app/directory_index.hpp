@@ -0,0 +1,47 @@
+#pragma once
+
+#include "app/directory_scanner.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// In-memory index of previously scanned directories, persisted next to
+// settings.json. Each snapshot stores the directory's mtime at scan time;
+// Lookup revalidates with a single stat, so re-filtering or revisiting a
+// directory costs a map lookup instead of a fresh walk. Snapshots whose
+// directory changed on disk are simply rescanned and replaced.
+class DirectoryIndex
+{
+  public:
+    // Returns the cached entries when the directory's current mtime still
+    // matches the snapshot, nullptr otherwise.
+    [[nodiscard]] const std::vector<DirectoryScanner::Entry>* Lookup(const std::filesystem::path& directory) const;
+
+    // Records a completed scan of directory. Oldest snapshots are dropped
+    // once the index holds kMaxIndexedDirectories.
+    void Store(const std::filesystem::path& directory, std::vector<DirectoryScanner::Entry> entries);
+
+    // Best-effort persistence; failures leave the index empty (load) or the
+    // previous file untouched (save) and are reported via the return value.
+    bool LoadFromFile(const std::filesystem::path& indexPath);
+    bool SaveToFile(const std::filesystem::path& indexPath) const;
+
+  private:
+    struct Snapshot
+    {
+        std::filesystem::file_time_type directoryMtime{};
+        std::vector<DirectoryScanner::Entry> entries;
+    };
+
+    static constexpr std::size_t kMaxIndexedDirectories = 64;
+
+    std::unordered_map<std::string, Snapshot> snapshots_;
+};
+
+} // namespace colony
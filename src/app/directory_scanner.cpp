@@ -0,0 +1,238 @@
+#include "app/directory_scanner.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace colony
+{
+namespace
+{
+// Entries accumulated on the worker before they are published to the UI
+// thread. Small enough that the first page appears within a frame, large
+// enough to keep lock traffic negligible.
+constexpr std::size_t kScanBatchSize = 64;
+
+DirectoryScanner::Entry DescribeEntry(const std::filesystem::directory_entry& source)
+{
+    DirectoryScanner::Entry entry;
+    entry.path = source.path();
+
+    std::error_code statusError;
+    std::filesystem::file_status status = source.status(statusError);
+    if (statusError)
+    {
+        statusError.clear();
+        status = source.symlink_status(statusError);
+    }
+    if (!statusError)
+    {
+        entry.isDirectory = std::filesystem::is_directory(status);
+    }
+    else
+    {
+        std::error_code dirError;
+        entry.isDirectory = std::filesystem::is_directory(entry.path, dirError) && !dirError;
+    }
+
+    if (!entry.isDirectory)
+    {
+        entry.hasExecutableInfo = true;
+#if !defined(_WIN32)
+        entry.isExecutable = (::access(entry.path.c_str(), X_OK) == 0);
+#endif
+    }
+
+    std::error_code timeError;
+    entry.lastWriteTime = std::filesystem::last_write_time(entry.path, timeError);
+    entry.hasWriteTime = !timeError;
+
+    return entry;
+}
+
+std::string LowercasePathString(const std::filesystem::path& path)
+{
+    std::string key = path.string();
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char ch) {
+        return static_cast<char>(std::tolower(ch));
+    });
+    return key;
+}
+
+} // namespace
+
+DirectoryScanner::~DirectoryScanner()
+{
+    Cancel();
+}
+
+void DirectoryScanner::Start(Request request)
+{
+    Cancel();
+
+    auto state = std::make_shared<ScanState>();
+    state_ = state;
+    drainedFinish_ = false;
+
+    std::thread worker([state, request = std::move(request)]() { ScanThread(state, request); });
+    worker.detach();
+}
+
+void DirectoryScanner::Cancel()
+{
+    if (state_)
+    {
+        state_->cancelled.store(true, std::memory_order_relaxed);
+        state_.reset();
+    }
+    drainedFinish_ = true;
+}
+
+bool DirectoryScanner::Drain(std::vector<Entry>& outEntries, std::string& outError)
+{
+    outError.clear();
+    if (!state_)
+    {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->pending.empty())
+        {
+            outEntries.insert(
+                outEntries.end(),
+                std::make_move_iterator(state_->pending.begin()),
+                std::make_move_iterator(state_->pending.end()));
+            state_->pending.clear();
+        }
+        outError = state_->errorMessage;
+    }
+
+    if (state_->finished.load(std::memory_order_acquire))
+    {
+        drainedFinish_ = true;
+        return true;
+    }
+    return false;
+}
+
+bool DirectoryScanner::Active() const
+{
+    return state_ != nullptr && !drainedFinish_;
+}
+
+void DirectoryScanner::ScanThread(const std::shared_ptr<ScanState>& state, const Request& request)
+{
+    std::vector<Entry> batch;
+    batch.reserve(kScanBatchSize);
+
+    auto publishBatch = [&]() {
+        if (batch.empty())
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->pending.insert(
+            state->pending.end(),
+            std::make_move_iterator(batch.begin()),
+            std::make_move_iterator(batch.end()));
+        batch.clear();
+    };
+
+    auto fail = [&](const char* message) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->errorMessage = message;
+    };
+
+    const bool hasFilter = !request.lowercaseFilter.empty();
+    std::size_t produced = 0;
+
+    if (request.recursive)
+    {
+        std::error_code iteratorError;
+        std::filesystem::recursive_directory_iterator iterator(
+            request.directory,
+            std::filesystem::directory_options::skip_permission_denied,
+            iteratorError);
+        const std::filesystem::recursive_directory_iterator end;
+        if (iteratorError)
+        {
+            fail("Unable to enumerate directory.");
+        }
+        else
+        {
+            for (; iterator != end; iterator.increment(iteratorError))
+            {
+                if (state->cancelled.load(std::memory_order_relaxed))
+                {
+                    break;
+                }
+                if (iteratorError)
+                {
+                    iteratorError.clear();
+                    continue;
+                }
+                if (request.maxResults > 0 && produced >= request.maxResults)
+                {
+                    break;
+                }
+
+                Entry entry = DescribeEntry(*iterator);
+                if (hasFilter && LowercasePathString(entry.path).find(request.lowercaseFilter) == std::string::npos)
+                {
+                    continue;
+                }
+
+                batch.emplace_back(std::move(entry));
+                ++produced;
+                if (batch.size() >= kScanBatchSize)
+                {
+                    publishBatch();
+                }
+            }
+        }
+    }
+    else
+    {
+        std::error_code iteratorError;
+        std::filesystem::directory_iterator iterator{request.directory, iteratorError};
+        const std::filesystem::directory_iterator end;
+        if (iteratorError)
+        {
+            fail("Unable to open directory.");
+        }
+        else
+        {
+            for (; iterator != end; iterator.increment(iteratorError))
+            {
+                if (state->cancelled.load(std::memory_order_relaxed))
+                {
+                    break;
+                }
+                if (iteratorError)
+                {
+                    fail("Unable to enumerate directory.");
+                    break;
+                }
+
+                batch.emplace_back(DescribeEntry(*iterator));
+                if (batch.size() >= kScanBatchSize)
+                {
+                    publishBatch();
+                }
+            }
+        }
+    }
+
+    publishBatch();
+    state->finished.store(true, std::memory_order_release);
+}
+
+} // namespace colony
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace colony
+{
+
+// Enumerates a directory (optionally recursively) on a background thread so
+// the UI never blocks on slow filesystems. Entries are streamed to the UI
+// thread in batches via Drain; starting a new scan or calling Cancel marks
+// the running scan cancelled and the worker exits at the next entry.
+class DirectoryScanner
+{
+  public:
+    struct Entry
+    {
+        std::filesystem::path path;
+        bool isDirectory = false;
+        std::filesystem::file_time_type lastWriteTime{};
+        bool hasWriteTime = false;
+        bool isExecutable = false;
+        bool hasExecutableInfo = false;
+    };
+
+    struct Request
+    {
+        std::filesystem::path directory;
+        // Recursive scans walk the whole subtree and apply lowercaseFilter
+        // against the full path, stopping after maxResults matches.
+        bool recursive = false;
+        std::string lowercaseFilter;
+        std::size_t maxResults = 0;
+    };
+
+    ~DirectoryScanner();
+
+    // Cancels any running scan and starts a new one for request.
+    void Start(Request request);
+
+    // Marks the running scan cancelled; the worker exits at the next entry.
+    void Cancel();
+
+    // Moves entries discovered since the last call into outEntries. Returns
+    // true once the scan has finished; outError is set to a user-facing
+    // message when enumeration failed.
+    bool Drain(std::vector<Entry>& outEntries, std::string& outError);
+
+    // True while a scan is running or has undrained results.
+    [[nodiscard]] bool Active() const;
+
+  private:
+    struct ScanState
+    {
+        std::mutex mutex;
+        std::vector<Entry> pending;
+        std::string errorMessage;
+        std::atomic<bool> cancelled{false};
+        std::atomic<bool> finished{false};
+    };
+
+    static void ScanThread(const std::shared_ptr<ScanState>& state, const Request& request);
+
+    std::shared_ptr<ScanState> state_;
+    bool drainedFinish_ = true;
+};
+
+} // namespace colony
@@ -0,0 +1,136 @@
+#include "app/event_recorder.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace colony
+{
+namespace
+{
+
+constexpr int kFormatVersion = 1;
+
+constexpr char kHexDigits[] = "0123456789abcdef";
+
+[[nodiscard]] int HexValue(char digit)
+{
+    if (digit >= '0' && digit <= '9')
+    {
+        return digit - '0';
+    }
+    if (digit >= 'a' && digit <= 'f')
+    {
+        return digit - 'a' + 10;
+    }
+    return -1;
+}
+
+} // namespace
+
+void EventRecorder::StartFromEnvironment()
+{
+    const char* path = std::getenv("COLONY_RECORD_EVENTS");
+    if (path == nullptr || *path == '\0')
+    {
+        return;
+    }
+
+    output_.open(path, std::ios::trunc);
+    if (!output_)
+    {
+        std::cerr << "Unable to open event recording path: " << path << '\n';
+        return;
+    }
+
+    output_ << "colony-events " << kFormatVersion << ' ' << sizeof(SDL_Event) << '\n';
+    originMs_ = SDL_GetTicks64();
+    enabled_ = true;
+}
+
+void EventRecorder::AdvanceFrame() noexcept
+{
+    if (enabled_)
+    {
+        ++frameIndex_;
+    }
+}
+
+void EventRecorder::Record(const SDL_Event& event)
+{
+    if (!enabled_)
+    {
+        return;
+    }
+
+    unsigned char raw[sizeof(SDL_Event)];
+    std::memcpy(raw, &event, sizeof(SDL_Event));
+
+    std::string line;
+    line.reserve(sizeof(SDL_Event) * 2 + 32);
+    line += std::to_string(frameIndex_);
+    line += ' ';
+    line += std::to_string(SDL_GetTicks64() - originMs_);
+    line += ' ';
+    for (const unsigned char byte : raw)
+    {
+        line += kHexDigits[byte >> 4];
+        line += kHexDigits[byte & 0x0f];
+    }
+    output_ << line << '\n';
+}
+
+std::optional<std::vector<EventRecorder::TimedEvent>> EventRecorder::Load(
+    const std::filesystem::path& path)
+{
+    std::ifstream input{path};
+    if (!input)
+    {
+        std::cerr << "Unable to open event recording: " << path << '\n';
+        return std::nullopt;
+    }
+
+    std::string magic;
+    int version = 0;
+    std::size_t eventSize = 0;
+    if (!(input >> magic >> version >> eventSize) || magic != "colony-events")
+    {
+        std::cerr << "Not an event recording: " << path << '\n';
+        return std::nullopt;
+    }
+    if (version != kFormatVersion || eventSize != sizeof(SDL_Event))
+    {
+        std::cerr << "Event recording was captured by an incompatible build: " << path << '\n';
+        return std::nullopt;
+    }
+
+    std::vector<TimedEvent> events;
+    TimedEvent entry{};
+    std::string hex;
+    while (input >> entry.frameIndex >> entry.atMs >> hex)
+    {
+        if (hex.size() != sizeof(SDL_Event) * 2)
+        {
+            std::cerr << "Malformed event recording line in: " << path << '\n';
+            return std::nullopt;
+        }
+        unsigned char raw[sizeof(SDL_Event)];
+        for (std::size_t i = 0; i < sizeof(SDL_Event); ++i)
+        {
+            const int high = HexValue(hex[i * 2]);
+            const int low = HexValue(hex[i * 2 + 1]);
+            if (high < 0 || low < 0)
+            {
+                std::cerr << "Malformed event recording line in: " << path << '\n';
+                return std::nullopt;
+            }
+            raw[i] = static_cast<unsigned char>((high << 4) | low);
+        }
+        std::memcpy(&entry.event, raw, sizeof(SDL_Event));
+        events.push_back(entry);
+    }
+    return events;
+}
+
+} // namespace colony
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+namespace colony
+{
+
+// Session capture for deterministic replay. Recording is opt-in via
+// COLONY_RECORD_EVENTS=<path>: every event reaching Application::HandleEvent
+// is appended with the frame index and wall-clock offset it arrived at, so a
+// captured browsing session can later be re-driven frame for frame against a
+// candidate build (see colony_replay). When the variable is unset every call
+// reduces to one branch on a cached flag, same as tracing.
+//
+// Events are captured after the dispatch loop's burst coalescing, so a replay
+// performs exactly the handler work the original session did regardless of
+// the input rate the seat produced.
+//
+// The format is one text line per event — frame index, millisecond offset,
+// and the raw SDL_Event union hex-encoded — behind a header carrying the
+// format version and sizeof(SDL_Event). Replay refuses recordings whose
+// event size does not match the running build; the union layout is not
+// stable across SDL revisions and silently reinterpreting it would turn a
+// regression harness into a fuzzer.
+class EventRecorder
+{
+  public:
+    struct TimedEvent
+    {
+        std::uint64_t frameIndex = 0;
+        std::uint64_t atMs = 0;
+        SDL_Event event{};
+    };
+
+    // Starts recording to COLONY_RECORD_EVENTS if set.
+    void StartFromEnvironment();
+
+    [[nodiscard]] bool Enabled() const noexcept { return enabled_; }
+
+    // Called once per pass of the main loop so records carry the frame they
+    // arrived in; replay uses it to group events back into frames.
+    void AdvanceFrame() noexcept;
+
+    void Record(const SDL_Event& event);
+
+    // Parses a recording produced by this build. Returns nullopt (with a
+    // diagnostic on stderr) for a missing file, a version mismatch or a
+    // malformed line.
+    [[nodiscard]] static std::optional<std::vector<TimedEvent>> Load(
+        const std::filesystem::path& path);
+
+  private:
+    bool enabled_ = false;
+    std::uint64_t frameIndex_ = 0;
+    std::uint64_t originMs_ = 0;
+    std::ofstream output_;
+};
+
+} // namespace colony
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace colony
+{
+
+// Accumulates the screen regions invalidated since the last presented frame.
+// Panels and input handlers report the rects they dirtied; the render loop
+// skips clearing and presenting entirely while the tracker is empty, which is
+// what lets an idle launcher stop consuming CPU and GPU time.
+//
+// The rect list is intentionally coarse: once more than kMaxTrackedRects
+// distinct regions accumulate the tracker collapses to a full-frame damage
+// flag, since at that point a full redraw is cheaper than bookkeeping.
+class DamageTracker
+{
+  public:
+    void AddRect(const SDL_Rect& rect)
+    {
+        if (fullFrame_ || rect.w <= 0 || rect.h <= 0)
+        {
+            return;
+        }
+        if (rects_.size() >= kMaxTrackedRects)
+        {
+            MarkFullFrame();
+            return;
+        }
+        rects_.push_back(rect);
+    }
+
+    void MarkFullFrame() noexcept
+    {
+        fullFrame_ = true;
+        rects_.clear();
+    }
+
+    void Clear() noexcept
+    {
+        fullFrame_ = false;
+        rects_.clear();
+    }
+
+    [[nodiscard]] bool Empty() const noexcept
+    {
+        return !fullFrame_ && rects_.empty();
+    }
+
+    [[nodiscard]] bool HasFullFrame() const noexcept
+    {
+        return fullFrame_;
+    }
+
+    // The individual tracked rects; empty while HasFullFrame() is set.
+    [[nodiscard]] const std::vector<SDL_Rect>& Rects() const noexcept
+    {
+        return rects_;
+    }
+
+    // Union of the tracked rects; meaningless while HasFullFrame() is set.
+    [[nodiscard]] SDL_Rect Bounds() const noexcept
+    {
+        SDL_Rect bounds{0, 0, 0, 0};
+        for (const SDL_Rect& rect : rects_)
+        {
+            if (bounds.w == 0 && bounds.h == 0)
+            {
+                bounds = rect;
+                continue;
+            }
+            const int left = bounds.x < rect.x ? bounds.x : rect.x;
+            const int top = bounds.y < rect.y ? bounds.y : rect.y;
+            const int right = bounds.x + bounds.w > rect.x + rect.w ? bounds.x + bounds.w : rect.x + rect.w;
+            const int bottom = bounds.y + bounds.h > rect.y + rect.h ? bounds.y + bounds.h : rect.y + rect.h;
+            bounds = SDL_Rect{left, top, right - left, bottom - top};
+        }
+        return bounds;
+    }
+
+  private:
+    static constexpr std::size_t kMaxTrackedRects = 32;
+
+    bool fullFrame_ = false;
+    std::vector<SDL_Rect> rects_;
+};
+
+} // namespace colony
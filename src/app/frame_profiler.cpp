@@ -0,0 +1,118 @@
+#include "app/frame_profiler.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace colony
+{
+namespace
+{
+
+float PercentileOf(std::vector<float>& sorted, double percentile)
+{
+    if (sorted.empty())
+    {
+        return 0.0f;
+    }
+    const auto rank = static_cast<std::size_t>(percentile * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+} // namespace
+
+std::string_view FramePhaseLabel(FramePhase phase) noexcept
+{
+    switch (phase)
+    {
+    case FramePhase::Events:
+        return "events";
+    case FramePhase::ThemeRebuild:
+        return "theme";
+    case FramePhase::NavRail:
+        return "nav rail";
+    case FramePhase::TopBar:
+        return "top bar";
+    case FramePhase::Library:
+        return "library";
+    case FramePhase::Hero:
+        return "hero";
+    case FramePhase::Hub:
+        return "hub";
+    case FramePhase::Present:
+        return "present";
+    case FramePhase::Count:
+        break;
+    }
+    return "?";
+}
+
+void FrameProfiler::BeginFrame() noexcept
+{
+    current_.fill(0.0f);
+    frameStart_ = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::EndFrame() noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - frameStart_;
+    current_[kPhaseCount] = static_cast<float>(std::chrono::duration<double, std::milli>(elapsed).count());
+
+    history_[nextSlot_] = current_;
+    nextSlot_ = (nextSlot_ + 1) % kHistoryFrames;
+    if (recordedFrames_ < kHistoryFrames)
+    {
+        ++recordedFrames_;
+    }
+}
+
+const FrameProfiler::Sample& FrameProfiler::LastFrame() const noexcept
+{
+    static constexpr Sample kEmpty{};
+    if (recordedFrames_ == 0)
+    {
+        return kEmpty;
+    }
+    return history_[(nextSlot_ + kHistoryFrames - 1) % kHistoryFrames];
+}
+
+void FrameProfiler::AddSample(FramePhase phase, double milliseconds) noexcept
+{
+    current_[static_cast<std::size_t>(phase)] += static_cast<float>(milliseconds);
+}
+
+FrameProfiler::Summary FrameProfiler::BuildSummary() const
+{
+    Summary summary;
+    summary.frameCount = recordedFrames_;
+    if (recordedFrames_ == 0)
+    {
+        return summary;
+    }
+
+    std::vector<float> scratch;
+    scratch.reserve(recordedFrames_);
+
+    const auto summarize = [&](std::size_t slot) {
+        scratch.clear();
+        for (std::size_t frame = 0; frame < recordedFrames_; ++frame)
+        {
+            scratch.push_back(history_[frame][slot]);
+        }
+        std::sort(scratch.begin(), scratch.end());
+
+        PhaseSummary phase;
+        phase.p50Ms = PercentileOf(scratch, 0.50);
+        phase.p95Ms = PercentileOf(scratch, 0.95);
+        phase.p99Ms = PercentileOf(scratch, 0.99);
+        return phase;
+    };
+
+    for (std::size_t phase = 0; phase < kPhaseCount; ++phase)
+    {
+        summary.phases[phase] = summarize(phase);
+    }
+    summary.total = summarize(kPhaseCount);
+    return summary;
+}
+
+} // namespace colony
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "app/trace_writer.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+namespace colony
+{
+
+// Frame phases instrumented by Application. The order here is the order the
+// HUD lists them in.
+enum class FramePhase : std::size_t
+{
+    Events,
+    ThemeRebuild,
+    NavRail,
+    TopBar,
+    Library,
+    Hero,
+    Hub,
+    Present,
+    Count
+};
+
+[[nodiscard]] std::string_view FramePhaseLabel(FramePhase phase) noexcept;
+
+// Per-phase frame timing with a fixed ring of recent frames. Application
+// brackets each rendered frame with BeginFrame/EndFrame and attributes time
+// to phases via ScopedPhaseTimer; the HUD pulls percentile summaries out of
+// the ring at its own (much lower) refresh rate.
+//
+// Sampling is a few stores per phase, so the profiler stays armed at all
+// times — a seat can toggle the HUD after jank happened and still see the
+// frames that contained it.
+class FrameProfiler
+{
+  public:
+    static constexpr std::size_t kHistoryFrames = 4096;
+    static constexpr std::size_t kPhaseCount = static_cast<std::size_t>(FramePhase::Count);
+
+    // One frame's per-phase milliseconds; the extra trailing slot holds the
+    // wall-clock frame total.
+    using Sample = std::array<float, kPhaseCount + 1>;
+
+    // Starts a new frame sample and records the frame's start time. Frames
+    // that are abandoned (the idle path skips rendering) are simply never
+    // committed; the next BeginFrame discards the partial sample.
+    void BeginFrame() noexcept;
+
+    // Commits the current sample to the ring. Total frame time is measured
+    // wall-clock from BeginFrame, so it also covers unattributed work.
+    void EndFrame() noexcept;
+
+    // Adds time to a phase of the current frame. Phases sampled several
+    // times per frame (event handling) accumulate.
+    void AddSample(FramePhase phase, double milliseconds) noexcept;
+
+    struct PhaseSummary
+    {
+        float p50Ms = 0.0f;
+        float p95Ms = 0.0f;
+        float p99Ms = 0.0f;
+    };
+
+    struct Summary
+    {
+        std::array<PhaseSummary, kPhaseCount> phases{};
+        PhaseSummary total{};
+        std::size_t frameCount = 0;
+    };
+
+    // Computes p50/p95/p99 per phase over the recorded history. Costs a sort
+    // per phase; callers refresh at HUD rate, not frame rate.
+    [[nodiscard]] Summary BuildSummary() const;
+
+    [[nodiscard]] std::size_t FrameCount() const noexcept { return recordedFrames_; }
+
+    // The most recently committed frame; all zeroes before the first
+    // EndFrame. The jank recorder reads this to attach a per-phase
+    // breakdown to an over-budget frame.
+    [[nodiscard]] const Sample& LastFrame() const noexcept;
+
+  private:
+    std::array<Sample, kHistoryFrames> history_{};
+    Sample current_{};
+    std::chrono::steady_clock::time_point frameStart_{};
+    std::size_t nextSlot_ = 0;
+    std::size_t recordedFrames_ = 0;
+};
+
+// RAII attribution: adds the scope's wall-clock duration to a phase of the
+// profiler's current frame.
+class ScopedPhaseTimer
+{
+  public:
+    ScopedPhaseTimer(FrameProfiler& profiler, FramePhase phase) noexcept
+        : profiler_(profiler), phase_(phase), start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedPhaseTimer()
+    {
+        const auto end = std::chrono::steady_clock::now();
+        profiler_.AddSample(phase_, std::chrono::duration<double, std::milli>(end - start_).count());
+        // Phase timers double as trace spans, so per-frame phases show up in
+        // a COLONY_TRACE capture without a second set of guards.
+        if (TraceWriter::Shared().Enabled())
+        {
+            TraceWriter::Shared().WriteSpan(FramePhaseLabel(phase_), start_, end);
+        }
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+  private:
+    FrameProfiler& profiler_;
+    FramePhase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace colony
@@ -0,0 +1,98 @@
+#include "app/hub_search_index.hpp"
+
+#include "utils/utf8.hpp"
+
+#include <numeric>
+#include <utility>
+
+namespace colony
+{
+
+void HubSearchIndex::Rebuild(std::vector<std::string> normalizedHaystacks)
+{
+    haystacks_ = std::move(normalizedHaystacks);
+    lastNormalizedQuery_.clear();
+    lastResults_.clear();
+    hasLastResults_ = false;
+}
+
+const std::vector<std::size_t>& HubSearchIndex::Query(std::string_view query)
+{
+    std::string normalized = Normalize(query);
+
+    // Extending a query can only remove matches: tokenizing a string prefix
+    // yields the same tokens with at most the last one shortened, and a
+    // haystack containing a token contains every prefix of it. So when the
+    // user appends characters we re-check only the previous result set.
+    std::vector<std::size_t> candidates;
+    const bool narrowing = hasLastResults_ && normalized.size() >= lastNormalizedQuery_.size()
+        && normalized.compare(0, lastNormalizedQuery_.size(), lastNormalizedQuery_) == 0;
+    if (narrowing)
+    {
+        candidates = lastResults_;
+    }
+    else
+    {
+        candidates.resize(haystacks_.size());
+        std::iota(candidates.begin(), candidates.end(), std::size_t{0});
+    }
+
+    const std::vector<std::string> tokens = Tokenize(normalized);
+    lastResults_.clear();
+    for (const std::size_t index : candidates)
+    {
+        const std::string& haystack = haystacks_[index];
+        bool matches = true;
+        for (const std::string& token : tokens)
+        {
+            if (haystack.find(token) == std::string::npos)
+            {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+        {
+            lastResults_.push_back(index);
+        }
+    }
+
+    lastNormalizedQuery_ = std::move(normalized);
+    hasLastResults_ = true;
+    return lastResults_;
+}
+
+std::string HubSearchIndex::Normalize(std::string_view value)
+{
+    return text::NormalizeForSearch(value);
+}
+
+std::vector<std::string> HubSearchIndex::Tokenize(std::string_view value)
+{
+    std::vector<std::string> tokens;
+    std::string normalized = Normalize(value);
+    std::string current;
+    current.reserve(normalized.size());
+    for (char ch : normalized)
+    {
+        if (ch == ' ')
+        {
+            if (!current.empty())
+            {
+                tokens.push_back(current);
+                current.clear();
+            }
+        }
+        else
+        {
+            current.push_back(ch);
+        }
+    }
+    if (!current.empty())
+    {
+        tokens.push_back(current);
+    }
+    return tokens;
+}
+
+} // namespace colony
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace colony
+{
+
+// Precomputed search index over the hub branches. The normalized haystack
+// for every branch is built once when the catalog changes; each keystroke
+// then only scans the previous query's result set, since appending
+// characters to a query can only narrow the matches. Matching keeps the
+// existing semantics: every query token must appear as a substring of the
+// branch haystack.
+class HubSearchIndex
+{
+public:
+    // Replaces the indexed haystacks. Entries must already be normalized
+    // with Normalize(); query results are indices into this vector.
+    void Rebuild(std::vector<std::string> normalizedHaystacks);
+
+    // Indices of entries matching every token of the query, in entry order.
+    // The returned reference stays valid until the next Query or Rebuild.
+    [[nodiscard]] const std::vector<std::size_t>& Query(std::string_view query);
+
+    // Lowercases alphanumerics and collapses every other run of characters
+    // into a single space.
+    [[nodiscard]] static std::string Normalize(std::string_view value);
+
+    // Splits a normalized query into its space-separated tokens.
+    [[nodiscard]] static std::vector<std::string> Tokenize(std::string_view value);
+
+private:
+    std::vector<std::string> haystacks_;
+    std::string lastNormalizedQuery_;
+    std::vector<std::size_t> lastResults_;
+    bool hasLastResults_ = false;
+};
+
+} // namespace colony
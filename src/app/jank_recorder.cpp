@@ -0,0 +1,142 @@
+#include "app/jank_recorder.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace colony
+{
+namespace
+{
+
+constexpr std::string_view kActiveFileName = "incidents.jsonl";
+constexpr std::string_view kRotatedFileName = "incidents.prev.jsonl";
+
+// Ring bound: up to this many records per file, two files on disk. Incidents
+// beyond the bound overwrite the oldest half, never grow the footprint.
+constexpr std::size_t kMaxRecordsPerFile = 32;
+
+// A stall that persists produces identical records every frame; one per
+// second captures its shape without writing hundreds of duplicates.
+constexpr double kMinSecondsBetweenRecords = 1.0;
+
+std::size_t CountLines(const std::filesystem::path& path)
+{
+    std::ifstream input{path};
+    std::size_t lines = 0;
+    std::string line;
+    while (std::getline(input, line))
+    {
+        ++lines;
+    }
+    return lines;
+}
+
+// Program ids come from catalog JSON, but an incident record must stay
+// parseable even if one contains a quote or backslash.
+std::string EscapeJson(const std::string& text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        if (static_cast<unsigned char>(character) < 0x20)
+        {
+            continue;
+        }
+        escaped.push_back(character);
+    }
+    return escaped;
+}
+
+} // namespace
+
+void JankRecorder::SetDirectory(std::filesystem::path directory)
+{
+    directory_ = std::move(directory);
+    countedExistingRecords_ = false;
+}
+
+void JankRecorder::Record(const Incident& incident)
+{
+    if (directory_.empty())
+    {
+        return;
+    }
+    if (lastRecordAtSeconds_ != 0.0 && incident.atSeconds - lastRecordAtSeconds_ < kMinSecondsBetweenRecords)
+    {
+        return;
+    }
+    lastRecordAtSeconds_ = incident.atSeconds;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec)
+    {
+        return;
+    }
+
+    const std::filesystem::path activePath = directory_ / kActiveFileName;
+    if (!countedExistingRecords_)
+    {
+        // Records survive restarts, so the bound has to count what previous
+        // runs left behind. Paid once, on the first incident of a run.
+        activeFileRecords_ = CountLines(activePath);
+        countedExistingRecords_ = true;
+    }
+
+    if (activeFileRecords_ >= kMaxRecordsPerFile)
+    {
+        std::filesystem::rename(activePath, directory_ / kRotatedFileName, ec);
+        activeFileRecords_ = 0;
+    }
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"at_seconds\":" << incident.atSeconds;
+    json << ",\"total_ms\":" << incident.frame[FrameProfiler::kPhaseCount];
+    json << ",\"budget_ms\":" << incident.budgetMs;
+    json << ",\"phases\":{";
+    for (std::size_t phase = 0; phase < FrameProfiler::kPhaseCount; ++phase)
+    {
+        if (phase != 0)
+        {
+            json << ',';
+        }
+        json << '"' << FramePhaseLabel(static_cast<FramePhase>(phase)) << "\":" << incident.frame[phase];
+    }
+    json << '}';
+    json << ",\"interface_state\":\"" << EscapeJson(incident.interfaceState) << '"';
+    json << ",\"active_program\":\"" << EscapeJson(incident.activeProgramId) << '"';
+    json << ",\"damage\":{\"full_frame\":" << (incident.fullFrameDamage ? "true" : "false") << ",\"rects\":[";
+    for (std::size_t index = 0; index < incident.damageRects.size(); ++index)
+    {
+        const SDL_Rect& rect = incident.damageRects[index];
+        if (index != 0)
+        {
+            json << ',';
+        }
+        json << '[' << rect.x << ',' << rect.y << ',' << rect.w << ',' << rect.h << ']';
+    }
+    json << "]}";
+    json << ",\"text_cache\":{\"hits\":" << incident.textCacheHits << ",\"misses\":" << incident.textCacheMisses
+         << '}';
+    json << "}\n";
+
+    std::ofstream output{activePath, std::ios::app};
+    if (!output.is_open())
+    {
+        return;
+    }
+    output << json.str();
+    ++activeFileRecords_;
+}
+
+} // namespace colony
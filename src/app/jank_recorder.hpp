@@ -0,0 +1,55 @@
+#pragma once
+
+#include "app/frame_profiler.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace colony
+{
+
+// On-disk incident log for frames that blow their budget. Application hands
+// over one Incident per offending frame; the recorder appends it as a JSON
+// line to a two-file ring under the settings directory, so a stuttering seat
+// ships a bounded, self-describing capture with its support ticket instead
+// of an unreproducible anecdote.
+//
+// The recorder does nothing per frame on its own — the caller's budget
+// comparison is the only steady-state cost — and records are rate-limited so
+// sustained overload cannot flood the disk.
+class JankRecorder
+{
+  public:
+    struct Incident
+    {
+        double atSeconds = 0.0;
+        double budgetMs = 0.0;
+        // Per-phase milliseconds with the wall-clock total in the trailing
+        // slot, exactly as FrameProfiler committed it.
+        FrameProfiler::Sample frame{};
+        std::string interfaceState;
+        std::string activeProgramId;
+        bool fullFrameDamage = false;
+        std::vector<SDL_Rect> damageRects;
+        std::size_t textCacheHits = 0;
+        std::size_t textCacheMisses = 0;
+    };
+
+    // Directory the ring files live in; created on demand. Recording is a
+    // no-op until this is set.
+    void SetDirectory(std::filesystem::path directory);
+
+    void Record(const Incident& incident);
+
+  private:
+    std::filesystem::path directory_;
+    std::size_t activeFileRecords_ = 0;
+    bool countedExistingRecords_ = false;
+    double lastRecordAtSeconds_ = 0.0;
+};
+
+} // namespace colony
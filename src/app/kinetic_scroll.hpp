@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cmath>
+
+namespace colony
+{
+
+// Velocity-based scroll model: wheel notches feed impulses, and the render
+// loop integrates the velocity with exponential decay each frame. The decay
+// constant is chosen so one notch travels exactly its classic fixed step in
+// total — the destination is unchanged, only the motion is smoothed out.
+//
+// Step() returns whole pixels and banks the sub-pixel remainder so repeated
+// small frames never lose travel distance to rounding.
+class KineticScroll
+{
+  public:
+    // Queues travel of `pixels` (signed); stacks with motion in flight, so a
+    // fast wheel spin accumulates distance exactly like discrete steps did.
+    void AddImpulse(float pixels) noexcept
+    {
+        velocity_ += pixels * kDecayPerSecond;
+    }
+
+    // Advances the integrator by deltaSeconds and returns the whole pixels of
+    // travel to apply this frame.
+    [[nodiscard]] int Step(double deltaSeconds) noexcept
+    {
+        if (!Active() || deltaSeconds <= 0.0)
+        {
+            return 0;
+        }
+
+        const float decay = std::exp(static_cast<float>(-kDecayPerSecond * deltaSeconds));
+        // Closed-form integral of the decaying velocity over the frame, so
+        // the travel per frame is exact regardless of the frame rate.
+        float travel = residual_ + velocity_ * (1.0f - decay) / kDecayPerSecond;
+        velocity_ *= decay;
+
+        if (std::abs(velocity_) < kRestVelocity)
+        {
+            // Snap to rest, flushing the tail the decay would still owe, so a
+            // notch lands exactly where its discrete step would have.
+            travel += velocity_ / kDecayPerSecond;
+            velocity_ = 0.0f;
+            residual_ = 0.0f;
+            return static_cast<int>(std::lround(travel));
+        }
+
+        const float whole = std::trunc(travel);
+        residual_ = travel - whole;
+        return static_cast<int>(whole);
+    }
+
+    [[nodiscard]] bool Active() const noexcept
+    {
+        return velocity_ != 0.0f;
+    }
+
+    // Drops any motion in flight; used when the scrolled content goes away or
+    // the offset is reset programmatically.
+    void Stop() noexcept
+    {
+        velocity_ = 0.0f;
+        residual_ = 0.0f;
+    }
+
+  private:
+    // 1/kDecayPerSecond is the time constant: ~95% of a notch's travel lands
+    // within three time constants (~250ms), snappy but visibly smooth.
+    static constexpr float kDecayPerSecond = 12.0f;
+    // Below half a pixel per frame at 60Hz there is nothing left to show.
+    static constexpr float kRestVelocity = 30.0f;
+
+    float velocity_ = 0.0f;
+    float residual_ = 0.0f;
+};
+
+} // namespace colony
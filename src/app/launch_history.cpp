@@ -0,0 +1,129 @@
+#include "app/launch_history.hpp"
+
+#include "json.hpp"
+
+#include <fstream>
+#include <utility>
+
+namespace colony
+{
+
+void LaunchHistory::RecordLaunch(const std::string& programId)
+{
+    if (programId.empty())
+    {
+        return;
+    }
+
+    if (ring_.size() < kRingCapacity)
+    {
+        ring_.push_back(programId);
+    }
+    else
+    {
+        DropOldestEvent();
+        ring_[head_] = programId;
+        head_ = (head_ + 1) % kRingCapacity;
+    }
+    ++counts_[programId];
+
+    if (const auto it = index_.find(programId); it != index_.end())
+    {
+        recency_.splice(recency_.begin(), recency_, it->second);
+    }
+    else
+    {
+        recency_.push_front(programId);
+        index_[programId] = recency_.begin();
+    }
+
+    ++version_;
+    orderCacheValid_ = false;
+}
+
+const std::vector<std::string>& LaunchHistory::RecencyOrder() const
+{
+    if (!orderCacheValid_)
+    {
+        orderCache_.assign(recency_.begin(), recency_.end());
+        orderCacheValid_ = true;
+    }
+    return orderCache_;
+}
+
+bool LaunchHistory::LoadFromFile(const std::filesystem::path& path)
+{
+    ring_.clear();
+    head_ = 0;
+    recency_.clear();
+    index_.clear();
+    counts_.clear();
+    orderCacheValid_ = false;
+    ++version_;
+
+    std::ifstream input{path};
+    if (!input.is_open())
+    {
+        return false;
+    }
+
+    try
+    {
+        const nlohmann::json document = nlohmann::json::parse(input);
+        if (!document.is_object() || !document.contains("launches") || !document["launches"].is_array())
+        {
+            return false;
+        }
+        for (const auto& event : document["launches"])
+        {
+            if (event.is_string())
+            {
+                RecordLaunch(event.get<std::string>());
+            }
+        }
+    }
+    catch (const nlohmann::json::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+std::string LaunchHistory::Serialize() const
+{
+    nlohmann::json launches = nlohmann::json::array();
+    // Oldest first, so replaying the array through RecordLaunch rebuilds the
+    // same recency order.
+    const std::size_t count = ring_.size();
+    const std::size_t start = count < kRingCapacity ? 0 : head_;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        launches.push_back(ring_[(start + i) % count]);
+    }
+
+    nlohmann::json document;
+    document["launches"] = std::move(launches);
+    return document.dump(2);
+}
+
+void LaunchHistory::DropOldestEvent()
+{
+    const std::string& oldest = ring_[head_];
+    const auto countIt = counts_.find(oldest);
+    if (countIt == counts_.end())
+    {
+        return;
+    }
+    if (--countIt->second == 0)
+    {
+        if (const auto it = index_.find(oldest); it != index_.end())
+        {
+            recency_.erase(it->second);
+            index_.erase(it);
+        }
+        counts_.erase(countIt);
+        orderCacheValid_ = false;
+    }
+}
+
+} // namespace colony
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// Recorded launch history backing the Recently Played sort. Each launch is an
+// O(1) ring-buffer append plus an O(1) splice in a maintained recency list,
+// so the sorted view is read straight from the list without ever scanning or
+// sorting timestamps. The ring bounds retention: once a program's last event
+// is overwritten it drops out of the recency order.
+class LaunchHistory
+{
+  public:
+    // Generous for a launcher: covers weeks of real usage while keeping the
+    // persisted file and the in-memory index trivially small.
+    static constexpr std::size_t kRingCapacity = 512;
+
+    // Records one launch of the program. O(1).
+    void RecordLaunch(const std::string& programId);
+
+    // Most-recent-first program ids, already unique. Rebuilt lazily after a
+    // launch; steady-state callers get the cached vector back.
+    [[nodiscard]] const std::vector<std::string>& RecencyOrder() const;
+
+    // Bumped on every recorded launch; callers can cheaply detect staleness.
+    [[nodiscard]] std::uint64_t Version() const noexcept { return version_; }
+
+    // Replaces the history with the persisted events (oldest first). Returns
+    // false and leaves the history empty when the file is missing or invalid.
+    bool LoadFromFile(const std::filesystem::path& path);
+
+    // Serializes the ring (oldest first) for the write-behind persister.
+    [[nodiscard]] std::string Serialize() const;
+
+  private:
+    void DropOldestEvent();
+
+    // Launch events in ring order; head_ is the slot the next event lands in
+    // once the ring is full.
+    std::vector<std::string> ring_;
+    std::size_t head_ = 0;
+
+    // Front is the most recently launched program. counts_ tracks how many
+    // ring events each program still owns, so an overwrite only evicts a
+    // program once its last event is gone.
+    std::list<std::string> recency_;
+    std::unordered_map<std::string, std::list<std::string>::iterator> index_;
+    std::unordered_map<std::string, std::size_t> counts_;
+
+    std::uint64_t version_ = 0;
+    mutable std::vector<std::string> orderCache_;
+    mutable bool orderCacheValid_ = false;
+};
+
+} // namespace colony
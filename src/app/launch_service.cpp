@@ -0,0 +1,230 @@
+#include "app/launch_service.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#if defined(_WIN32)
+#include <cstdlib>
+#include <thread>
+#else
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+#endif
+
+namespace colony
+{
+
+#if !defined(_WIN32)
+
+namespace
+{
+
+// Supervision poll period. Reaping is driven by this cadence rather than
+// SIGCHLD so the launcher never installs a process-wide signal handler that
+// could interfere with SDL or spawned tooling.
+constexpr auto kSupervisorPollInterval = std::chrono::milliseconds(100);
+
+// Returns whether the child has accumulated any CPU time yet — the closest
+// portable-ish stand-in for "first activity". Only available via procfs.
+bool ChildHasRun(pid_t pid)
+{
+#if defined(__linux__)
+    std::ifstream stat{"/proc/" + std::to_string(pid) + "/stat"};
+    if (!stat.is_open())
+    {
+        return false;
+    }
+    std::string line;
+    std::getline(stat, line);
+    // comm (field 2) may contain spaces; fields after the closing paren are
+    // whitespace-delimited, with utime/stime at positions 14 and 15.
+    const std::size_t commEnd = line.rfind(')');
+    if (commEnd == std::string::npos)
+    {
+        return false;
+    }
+    std::istringstream fields{line.substr(commEnd + 1)};
+    std::string token;
+    for (int field = 3; field <= 15 && fields >> token; ++field)
+    {
+        if (field >= 14 && token != "0")
+        {
+            return true;
+        }
+    }
+    return false;
+#else
+    (void)pid;
+    return true;
+#endif
+}
+
+} // namespace
+
+LaunchService::~LaunchService()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (supervisor_.joinable())
+    {
+        supervisor_.join();
+    }
+    // Still-running children are orphaned deliberately: closing the launcher
+    // must not take the user's applications down with it.
+}
+
+bool LaunchService::Launch(
+    const std::string& programId, const std::string& displayName, const std::filesystem::path& executablePath)
+{
+    const auto requestedAt = std::chrono::steady_clock::now();
+
+    // argv and environment are resolved before the spawn call; the child
+    // inherits the launcher's environment unchanged.
+    const std::string pathText = executablePath.string();
+    char* argv[] = {const_cast<char*>(pathText.c_str()), nullptr};
+
+    pid_t pid = -1;
+    const int spawnError = posix_spawn(&pid, pathText.c_str(), nullptr, nullptr, argv, environ);
+    if (spawnError != 0)
+    {
+        LaunchResult failure;
+        failure.programId = programId;
+        failure.displayName = displayName;
+        failure.error = std::strerror(spawnError);
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            finished_.push_back(std::move(failure));
+        }
+        return false;
+    }
+
+    const double spawnLatencyMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - requestedAt).count();
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        // Spawn round-trip as the floor; the supervisor upgrades this to
+        // first-activity latency once the child is seen on CPU.
+        launchLatencyMs_[programId] = spawnLatencyMs;
+        children_.push_back(Child{pid, programId, displayName, requestedAt, false});
+    }
+    EnsureSupervisor();
+    wake_.notify_one();
+    return true;
+}
+
+#else // defined(_WIN32)
+
+LaunchService::~LaunchService() = default;
+
+bool LaunchService::Launch(
+    const std::string& programId, const std::string& displayName, const std::filesystem::path& executablePath)
+{
+    (void)displayName;
+    const auto requestedAt = std::chrono::steady_clock::now();
+
+    // `start` detaches the child from the launcher; the empty quoted argument
+    // is the window title slot so quoted paths are not mistaken for it.
+    const std::string command = "start \"\" \"" + executablePath.string() + "\"";
+    std::thread launcherThread([command]() { std::system(command.c_str()); });
+    launcherThread.detach();
+
+    const double spawnLatencyMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - requestedAt).count();
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        launchLatencyMs_[programId] = spawnLatencyMs;
+    }
+    return true;
+}
+
+#endif
+
+std::vector<LaunchService::LaunchResult> LaunchService::TakeFinished()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return std::exchange(finished_, {});
+}
+
+double LaunchService::LastLaunchLatencyMs(const std::string& programId) const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto it = launchLatencyMs_.find(programId);
+    return it != launchLatencyMs_.end() ? it->second : 0.0;
+}
+
+#if !defined(_WIN32)
+
+void LaunchService::EnsureSupervisor()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!supervisor_.joinable())
+    {
+        supervisor_ = std::thread{&LaunchService::SupervisorLoop, this};
+    }
+}
+
+void LaunchService::SupervisorLoop()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    for (;;)
+    {
+        wake_.wait_for(lock, kSupervisorPollInterval, [this] { return stopping_; });
+        if (stopping_)
+        {
+            return;
+        }
+
+        for (std::size_t index = 0; index < children_.size();)
+        {
+            Child& child = children_[index];
+
+            // The procfs read is a handful of microseconds, cheap enough to
+            // do under the lock rather than juggling iterator invalidation.
+            if (!child.activitySeen && ChildHasRun(child.pid))
+            {
+                child.activitySeen = true;
+                launchLatencyMs_[child.programId] =
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - child.requestedAt)
+                        .count();
+            }
+
+            int status = 0;
+            const pid_t reaped = waitpid(child.pid, &status, WNOHANG);
+            if (reaped != child.pid)
+            {
+                ++index;
+                continue;
+            }
+
+            LaunchResult result;
+            result.programId = child.programId;
+            result.displayName = child.displayName;
+            result.spawned = true;
+            result.launchLatencyMs = launchLatencyMs_[child.programId];
+            if (WIFSIGNALED(status))
+            {
+                result.signalled = true;
+                result.signalNumber = WTERMSIG(status);
+            }
+            else
+            {
+                result.exitCode = WEXITSTATUS(status);
+            }
+            finished_.push_back(std::move(result));
+            children_.erase(children_.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+    }
+}
+
+#endif // !defined(_WIN32)
+
+} // namespace colony
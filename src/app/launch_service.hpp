@@ -0,0 +1,95 @@
+#pragma once
+
+#include <condition_variable>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#endif
+
+namespace colony
+{
+
+// Non-blocking child process launcher with exit supervision. Launch spawns
+// via posix_spawn with pre-resolved argv/environment and returns immediately;
+// a supervisor thread reaps children and queues a LaunchResult per exit,
+// which the UI thread drains at frame rate via TakeFinished and turns into a
+// status message. The click handler never waits on a slow-starting binary.
+//
+// Launch latency — the time from the launch request to the child's first
+// accumulated CPU time — is sampled by the supervisor and recorded per
+// program id; where that signal is unavailable the spawn round-trip is
+// recorded instead.
+//
+// On Windows there is no posix_spawn: Launch falls back to the shell `start`
+// command on a detached thread, so launches still never block the click
+// handler but no exit status comes back and only the spawn round-trip is
+// recorded.
+class LaunchService
+{
+  public:
+    struct LaunchResult
+    {
+        std::string programId;
+        std::string displayName;
+        bool spawned = false;
+        // Valid only when spawned: the reaped exit status.
+        int exitCode = 0;
+        bool signalled = false;
+        int signalNumber = 0;
+        // Spawn failure description when spawned is false.
+        std::string error;
+        double launchLatencyMs = 0.0;
+    };
+
+    LaunchService() = default;
+    ~LaunchService();
+
+    LaunchService(const LaunchService&) = delete;
+    LaunchService& operator=(const LaunchService&) = delete;
+
+    // Spawns the executable and registers it for supervision. Returns false
+    // (and queues a failed LaunchResult) when the spawn itself fails.
+    bool Launch(const std::string& programId, const std::string& displayName,
+        const std::filesystem::path& executablePath);
+
+    // Drains results for children that failed to spawn or have exited.
+    [[nodiscard]] std::vector<LaunchResult> TakeFinished();
+
+    // Latency recorded for the most recent launch of the program, or 0 when
+    // it has not been launched this session.
+    [[nodiscard]] double LastLaunchLatencyMs(const std::string& programId) const;
+
+  private:
+#if !defined(_WIN32)
+    struct Child
+    {
+        pid_t pid = -1;
+        std::string programId;
+        std::string displayName;
+        std::chrono::steady_clock::time_point requestedAt;
+        bool activitySeen = false;
+    };
+
+    void SupervisorLoop();
+    void EnsureSupervisor();
+#endif
+
+    mutable std::mutex mutex_;
+    std::vector<LaunchResult> finished_;
+    std::unordered_map<std::string, double> launchLatencyMs_;
+#if !defined(_WIN32)
+    std::condition_variable wake_;
+    std::vector<Child> children_;
+    bool stopping_ = false;
+    std::thread supervisor_;
+#endif
+};
+
+} // namespace colony
@@ -0,0 +1,72 @@
+#include "app/metrics_server.hpp"
+
+#include "cpp-httplib/httplib.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+namespace colony
+{
+
+MetricsServer::MetricsServer() = default;
+
+MetricsServer::~MetricsServer()
+{
+    if (server_)
+    {
+        server_->stop();
+    }
+    if (serverThread_.joinable())
+    {
+        serverThread_.join();
+    }
+}
+
+bool MetricsServer::StartFromEnvironment()
+{
+    const char* portText = std::getenv("COLONY_METRICS_PORT");
+    if (portText == nullptr || *portText == '\0')
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    const long port = std::strtol(portText, &end, 10);
+    if (end == portText || *end != '\0' || port < 1 || port > 65535)
+    {
+        std::cerr << "Ignoring invalid COLONY_METRICS_PORT value: " << portText << '\n';
+        return false;
+    }
+
+    server_ = std::make_unique<httplib::Server>();
+    server_->Get("/metrics", [this](const httplib::Request&, httplib::Response& response) {
+        std::string snapshot;
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            snapshot = payload_;
+        }
+        response.set_content(snapshot, "application/json");
+    });
+
+    // Bind before spawning the thread so a port conflict is reported at
+    // startup instead of racing the first scrape.
+    if (!server_->bind_to_port("127.0.0.1", static_cast<int>(port)))
+    {
+        std::cerr << "Unable to bind metrics endpoint to 127.0.0.1:" << port << '\n';
+        server_.reset();
+        return false;
+    }
+
+    serverThread_ = std::thread{[this] { server_->listen_after_bind(); }};
+    enabled_ = true;
+    return true;
+}
+
+void MetricsServer::Publish(std::string json)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    payload_ = std::move(json);
+}
+
+} // namespace colony
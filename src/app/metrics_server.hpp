@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace httplib
+{
+class Server;
+}
+
+namespace colony
+{
+
+// Opt-in localhost metrics endpoint for fleet monitoring. When the
+// COLONY_METRICS_PORT environment variable holds a valid port, an
+// httplib::Server is started on a background thread, bound to loopback only,
+// serving the most recently published JSON snapshot at GET /metrics.
+//
+// The server thread never touches application state: the UI thread renders
+// its counters into a JSON string about once a second and hands it over via
+// Publish; scrapes between publishes simply see the previous snapshot.
+class MetricsServer
+{
+  public:
+    // Defined in the translation unit: the members need httplib::Server to
+    // be a complete type, which only metrics_server.cpp pulls in.
+    MetricsServer();
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    // Starts serving if COLONY_METRICS_PORT is set to a port in [1, 65535].
+    // Returns whether the endpoint is up; failures log and leave the
+    // application running unobserved, exactly as if the variable were unset.
+    bool StartFromEnvironment();
+
+    [[nodiscard]] bool Enabled() const noexcept { return enabled_; }
+
+    // Replaces the snapshot served at /metrics.
+    void Publish(std::string json);
+
+  private:
+    std::unique_ptr<httplib::Server> server_;
+    std::thread serverThread_;
+    mutable std::mutex mutex_;
+    std::string payload_ = "{}";
+    bool enabled_ = false;
+};
+
+} // namespace colony
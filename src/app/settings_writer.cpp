@@ -0,0 +1,109 @@
+#include "app/settings_writer.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+namespace colony
+{
+
+SettingsWriter::~SettingsWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable())
+    {
+        worker_.join();
+    }
+}
+
+void SettingsWriter::Queue(std::filesystem::path path, std::string payload)
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (stopping_)
+        {
+            return;
+        }
+        pending_.emplace(std::move(path), std::move(payload));
+        if (!worker_.joinable())
+        {
+            worker_ = std::thread{&SettingsWriter::WorkerLoop, this};
+        }
+    }
+    wake_.notify_one();
+}
+
+void SettingsWriter::Flush()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    idle_.wait(lock, [this]() { return !pending_.has_value() && !writing_; });
+}
+
+void SettingsWriter::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true)
+    {
+        wake_.wait(lock, [this]() { return pending_.has_value() || stopping_; });
+
+        // Drain any pending payload even when stopping, so the final state
+        // queued before shutdown still reaches disk.
+        if (!pending_.has_value())
+        {
+            break;
+        }
+
+        auto work = std::move(*pending_);
+        pending_.reset();
+        writing_ = true;
+        lock.unlock();
+
+        WriteAtomically(work.first, work.second);
+
+        lock.lock();
+        writing_ = false;
+        idle_.notify_all();
+    }
+}
+
+void SettingsWriter::WriteAtomically(const std::filesystem::path& path, const std::string& payload)
+{
+    const std::filesystem::path directory = path.parent_path();
+    std::error_code error;
+    if (!directory.empty() && !std::filesystem::exists(directory, error))
+    {
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            std::cerr << "Unable to create settings directory: " << directory << '\n';
+            return;
+        }
+    }
+
+    const std::filesystem::path tempPath = path.string() + ".tmp";
+    {
+        std::ofstream output{tempPath, std::ios::trunc};
+        if (!output.is_open())
+        {
+            std::cerr << "Unable to write settings file: " << path << '\n';
+            return;
+        }
+        output << payload;
+        if (!output.good())
+        {
+            return;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::cerr << "Unable to replace settings file: " << path << '\n';
+    }
+}
+
+} // namespace colony
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace colony
+{
+
+// Write-behind persistence for the settings file. The UI thread hands over a
+// serialized payload and returns immediately; a worker thread writes it to a
+// temp file and renames it into place, so a crash mid-write can never leave
+// a torn settings file. Only the latest queued payload is written — queueing
+// replaces any payload the worker has not picked up yet.
+class SettingsWriter
+{
+public:
+    SettingsWriter() = default;
+    ~SettingsWriter();
+
+    SettingsWriter(const SettingsWriter&) = delete;
+    SettingsWriter& operator=(const SettingsWriter&) = delete;
+
+    // Queues the payload for asynchronous persistence to the path.
+    void Queue(std::filesystem::path path, std::string payload);
+
+    // Blocks until everything queued so far is on disk. Call at shutdown.
+    void Flush();
+
+private:
+    void WorkerLoop();
+
+    static void WriteAtomically(const std::filesystem::path& path, const std::string& payload);
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::optional<std::pair<std::filesystem::path, std::string>> pending_;
+    bool writing_ = false;
+    bool stopping_ = false;
+    std::thread worker_;
+};
+
+} // namespace colony
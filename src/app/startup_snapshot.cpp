@@ -0,0 +1,90 @@
+#include "app/startup_snapshot.hpp"
+
+#include <algorithm>
+#include <system_error>
+
+namespace colony
+{
+
+bool SaveStartupSnapshot(SDL_Renderer* renderer, const std::filesystem::path& file)
+{
+    if (renderer == nullptr)
+    {
+        return false;
+    }
+
+    int outputWidth = 0;
+    int outputHeight = 0;
+    if (SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight) != 0 || outputWidth <= 0
+        || outputHeight <= 0)
+    {
+        return false;
+    }
+
+    SDL_Surface* full =
+        SDL_CreateRGBSurfaceWithFormat(0, outputWidth, outputHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (full == nullptr)
+    {
+        return false;
+    }
+    if (SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA32, full->pixels, full->pitch) != 0)
+    {
+        SDL_FreeSurface(full);
+        return false;
+    }
+
+    const int halfWidth = std::max(1, outputWidth / 2);
+    const int halfHeight = std::max(1, outputHeight / 2);
+    SDL_Surface* half = SDL_CreateRGBSurfaceWithFormat(0, halfWidth, halfHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (half == nullptr)
+    {
+        SDL_FreeSurface(full);
+        return false;
+    }
+    SDL_Rect destination{0, 0, halfWidth, halfHeight};
+    SDL_SetSurfaceBlendMode(full, SDL_BLENDMODE_NONE);
+    SDL_BlitScaled(full, nullptr, half, &destination);
+    SDL_FreeSurface(full);
+
+    std::error_code directoryError;
+    std::filesystem::create_directories(file.parent_path(), directoryError);
+
+    std::filesystem::path temporary = file;
+    temporary += ".tmp";
+    const bool saved = SDL_SaveBMP(half, temporary.string().c_str()) == 0;
+    SDL_FreeSurface(half);
+    if (!saved)
+    {
+        std::error_code removeError;
+        std::filesystem::remove(temporary, removeError);
+        return false;
+    }
+
+    std::error_code renameError;
+    std::filesystem::rename(temporary, file, renameError);
+    return !renameError;
+}
+
+sdl::TextureHandle LoadStartupSnapshot(SDL_Renderer* renderer, const std::filesystem::path& file)
+{
+    if (renderer == nullptr)
+    {
+        return {};
+    }
+
+    SDL_Surface* surface = SDL_LoadBMP(file.string().c_str());
+    if (surface == nullptr)
+    {
+        return {};
+    }
+
+    sdl::TextureHandle texture{SDL_CreateTextureFromSurface(renderer, surface)};
+    SDL_FreeSurface(surface);
+    if (texture)
+    {
+        SDL_SetTextureBlendMode(texture.get(), SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+} // namespace colony
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "utils/sdl_wrappers.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <filesystem>
+
+namespace colony
+{
+
+// Persistence for the instant-on startup snapshot: the last presented frame
+// is written to disk at shutdown and splashed onto the very first frames of
+// the next launch, so a kiosk powering on shows the launcher immediately
+// instead of a black window while fonts and content initialize. The live UI
+// then cross-fades in over the snapshot.
+//
+// The snapshot is stored as a half-resolution BMP — it is only ever shown
+// stretched to the window for a fraction of a second, and halving each axis
+// keeps the file a quarter of a raw frame without pulling a codec into the
+// tree. A stale snapshot (theme or content changed since) is acceptable by
+// design; it is gone within the fade.
+
+// Reads back the renderer's current backbuffer and writes it to file via a
+// temp-and-rename, so a crash mid-write never leaves a torn splash. Must be
+// called after drawing a frame and before presenting it — the backbuffer's
+// contents are undefined once SDL_RenderPresent runs.
+bool SaveStartupSnapshot(SDL_Renderer* renderer, const std::filesystem::path& file);
+
+// Loads a previously saved snapshot into a texture, or an empty handle when
+// none exists or the file is unreadable (it is simply skipped — the worst
+// case is the black window we always had).
+[[nodiscard]] sdl::TextureHandle LoadStartupSnapshot(SDL_Renderer* renderer, const std::filesystem::path& file);
+
+} // namespace colony
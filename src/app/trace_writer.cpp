@@ -0,0 +1,77 @@
+#include "app/trace_writer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+namespace colony
+{
+
+TraceWriter& TraceWriter::Shared()
+{
+    static TraceWriter writer;
+    return writer;
+}
+
+TraceWriter::TraceWriter()
+{
+    const char* tracePath = std::getenv("COLONY_TRACE");
+    if (tracePath == nullptr || tracePath[0] == '\0')
+    {
+        return;
+    }
+
+    output_.open(tracePath, std::ios::trunc);
+    if (!output_.is_open())
+    {
+        std::cerr << "Unable to open trace output file: " << tracePath << '\n';
+        return;
+    }
+
+    output_ << "[\n";
+    origin_ = std::chrono::steady_clock::now();
+    enabled_ = true;
+}
+
+TraceWriter::~TraceWriter()
+{
+    if (!enabled_)
+    {
+        return;
+    }
+    // Close the JSON array for strict parsers; chrome://tracing also accepts
+    // a truncated file if the process dies before this runs.
+    output_ << "\n]\n";
+}
+
+void TraceWriter::WriteSpan(
+    std::string_view name,
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point end)
+{
+    if (!enabled_)
+    {
+        return;
+    }
+
+    const auto toMicros = [this](std::chrono::steady_clock::time_point point) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(point - origin_).count();
+    };
+    const long long ts = toMicros(start);
+    const long long dur = std::max(0LL, toMicros(end) - ts);
+    const auto tid =
+        static_cast<unsigned long long>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xffffffffULL);
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!firstEvent_)
+    {
+        output_ << ",\n";
+    }
+    firstEvent_ = false;
+    output_ << R"({"name":")" << name << R"(","ph":"X","ts":)" << ts << R"(,"dur":)" << dur
+            << R"(,"pid":1,"tid":)" << tid << '}';
+}
+
+} // namespace colony
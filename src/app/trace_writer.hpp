@@ -0,0 +1,89 @@
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+
+namespace colony
+{
+
+// Emits Trace Event Format spans consumable by chrome://tracing and Perfetto.
+// Tracing is opt-in via COLONY_TRACE=<path>; when the variable is unset every
+// instrumentation site reduces to one branch on a cached flag. Builds that
+// must not carry the instrumentation at all can define COLONY_DISABLE_TRACING
+// to compile the macros out entirely.
+class TraceWriter
+{
+  public:
+    [[nodiscard]] static TraceWriter& Shared();
+
+    [[nodiscard]] bool Enabled() const noexcept { return enabled_; }
+
+    // Emits a complete ("ph":"X") span. Safe to call from any thread; worker
+    // spans land on their own tracks via the thread id.
+    void WriteSpan(
+        std::string_view name,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end);
+
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+  private:
+    TraceWriter();
+
+    bool enabled_ = false;
+    std::chrono::steady_clock::time_point origin_{};
+    std::mutex mutex_;
+    std::ofstream output_;
+    bool firstEvent_ = true;
+};
+
+// RAII span covering its enclosing scope. Span names must outlive the guard;
+// instrumentation sites pass string literals.
+class ScopedTraceSpan
+{
+  public:
+    explicit ScopedTraceSpan(std::string_view name) noexcept
+    {
+        if (TraceWriter::Shared().Enabled())
+        {
+            name_ = name;
+            start_ = std::chrono::steady_clock::now();
+            active_ = true;
+        }
+    }
+
+    ~ScopedTraceSpan()
+    {
+        if (active_)
+        {
+            TraceWriter::Shared().WriteSpan(name_, start_, std::chrono::steady_clock::now());
+        }
+    }
+
+    ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+    ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+
+  private:
+    std::string_view name_;
+    std::chrono::steady_clock::time_point start_{};
+    bool active_ = false;
+};
+
+} // namespace colony
+
+#if defined(COLONY_DISABLE_TRACING)
+#define COLONY_TRACE_SCOPE(name) static_cast<void>(0)
+#else
+#define COLONY_TRACE_CONCAT_IMPL(a, b) a##b
+#define COLONY_TRACE_CONCAT(a, b) COLONY_TRACE_CONCAT_IMPL(a, b)
+#define COLONY_TRACE_SCOPE(name) \
+    ::colony::ScopedTraceSpan COLONY_TRACE_CONCAT(colonyTraceSpan, __LINE__) \
+    { \
+        name \
+    }
+#endif
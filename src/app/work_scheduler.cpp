@@ -0,0 +1,143 @@
+#include "app/work_scheduler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace colony
+{
+
+WorkScheduler::WorkScheduler(unsigned workerCount)
+{
+    if (workerCount == 0)
+    {
+        workerCount = std::clamp(std::thread::hardware_concurrency() / 2u, 1u, 2u);
+    }
+
+    workers_.reserve(workerCount);
+    for (unsigned index = 0; index < workerCount; ++index)
+    {
+        workers_.emplace_back(&WorkScheduler::WorkerLoop, this);
+    }
+}
+
+WorkScheduler::~WorkScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+    // Queued tasks and undrained completions are dropped: everything routed
+    // through the scheduler is speculative or re-creatable by design.
+}
+
+void WorkScheduler::Submit(Priority priority, Task task)
+{
+    if (!task)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (stopping_)
+        {
+            return;
+        }
+        queues_[static_cast<std::size_t>(priority)].push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+void WorkScheduler::PostCompletion(Completion completion)
+{
+    if (!completion)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (stopping_)
+    {
+        return;
+    }
+    completions_.push_back(std::move(completion));
+}
+
+std::size_t WorkScheduler::DrainCompletions(std::size_t budget)
+{
+    std::size_t ran = 0;
+    while (ran < budget)
+    {
+        Completion completion;
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (completions_.empty())
+            {
+                break;
+            }
+            completion = std::move(completions_.front());
+            completions_.pop_front();
+        }
+        completion();
+        ++ran;
+    }
+    return ran;
+}
+
+bool WorkScheduler::HasPendingCompletions() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return !completions_.empty();
+}
+
+void WorkScheduler::WorkerLoop()
+{
+    for (;;)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            wake_.wait(lock, [this] {
+                if (stopping_)
+                {
+                    return true;
+                }
+                for (const auto& queue : queues_)
+                {
+                    if (!queue.empty())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            });
+
+            if (stopping_)
+            {
+                return;
+            }
+
+            for (auto& queue : queues_)
+            {
+                if (!queue.empty())
+                {
+                    task = std::move(queue.front());
+                    queue.pop_front();
+                    break;
+                }
+            }
+        }
+
+        Completion completion = task();
+        if (completion)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            completions_.push_back(std::move(completion));
+        }
+    }
+}
+
+} // namespace colony
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace colony
+{
+
+// Small thread pool for background work that must not fight the frame:
+// cache warm-ups, index refreshes, prefetching. Tasks carry a priority and
+// workers always pick urgent before normal before idle, so a queue full of
+// speculative work never delays something the user is waiting on.
+//
+// A task may return a completion, which is queued for the UI thread and
+// drained with a fixed per-frame budget at one well-defined point in
+// RenderFrame — results are applied between frames instead of racing the
+// renderer. Latency for a completion that lands while the launcher is idle
+// is bounded by the idle wait timeout in the run loop.
+class WorkScheduler
+{
+  public:
+    enum class Priority
+    {
+        Urgent,
+        Normal,
+        Idle,
+    };
+
+    using Completion = std::function<void()>;
+    // Runs on a pool thread; the returned completion (may be empty) runs on
+    // the UI thread. Tasks must not touch SDL or UI state themselves.
+    using Task = std::function<Completion()>;
+
+    // workerCount 0 sizes the pool from the hardware, capped small — this
+    // pool exists to soak up idle time, not to saturate the machine.
+    explicit WorkScheduler(unsigned workerCount = 0);
+    ~WorkScheduler();
+
+    WorkScheduler(const WorkScheduler&) = delete;
+    WorkScheduler& operator=(const WorkScheduler&) = delete;
+
+    void Submit(Priority priority, Task task);
+
+    // Queues a completion directly for the UI thread without a pool round
+    // trip; the coroutine layer uses it to park a task until the next drain.
+    void PostCompletion(Completion completion);
+
+    // Runs up to budget queued completions on the calling (UI) thread and
+    // returns how many ran.
+    std::size_t DrainCompletions(std::size_t budget);
+
+    [[nodiscard]] bool HasPendingCompletions() const;
+
+  private:
+    void WorkerLoop();
+
+    static constexpr std::size_t kPriorityCount = 3;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::array<std::deque<Task>, kPriorityCount> queues_;
+    std::deque<Completion> completions_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace colony
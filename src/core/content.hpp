@@ -12,6 +12,8 @@ struct ViewSection
 {
     std::string title;
     std::vector<std::string> options;
+
+    [[nodiscard]] bool operator==(const ViewSection&) const = default;
 };
 
 struct ViewContent
@@ -29,6 +31,8 @@ struct ViewContent
     std::string availability;
     std::string lastLaunched;
     std::string accentColor{"#3B82F6"};
+
+    [[nodiscard]] bool operator==(const ViewContent&) const = default;
 };
 
 struct Channel
@@ -36,12 +40,21 @@ struct Channel
     std::string id;
     std::string label;
     std::vector<std::string> programs;
+    // Manifest catalogs keep a channel's programs and views in a separate
+    // shard file; programs stays empty until the shard is merged. The path
+    // is relative to the root content file.
+    std::string shardPath;
+    bool shardLoaded = false;
+
+    [[nodiscard]] bool operator==(const Channel&) const = default;
 };
 
 struct UserProfile
 {
     std::string name{"Operator"};
     std::string status{"Offline"};
+
+    [[nodiscard]] bool operator==(const UserProfile&) const = default;
 };
 
 struct HubBranch
@@ -55,6 +68,8 @@ struct HubBranch
     std::vector<std::string> tagLocalizationKeys;
     std::string actionLocalizationKey;
     std::string metricsLocalizationKey;
+
+    [[nodiscard]] bool operator==(const HubBranch&) const = default;
 };
 
 struct HubWidget
@@ -64,6 +79,8 @@ struct HubWidget
     std::string descriptionLocalizationKey;
     std::vector<std::string> itemLocalizationKeys;
     std::string accentColor;
+
+    [[nodiscard]] bool operator==(const HubWidget&) const = default;
 };
 
 struct HubConfiguration
@@ -75,6 +92,8 @@ struct HubConfiguration
     std::string primaryActionDescriptionLocalizationKey;
     std::vector<HubWidget> widgets;
     std::vector<HubBranch> branches;
+
+    [[nodiscard]] bool operator==(const HubConfiguration&) const = default;
 };
 
 struct AppContent
@@ -0,0 +1,603 @@
+#include "core/content_cache.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace colony
+{
+namespace
+{
+constexpr char kCacheMagic[4] = {'C', 'L', 'N', 'C'};
+
+// Bump whenever the serialized layout of AppContent (or any nested struct)
+// changes; stale caches are then rebuilt transparently from the JSON.
+constexpr std::uint32_t kCacheFormatVersion = 2;
+
+// Fixed header preceding the record stream: magic, format version, source
+// hash, then the offset and length of the string blob at the file's tail.
+constexpr std::size_t kHeaderSize = sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t) + sizeof(std::uint32_t) * 2;
+
+std::uint64_t HashBytes(const std::string& bytes)
+{
+    // FNV-1a, 64-bit.
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const char byte : bytes)
+    {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool ReadFileBytes(const std::filesystem::path& path, std::string& outBytes)
+{
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream.is_open())
+    {
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    outBytes = buffer.str();
+    return true;
+}
+
+// Builds the record stream and the deduplicated string blob the cache file
+// is assembled from. Strings are written as (offset, length) references into
+// the blob — position-independent, like the localization bundle, so the
+// finished file can be memory-mapped at any address — and identical strings
+// share one blob range, which catalogs full of repeated install states and
+// accent colors compress well under.
+class Writer
+{
+  public:
+    void WriteU32(std::uint32_t value)
+    {
+        Append(&value, sizeof(value));
+    }
+
+    void WriteU64(std::uint64_t value)
+    {
+        Append(&value, sizeof(value));
+    }
+
+    void WriteString(const std::string& value)
+    {
+        const auto [it, inserted] = internTable_.try_emplace(value, static_cast<std::uint32_t>(blob_.size()));
+        if (inserted)
+        {
+            blob_.append(value);
+        }
+        WriteU32(it->second);
+        WriteU32(static_cast<std::uint32_t>(value.size()));
+    }
+
+    void WriteStringVector(const std::vector<std::string>& values)
+    {
+        WriteU32(static_cast<std::uint32_t>(values.size()));
+        for (const std::string& value : values)
+        {
+            WriteString(value);
+        }
+    }
+
+    // Assembles header, record stream and blob into the final file image.
+    [[nodiscard]] std::string Finish(std::uint64_t sourceHash) const
+    {
+        std::string bytes;
+        bytes.reserve(kHeaderSize + records_.size() + blob_.size());
+        const auto append = [&bytes](const void* data, std::size_t size) {
+            bytes.append(static_cast<const char*>(data), size);
+        };
+
+        std::uint32_t magic = 0;
+        std::memcpy(&magic, kCacheMagic, sizeof(magic));
+        const std::uint32_t version = kCacheFormatVersion;
+        const std::uint32_t blobOffset = static_cast<std::uint32_t>(kHeaderSize + records_.size());
+        const std::uint32_t blobLength = static_cast<std::uint32_t>(blob_.size());
+        append(&magic, sizeof(magic));
+        append(&version, sizeof(version));
+        append(&sourceHash, sizeof(sourceHash));
+        append(&blobOffset, sizeof(blobOffset));
+        append(&blobLength, sizeof(blobLength));
+        bytes.append(records_);
+        bytes.append(blob_);
+        return bytes;
+    }
+
+  private:
+    void Append(const void* data, std::size_t size)
+    {
+        records_.append(static_cast<const char*>(data), size);
+    }
+
+    std::string records_;
+    std::string blob_;
+    std::unordered_map<std::string, std::uint32_t> internTable_;
+};
+
+// Decodes the record stream of a mapped cache file. Strings resolve through
+// (offset, length) references into the shared blob; every reference is
+// bounds-checked so a truncated or corrupt cache fails the load instead of
+// reading past the end of the mapping.
+class Reader
+{
+  public:
+    Reader(const char* records, std::size_t recordBytes, const char* blob, std::uint32_t blobLength)
+        : records_{records}
+        , recordBytes_{recordBytes}
+        , blob_{blob}
+        , blobLength_{blobLength}
+    {
+    }
+
+    bool ReadU32(std::uint32_t& value)
+    {
+        return Extract(&value, sizeof(value));
+    }
+
+    bool ReadU64(std::uint64_t& value)
+    {
+        return Extract(&value, sizeof(value));
+    }
+
+    bool ReadString(std::string& value)
+    {
+        std::uint32_t blobOffset = 0;
+        std::uint32_t length = 0;
+        if (!ReadU32(blobOffset) || !ReadU32(length) || blobOffset > blobLength_
+            || length > blobLength_ - blobOffset)
+        {
+            return false;
+        }
+        value.assign(blob_ + blobOffset, length);
+        return true;
+    }
+
+    bool ReadStringVector(std::vector<std::string>& values)
+    {
+        std::uint32_t count = 0;
+        if (!ReadU32(count))
+        {
+            return false;
+        }
+        values.clear();
+        values.reserve(count);
+        for (std::uint32_t index = 0; index < count; ++index)
+        {
+            std::string value;
+            if (!ReadString(value))
+            {
+                return false;
+            }
+            values.push_back(std::move(value));
+        }
+        return true;
+    }
+
+  private:
+    bool Extract(void* target, std::size_t size)
+    {
+        if (recordBytes_ - offset_ < size)
+        {
+            return false;
+        }
+        std::memcpy(target, records_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    const char* records_;
+    std::size_t recordBytes_;
+    const char* blob_;
+    std::uint32_t blobLength_;
+    std::size_t offset_ = 0;
+};
+
+#if !defined(_WIN32)
+
+// Read-only mapping of the cache file. Multi-seat hosts run several launcher
+// instances against the same catalog; mapping instead of streaming means the
+// page cache backs every instance with one physical copy of the file. On
+// Windows the load falls back to streaming the file into memory — the
+// position-independent layout reads identically either way.
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile()
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat info = {};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        const std::size_t size = static_cast<std::size_t>(info.st_size);
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+        data_ = static_cast<const char*>(mapping);
+        size_ = size;
+        return true;
+    }
+
+    [[nodiscard]] const char* Data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t Size() const noexcept { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+#endif // !defined(_WIN32)
+
+void WriteViewContent(Writer& writer, const ViewContent& view)
+{
+    writer.WriteString(view.heading);
+    writer.WriteString(view.tagline);
+    writer.WriteStringVector(view.paragraphs);
+    writer.WriteU32(static_cast<std::uint32_t>(view.sections.size()));
+    for (const ViewSection& section : view.sections)
+    {
+        writer.WriteString(section.title);
+        writer.WriteStringVector(section.options);
+    }
+    writer.WriteStringVector(view.heroHighlights);
+    writer.WriteString(view.heroGradient[0]);
+    writer.WriteString(view.heroGradient[1]);
+    writer.WriteString(view.primaryActionLabel);
+    writer.WriteString(view.statusMessage);
+    writer.WriteString(view.version);
+    writer.WriteString(view.installState);
+    writer.WriteString(view.availability);
+    writer.WriteString(view.lastLaunched);
+    writer.WriteString(view.accentColor);
+}
+
+bool ReadViewContent(Reader& reader, ViewContent& view)
+{
+    if (!reader.ReadString(view.heading) || !reader.ReadString(view.tagline)
+        || !reader.ReadStringVector(view.paragraphs))
+    {
+        return false;
+    }
+
+    std::uint32_t sectionCount = 0;
+    if (!reader.ReadU32(sectionCount))
+    {
+        return false;
+    }
+    view.sections.clear();
+    view.sections.reserve(sectionCount);
+    for (std::uint32_t index = 0; index < sectionCount; ++index)
+    {
+        ViewSection section;
+        if (!reader.ReadString(section.title) || !reader.ReadStringVector(section.options))
+        {
+            return false;
+        }
+        view.sections.push_back(std::move(section));
+    }
+
+    return reader.ReadStringVector(view.heroHighlights) && reader.ReadString(view.heroGradient[0])
+        && reader.ReadString(view.heroGradient[1]) && reader.ReadString(view.primaryActionLabel)
+        && reader.ReadString(view.statusMessage) && reader.ReadString(view.version)
+        && reader.ReadString(view.installState) && reader.ReadString(view.availability)
+        && reader.ReadString(view.lastLaunched) && reader.ReadString(view.accentColor);
+}
+
+void WriteHubBranch(Writer& writer, const HubBranch& branch)
+{
+    writer.WriteString(branch.id);
+    writer.WriteString(branch.titleLocalizationKey);
+    writer.WriteString(branch.descriptionLocalizationKey);
+    writer.WriteString(branch.accentColor);
+    writer.WriteString(branch.channelId);
+    writer.WriteString(branch.programId);
+    writer.WriteStringVector(branch.tagLocalizationKeys);
+    writer.WriteString(branch.actionLocalizationKey);
+    writer.WriteString(branch.metricsLocalizationKey);
+}
+
+bool ReadHubBranch(Reader& reader, HubBranch& branch)
+{
+    return reader.ReadString(branch.id) && reader.ReadString(branch.titleLocalizationKey)
+        && reader.ReadString(branch.descriptionLocalizationKey) && reader.ReadString(branch.accentColor)
+        && reader.ReadString(branch.channelId) && reader.ReadString(branch.programId)
+        && reader.ReadStringVector(branch.tagLocalizationKeys) && reader.ReadString(branch.actionLocalizationKey)
+        && reader.ReadString(branch.metricsLocalizationKey);
+}
+
+void WriteHubWidget(Writer& writer, const HubWidget& widget)
+{
+    writer.WriteString(widget.id);
+    writer.WriteString(widget.titleLocalizationKey);
+    writer.WriteString(widget.descriptionLocalizationKey);
+    writer.WriteStringVector(widget.itemLocalizationKeys);
+    writer.WriteString(widget.accentColor);
+}
+
+bool ReadHubWidget(Reader& reader, HubWidget& widget)
+{
+    return reader.ReadString(widget.id) && reader.ReadString(widget.titleLocalizationKey)
+        && reader.ReadString(widget.descriptionLocalizationKey)
+        && reader.ReadStringVector(widget.itemLocalizationKeys) && reader.ReadString(widget.accentColor);
+}
+
+void WriteContent(Writer& writer, const AppContent& content)
+{
+    writer.WriteString(content.brandName);
+    writer.WriteString(content.user.name);
+    writer.WriteString(content.user.status);
+
+    writer.WriteU32(static_cast<std::uint32_t>(content.channels.size()));
+    for (const Channel& channel : content.channels)
+    {
+        writer.WriteString(channel.id);
+        writer.WriteString(channel.label);
+        writer.WriteStringVector(channel.programs);
+    }
+
+    writer.WriteU32(static_cast<std::uint32_t>(content.views.size()));
+    for (const auto& [id, view] : content.views)
+    {
+        writer.WriteString(id);
+        WriteViewContent(writer, view);
+    }
+
+    const HubConfiguration& hub = content.hub;
+    writer.WriteString(hub.headlineLocalizationKey);
+    writer.WriteString(hub.descriptionLocalizationKey);
+    writer.WriteStringVector(hub.highlightLocalizationKeys);
+    writer.WriteString(hub.primaryActionLocalizationKey);
+    writer.WriteString(hub.primaryActionDescriptionLocalizationKey);
+    writer.WriteU32(static_cast<std::uint32_t>(hub.widgets.size()));
+    for (const HubWidget& widget : hub.widgets)
+    {
+        WriteHubWidget(writer, widget);
+    }
+    writer.WriteU32(static_cast<std::uint32_t>(hub.branches.size()));
+    for (const HubBranch& branch : hub.branches)
+    {
+        WriteHubBranch(writer, branch);
+    }
+}
+
+bool ReadContent(Reader& reader, AppContent& content)
+{
+    if (!reader.ReadString(content.brandName) || !reader.ReadString(content.user.name)
+        || !reader.ReadString(content.user.status))
+    {
+        return false;
+    }
+
+    std::uint32_t channelCount = 0;
+    if (!reader.ReadU32(channelCount))
+    {
+        return false;
+    }
+    content.channels.clear();
+    content.channels.reserve(channelCount);
+    for (std::uint32_t index = 0; index < channelCount; ++index)
+    {
+        Channel channel;
+        if (!reader.ReadString(channel.id) || !reader.ReadString(channel.label)
+            || !reader.ReadStringVector(channel.programs))
+        {
+            return false;
+        }
+        content.channels.push_back(std::move(channel));
+    }
+
+    std::uint32_t viewCount = 0;
+    if (!reader.ReadU32(viewCount))
+    {
+        return false;
+    }
+    content.views.clear();
+    content.views.reserve(viewCount);
+    for (std::uint32_t index = 0; index < viewCount; ++index)
+    {
+        std::string id;
+        ViewContent view;
+        if (!reader.ReadString(id) || !ReadViewContent(reader, view))
+        {
+            return false;
+        }
+        content.views.emplace(std::move(id), std::move(view));
+    }
+
+    HubConfiguration& hub = content.hub;
+    if (!reader.ReadString(hub.headlineLocalizationKey) || !reader.ReadString(hub.descriptionLocalizationKey)
+        || !reader.ReadStringVector(hub.highlightLocalizationKeys)
+        || !reader.ReadString(hub.primaryActionLocalizationKey)
+        || !reader.ReadString(hub.primaryActionDescriptionLocalizationKey))
+    {
+        return false;
+    }
+
+    std::uint32_t widgetCount = 0;
+    if (!reader.ReadU32(widgetCount))
+    {
+        return false;
+    }
+    hub.widgets.clear();
+    hub.widgets.reserve(widgetCount);
+    for (std::uint32_t index = 0; index < widgetCount; ++index)
+    {
+        HubWidget widget;
+        if (!ReadHubWidget(reader, widget))
+        {
+            return false;
+        }
+        hub.widgets.push_back(std::move(widget));
+    }
+
+    std::uint32_t branchCount = 0;
+    if (!reader.ReadU32(branchCount))
+    {
+        return false;
+    }
+    hub.branches.clear();
+    hub.branches.reserve(branchCount);
+    for (std::uint32_t index = 0; index < branchCount; ++index)
+    {
+        HubBranch branch;
+        if (!ReadHubBranch(reader, branch))
+        {
+            return false;
+        }
+        hub.branches.push_back(std::move(branch));
+    }
+
+    return true;
+}
+
+} // namespace
+
+std::filesystem::path ContentCachePathFor(const std::filesystem::path& contentPath)
+{
+    std::filesystem::path cachePath = contentPath;
+    cachePath += ".cache";
+    return cachePath;
+}
+
+std::optional<AppContent> TryLoadContentCache(const std::filesystem::path& contentPath)
+{
+    std::string sourceBytes;
+    if (!ReadFileBytes(contentPath, sourceBytes))
+    {
+        return std::nullopt;
+    }
+
+#if !defined(_WIN32)
+    MappedFile cache;
+    if (!cache.Open(ContentCachePathFor(contentPath)))
+    {
+        return std::nullopt;
+    }
+    const char* data = cache.Data();
+    const std::size_t cacheSize = cache.Size();
+#else
+    std::string cacheBytes;
+    if (!ReadFileBytes(ContentCachePathFor(contentPath), cacheBytes))
+    {
+        return std::nullopt;
+    }
+    const char* data = cacheBytes.data();
+    const std::size_t cacheSize = cacheBytes.size();
+#endif
+    if (cacheSize < kHeaderSize)
+    {
+        return std::nullopt;
+    }
+
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint64_t sourceHash = 0;
+    std::uint32_t blobOffset = 0;
+    std::uint32_t blobLength = 0;
+    std::size_t cursor = 0;
+    const auto extract = [&](void* target, std::size_t size) {
+        std::memcpy(target, data + cursor, size);
+        cursor += size;
+    };
+    extract(magic, sizeof(magic));
+    extract(&version, sizeof(version));
+    extract(&sourceHash, sizeof(sourceHash));
+    extract(&blobOffset, sizeof(blobOffset));
+    extract(&blobLength, sizeof(blobLength));
+
+    if (std::memcmp(magic, kCacheMagic, sizeof(magic)) != 0 || version != kCacheFormatVersion
+        || sourceHash != HashBytes(sourceBytes))
+    {
+        return std::nullopt;
+    }
+    if (blobOffset < kHeaderSize || blobOffset > cacheSize || blobLength > cacheSize - blobOffset)
+    {
+        return std::nullopt;
+    }
+
+    Reader reader{data + kHeaderSize, blobOffset - kHeaderSize, data + blobOffset, blobLength};
+    AppContent content;
+    if (!ReadContent(reader, content))
+    {
+        return std::nullopt;
+    }
+    return content;
+}
+
+bool WriteContentCache(const std::filesystem::path& contentPath, const AppContent& content)
+{
+    std::string sourceBytes;
+    if (!ReadFileBytes(contentPath, sourceBytes))
+    {
+        return false;
+    }
+
+    Writer writer;
+    WriteContent(writer, content);
+    const std::string bytes = writer.Finish(HashBytes(sourceBytes));
+
+    const std::filesystem::path cachePath = ContentCachePathFor(contentPath);
+    std::filesystem::path temporaryPath = cachePath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream stream{temporaryPath, std::ios::binary | std::ios::trunc};
+        if (!stream.is_open())
+        {
+            return false;
+        }
+        stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!stream.good())
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, cachePath, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+} // namespace colony
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "core/content.hpp"
+
+#include <filesystem>
+#include <optional>
+
+namespace colony
+{
+
+// Versioned binary cache of a parsed AppContent, written next to the source
+// JSON. The cache header stores a hash of the JSON bytes, so a warm startup
+// can skip the DOM parse and field validation entirely and fall back to the
+// JSON path only when the source actually changed.
+//
+// The file is a fixed record stream over a deduplicated string blob,
+// referenced by position-independent offsets — no embedded pointers — and is
+// loaded through a read-only memory mapping. Multi-seat hosts running
+// several launcher instances against the same catalog therefore share one
+// physical copy of the cache bytes through the page cache, the same way the
+// compiled localization bundle is shared.
+
+// Location of the cache file for a given content.json path.
+[[nodiscard]] std::filesystem::path ContentCachePathFor(const std::filesystem::path& contentPath);
+
+// Loads the cached AppContent if the cache exists, matches the current
+// format version and was built from the JSON bytes currently on disk.
+// Returns std::nullopt on any mismatch or read error.
+[[nodiscard]] std::optional<AppContent> TryLoadContentCache(const std::filesystem::path& contentPath);
+
+// Serializes content into the cache file for contentPath. Best effort: the
+// cache is written to a temporary file and renamed into place; failures are
+// reported through the return value and never throw.
+bool WriteContentCache(const std::filesystem::path& contentPath, const AppContent& content);
+
+} // namespace colony
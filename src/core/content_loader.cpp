@@ -1,10 +1,20 @@
 #include "core/content_loader.hpp"
 
+#include "core/json_arena.hpp"
 #include "json.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
 #include <fstream>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace colony
 {
@@ -16,6 +26,15 @@ const char* kUserKey = "user";
 const char* kBrandKey = "brand";
 const char* kHubKey = "hub";
 
+// Files at or above this size take the SAX path in LoadFromFile; smaller
+// files keep the simpler DOM parse, where the tree overhead is negligible.
+constexpr std::uintmax_t kStreamingParseThresholdBytes = 4ull * 1024ull * 1024ull;
+
+// Catalogs below this many views per worker parse faster on one core than
+// they would after paying thread spawn and shard-merge overhead.
+constexpr std::size_t kMinViewsPerParseWorker = 64;
+constexpr std::size_t kMaxViewParseWorkers = 8;
+
 std::ifstream OpenFile(const std::string& filePath)
 {
     std::ifstream input{filePath};
@@ -30,25 +49,181 @@ std::ifstream OpenFile(const std::string& filePath)
 
 AppContent ContentValidator::LoadFromFile(const std::string& filePath) const
 {
+    std::error_code sizeError;
+    const std::uintmax_t fileSize = std::filesystem::file_size(filePath, sizeError);
+    if (!sizeError && fileSize >= kStreamingParseThresholdBytes)
+    {
+        return LoadFromFileStreaming(filePath);
+    }
+
     auto input = OpenFile(filePath);
-    const nlohmann::json document = nlohmann::json::parse(input);
+    // The DOM and every string in it live in the arena; extraction copies
+    // into AppContent's owning strings and the whole tree is released in one
+    // step when the arena leaves scope.
+    JsonArena arena;
+    JsonArenaScope scope{arena};
+    const ArenaJson document = ArenaJson::parse(input);
     return ParseDocument(document);
 }
 
-AppContent ContentValidator::ParseDocument(const nlohmann::json& document) const
+ChannelShard ContentValidator::LoadChannelShardFromFile(const std::string& filePath) const
+{
+    auto input = OpenFile(filePath);
+    JsonArena arena;
+    JsonArenaScope scope{arena};
+    const ArenaJson document = ArenaJson::parse(input);
+
+    ChannelShard shard;
+    if (!document.contains("programs") || !document["programs"].is_array())
+    {
+        throw std::runtime_error("Channel shard \"" + filePath + "\" missing \"programs\" array.");
+    }
+    for (const auto& programJson : document["programs"])
+    {
+        if (!programJson.is_string() || programJson.get<std::string>().empty())
+        {
+            throw std::runtime_error("Channel shard \"" + filePath + "\" has an invalid program entry.");
+        }
+        shard.programs.emplace_back(programJson.get<std::string>());
+    }
+
+    if (!document.contains(kViewsKey) || !document[kViewsKey].is_object())
+    {
+        throw std::runtime_error("Channel shard \"" + filePath + "\" missing \"views\" object.");
+    }
+    for (const auto& [id, value] : document[kViewsKey].items())
+    {
+        const std::string viewId{std::string_view{id}};
+        shard.views.emplace(viewId, ParseViewContent(viewId, value));
+    }
+
+    // A shard is self-contained: every program it lists must be described in
+    // the same file, so merging one never leaves dangling references.
+    for (const auto& programId : shard.programs)
+    {
+        if (shard.views.find(programId) == shard.views.end())
+        {
+            throw std::runtime_error(
+                "Channel shard \"" + filePath + "\" references unknown program id \"" + programId + "\".");
+        }
+    }
+
+    return shard;
+}
+
+template <typename JsonType>
+AppContent ContentValidator::ParseDocument(const JsonType& document) const
 {
     AppContent content;
     content.brandName = document.value(kBrandKey, "COLONY");
 
-    ParseUserSection(document, content);
-    ParseViewsSection(document, content);
-    ParseChannelsSection(document, content);
-    ParseHubSection(document, content);
+    if (!TryParseDocumentParallel(document, content))
+    {
+        ParseUserSection(document, content);
+        ParseViewsSection(document, content);
+        ParseChannelsSection(document, content);
+        ValidateChannelReferences(content);
+        ParseHubSection(document, content);
+    }
 
     return content;
 }
 
-void ContentValidator::ParseHubSection(const nlohmann::json& document, AppContent& content) const
+// The views section dwarfs the rest of a large catalog, so its entries are
+// striped across a small thread pool — each worker extracts its share into a
+// private shard — while the calling thread parses the user, channels and hub
+// sections. Workers only read the finished DOM; no JsonArenaScope is active
+// on them, so the transient strings they build fall back to the heap by the
+// allocator's design. Returns false when the catalog is too small for the
+// spawn cost to pay off, leaving the caller on the sequential path.
+template <typename JsonType>
+bool ContentValidator::TryParseDocumentParallel(const JsonType& document, AppContent& content) const
+{
+    if (!document.contains(kViewsKey) || !document[kViewsKey].is_object())
+    {
+        throw std::runtime_error("Content file missing \"views\" object.");
+    }
+    const auto& viewsJson = document[kViewsKey];
+
+    std::vector<std::pair<std::string, const JsonType*>> entries;
+    entries.reserve(viewsJson.size());
+    for (auto it = viewsJson.begin(); it != viewsJson.end(); ++it)
+    {
+        entries.emplace_back(std::string{std::string_view{it.key()}}, &it.value());
+    }
+
+    const std::size_t hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const std::size_t workerCount =
+        std::min({hardware, kMaxViewParseWorkers, entries.size() / kMinViewsPerParseWorker});
+    if (workerCount < 2)
+    {
+        return false;
+    }
+
+    std::vector<std::unordered_map<std::string, ViewContent>> shards(workerCount);
+    std::vector<std::exception_ptr> workerErrors(workerCount);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (std::size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.emplace_back([&, workerIndex] {
+            try
+            {
+                auto& shard = shards[workerIndex];
+                for (std::size_t i = workerIndex; i < entries.size(); i += workerCount)
+                {
+                    shard.emplace(entries[i].first, ParseViewContent(entries[i].first, *entries[i].second));
+                }
+            }
+            catch (...)
+            {
+                workerErrors[workerIndex] = std::current_exception();
+            }
+        });
+    }
+
+    // The remaining sections are tiny by comparison; handle them here while
+    // the pool chews through views. Their errors must still wait for the
+    // join — workers hold references into this frame.
+    std::exception_ptr sectionError;
+    try
+    {
+        ParseUserSection(document, content);
+        ParseChannelsSection(document, content);
+        ParseHubSection(document, content);
+    }
+    catch (...)
+    {
+        sectionError = std::current_exception();
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    if (sectionError)
+    {
+        std::rethrow_exception(sectionError);
+    }
+    for (const auto& workerError : workerErrors)
+    {
+        if (workerError)
+        {
+            std::rethrow_exception(workerError);
+        }
+    }
+
+    content.views.reserve(entries.size());
+    for (auto& shard : shards)
+    {
+        content.views.merge(shard);
+    }
+    ValidateChannelReferences(content);
+    return true;
+}
+
+template <typename JsonType>
+void ContentValidator::ParseHubSection(const JsonType& document, AppContent& content) const
 {
     content.hub = {};
 
@@ -57,18 +232,23 @@ void ContentValidator::ParseHubSection(const nlohmann::json& document, AppConten
         return;
     }
 
-    const auto& hubJson = document[kHubKey];
+    ParseHubValue(document[kHubKey], content);
+}
+
+template <typename JsonType>
+void ContentValidator::ParseHubValue(const JsonType& hubJson, AppContent& content) const
+{
     if (!hubJson.is_object())
     {
         throw std::runtime_error("Content file field \"hub\" must be an object.");
     }
 
-    auto requireString = [](const nlohmann::json& node, const char* field) -> std::string {
+    auto requireString = [](const JsonType& node, const char* field) -> std::string {
         if (!node.contains(field) || !node[field].is_string())
         {
             throw std::runtime_error(std::string{"Hub field \""} + field + "\" must be a string.");
         }
-        const std::string value = node[field].get<std::string>();
+        const std::string value = node[field].template get<std::string>();
         if (value.empty())
         {
             throw std::runtime_error(std::string{"Hub field \""} + field + "\" must not be empty.");
@@ -95,7 +275,7 @@ void ContentValidator::ParseHubSection(const nlohmann::json& document, AppConten
             {
                 throw std::runtime_error("Each hub highlight entry must be a string.");
             }
-            const std::string highlightKey = highlight.get<std::string>();
+            const std::string highlightKey = highlight.template get<std::string>();
             if (!highlightKey.empty())
             {
                 content.hub.highlightLocalizationKeys.push_back(highlightKey);
@@ -134,19 +314,20 @@ void ContentValidator::ParseHubSection(const nlohmann::json& document, AppConten
     }
 }
 
-HubBranch ContentValidator::ParseHubBranch(const nlohmann::json& json) const
+template <typename JsonType>
+HubBranch ContentValidator::ParseHubBranch(const JsonType& json) const
 {
     if (!json.is_object())
     {
         throw std::runtime_error("Each hub branch entry must be a JSON object.");
     }
 
-    auto requireString = [](const nlohmann::json& node, const char* field) -> std::string {
+    auto requireString = [](const JsonType& node, const char* field) -> std::string {
         if (!node.contains(field) || !node[field].is_string())
         {
             throw std::runtime_error(std::string{"Hub branch field \""} + field + "\" must be a string.");
         }
-        const std::string value = node[field].get<std::string>();
+        const std::string value = node[field].template get<std::string>();
         if (value.empty())
         {
             throw std::runtime_error(std::string{"Hub branch field \""} + field + "\" must not be empty.");
@@ -174,7 +355,7 @@ HubBranch ContentValidator::ParseHubBranch(const nlohmann::json& json) const
             {
                 throw std::runtime_error("Each hub branch tag must be a string.");
             }
-            const std::string tagKey = tagJson.get<std::string>();
+            const std::string tagKey = tagJson.template get<std::string>();
             if (!tagKey.empty())
             {
                 branch.tagLocalizationKeys.push_back(tagKey);
@@ -186,19 +367,20 @@ HubBranch ContentValidator::ParseHubBranch(const nlohmann::json& json) const
     return branch;
 }
 
-HubWidget ContentValidator::ParseHubWidget(const nlohmann::json& json) const
+template <typename JsonType>
+HubWidget ContentValidator::ParseHubWidget(const JsonType& json) const
 {
     if (!json.is_object())
     {
         throw std::runtime_error("Each hub widget entry must be a JSON object.");
     }
 
-    auto requireString = [](const nlohmann::json& node, const char* field) -> std::string {
+    auto requireString = [](const JsonType& node, const char* field) -> std::string {
         if (!node.contains(field) || !node[field].is_string())
         {
             throw std::runtime_error(std::string{"Hub widget field \""} + field + "\" must be a string.");
         }
-        const std::string value = node[field].get<std::string>();
+        const std::string value = node[field].template get<std::string>();
         if (value.empty())
         {
             throw std::runtime_error(std::string{"Hub widget field \""} + field + "\" must not be empty.");
@@ -225,7 +407,7 @@ HubWidget ContentValidator::ParseHubWidget(const nlohmann::json& json) const
             {
                 throw std::runtime_error("Each hub widget item must be a string.");
             }
-            const std::string itemKey = itemJson.get<std::string>();
+            const std::string itemKey = itemJson.template get<std::string>();
             if (!itemKey.empty())
             {
                 widget.itemLocalizationKeys.push_back(itemKey);
@@ -236,14 +418,20 @@ HubWidget ContentValidator::ParseHubWidget(const nlohmann::json& json) const
     return widget;
 }
 
-void ContentValidator::ParseUserSection(const nlohmann::json& document, AppContent& content) const
+template <typename JsonType>
+void ContentValidator::ParseUserSection(const JsonType& document, AppContent& content) const
 {
     if (!document.contains(kUserKey))
     {
         return;
     }
 
-    const auto& userJson = document[kUserKey];
+    ParseUserValue(document[kUserKey], content);
+}
+
+template <typename JsonType>
+void ContentValidator::ParseUserValue(const JsonType& userJson, AppContent& content) const
+{
     if (!userJson.is_object())
     {
         throw std::runtime_error("Content file field \"user\" must be an object.");
@@ -255,7 +443,7 @@ void ContentValidator::ParseUserSection(const nlohmann::json& document, AppConte
         {
             throw std::runtime_error("User name must be a string.");
         }
-        content.user.name = userJson["name"].get<std::string>();
+        content.user.name = userJson["name"].template get<std::string>();
     }
 
     if (userJson.contains("status"))
@@ -264,11 +452,12 @@ void ContentValidator::ParseUserSection(const nlohmann::json& document, AppConte
         {
             throw std::runtime_error("User status must be a string.");
         }
-        content.user.status = userJson["status"].get<std::string>();
+        content.user.status = userJson["status"].template get<std::string>();
     }
 }
 
-void ContentValidator::ParseViewsSection(const nlohmann::json& document, AppContent& content) const
+template <typename JsonType>
+void ContentValidator::ParseViewsSection(const JsonType& document, AppContent& content) const
 {
     if (!document.contains(kViewsKey) || !document[kViewsKey].is_object())
     {
@@ -282,29 +471,31 @@ void ContentValidator::ParseViewsSection(const nlohmann::json& document, AppCont
 
     for (const auto& [id, value] : document[kViewsKey].items())
     {
-        if (!value.is_object())
-        {
-            throw std::runtime_error("View \"" + id + "\" must be a JSON object.");
-        }
-        content.views.emplace(id, ParseViewContent(id, value));
+        const std::string viewId{std::string_view{id}};
+        content.views.emplace(viewId, ParseViewContent(viewId, value));
     }
 }
 
-ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const nlohmann::json& json) const
+template <typename JsonType>
+ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const JsonType& json) const
 {
-    if (!json.contains("heading") || !json["heading"].is_string() || json["heading"].get<std::string>().empty())
+    if (!json.is_object())
+    {
+        throw std::runtime_error("View \"" + viewId + "\" must be a JSON object.");
+    }
+    if (!json.contains("heading") || !json["heading"].is_string() || json["heading"].template get<std::string>().empty())
     {
         throw std::runtime_error("View \"" + viewId + "\" requires a non-empty heading.");
     }
     if (!json.contains("primaryActionLabel") || !json["primaryActionLabel"].is_string()
-        || json["primaryActionLabel"].get<std::string>().empty())
+        || json["primaryActionLabel"].template get<std::string>().empty())
     {
         throw std::runtime_error("View \"" + viewId + "\" requires a non-empty primaryActionLabel.");
     }
 
     ViewContent content;
-    content.heading = json["heading"].get<std::string>();
-    content.primaryActionLabel = json["primaryActionLabel"].get<std::string>();
+    content.heading = json["heading"].template get<std::string>();
+    content.primaryActionLabel = json["primaryActionLabel"].template get<std::string>();
     content.statusMessage = json.value("statusMessage", "");
     content.tagline = json.value("tagline", "");
     content.version = json.value("version", "");
@@ -325,7 +516,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
             {
                 throw std::runtime_error("View \"" + viewId + "\" heroGradient entries must be strings.");
             }
-            content.heroGradient[i] = json["heroGradient"][i].get<std::string>();
+            content.heroGradient[i] = json["heroGradient"][i].template get<std::string>();
         }
     }
 
@@ -341,7 +532,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
             {
                 throw std::runtime_error("View \"" + viewId + "\" contains a non-string paragraph entry.");
             }
-            content.paragraphs.emplace_back(paragraph.get<std::string>());
+            content.paragraphs.emplace_back(paragraph.template get<std::string>());
         }
     }
 
@@ -357,7 +548,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
             {
                 throw std::runtime_error("View \"" + viewId + "\" heroHighlights must contain only strings.");
             }
-            content.heroHighlights.emplace_back(highlight.get<std::string>());
+            content.heroHighlights.emplace_back(highlight.template get<std::string>());
         }
     }
 
@@ -376,7 +567,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
             }
 
             if (!sectionJson.contains("title") || !sectionJson["title"].is_string()
-                || sectionJson["title"].get<std::string>().empty())
+                || sectionJson["title"].template get<std::string>().empty())
             {
                 throw std::runtime_error("View \"" + viewId + "\" requires each section to declare a non-empty title.");
             }
@@ -388,7 +579,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
             }
 
             ViewSection section;
-            section.title = sectionJson["title"].get<std::string>();
+            section.title = sectionJson["title"].template get<std::string>();
 
             for (const auto& optionJson : sectionJson["options"])
             {
@@ -396,7 +587,7 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
                 {
                     throw std::runtime_error("View \"" + viewId + "\" has a section option that is not a string.");
                 }
-                const std::string optionText = optionJson.get<std::string>();
+                const std::string optionText = optionJson.template get<std::string>();
                 if (optionText.empty())
                 {
                     continue;
@@ -414,7 +605,8 @@ ViewContent ContentValidator::ParseViewContent(const std::string& viewId, const
     return content;
 }
 
-void ContentValidator::ParseChannelsSection(const nlohmann::json& document, AppContent& content) const
+template <typename JsonType>
+void ContentValidator::ParseChannelsSection(const JsonType& document, AppContent& content) const
 {
     if (!document.contains(kChannelsKey) || !document[kChannelsKey].is_array())
     {
@@ -423,57 +615,416 @@ void ContentValidator::ParseChannelsSection(const nlohmann::json& document, AppC
 
     for (const auto& channelJson : document[kChannelsKey])
     {
-        if (!channelJson.is_object())
+        content.channels.emplace_back(ParseChannel(channelJson));
+    }
+}
+
+template <typename JsonType>
+Channel ContentValidator::ParseChannel(const JsonType& channelJson) const
+{
+    if (!channelJson.is_object())
+    {
+        throw std::runtime_error("Each channel entry must be an object.");
+    }
+
+    Channel channel;
+    if (!channelJson.contains("id") || !channelJson["id"].is_string() || channelJson["id"].template get<std::string>().empty())
+    {
+        throw std::runtime_error("Each channel must include a non-empty id.");
+    }
+    channel.id = channelJson["id"].template get<std::string>();
+
+    if (!channelJson.contains("label") || !channelJson["label"].is_string()
+        || channelJson["label"].template get<std::string>().empty())
+    {
+        throw std::runtime_error("Each channel must include a non-empty label.");
+    }
+    channel.label = channelJson["label"].template get<std::string>();
+
+    // Manifest catalogs externalize a channel's programs and views into a
+    // shard file; such entries carry a "shard" path instead of an inline
+    // programs array and stay empty until the shard is merged.
+    if (channelJson.contains("shard"))
+    {
+        if (!channelJson["shard"].is_string() || channelJson["shard"].template get<std::string>().empty())
+        {
+            throw std::runtime_error("Channel \"" + channel.id + "\" has an invalid shard path.");
+        }
+        channel.shardPath = channelJson["shard"].template get<std::string>();
+        return channel;
+    }
+
+    if (!channelJson.contains("programs") || !channelJson["programs"].is_array())
+    {
+        throw std::runtime_error("Channel \"" + channel.id + "\" requires a programs array or a shard path.");
+    }
+    for (const auto& programJson : channelJson["programs"])
+    {
+        if (!programJson.is_string() || programJson.template get<std::string>().empty())
+        {
+            throw std::runtime_error("Channel \"" + channel.id + "\" has an invalid program entry.");
+        }
+        channel.programs.emplace_back(programJson.template get<std::string>());
+    }
+
+    return channel;
+}
+
+void ContentValidator::ValidateChannelReferences(const AppContent& content) const
+{
+    if (content.channels.empty())
+    {
+        throw std::runtime_error("Content file must declare at least one channel.");
+    }
+
+    for (const auto& channel : content.channels)
+    {
+        for (const auto& programId : channel.programs)
+        {
+            if (content.views.find(programId) == content.views.end())
+            {
+                throw std::runtime_error(
+                    "Channel \"" + channel.id + "\" references unknown program id \"" + programId + "\".");
+            }
+        }
+    }
+}
+
+// SAX handler that feeds AppContent directly from parse events. Top-level
+// sections are recognized as they stream past; within "views" and "channels"
+// only the entry currently being read is materialized as a JSON value, which
+// is handed to the same per-entry validators the DOM path uses and then
+// discarded. Peak memory is the finished AppContent plus one entry.
+class StreamingContentHandler : public nlohmann::json_sax<nlohmann::json>
+{
+  public:
+    StreamingContentHandler(const ContentValidator& validator, AppContent& content)
+        : validator_{validator}
+        , content_{content}
+    {
+    }
+
+    bool null() override { return HandleScalar(nullptr); }
+    bool boolean(bool val) override { return HandleScalar(val); }
+    bool number_integer(number_integer_t val) override { return HandleScalar(val); }
+    bool number_unsigned(number_unsigned_t val) override { return HandleScalar(val); }
+    bool number_float(number_float_t val, const string_t&) override { return HandleScalar(val); }
+    bool string(string_t& val) override { return HandleScalar(std::move(val)); }
+    bool binary(binary_t& val) override { return HandleScalar(std::move(val)); }
+
+    bool key(string_t& val) override
+    {
+        if (capturing_)
         {
-            throw std::runtime_error("Each channel entry must be an object.");
+            captureKey_ = std::move(val);
+            return true;
         }
+        if (section_ == Section::Views)
+        {
+            currentViewId_ = std::move(val);
+            return true;
+        }
+        pendingRootKey_ = std::move(val);
+        awaitingRootValue_ = true;
+        return true;
+    }
+
+    bool start_object(std::size_t) override { return HandleContainerStart(true); }
+    bool start_array(std::size_t) override { return HandleContainerStart(false); }
 
-        Channel channel;
-        if (!channelJson.contains("id") || !channelJson["id"].is_string() || channelJson["id"].get<std::string>().empty())
+    bool end_object() override
+    {
+        if (capturing_)
+        {
+            return HandleContainerEnd();
+        }
+        if (section_ == Section::Views)
         {
-            throw std::runtime_error("Each channel must include a non-empty id.");
+            if (viewCount_ == 0)
+            {
+                throw std::runtime_error("Content file must declare at least one view.");
+            }
+            section_ = Section::None;
+            return true;
         }
-        channel.id = channelJson["id"].get<std::string>();
+        // Root object closed.
+        return true;
+    }
 
-        if (!channelJson.contains("label") || !channelJson["label"].is_string()
-            || channelJson["label"].get<std::string>().empty())
+    bool end_array() override
+    {
+        if (capturing_)
         {
-            throw std::runtime_error("Each channel must include a non-empty label.");
+            return HandleContainerEnd();
         }
-        channel.label = channelJson["label"].get<std::string>();
+        // Channels array closed.
+        section_ = Section::None;
+        return true;
+    }
 
-        if (!channelJson.contains("programs") || !channelJson["programs"].is_array())
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override
+    {
+        throw std::runtime_error(std::string{"Content file is not valid JSON: "} + ex.what());
+    }
+
+    // Cross-section validation that the DOM path performs after parsing the
+    // whole document.
+    void FinalizeDocument() const
+    {
+        if (!sawViews_)
         {
-            throw std::runtime_error("Channel \"" + channel.id + "\" requires a programs array.");
+            throw std::runtime_error("Content file missing \"views\" object.");
         }
-        for (const auto& programJson : channelJson["programs"])
+        if (!sawChannels_)
         {
-            if (!programJson.is_string() || programJson.get<std::string>().empty())
+            throw std::runtime_error("Content file missing \"channels\" array.");
+        }
+        validator_.ValidateChannelReferences(content_);
+    }
+
+  private:
+    enum class Section
+    {
+        None,
+        Views,
+        Channels
+    };
+
+    enum class CaptureTarget
+    {
+        Discard,
+        Brand,
+        User,
+        Hub,
+        View,
+        Channel
+    };
+
+    bool HandleScalar(nlohmann::json value)
+    {
+        if (capturing_)
+        {
+            if (captureStack_.empty())
+            {
+                DispatchCapture(std::move(value));
+                return true;
+            }
+            InsertIntoCapture(std::move(value));
+            return true;
+        }
+        if (!rootOpen_)
+        {
+            throw std::runtime_error("Content file root must be a JSON object.");
+        }
+        if (section_ == Section::Views)
+        {
+            captureTarget_ = CaptureTarget::View;
+            DispatchCapture(std::move(value));
+            return true;
+        }
+        if (section_ == Section::Channels)
+        {
+            captureTarget_ = CaptureTarget::Channel;
+            DispatchCapture(std::move(value));
+            return true;
+        }
+        if (awaitingRootValue_)
+        {
+            awaitingRootValue_ = false;
+            if (pendingRootKey_ == kViewsKey)
+            {
+                throw std::runtime_error("Content file missing \"views\" object.");
+            }
+            if (pendingRootKey_ == kChannelsKey)
             {
-                throw std::runtime_error("Channel \"" + channel.id + "\" has an invalid program entry.");
+                throw std::runtime_error("Content file missing \"channels\" array.");
             }
-            channel.programs.emplace_back(programJson.get<std::string>());
+            captureTarget_ = RootCaptureTarget();
+            DispatchCapture(std::move(value));
         }
+        return true;
+    }
 
-        content.channels.emplace_back(std::move(channel));
+    bool HandleContainerStart(bool isObject)
+    {
+        if (capturing_)
+        {
+            OpenCaptureContainer(isObject);
+            return true;
+        }
+        if (!rootOpen_)
+        {
+            if (!isObject)
+            {
+                throw std::runtime_error("Content file root must be a JSON object.");
+            }
+            rootOpen_ = true;
+            return true;
+        }
+        if (section_ == Section::Views)
+        {
+            BeginCapture(CaptureTarget::View, isObject);
+            return true;
+        }
+        if (section_ == Section::Channels)
+        {
+            BeginCapture(CaptureTarget::Channel, isObject);
+            return true;
+        }
+        if (awaitingRootValue_)
+        {
+            awaitingRootValue_ = false;
+            if (pendingRootKey_ == kViewsKey)
+            {
+                if (!isObject)
+                {
+                    throw std::runtime_error("Content file missing \"views\" object.");
+                }
+                section_ = Section::Views;
+                sawViews_ = true;
+                return true;
+            }
+            if (pendingRootKey_ == kChannelsKey)
+            {
+                if (isObject)
+                {
+                    throw std::runtime_error("Content file missing \"channels\" array.");
+                }
+                section_ = Section::Channels;
+                sawChannels_ = true;
+                return true;
+            }
+            BeginCapture(RootCaptureTarget(), isObject);
+        }
+        return true;
     }
 
-    if (content.channels.empty())
+    bool HandleContainerEnd()
     {
-        throw std::runtime_error("Content file must declare at least one channel.");
+        captureStack_.pop_back();
+        if (captureStack_.empty())
+        {
+            DispatchCapture(std::move(captureRoot_));
+        }
+        return true;
     }
 
-    for (const auto& channel : content.channels)
+    [[nodiscard]] CaptureTarget RootCaptureTarget() const
     {
-        for (const auto& programId : channel.programs)
+        if (pendingRootKey_ == kBrandKey)
         {
-            if (content.views.find(programId) == content.views.end())
+            return CaptureTarget::Brand;
+        }
+        if (pendingRootKey_ == kUserKey)
+        {
+            return CaptureTarget::User;
+        }
+        if (pendingRootKey_ == kHubKey)
+        {
+            return CaptureTarget::Hub;
+        }
+        return CaptureTarget::Discard;
+    }
+
+    void BeginCapture(CaptureTarget target, bool isObject)
+    {
+        capturing_ = true;
+        captureTarget_ = target;
+        captureRoot_ = isObject ? nlohmann::json::object() : nlohmann::json::array();
+        captureStack_.clear();
+        captureStack_.push_back(&captureRoot_);
+    }
+
+    void OpenCaptureContainer(bool isObject)
+    {
+        nlohmann::json node = isObject ? nlohmann::json::object() : nlohmann::json::array();
+        nlohmann::json* parent = captureStack_.back();
+        nlohmann::json* inserted = nullptr;
+        if (parent->is_object())
+        {
+            inserted = &((*parent)[captureKey_] = std::move(node));
+        }
+        else
+        {
+            parent->push_back(std::move(node));
+            inserted = &parent->back();
+        }
+        captureStack_.push_back(inserted);
+    }
+
+    void InsertIntoCapture(nlohmann::json value)
+    {
+        nlohmann::json* parent = captureStack_.back();
+        if (parent->is_object())
+        {
+            (*parent)[captureKey_] = std::move(value);
+        }
+        else
+        {
+            parent->push_back(std::move(value));
+        }
+    }
+
+    void DispatchCapture(nlohmann::json value)
+    {
+        capturing_ = false;
+        captureStack_.clear();
+        switch (captureTarget_)
+        {
+        case CaptureTarget::Brand:
+            if (value.is_string())
             {
-                throw std::runtime_error(
-                    "Channel \"" + channel.id + "\" references unknown program id \"" + programId + "\".");
+                content_.brandName = value.get<std::string>();
             }
+            break;
+        case CaptureTarget::User:
+            validator_.ParseUserValue(value, content_);
+            break;
+        case CaptureTarget::Hub:
+            validator_.ParseHubValue(value, content_);
+            break;
+        case CaptureTarget::View:
+            content_.views.emplace(currentViewId_, validator_.ParseViewContent(currentViewId_, value));
+            ++viewCount_;
+            break;
+        case CaptureTarget::Channel:
+            content_.channels.emplace_back(validator_.ParseChannel(value));
+            break;
+        case CaptureTarget::Discard:
+            break;
         }
+        captureRoot_ = nullptr;
     }
+
+    const ContentValidator& validator_;
+    AppContent& content_;
+    Section section_ = Section::None;
+    CaptureTarget captureTarget_ = CaptureTarget::Discard;
+    bool rootOpen_ = false;
+    bool capturing_ = false;
+    bool awaitingRootValue_ = false;
+    bool sawViews_ = false;
+    bool sawChannels_ = false;
+    std::size_t viewCount_ = 0;
+    std::string pendingRootKey_;
+    std::string currentViewId_;
+    std::string captureKey_;
+    nlohmann::json captureRoot_;
+    std::vector<nlohmann::json*> captureStack_;
+};
+
+AppContent ContentValidator::LoadFromFileStreaming(const std::string& filePath) const
+{
+    auto input = OpenFile(filePath);
+
+    AppContent content;
+    content.brandName = "COLONY";
+
+    StreamingContentHandler handler{*this, content};
+    nlohmann::json::sax_parse(input, &handler);
+    handler.FinalizeDocument();
+
+    return content;
 }
 
 AppContent LoadContentFromFile(const std::string& filePath)
@@ -482,4 +1033,10 @@ AppContent LoadContentFromFile(const std::string& filePath)
     return validator.LoadFromFile(filePath);
 }
 
+ChannelShard LoadChannelShardFromFile(const std::string& filePath)
+{
+    ContentValidator validator;
+    return validator.LoadChannelShardFromFile(filePath);
+}
+
 } // namespace colony
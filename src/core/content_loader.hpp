@@ -4,26 +4,74 @@
 #include "json.hpp"
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace colony
 {
 
+// One channel's externalized catalog slice: its program list plus the views
+// those programs reference. Produced by manifest catalogs, where the root
+// file only names channels and their shard paths.
+struct ChannelShard
+{
+    std::vector<std::string> programs;
+    std::unordered_map<std::string, ViewContent> views;
+};
+
 class ContentValidator
 {
   public:
+    // Parses the whole document into a DOM first. Large files are routed
+    // through LoadFromFileStreaming automatically so the full JSON tree and
+    // the resulting AppContent never live in memory at the same time.
     AppContent LoadFromFile(const std::string& filePath) const;
 
+    // SAX-based parse that feeds AppContent directly. Only one view, channel
+    // or hub entry is materialized as a JSON value at any point, so peak
+    // memory stays close to the size of the final AppContent.
+    AppContent LoadFromFileStreaming(const std::string& filePath) const;
+
+    // Parses one channel shard file. Shards hold a single channel's slice of
+    // the catalog, so the DOM path is always cheap enough; validation
+    // guarantees every listed program has a view in the same shard.
+    ChannelShard LoadChannelShardFromFile(const std::string& filePath) const;
+
   private:
-    AppContent ParseDocument(const nlohmann::json& document) const;
-    void ParseUserSection(const nlohmann::json& document, AppContent& content) const;
-    void ParseViewsSection(const nlohmann::json& document, AppContent& content) const;
-    ViewContent ParseViewContent(const std::string& viewId, const nlohmann::json& json) const;
-    void ParseChannelsSection(const nlohmann::json& document, AppContent& content) const;
-    void ParseHubSection(const nlohmann::json& document, AppContent& content) const;
-    HubBranch ParseHubBranch(const nlohmann::json& json) const;
-    HubWidget ParseHubWidget(const nlohmann::json& json) const;
+    friend class StreamingContentHandler;
+
+    // Templated over the json type: the DOM path parses into an
+    // arena-allocated ArenaJson, while the SAX path still hands plain
+    // nlohmann::json captures to the same validators. Definitions live in
+    // the translation unit; both instantiations happen there.
+    template <typename JsonType>
+    AppContent ParseDocument(const JsonType& document) const;
+    template <typename JsonType>
+    bool TryParseDocumentParallel(const JsonType& document, AppContent& content) const;
+    template <typename JsonType>
+    void ParseUserSection(const JsonType& document, AppContent& content) const;
+    template <typename JsonType>
+    void ParseUserValue(const JsonType& json, AppContent& content) const;
+    template <typename JsonType>
+    void ParseViewsSection(const JsonType& document, AppContent& content) const;
+    template <typename JsonType>
+    ViewContent ParseViewContent(const std::string& viewId, const JsonType& json) const;
+    template <typename JsonType>
+    void ParseChannelsSection(const JsonType& document, AppContent& content) const;
+    template <typename JsonType>
+    Channel ParseChannel(const JsonType& json) const;
+    void ValidateChannelReferences(const AppContent& content) const;
+    template <typename JsonType>
+    void ParseHubSection(const JsonType& document, AppContent& content) const;
+    template <typename JsonType>
+    void ParseHubValue(const JsonType& json, AppContent& content) const;
+    template <typename JsonType>
+    HubBranch ParseHubBranch(const JsonType& json) const;
+    template <typename JsonType>
+    HubWidget ParseHubWidget(const JsonType& json) const;
 };
 
 AppContent LoadContentFromFile(const std::string& filePath);
+ChannelShard LoadChannelShardFromFile(const std::string& filePath);
 
 } // namespace colony
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace colony
+{
+
+// Monotonic bump allocator for transient JSON DOMs. Parsing the catalog with
+// the default allocator produces one heap allocation per node, key and string
+// value; the arena replaces all of them with pointer bumps into a few large
+// chunks and releases everything wholesale when it goes out of scope, so a
+// parse leaves no fragmentation behind.
+//
+// nlohmann::basic_json default-constructs its allocators internally, so the
+// arena cannot be passed through the json type; JsonArenaScope publishes it
+// through a thread-local instead. The contract is: parse an ArenaJson value,
+// extract what you need into ordinary owning types, and let the value die
+// before the scope does. An ArenaJson must never outlive its scope.
+class JsonArena
+{
+  public:
+    JsonArena() = default;
+    JsonArena(const JsonArena&) = delete;
+    JsonArena& operator=(const JsonArena&) = delete;
+
+    void* Allocate(std::size_t bytes, std::size_t alignment)
+    {
+        std::uintptr_t cursor = (cursor_ + (alignment - 1)) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        if (cursor + bytes > chunkEnd_)
+        {
+            AddChunk(bytes + alignment);
+            cursor = (cursor_ + (alignment - 1)) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        }
+        cursor_ = cursor + bytes;
+        return reinterpret_cast<void*>(cursor);
+    }
+
+  private:
+    // Large enough that a typical language file or content document fits in a
+    // handful of chunks; doubling keeps the chunk count logarithmic for the
+    // full catalog.
+    static constexpr std::size_t kInitialChunkBytes = 256 * 1024;
+
+    void AddChunk(std::size_t minimumBytes)
+    {
+        std::size_t chunkBytes = chunks_.empty() ? kInitialChunkBytes : chunkBytes_ * 2;
+        while (chunkBytes < minimumBytes)
+        {
+            chunkBytes *= 2;
+        }
+        chunkBytes_ = chunkBytes;
+        chunks_.push_back(std::make_unique<std::byte[]>(chunkBytes));
+        cursor_ = reinterpret_cast<std::uintptr_t>(chunks_.back().get());
+        chunkEnd_ = cursor_ + chunkBytes;
+    }
+
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    std::size_t chunkBytes_ = 0;
+    std::uintptr_t cursor_ = 0;
+    std::uintptr_t chunkEnd_ = 0;
+};
+
+namespace detail
+{
+inline JsonArena*& ActiveJsonArena() noexcept
+{
+    thread_local JsonArena* active = nullptr;
+    return active;
+}
+} // namespace detail
+
+// Publishes an arena for the current thread while alive. Scopes nest; the
+// previous arena is restored on destruction.
+class JsonArenaScope
+{
+  public:
+    explicit JsonArenaScope(JsonArena& arena) noexcept
+        : previous_{detail::ActiveJsonArena()}
+    {
+        detail::ActiveJsonArena() = &arena;
+    }
+
+    ~JsonArenaScope() noexcept { detail::ActiveJsonArena() = previous_; }
+
+    JsonArenaScope(const JsonArenaScope&) = delete;
+    JsonArenaScope& operator=(const JsonArenaScope&) = delete;
+
+  private:
+    JsonArena* previous_;
+};
+
+// std::allocator-shaped adapter. Default construction binds to the scope's
+// arena (or to the heap when no scope is active, so stray uses stay correct);
+// deallocation is a no-op for arena-backed instances — the arena reclaims
+// everything at once.
+template <typename T>
+class JsonArenaAllocator
+{
+  public:
+    using value_type = T;
+
+    JsonArenaAllocator() noexcept
+        : arena_{detail::ActiveJsonArena()}
+    {
+    }
+
+    template <typename U>
+    JsonArenaAllocator(const JsonArenaAllocator<U>& other) noexcept
+        : arena_{other.Arena()}
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t count)
+    {
+        if (arena_ != nullptr)
+        {
+            return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept
+    {
+        if (arena_ == nullptr)
+        {
+            ::operator delete(pointer);
+        }
+    }
+
+    [[nodiscard]] JsonArena* Arena() const noexcept { return arena_; }
+
+    friend bool operator==(const JsonArenaAllocator& a, const JsonArenaAllocator& b) noexcept
+    {
+        return a.arena_ == b.arena_;
+    }
+    friend bool operator!=(const JsonArenaAllocator& a, const JsonArenaAllocator& b) noexcept
+    {
+        return !(a == b);
+    }
+
+  private:
+    JsonArena* arena_;
+};
+
+// basic_json specialization whose nodes, object keys and string values all
+// live in the active arena, including the strings the lexer builds while
+// scanning.
+using ArenaJsonString = std::basic_string<char, std::char_traits<char>, JsonArenaAllocator<char>>;
+using ArenaJson = nlohmann::basic_json<
+    std::map,
+    std::vector,
+    ArenaJsonString,
+    bool,
+    std::int64_t,
+    std::uint64_t,
+    double,
+    JsonArenaAllocator>;
+
+} // namespace colony
@@ -0,0 +1,278 @@
+#include "core/localization_bundle.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace colony
+{
+namespace
+{
+constexpr char kMagic[4] = {'C', 'L', 'B', '1'};
+constexpr std::uint32_t kVersion = 1;
+
+struct BundleHeader
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t languageCount;
+    std::uint32_t reserved;
+};
+
+struct LanguageRecord
+{
+    std::uint32_t idOffset;
+    std::uint32_t idLength;
+    // Byte offset from the start of the file to this language's Entry array.
+    std::uint32_t entriesOffset;
+    std::uint32_t entryCount;
+};
+
+bool RangeInFile(std::uint32_t offset, std::uint32_t length, std::size_t fileSize) noexcept
+{
+    return offset <= fileSize && length <= fileSize - offset;
+}
+
+} // namespace
+
+bool LocalizationBundle::Language::Find(std::string_view key, std::string_view& outValue) const noexcept
+{
+    const Entry* end = entries_ + count_;
+    const Entry* it = std::lower_bound(entries_, end, key, [&](const Entry& entry, std::string_view probe) {
+        return std::string_view{base_ + entry.keyOffset, entry.keyLength} < probe;
+    });
+    if (it == end || std::string_view{base_ + it->keyOffset, it->keyLength} != key)
+    {
+        return false;
+    }
+    outValue = std::string_view{base_ + it->valueOffset, it->valueLength};
+    return true;
+}
+
+LocalizationBundle::~LocalizationBundle()
+{
+    Close();
+}
+
+bool LocalizationBundle::Open(const std::filesystem::path& path)
+{
+    Close();
+
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info = {};
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(BundleHeader)))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    data_ = static_cast<const char*>(mapping);
+    size_ = size;
+#else
+    // No mmap here: read the whole bundle into one heap buffer. The layout is
+    // offsets from the start of the file, so everything below works the same
+    // against the buffer as against a mapping.
+    std::ifstream input{path, std::ios::binary | std::ios::ate};
+    if (!input.is_open())
+    {
+        return false;
+    }
+    const std::streamoff fileSize = input.tellg();
+    if (fileSize < static_cast<std::streamoff>(sizeof(BundleHeader)))
+    {
+        return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(fileSize);
+    char* buffer = new char[size];
+    input.seekg(0, std::ios::beg);
+    if (!input.read(buffer, static_cast<std::streamsize>(size)))
+    {
+        delete[] buffer;
+        return false;
+    }
+
+    data_ = buffer;
+    size_ = size;
+#endif
+
+    // Validate every table against the file size up front, so lookups never
+    // have to bounds-check. This only touches the header and the entry
+    // tables, not the string blob.
+    BundleHeader header;
+    std::memcpy(&header, data_, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion)
+    {
+        Close();
+        return false;
+    }
+
+    const std::size_t tableBytes = static_cast<std::size_t>(header.languageCount) * sizeof(LanguageRecord);
+    if (!RangeInFile(sizeof(BundleHeader), static_cast<std::uint32_t>(tableBytes), size_)
+        || tableBytes != static_cast<std::uint32_t>(tableBytes))
+    {
+        Close();
+        return false;
+    }
+
+    const auto* records = reinterpret_cast<const LanguageRecord*>(data_ + sizeof(BundleHeader));
+    for (std::uint32_t i = 0; i < header.languageCount; ++i)
+    {
+        const LanguageRecord& record = records[i];
+        const std::uint64_t entryBytes = static_cast<std::uint64_t>(record.entryCount) * sizeof(Entry);
+        if (!RangeInFile(record.idOffset, record.idLength, size_) || record.entriesOffset % alignof(Entry) != 0
+            || record.entriesOffset > size_ || entryBytes > size_ - record.entriesOffset)
+        {
+            Close();
+            return false;
+        }
+        const auto* entries = reinterpret_cast<const Entry*>(data_ + record.entriesOffset);
+        for (std::uint32_t j = 0; j < record.entryCount; ++j)
+        {
+            if (!RangeInFile(entries[j].keyOffset, entries[j].keyLength, size_)
+                || !RangeInFile(entries[j].valueOffset, entries[j].valueLength, size_))
+            {
+                Close();
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void LocalizationBundle::Close() noexcept
+{
+    if (data_ != nullptr)
+    {
+#if !defined(_WIN32)
+        ::munmap(const_cast<char*>(data_), size_);
+#else
+        delete[] data_;
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+LocalizationBundle::Language LocalizationBundle::FindLanguage(std::string_view languageId) const noexcept
+{
+    if (data_ == nullptr)
+    {
+        return {};
+    }
+
+    BundleHeader header;
+    std::memcpy(&header, data_, sizeof(header));
+    const auto* records = reinterpret_cast<const LanguageRecord*>(data_ + sizeof(BundleHeader));
+    for (std::uint32_t i = 0; i < header.languageCount; ++i)
+    {
+        const LanguageRecord& record = records[i];
+        if (std::string_view{data_ + record.idOffset, record.idLength} == languageId)
+        {
+            return Language{reinterpret_cast<const Entry*>(data_ + record.entriesOffset), record.entryCount, data_};
+        }
+    }
+    return {};
+}
+
+bool LocalizationBundle::Write(const std::filesystem::path& path, const std::vector<CompiledLanguage>& languages)
+{
+    const std::size_t languageCount = languages.size();
+    std::size_t entryCount = 0;
+    for (const auto& [id, entries] : languages)
+    {
+        entryCount += entries.size();
+    }
+
+    BundleHeader header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.languageCount = static_cast<std::uint32_t>(languageCount);
+
+    const std::size_t recordsOffset = sizeof(BundleHeader);
+    const std::size_t entriesOffset = recordsOffset + languageCount * sizeof(LanguageRecord);
+    std::size_t blobOffset = entriesOffset + entryCount * sizeof(Entry);
+
+    std::vector<LanguageRecord> records;
+    records.reserve(languageCount);
+    std::vector<Entry> entries;
+    entries.reserve(entryCount);
+    std::string blob;
+
+    const auto appendToBlob = [&](std::string_view text, std::uint32_t& outOffset, std::uint32_t& outLength) {
+        outOffset = static_cast<std::uint32_t>(blobOffset + blob.size());
+        outLength = static_cast<std::uint32_t>(text.size());
+        blob.append(text);
+    };
+
+    for (const auto& [id, languageEntries] : languages)
+    {
+        LanguageRecord record = {};
+        appendToBlob(id, record.idOffset, record.idLength);
+        record.entriesOffset = static_cast<std::uint32_t>(entriesOffset + entries.size() * sizeof(Entry));
+        record.entryCount = static_cast<std::uint32_t>(languageEntries.size());
+        records.push_back(record);
+
+        for (const auto& [key, value] : languageEntries)
+        {
+            Entry entry = {};
+            appendToBlob(key, entry.keyOffset, entry.keyLength);
+            appendToBlob(value, entry.valueOffset, entry.valueLength);
+            entries.push_back(entry);
+        }
+    }
+
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream output{tempPath, std::ios::binary | std::ios::trunc};
+        if (!output.is_open())
+        {
+            return false;
+        }
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(records.data()),
+                     static_cast<std::streamsize>(records.size() * sizeof(LanguageRecord)));
+        output.write(reinterpret_cast<const char*>(entries.data()),
+                     static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+        output.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+        if (!output.good())
+        {
+            return false;
+        }
+    }
+
+    std::error_code renameError;
+    std::filesystem::rename(tempPath, path, renameError);
+    if (renameError)
+    {
+        std::error_code removeError;
+        std::filesystem::remove(tempPath, removeError);
+        return false;
+    }
+    return true;
+}
+
+} // namespace colony
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace colony
+{
+
+// Compiled localization bundle: every language packed into one flat file
+// that is memory-mapped at startup. Layout is a header, a language table,
+// one key-sorted entry table per language and a shared string blob, all
+// referenced by offsets from the start of the file. Switching languages is
+// then a pointer swap into the mapping — no parse, no per-language heap —
+// and lookups binary-search the sorted entries in place. On Windows, where
+// the launcher has no mmap, the file is read into one heap buffer instead;
+// the offset-based layout works identically either way.
+//
+// The bundle is a local cache in the pref directory (like
+// directory_index.cache): LocalizationManager recompiles it from the JSON/
+// YAML sources whenever they are newer, so the offsets are always
+// native-endian and never need to survive a format migration.
+class LocalizationBundle
+{
+  public:
+    struct Entry
+    {
+        std::uint32_t keyOffset = 0;
+        std::uint32_t keyLength = 0;
+        std::uint32_t valueOffset = 0;
+        std::uint32_t valueLength = 0;
+    };
+
+    // A language's entry table inside the mapping. Valid while the bundle
+    // stays open; an empty table means the language is not in the bundle.
+    class Language
+    {
+      public:
+        Language() = default;
+        Language(const Entry* entries, std::uint32_t count, const char* base) noexcept
+            : entries_{entries}
+            , count_{count}
+            , base_{base}
+        {
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return entries_ != nullptr; }
+
+        // Binary search over the key-sorted entries; returns false on a miss.
+        [[nodiscard]] bool Find(std::string_view key, std::string_view& outValue) const noexcept;
+
+      private:
+        const Entry* entries_ = nullptr;
+        std::uint32_t count_ = 0;
+        const char* base_ = nullptr;
+    };
+
+    // One language's sorted key/value pairs, as handed to Write.
+    using CompiledLanguage = std::pair<std::string, std::vector<std::pair<std::string, std::string>>>;
+
+    LocalizationBundle() = default;
+    ~LocalizationBundle();
+    LocalizationBundle(const LocalizationBundle&) = delete;
+    LocalizationBundle& operator=(const LocalizationBundle&) = delete;
+
+    // Maps the bundle and bounds-checks every table against the file size.
+    // Returns false (leaving the bundle closed) on any structural problem.
+    bool Open(const std::filesystem::path& path);
+    void Close() noexcept;
+    [[nodiscard]] bool IsOpen() const noexcept { return data_ != nullptr; }
+
+    [[nodiscard]] Language FindLanguage(std::string_view languageId) const noexcept;
+
+    // Serializes the languages (entries must already be key-sorted) through
+    // a temp file and an atomic rename.
+    static bool Write(const std::filesystem::path& path, const std::vector<CompiledLanguage>& languages);
+
+  private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace colony
@@ -1,10 +1,12 @@
 #include "core/localization_manager.hpp"
 
-#include "json.hpp"
+#include "core/json_arena.hpp"
 
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <string_view>
 #include <vector>
 
@@ -28,13 +30,18 @@ std::string TrimCopy(std::string_view view)
     return std::string{TrimView(view)};
 }
 
-void FlattenJsonNode(const nlohmann::json& node, const std::string& prefix, LocalizationManager::StringsMap& outStrings)
+void FlattenJsonNode(const ArenaJson& node, const std::string& prefix, LocalizationManager::StringsMap& outStrings)
 {
     if (node.is_object())
     {
         for (auto it = node.begin(); it != node.end(); ++it)
         {
-            std::string nextPrefix = prefix.empty() ? it.key() : prefix + "." + it.key();
+            std::string nextPrefix = prefix;
+            if (!nextPrefix.empty())
+            {
+                nextPrefix += '.';
+            }
+            nextPrefix.append(it.key());
             FlattenJsonNode(it.value(), nextPrefix, outStrings);
         }
         return;
@@ -82,18 +89,169 @@ std::string StripYamlValueQuotes(std::string value)
 
 } // namespace
 
+void LocalizationManager::Snapshot::Build(const StringsMap& strings)
+{
+    Clear();
+
+    // Size the buffer exactly up front: the table stores views into it, so
+    // it must never reallocate after the first view is taken.
+    std::size_t totalSize = 0;
+    for (const auto& [key, value] : strings)
+    {
+        totalSize += key.size() + value.size();
+    }
+    buffer.reserve(totalSize);
+    table.reserve(strings.size());
+
+    for (const auto& [key, value] : strings)
+    {
+        const std::size_t keyOffset = buffer.size();
+        buffer.append(key);
+        const std::size_t valueOffset = buffer.size();
+        buffer.append(value);
+
+        const std::string_view keyView{buffer.data() + keyOffset, key.size()};
+        const std::string_view valueView{buffer.data() + valueOffset, value.size()};
+        table.emplace(keyView, valueView);
+    }
+}
+
+void LocalizationManager::Snapshot::Clear() noexcept
+{
+    table.clear();
+    buffer.clear();
+}
+
+const std::string_view* LocalizationManager::Snapshot::Find(std::string_view key) const noexcept
+{
+    const auto it = table.find(key);
+    return it != table.end() ? &it->second : nullptr;
+}
+
 void LocalizationManager::SetResourceDirectory(std::filesystem::path directory)
 {
     resourceDirectory_ = std::move(directory);
-    activeStrings_.clear();
-    fallbackStrings_.clear();
+    bundle_.Close();
+    activeBundleLanguage_ = {};
+    fallbackBundleLanguage_ = {};
+    activeSnapshot_.Clear();
+    fallbackSnapshot_.Clear();
+    fallbackLoaded_ = false;
     activeLanguageId_.clear();
 }
 
 void LocalizationManager::SetFallbackLanguage(std::string languageId)
 {
     fallbackLanguageId_ = std::move(languageId);
-    fallbackStrings_.clear();
+    fallbackBundleLanguage_ = {};
+    fallbackSnapshot_.Clear();
+    fallbackLoaded_ = false;
+}
+
+bool LocalizationManager::UseCompiledBundle(const std::filesystem::path& bundlePath)
+{
+    if (resourceDirectory_.empty())
+    {
+        return false;
+    }
+
+    // The bundle is stale as soon as any source file is newer than it; a
+    // recompile reparses every language once, after which all switches are
+    // served from the mapping.
+    std::error_code error;
+    std::filesystem::file_time_type newestSource = std::filesystem::file_time_type::min();
+    bool haveSources = false;
+    for (const auto& entry : std::filesystem::directory_iterator{resourceDirectory_, error})
+    {
+        const std::string extension = entry.path().extension().string();
+        if (extension != ".json" && extension != ".yaml" && extension != ".yml")
+        {
+            continue;
+        }
+        haveSources = true;
+        const auto writeTime = std::filesystem::last_write_time(entry.path(), error);
+        if (!error && writeTime > newestSource)
+        {
+            newestSource = writeTime;
+        }
+    }
+    if (!haveSources)
+    {
+        return false;
+    }
+
+    const auto bundleTime = std::filesystem::last_write_time(bundlePath, error);
+    if (error || bundleTime < newestSource)
+    {
+        if (!CompileBundle(bundlePath))
+        {
+            std::cerr << "Failed to compile localization bundle: " << bundlePath << '\n';
+            return false;
+        }
+    }
+
+    activeBundleLanguage_ = {};
+    fallbackBundleLanguage_ = {};
+    return bundle_.Open(bundlePath);
+}
+
+bool LocalizationManager::CompileBundle(const std::filesystem::path& bundlePath) const
+{
+    // One source per language id; when several extensions exist the same
+    // priority order as ResolveLanguageFile decides which one wins.
+    const auto extensionRank = [](const std::string& extension) {
+        if (extension == ".json")
+        {
+            return 0;
+        }
+        if (extension == ".yaml")
+        {
+            return 1;
+        }
+        return 2;
+    };
+
+    std::map<std::string, std::filesystem::path> sources;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator{resourceDirectory_, error})
+    {
+        const std::string extension = entry.path().extension().string();
+        if (extension != ".json" && extension != ".yaml" && extension != ".yml")
+        {
+            continue;
+        }
+        const std::string languageId = entry.path().stem().string();
+        auto it = sources.find(languageId);
+        if (it == sources.end())
+        {
+            sources.emplace(languageId, entry.path());
+        }
+        else if (extensionRank(extension) < extensionRank(it->second.extension().string()))
+        {
+            it->second = entry.path();
+        }
+    }
+
+    std::vector<LocalizationBundle::CompiledLanguage> languages;
+    languages.reserve(sources.size());
+    for (const auto& [languageId, sourcePath] : sources)
+    {
+        StringsMap strings;
+        if (!LoadFromFile(sourcePath, strings))
+        {
+            std::cerr << "Skipping unparsable localization file: " << sourcePath << '\n';
+            continue;
+        }
+        std::vector<std::pair<std::string, std::string>> entries{strings.begin(), strings.end()};
+        std::sort(entries.begin(), entries.end());
+        languages.emplace_back(languageId, std::move(entries));
+    }
+
+    if (languages.empty())
+    {
+        return false;
+    }
+    return LocalizationBundle::Write(bundlePath, languages);
 }
 
 bool LocalizationManager::LoadLanguage(const std::string& languageId)
@@ -109,6 +267,15 @@ bool LocalizationManager::LoadLanguage(const std::string& languageId)
         return false;
     }
 
+    if (LocalizationBundle::Language bundled = bundle_.FindLanguage(languageId))
+    {
+        // Instant switch: the language's table already sits in the mapping.
+        activeLanguageId_ = languageId;
+        activeBundleLanguage_ = bundled;
+        activeSnapshot_.Clear();
+        return true;
+    }
+
     LocalizationManager::StringsMap newStrings;
     const std::filesystem::path filePath = ResolveLanguageFile(languageId);
     if (!LoadFromFile(filePath, newStrings))
@@ -118,50 +285,81 @@ bool LocalizationManager::LoadLanguage(const std::string& languageId)
     }
 
     activeLanguageId_ = languageId;
-    activeStrings_ = std::move(newStrings);
+    activeBundleLanguage_ = {};
+    activeSnapshot_.Build(newStrings);
     return true;
 }
 
 std::string LocalizationManager::GetString(std::string_view key) const
+{
+    return std::string{GetView(key)};
+}
+
+std::string LocalizationManager::GetStringOrDefault(std::string_view key, std::string_view fallback) const
+{
+    return std::string{GetViewOrDefault(key, fallback)};
+}
+
+std::string_view LocalizationManager::GetView(std::string_view key) const noexcept
 {
     if (key.empty())
     {
         return {};
     }
 
-    const std::string keyStr{key};
-    if (const auto it = activeStrings_.find(keyStr); it != activeStrings_.end())
+    std::string_view bundledValue;
+    if (activeBundleLanguage_ && activeBundleLanguage_.Find(key, bundledValue))
+    {
+        return bundledValue;
+    }
+
+    if (const std::string_view* value = activeSnapshot_.Find(key))
+    {
+        return *value;
+    }
+
+    if (fallbackBundleLanguage_ && fallbackBundleLanguage_.Find(key, bundledValue))
     {
-        return it->second;
+        return bundledValue;
     }
 
-    if (const auto fallbackIt = fallbackStrings_.find(keyStr); fallbackIt != fallbackStrings_.end())
+    if (const std::string_view* value = fallbackSnapshot_.Find(key))
     {
-        return fallbackIt->second;
+        return *value;
     }
 
-    return keyStr;
+    return key;
 }
 
-std::string LocalizationManager::GetStringOrDefault(std::string_view key, std::string_view fallback) const
+std::string_view LocalizationManager::GetViewOrDefault(std::string_view key, std::string_view fallback) const noexcept
 {
     if (key.empty())
     {
-        return std::string{fallback};
+        return fallback;
+    }
+
+    std::string_view bundledValue;
+    if (activeBundleLanguage_ && activeBundleLanguage_.Find(key, bundledValue))
+    {
+        return bundledValue;
+    }
+
+    if (const std::string_view* value = activeSnapshot_.Find(key))
+    {
+        return *value;
     }
 
-    const std::string keyStr{key};
-    if (const auto it = activeStrings_.find(keyStr); it != activeStrings_.end())
+    if (fallbackBundleLanguage_ && fallbackBundleLanguage_.Find(key, bundledValue))
     {
-        return it->second;
+        return bundledValue;
     }
 
-    if (const auto fallbackIt = fallbackStrings_.find(keyStr); fallbackIt != fallbackStrings_.end())
+    if (const std::string_view* value = fallbackSnapshot_.Find(key))
     {
-        return fallbackIt->second;
+        return *value;
     }
 
-    return std::string{fallback};
+    return fallback;
 }
 
 std::filesystem::path LocalizationManager::ResolveLanguageFile(const std::string& languageId) const
@@ -213,7 +411,12 @@ bool LocalizationManager::LoadJson(std::istream& stream, StringsMap& outStrings)
 {
     try
     {
-        nlohmann::json document = nlohmann::json::parse(stream, nullptr, true, true);
+        // The parsed DOM lives entirely in the arena and is dropped wholesale
+        // once flattened into the string map; language switches leave no
+        // small-allocation churn behind.
+        JsonArena arena;
+        JsonArenaScope scope{arena};
+        const ArenaJson document = ArenaJson::parse(stream, nullptr, true, true);
         FlattenJsonNode(document, "", outStrings);
         return true;
     }
@@ -299,11 +502,12 @@ bool LocalizationManager::EnsureFallbackLoaded()
 {
     if (fallbackLanguageId_.empty())
     {
-        fallbackStrings_.clear();
+        fallbackSnapshot_.Clear();
+        fallbackLoaded_ = true;
         return true;
     }
 
-    if (!fallbackStrings_.empty())
+    if (fallbackLoaded_)
     {
         return true;
     }
@@ -313,6 +517,14 @@ bool LocalizationManager::EnsureFallbackLoaded()
         return false;
     }
 
+    if (LocalizationBundle::Language bundled = bundle_.FindLanguage(fallbackLanguageId_))
+    {
+        fallbackBundleLanguage_ = bundled;
+        fallbackSnapshot_.Clear();
+        fallbackLoaded_ = true;
+        return true;
+    }
+
     LocalizationManager::StringsMap fallbackStrings;
     const std::filesystem::path fallbackPath = ResolveLanguageFile(fallbackLanguageId_);
     if (!LoadFromFile(fallbackPath, fallbackStrings))
@@ -321,7 +533,9 @@ bool LocalizationManager::EnsureFallbackLoaded()
         return false;
     }
 
-    fallbackStrings_ = std::move(fallbackStrings);
+    fallbackBundleLanguage_ = {};
+    fallbackSnapshot_.Build(fallbackStrings);
+    fallbackLoaded_ = true;
     return true;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/localization_bundle.hpp"
+
 #include <filesystem>
 #include <string>
 #include <string_view>
@@ -23,23 +25,58 @@ class LocalizationManager
 
     bool LoadLanguage(const std::string& languageId);
 
+    // Points the manager at a compiled bundle of every language in the
+    // resource directory, recompiling it first if any source file is newer.
+    // Once open, LoadLanguage for a bundled language is a pointer swap into
+    // the mapping; languages missing from the bundle (or a failed open) fall
+    // back to the per-file parse path. Returns whether the bundle is open.
+    bool UseCompiledBundle(const std::filesystem::path& bundlePath);
+
     [[nodiscard]] std::string GetString(std::string_view key) const;
     [[nodiscard]] std::string GetStringOrDefault(std::string_view key, std::string_view fallback) const;
 
+    // Allocation-free lookups into the immutable per-language snapshot.
+    // Returned views stay valid until the next LoadLanguage,
+    // SetResourceDirectory or SetFallbackLanguage call; on a miss the key
+    // (or fallback) itself is returned, so callers passing temporaries must
+    // not hold the result past the expression.
+    [[nodiscard]] std::string_view GetView(std::string_view key) const noexcept;
+    [[nodiscard]] std::string_view GetViewOrDefault(std::string_view key, std::string_view fallback) const noexcept;
+
   private:
     using StringPair = std::pair<std::string, std::string>;
 
+    // Immutable per-language string table: one contiguous buffer holding
+    // every key and value, plus a view-keyed hash table into it. Built once
+    // per load so lookups never allocate.
+    struct Snapshot
+    {
+        std::string buffer;
+        std::unordered_map<std::string_view, std::string_view> table;
+
+        void Build(const StringsMap& strings);
+        void Clear() noexcept;
+        [[nodiscard]] const std::string_view* Find(std::string_view key) const noexcept;
+    };
+
     [[nodiscard]] std::filesystem::path ResolveLanguageFile(const std::string& languageId) const;
     bool LoadFromFile(const std::filesystem::path& path, StringsMap& outStrings) const;
     bool LoadJson(std::istream& stream, StringsMap& outStrings) const;
     bool LoadYaml(std::istream& stream, StringsMap& outStrings) const;
+    bool CompileBundle(const std::filesystem::path& bundlePath) const;
     bool EnsureFallbackLoaded();
 
     std::filesystem::path resourceDirectory_{};
     std::string activeLanguageId_{};
     std::string fallbackLanguageId_{"en"};
-    StringsMap activeStrings_{};
-    StringsMap fallbackStrings_{};
+    Snapshot activeSnapshot_{};
+    Snapshot fallbackSnapshot_{};
+    bool fallbackLoaded_ = false;
+    LocalizationBundle bundle_{};
+    // Bundle-backed tables take precedence over the snapshots; an empty
+    // table means that language came from the per-file parse path instead.
+    LocalizationBundle::Language activeBundleLanguage_{};
+    LocalizationBundle::Language fallbackBundleLanguage_{};
 };
 
 } // namespace colony
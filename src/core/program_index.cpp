@@ -0,0 +1,107 @@
+#include "core/program_index.hpp"
+
+namespace colony
+{
+namespace
+{
+const std::string kEmptyProgramId;
+const std::vector<ProgramHandle> kEmptyChannelPrograms;
+} // namespace
+
+void ProgramIndex::Rebuild(const AppContent& content)
+{
+    handles_.clear();
+    ids_.clear();
+    views_.clear();
+    firstChannel_.clear();
+    channelPrograms_.clear();
+
+    // Intern views first so every declared program gets a handle even when no
+    // channel lists it yet.
+    for (const auto& [programId, view] : content.views)
+    {
+        (void)view;
+        Intern(programId);
+    }
+
+    channelPrograms_.resize(content.channels.size());
+    for (std::size_t channelIndex = 0; channelIndex < content.channels.size(); ++channelIndex)
+    {
+        const auto& programs = content.channels[channelIndex].programs;
+        auto& handles = channelPrograms_[channelIndex];
+        handles.reserve(programs.size());
+        for (const auto& programId : programs)
+        {
+            const ProgramHandle handle = Intern(programId);
+            handles.push_back(handle);
+            if (firstChannel_[handle] < 0)
+            {
+                firstChannel_[handle] = static_cast<int>(channelIndex);
+            }
+        }
+    }
+
+    for (ProgramHandle handle = 0; handle < ids_.size(); ++handle)
+    {
+        const auto viewIt = content.views.find(ids_[handle]);
+        views_[handle] = viewIt != content.views.end() ? &viewIt->second : nullptr;
+    }
+}
+
+ProgramHandle ProgramIndex::HandleFor(const std::string& programId) const
+{
+    const auto it = handles_.find(programId);
+    return it != handles_.end() ? it->second : kInvalidProgram;
+}
+
+const std::string& ProgramIndex::IdFor(ProgramHandle handle) const
+{
+    return handle < ids_.size() ? ids_[handle] : kEmptyProgramId;
+}
+
+const ViewContent* ProgramIndex::ViewFor(ProgramHandle handle) const
+{
+    return handle < views_.size() ? views_[handle] : nullptr;
+}
+
+const std::vector<ProgramHandle>& ProgramIndex::ProgramsForChannel(std::size_t channelIndex) const
+{
+    return channelIndex < channelPrograms_.size() ? channelPrograms_[channelIndex] : kEmptyChannelPrograms;
+}
+
+int ProgramIndex::IndexInChannel(std::size_t channelIndex, ProgramHandle handle) const
+{
+    if (handle == kInvalidProgram || channelIndex >= channelPrograms_.size())
+    {
+        return -1;
+    }
+
+    const auto& handles = channelPrograms_[channelIndex];
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+        if (handles[i] == handle)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int ProgramIndex::ChannelForProgram(ProgramHandle handle) const
+{
+    return handle < firstChannel_.size() ? firstChannel_[handle] : -1;
+}
+
+ProgramHandle ProgramIndex::Intern(const std::string& programId)
+{
+    const auto [it, inserted] = handles_.emplace(programId, static_cast<ProgramHandle>(ids_.size()));
+    if (inserted)
+    {
+        ids_.push_back(programId);
+        views_.push_back(nullptr);
+        firstChannel_.push_back(-1);
+    }
+    return it->second;
+}
+
+} // namespace colony
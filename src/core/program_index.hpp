@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/content.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+using ProgramHandle = std::uint32_t;
+
+inline constexpr ProgramHandle kInvalidProgram = std::numeric_limits<ProgramHandle>::max();
+
+// Interns every program ID in the loaded content into a dense 32-bit handle
+// so hot paths (tile clicks, hub branch activation, wheel navigation) compare
+// and index integers instead of hashing strings. Rebuild must be called after
+// channels or views are added or removed; pointers returned by ViewFor stay
+// valid across in-place edits of existing view entries.
+class ProgramIndex
+{
+  public:
+    void Rebuild(const AppContent& content);
+
+    [[nodiscard]] ProgramHandle HandleFor(const std::string& programId) const;
+    [[nodiscard]] const std::string& IdFor(ProgramHandle handle) const;
+    [[nodiscard]] const ViewContent* ViewFor(ProgramHandle handle) const;
+
+    // Programs of a channel as handles, parallel to Channel::programs.
+    [[nodiscard]] const std::vector<ProgramHandle>& ProgramsForChannel(std::size_t channelIndex) const;
+
+    // Position of a program within a channel, or -1 when the channel does not
+    // list it.
+    [[nodiscard]] int IndexInChannel(std::size_t channelIndex, ProgramHandle handle) const;
+
+    // First channel listing the program, or -1 when none does.
+    [[nodiscard]] int ChannelForProgram(ProgramHandle handle) const;
+
+  private:
+    ProgramHandle Intern(const std::string& programId);
+
+    std::unordered_map<std::string, ProgramHandle> handles_;
+    std::vector<std::string> ids_;
+    std::vector<const ViewContent*> views_;
+    std::vector<int> firstChannel_;
+    std::vector<std::vector<ProgramHandle>> channelPrograms_;
+};
+
+} // namespace colony
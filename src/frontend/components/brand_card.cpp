@@ -5,6 +5,7 @@
 #include "ui/layout.hpp"
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
+#include "utils/glow_cache.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -83,8 +84,15 @@ SDL_Rect BrandCard::Render(
 
     const int avatarSize = colony::ui::Scale(48);
     SDL_Rect avatarRect{cursorX, cursorY, avatarSize, avatarSize};
-    SDL_SetRenderDrawColor(renderer, content_.accent.r, content_.accent.g, content_.accent.b, SDL_ALPHA_OPAQUE);
-    colony::drawing::RenderFilledRoundedRect(renderer, avatarRect, avatarSize / 2);
+    if (content_.artworkTexture != nullptr && content_.artworkSourceRect.w > 0)
+    {
+        SDL_RenderCopy(renderer, content_.artworkTexture, &content_.artworkSourceRect, &avatarRect);
+    }
+    else
+    {
+        SDL_SetRenderDrawColor(renderer, content_.accent.r, content_.accent.g, content_.accent.b, SDL_ALPHA_OPAQUE);
+        colony::drawing::RenderFilledRoundedRect(renderer, avatarRect, avatarSize / 2);
+    }
     SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, 180);
     colony::drawing::RenderRoundedRect(renderer, avatarRect, avatarSize / 2);
 
@@ -214,25 +222,15 @@ SDL_Rect BrandCard::Render(
     {
         SDL_Color glow = interactions.hover;
         glow.a = 60;
-        SDL_Rect halo = cardRect;
-        halo.x -= colony::ui::Scale(6);
-        halo.y -= colony::ui::Scale(6);
-        halo.w += colony::ui::Scale(12);
-        halo.h += colony::ui::Scale(12);
-        colony::drawing::RenderRoundedRect(renderer, halo, radius + colony::ui::Scale(4));
+        colony::drawing::GlowCache::Shared().Render(renderer, cardRect, radius, colony::ui::Scale(8), glow);
     }
 
     if (active)
     {
         const float pulse = static_cast<float>(std::sin(timeSeconds * 2.8) * 0.5 + 0.5);
         SDL_Color activeGlow = colony::color::Mix(content_.accent, theme.heroTitle, 0.35f);
-        SDL_Rect halo = cardRect;
-        halo.x -= colony::ui::Scale(8);
-        halo.y -= colony::ui::Scale(8);
-        halo.w += colony::ui::Scale(16);
-        halo.h += colony::ui::Scale(16);
-        SDL_SetRenderDrawColor(renderer, activeGlow.r, activeGlow.g, activeGlow.b, static_cast<Uint8>(90 + 60 * pulse));
-        colony::drawing::RenderRoundedRect(renderer, halo, radius + colony::ui::Scale(6));
+        activeGlow.a = static_cast<Uint8>(90 + 60 * pulse);
+        colony::drawing::GlowCache::Shared().Render(renderer, cardRect, radius, colony::ui::Scale(12), activeGlow);
     }
 
     return cardRect;
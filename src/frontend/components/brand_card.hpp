@@ -30,6 +30,11 @@ class BrandCard
         std::vector<std::string> highlights;
         SDL_Color accent{255, 255, 255, SDL_ALPHA_OPAQUE};
         bool ready = false;
+        // Atlas-resident cover art drawn in the avatar slot when present;
+        // the card falls back to the accent disc while art is still
+        // decoding. Not owned by the card.
+        SDL_Texture* artworkTexture = nullptr;
+        SDL_Rect artworkSourceRect{0, 0, 0, 0};
     };
 
     void Build(
@@ -3,6 +3,7 @@
 #include "ui/layout.hpp"
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
+#include "utils/glyph_atlas.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -14,9 +15,6 @@ void SearchField::Build(SDL_Renderer* renderer, TTF_Font* font, std::string_view
 {
     font_ = font;
     placeholder_ = colony::CreateTextTexture(renderer, font_, std::string{placeholder}, theme.inputPlaceholder);
-    cachedValueTexture_ = {};
-    cachedValue_.clear();
-    cachedTextColor_ = SDL_Color{0, 0, 0, 0};
 }
 
 SearchField::RenderResult SearchField::Render(
@@ -72,30 +70,13 @@ SearchField::RenderResult SearchField::Render(
 
     if (!value.empty() && font_)
     {
-        SDL_Color desiredColor = theme.heroTitle;
-        if (cachedValue_ != value
-            || cachedTextColor_.r != desiredColor.r || cachedTextColor_.g != desiredColor.g
-            || cachedTextColor_.b != desiredColor.b || cachedTextColor_.a != desiredColor.a)
-        {
-            cachedValue_ = std::string{value};
-            cachedTextColor_ = desiredColor;
-            cachedValueTexture_ = colony::CreateTextTexture(renderer, font_, cachedValue_, desiredColor);
-        }
-
-        if (cachedValueTexture_.texture)
-        {
-            SDL_Rect textRect{
-                textStartX,
-                bounds.y + (bounds.h - cachedValueTexture_.height) / 2,
-                cachedValueTexture_.width,
-                cachedValueTexture_.height};
-            colony::RenderTexture(renderer, cachedValueTexture_, textRect);
-        }
+        // The draft changes every keystroke, so it goes through the glyph
+        // atlas rather than the whole-string texture cache.
+        const int textY = bounds.y + (bounds.h - TTF_FontHeight(font_)) / 2;
+        colony::GlyphAtlas::Shared().RenderText(renderer, font_, value, textStartX, textY, theme.heroTitle);
     }
     else if (placeholder_.texture)
     {
-        cachedValue_.clear();
-        cachedValueTexture_ = {};
         SDL_Rect placeholderRect{
             textStartX,
             bounds.y + (bounds.h - placeholder_.height) / 2,
@@ -6,7 +6,6 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
-#include <string>
 #include <string_view>
 
 namespace colony::frontend::components
@@ -34,9 +33,6 @@ class SearchField
   private:
     TTF_Font* font_ = nullptr;
     colony::TextTexture placeholder_;
-    mutable colony::TextTexture cachedValueTexture_;
-    mutable std::string cachedValue_;
-    mutable SDL_Color cachedTextColor_{0, 0, 0, 0};
 };
 
 } // namespace colony::frontend::components
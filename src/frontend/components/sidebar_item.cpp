@@ -3,6 +3,7 @@
 #include "ui/layout.hpp"
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
+#include "utils/glow_cache.hpp"
 #include "utils/text.hpp"
 
 #include <algorithm>
@@ -102,13 +103,8 @@ SDL_Rect SidebarItem::Render(
     if (pulse > 0.01f)
     {
         SDL_Color halo = colony::color::Mix(glow, theme.navRail, 0.4f);
-        SDL_Rect haloRect = itemRect;
-        haloRect.x -= colony::ui::Scale(6);
-        haloRect.w += colony::ui::Scale(12);
-        haloRect.y -= colony::ui::Scale(4);
-        haloRect.h += colony::ui::Scale(8);
-        SDL_SetRenderDrawColor(renderer, halo.r, halo.g, halo.b, static_cast<Uint8>(80 + pulse * 60.0f));
-        colony::drawing::RenderFilledRoundedRect(renderer, haloRect, radius + colony::ui::Scale(6));
+        halo.a = static_cast<Uint8>(80 + pulse * 60.0f);
+        colony::drawing::GlowCache::Shared().Render(renderer, itemRect, radius, colony::ui::Scale(10), halo);
     }
 
     return itemRect;
@@ -0,0 +1,124 @@
+#include "frontend/models/fuzzy_matcher.hpp"
+
+#include "utils/utf8.hpp"
+
+#include <algorithm>
+
+namespace colony::frontend::models::fuzzy
+{
+namespace
+{
+
+constexpr std::uint32_t kDigitBit = 1u << 26;
+constexpr std::uint32_t kOtherBit = 1u << 27;
+
+// Scores are additive in points; the substring base clears everything a
+// subsequence can accumulate, so the two tiers never interleave.
+constexpr int kSubstringBase = 1000;
+constexpr int kSubsequenceBase = 100;
+constexpr int kConsecutiveBonus = 10;
+constexpr int kBoundaryBonus = 15;
+constexpr int kGapPenaltyCap = 50;
+
+[[nodiscard]] std::uint32_t MaskFor(char ch) noexcept
+{
+    if (ch >= 'a' && ch <= 'z')
+    {
+        return 1u << (ch - 'a');
+    }
+    if (ch >= '0' && ch <= '9')
+    {
+        return kDigitBit;
+    }
+    if (ch == ' ' || ch == '\n')
+    {
+        // Separators carry no information; a query space should not demand
+        // one in the candidate.
+        return 0;
+    }
+    return kOtherBit;
+}
+
+[[nodiscard]] bool IsWordBoundary(char previous) noexcept
+{
+    return previous == ' ' || previous == '\n' || previous == '-' || previous == '_'
+        || previous == '.' || previous == '/';
+}
+
+} // namespace
+
+MatchKey BuildKey(std::string_view text)
+{
+    MatchKey key;
+    key.text = text::ToLowerAscii(std::string{text});
+    for (const char ch : key.text)
+    {
+        key.charMask |= MaskFor(ch);
+    }
+    return key;
+}
+
+std::optional<int> ScoreMatch(const MatchKey& candidate, const MatchKey& query)
+{
+    if (query.text.empty())
+    {
+        return kSubsequenceBase;
+    }
+    if ((candidate.charMask & query.charMask) != query.charMask)
+    {
+        return std::nullopt;
+    }
+
+    // Substring tier: ranked by how early the match starts, with a boundary
+    // bonus and a mild preference for shorter candidates so "Go" lands on
+    // the program named Go before everything merely containing it.
+    const auto position = candidate.text.find(query.text);
+    if (position != std::string::npos)
+    {
+        int score = kSubstringBase - static_cast<int>(std::min<std::size_t>(position, 100));
+        if (position == 0 || IsWordBoundary(candidate.text[position - 1]))
+        {
+            score += kBoundaryBonus;
+        }
+        score -= static_cast<int>(std::min<std::size_t>(candidate.text.size() - query.text.size(), 200)) / 4;
+        return score;
+    }
+
+    // Subsequence tier: greedy in-order scan rewarding consecutive runs and
+    // word-boundary hits, charging for the gaps in between.
+    int score = kSubsequenceBase;
+    int gap = 0;
+    std::size_t queryIndex = 0;
+    bool previousMatched = false;
+    for (std::size_t i = 0; i < candidate.text.size() && queryIndex < query.text.size(); ++i)
+    {
+        if (candidate.text[i] == query.text[queryIndex])
+        {
+            if (previousMatched)
+            {
+                score += kConsecutiveBonus;
+            }
+            if (i == 0 || IsWordBoundary(candidate.text[i - 1]))
+            {
+                score += kBoundaryBonus;
+            }
+            previousMatched = true;
+            ++queryIndex;
+        }
+        else
+        {
+            if (queryIndex != 0)
+            {
+                ++gap;
+            }
+            previousMatched = false;
+        }
+    }
+    if (queryIndex != query.text.size())
+    {
+        return std::nullopt;
+    }
+    return score - std::min(gap, kGapPenaltyCap);
+}
+
+} // namespace colony::frontend::models::fuzzy
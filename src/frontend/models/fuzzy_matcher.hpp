@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace colony::frontend::models::fuzzy
+{
+
+// Precomputable match key for library filtering: the normalized (lowercased)
+// text plus a character-class bitmask. The mask has one bit per ASCII letter
+// and one each for digits and everything else, so a candidate that cannot
+// possibly contain the query is rejected with a single AND before any
+// per-character work — the keys are computed once per channel and reused
+// across every keystroke.
+struct MatchKey
+{
+    std::string text;
+    std::uint32_t charMask = 0;
+};
+
+[[nodiscard]] MatchKey BuildKey(std::string_view text);
+
+// Scores query against candidate; higher is a better match, nullopt is a
+// miss. An exact substring always outranks a scattered subsequence, earlier
+// and word-boundary matches outrank later ones, and gaps cost. The
+// subsequence pass is greedy rather than optimal-alignment DP — library
+// headings are short and the greedy pick loses only on adversarial inputs,
+// while staying linear in the candidate length.
+[[nodiscard]] std::optional<int> ScoreMatch(const MatchKey& candidate, const MatchKey& query);
+
+} // namespace colony::frontend::models::fuzzy
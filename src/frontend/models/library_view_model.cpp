@@ -1,7 +1,11 @@
 #include "frontend/models/library_view_model.hpp"
 
+#include "utils/utf8.hpp"
+
 #include <algorithm>
 #include <cctype>
+#include <unordered_map>
+#include <utility>
 
 namespace colony::frontend::models
 {
@@ -22,10 +26,7 @@ std::string Trim(std::string value)
 
 std::string ToLower(std::string value)
 {
-    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-        return static_cast<char>(std::tolower(ch));
-    });
-    return value;
+    return text::ToLowerAscii(std::move(value));
 }
 
 } // namespace
@@ -43,6 +44,10 @@ const std::string& LibraryViewModel::Filter() const noexcept
 
 void LibraryViewModel::SetSortOption(LibrarySortOption option) noexcept
 {
+    if (option != sortOption_)
+    {
+        chipsCacheValid_ = false;
+    }
     sortOption_ = option;
 }
 
@@ -51,9 +56,14 @@ LibrarySortOption LibraryViewModel::SortOption() const noexcept
     return sortOption_;
 }
 
-std::vector<LibrarySortChip> LibraryViewModel::BuildSortChips(
+const std::vector<LibrarySortChip>& LibraryViewModel::BuildSortChips(
     const std::function<std::string(std::string_view)>& localize) const
 {
+    if (chipsCacheValid_)
+    {
+        return cachedChips_;
+    }
+
     auto resolveLabel = [&](std::string_view key, std::string_view fallback) {
         if (localize)
         {
@@ -76,95 +86,319 @@ std::vector<LibrarySortChip> LibraryViewModel::BuildSortChips(
         LibrarySortOption::Alphabetical,
         resolveLabel("library.sort_alphabetical", "Alphabetical"),
         sortOption_ == LibrarySortOption::Alphabetical});
-    return chips;
+
+    cachedChips_ = std::move(chips);
+    chipsCacheValid_ = true;
+    return cachedChips_;
+}
+
+void LibraryViewModel::InvalidateSortChips() noexcept
+{
+    chipsCacheValid_ = false;
 }
 
-std::vector<LibraryProgramEntry> LibraryViewModel::BuildProgramList(
+const std::vector<LibraryProgramEntry>& LibraryViewModel::BuildProgramList(
     const colony::AppContent& content,
     int activeChannelIndex,
     const std::vector<int>& channelSelections) const
 {
-    std::vector<LibraryProgramEntry> entries;
-
     if (activeChannelIndex < 0 || activeChannelIndex >= static_cast<int>(content.channels.size()))
     {
-        return entries;
+        cachedEntries_.clear();
+        cacheValid_ = false;
+        return cachedEntries_;
     }
 
     const auto& channel = content.channels[activeChannelIndex];
-    if (channel.programs.empty())
+
+    std::string selectedProgramId;
+    if (!channel.programs.empty() && activeChannelIndex < static_cast<int>(channelSelections.size()))
     {
-        return entries;
+        const int selectionIndex = std::clamp(
+            channelSelections[activeChannelIndex],
+            0,
+            static_cast<int>(channel.programs.size()) - 1);
+        if (selectionIndex >= 0 && selectionIndex < static_cast<int>(channel.programs.size()))
+        {
+            selectedProgramId = channel.programs[selectionIndex];
+        }
     }
 
-    std::vector<std::string> workingPrograms = channel.programs;
-    if (sortOption_ == LibrarySortOption::Alphabetical)
+    const bool sameListInputs = cacheValid_ && cachedChannelIndex_ == activeChannelIndex
+        && cachedSortOption_ == sortOption_ && cachedFilter_ == normalizedFilter_;
+    if (sameListInputs)
     {
-        auto makeSortKey = [&](const std::string& programId) {
-            auto viewIt = content.views.find(programId);
-            if (viewIt != content.views.end())
+        if (cachedSelectedProgramId_ != selectedProgramId)
+        {
+            for (auto& entry : cachedEntries_)
             {
-                return ToLower(viewIt->second.heading);
+                entry.selected = entry.programId == selectedProgramId;
             }
-            return ToLower(programId);
-        };
+            cachedSelectedProgramId_ = selectedProgramId;
+        }
+        return cachedEntries_;
+    }
 
-        std::sort(workingPrograms.begin(), workingPrograms.end(), [&](const std::string& lhs, const std::string& rhs) {
-            return makeSortKey(lhs) < makeSortKey(rhs);
-        });
+    // Adopt an idle-prefetched list when one matches the current inputs, so
+    // switching into a large channel skips the sort entirely.
+    bool adopted = false;
+    for (auto it = prefetchedLists_.begin(); it != prefetchedLists_.end(); ++it)
+    {
+        if (it->channelIndex == activeChannelIndex && it->sortOption == sortOption_
+            && it->normalizedFilter == normalizedFilter_)
+        {
+            cachedEntries_ = std::move(it->entries);
+            prefetchedLists_.erase(it);
+            adopted = true;
+            break;
+        }
     }
 
-    std::string selectedProgramId;
-    if (activeChannelIndex >= 0 && activeChannelIndex < static_cast<int>(channelSelections.size()))
+    if (!adopted)
     {
-        const int selectionIndex = std::clamp(
-            channelSelections[activeChannelIndex],
-            0,
-            static_cast<int>(channel.programs.size()) - 1);
-        if (selectionIndex >= 0 && selectionIndex < static_cast<int>(channel.programs.size()))
+        if (normalizedFilter_.empty())
         {
-            selectedProgramId = channel.programs[selectionIndex];
+            cachedEntries_ = BuildEntriesFromSnapshot(
+                SnapshotChannel(content, activeChannelIndex, sortOption_, normalizedFilter_, recencyOrder_),
+                sortOption_,
+                normalizedFilter_);
+        }
+        else
+        {
+            // The match keys depend only on the channel and sort option, not
+            // on the query, so each keystroke rescores the cached keys
+            // instead of re-lowercasing and re-keying the channel's text.
+            const bool reuseKeys = keySnapshotValid_
+                && keySnapshot_.channelIndex == activeChannelIndex
+                && keySnapshotSortOption_ == sortOption_;
+            if (!reuseKeys)
+            {
+                keySnapshot_ = SnapshotChannel(
+                    content, activeChannelIndex, sortOption_, normalizedFilter_, recencyOrder_);
+                keySnapshotValid_ = true;
+                keySnapshotSortOption_ = sortOption_;
+            }
+            cachedEntries_ = BuildEntriesFromSnapshot(keySnapshot_, sortOption_, normalizedFilter_);
         }
     }
 
-    entries.reserve(workingPrograms.size());
-    for (const auto& programId : workingPrograms)
+    for (auto& entry : cachedEntries_)
+    {
+        entry.selected = entry.programId == selectedProgramId;
+    }
+
+    cacheValid_ = true;
+    cachedChannelIndex_ = activeChannelIndex;
+    cachedSortOption_ = sortOption_;
+    cachedFilter_ = normalizedFilter_;
+    cachedSelectedProgramId_ = selectedProgramId;
+    return cachedEntries_;
+}
+
+void LibraryViewModel::InvalidateProgramList() noexcept
+{
+    cacheValid_ = false;
+    // Prefetched lists and match keys were built from the same content and
+    // are just as stale as the cache.
+    prefetchedLists_.clear();
+    keySnapshotValid_ = false;
+}
+
+LibraryViewModel::ChannelSnapshot LibraryViewModel::SnapshotChannel(
+    const colony::AppContent& content,
+    int channelIndex,
+    LibrarySortOption sortOption,
+    const std::string& normalizedFilter,
+    const std::vector<std::string>& recencyOrder)
+{
+    ChannelSnapshot snapshot;
+    if (channelIndex < 0 || channelIndex >= static_cast<int>(content.channels.size()))
+    {
+        return snapshot;
+    }
+
+    const auto& channel = content.channels[channelIndex];
+    const bool needsSortKey = sortOption == LibrarySortOption::Alphabetical;
+    const bool needsSearchText = !normalizedFilter.empty();
+    if (sortOption == LibrarySortOption::RecentlyPlayed)
     {
-        if (!normalizedFilter_.empty())
+        snapshot.recencyOrder = recencyOrder;
+    }
+
+    snapshot.channelIndex = channelIndex;
+    snapshot.programs.reserve(channel.programs.size());
+    for (const auto& programId : channel.programs)
+    {
+        ChannelSnapshot::Program program;
+        program.programId = programId;
+        if (needsSortKey || needsSearchText)
+        {
+            const auto viewIt = content.views.find(programId);
+            if (needsSortKey)
+            {
+                program.sortKey =
+                    viewIt != content.views.end() ? ToLower(viewIt->second.heading) : ToLower(programId);
+            }
+            if (needsSearchText)
+            {
+                // Joined with newlines the filter cannot contain, so a match
+                // never spans two fields.
+                std::string searchText = programId;
+                if (viewIt != content.views.end())
+                {
+                    searchText += '\n';
+                    searchText += viewIt->second.heading;
+                    searchText += '\n';
+                    searchText += viewIt->second.tagline;
+                }
+                program.searchKey = fuzzy::BuildKey(searchText);
+            }
+        }
+        snapshot.programs.emplace_back(std::move(program));
+    }
+    return snapshot;
+}
+
+std::vector<LibraryProgramEntry> LibraryViewModel::BuildEntriesFromSnapshot(
+    ChannelSnapshot snapshot, LibrarySortOption sortOption, const std::string& normalizedFilter)
+{
+    if (sortOption == LibrarySortOption::Alphabetical)
+    {
+        // The snapshot carries pre-lowercased sort keys, so each heading was
+        // lowercased once rather than on every comparison.
+        std::sort(snapshot.programs.begin(), snapshot.programs.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.sortKey < rhs.sortKey;
+        });
+    }
+    else if (sortOption == LibrarySortOption::RecentlyPlayed && !snapshot.recencyOrder.empty())
+    {
+        // Walk the maintained recency order and pick out the channel's
+        // members, then append never-launched programs in channel order.
+        // O(history + channel), no sorting.
+        std::unordered_map<std::string_view, std::size_t> positions;
+        positions.reserve(snapshot.programs.size());
+        for (std::size_t i = 0; i < snapshot.programs.size(); ++i)
         {
-            auto viewIt = content.views.find(programId);
-            bool matches = MatchesFilter(programId);
-            if (viewIt != content.views.end())
+            positions.emplace(snapshot.programs[i].programId, i);
+        }
+
+        std::vector<ChannelSnapshot::Program> ordered;
+        ordered.reserve(snapshot.programs.size());
+        std::vector<bool> taken(snapshot.programs.size(), false);
+        for (const auto& programId : snapshot.recencyOrder)
+        {
+            const auto it = positions.find(programId);
+            if (it != positions.end() && !taken[it->second])
             {
-                matches = matches || MatchesFilter(viewIt->second.heading) || MatchesFilter(viewIt->second.tagline);
+                taken[it->second] = true;
+                ordered.emplace_back(std::move(snapshot.programs[it->second]));
             }
-            if (!matches)
+        }
+        for (std::size_t i = 0; i < snapshot.programs.size(); ++i)
+        {
+            if (!taken[i])
             {
-                continue;
+                ordered.emplace_back(std::move(snapshot.programs[i]));
             }
         }
+        snapshot.programs = std::move(ordered);
+    }
 
-        entries.push_back(LibraryProgramEntry{programId, programId == selectedProgramId});
+    std::vector<LibraryProgramEntry> entries;
+    entries.reserve(snapshot.programs.size());
+    if (normalizedFilter.empty())
+    {
+        for (auto& program : snapshot.programs)
+        {
+            entries.push_back(LibraryProgramEntry{std::move(program.programId), false});
+        }
+        return entries;
     }
 
+    // Score each program against the query; the character mask inside
+    // ScoreMatch rejects most non-matches with a single AND.
+    const fuzzy::MatchKey queryKey = fuzzy::BuildKey(normalizedFilter);
+    struct ScoredProgram
+    {
+        int score;
+        std::string programId;
+    };
+    std::vector<ScoredProgram> scored;
+    scored.reserve(snapshot.programs.size());
+    for (auto& program : snapshot.programs)
+    {
+        if (const auto score = fuzzy::ScoreMatch(program.searchKey, queryKey))
+        {
+            scored.push_back(ScoredProgram{*score, std::move(program.programId)});
+        }
+    }
+    // Best matches first; stable so ties keep the sort option's base order.
+    std::stable_sort(scored.begin(), scored.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.score > rhs.score;
+    });
+    for (auto& program : scored)
+    {
+        entries.push_back(LibraryProgramEntry{std::move(program.programId), false});
+    }
     return entries;
 }
 
-bool LibraryViewModel::HasActiveFilter() const noexcept
+void LibraryViewModel::StorePrefetchedList(
+    int channelIndex,
+    LibrarySortOption sortOption,
+    std::string normalizedFilter,
+    std::vector<LibraryProgramEntry> entries)
 {
-    return !normalizedFilter_.empty();
+    // One slot per channel; a newer prefetch for the same channel replaces
+    // the old list (its inputs may have changed in the meantime).
+    auto it = std::find_if(prefetchedLists_.begin(), prefetchedLists_.end(), [&](const PrefetchedList& list) {
+        return list.channelIndex == channelIndex;
+    });
+    if (it == prefetchedLists_.end())
+    {
+        // Bounded by the handful of channels the prefetcher targets; drop
+        // the oldest slot if a burst ever exceeds that.
+        constexpr std::size_t kMaxPrefetchedLists = 4;
+        if (prefetchedLists_.size() >= kMaxPrefetchedLists)
+        {
+            prefetchedLists_.erase(prefetchedLists_.begin());
+        }
+        it = prefetchedLists_.emplace(prefetchedLists_.end());
+    }
+    it->channelIndex = channelIndex;
+    it->sortOption = sortOption;
+    it->normalizedFilter = std::move(normalizedFilter);
+    it->entries = std::move(entries);
 }
 
-bool LibraryViewModel::MatchesFilter(std::string_view value) const
+const std::string& LibraryViewModel::NormalizedFilter() const noexcept
 {
-    if (normalizedFilter_.empty())
+    return normalizedFilter_;
+}
+
+void LibraryViewModel::SetRecencyOrder(std::vector<std::string> order)
+{
+    if (order == recencyOrder_)
+    {
+        return;
+    }
+    recencyOrder_ = std::move(order);
+    // Only the Recently Played view reads the order, so an alphabetical or
+    // filtered cache stays valid across launches.
+    if (sortOption_ == LibrarySortOption::RecentlyPlayed)
     {
-        return true;
+        InvalidateProgramList();
     }
+}
+
+const std::vector<std::string>& LibraryViewModel::RecencyOrder() const noexcept
+{
+    return recencyOrder_;
+}
 
-    std::string candidate{value};
-    candidate = ToLower(candidate);
-    return candidate.find(normalizedFilter_) != std::string::npos;
+bool LibraryViewModel::HasActiveFilter() const noexcept
+{
+    return !normalizedFilter_.empty();
 }
 
 } // namespace colony::frontend::models
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/content.hpp"
+#include "frontend/models/fuzzy_matcher.hpp"
 
 #include <functional>
 #include <string>
@@ -38,22 +39,111 @@ class LibraryViewModel
     void SetSortOption(LibrarySortOption option) noexcept;
     [[nodiscard]] LibrarySortOption SortOption() const noexcept;
 
-    [[nodiscard]] std::vector<LibrarySortChip> BuildSortChips(
+    // Returns the sort chips with localized labels. The result is cached so
+    // steady-state frames do not relocalize and reallocate the labels; the
+    // cache refreshes when the sort option changes and can be dropped
+    // explicitly when the language does.
+    [[nodiscard]] const std::vector<LibrarySortChip>& BuildSortChips(
         const std::function<std::string(std::string_view)>& localize) const;
 
-    [[nodiscard]] std::vector<LibraryProgramEntry> BuildProgramList(
+    // Drops the cached sort chips; call after the localization changes.
+    void InvalidateSortChips() noexcept;
+
+    // Returns the filtered, sorted program list for the active channel. The
+    // result is cached and rebuilt only when the channel, filter or sort
+    // option changes; a selection change just patches the selected flags.
+    [[nodiscard]] const std::vector<LibraryProgramEntry>& BuildProgramList(
         const colony::AppContent& content,
         int activeChannelIndex,
         const std::vector<int>& channelSelections) const;
 
+    // Drops the cached program list; call after content mutates (programs
+    // added or removed, headings edited).
+    void InvalidateProgramList() noexcept;
+
+    // Plain-copy snapshot of the fields one channel's list is built from,
+    // safe to hand to a worker thread: no pointers back into AppContent.
+    // Only the fields the given sort and filter actually read are copied.
+    struct ChannelSnapshot
+    {
+        struct Program
+        {
+            std::string programId;
+            std::string sortKey;
+            fuzzy::MatchKey searchKey;
+        };
+
+        int channelIndex = -1;
+        std::vector<Program> programs;
+        // Most-recent-first launch order, copied only for RecentlyPlayed.
+        std::vector<std::string> recencyOrder;
+    };
+
+    [[nodiscard]] static ChannelSnapshot SnapshotChannel(
+        const colony::AppContent& content,
+        int channelIndex,
+        LibrarySortOption sortOption,
+        const std::string& normalizedFilter,
+        const std::vector<std::string>& recencyOrder);
+
+    // Pure sort/filter kernel shared by BuildProgramList and the idle
+    // prefetch path; runs against a snapshot so it can execute off the UI
+    // thread. Selection flags are left unset for the caller to patch.
+    [[nodiscard]] static std::vector<LibraryProgramEntry> BuildEntriesFromSnapshot(
+        ChannelSnapshot snapshot, LibrarySortOption sortOption, const std::string& normalizedFilter);
+
+    // Installs an idle-prefetched list; the next BuildProgramList for that
+    // channel adopts it instead of sorting on the UI thread, provided the
+    // sort option and filter still match.
+    void StorePrefetchedList(
+        int channelIndex,
+        LibrarySortOption sortOption,
+        std::string normalizedFilter,
+        std::vector<LibraryProgramEntry> entries);
+
+    [[nodiscard]] const std::string& NormalizedFilter() const noexcept;
+
+    // Installs the launch history's most-recent-first order; the Recently
+    // Played view reads it directly instead of sorting. Invalidates the
+    // cached list only when the order actually changed.
+    void SetRecencyOrder(std::vector<std::string> order);
+    [[nodiscard]] const std::vector<std::string>& RecencyOrder() const noexcept;
+
     [[nodiscard]] bool HasActiveFilter() const noexcept;
 
   private:
-    [[nodiscard]] bool MatchesFilter(std::string_view value) const;
+    struct PrefetchedList
+    {
+        int channelIndex = -1;
+        LibrarySortOption sortOption = LibrarySortOption::RecentlyPlayed;
+        std::string normalizedFilter;
+        std::vector<LibraryProgramEntry> entries;
+    };
 
     std::string filter_;
     std::string normalizedFilter_;
     LibrarySortOption sortOption_ = LibrarySortOption::RecentlyPlayed;
+
+    mutable std::vector<LibraryProgramEntry> cachedEntries_;
+    mutable bool cacheValid_ = false;
+    mutable int cachedChannelIndex_ = -1;
+    mutable LibrarySortOption cachedSortOption_ = LibrarySortOption::RecentlyPlayed;
+    mutable std::string cachedFilter_;
+    mutable std::string cachedSelectedProgramId_;
+
+    mutable std::vector<LibrarySortChip> cachedChips_;
+    mutable bool chipsCacheValid_ = false;
+
+    mutable std::vector<PrefetchedList> prefetchedLists_;
+
+    // Cached snapshot with the programs' match keys, reused across
+    // keystrokes: typing into the filter rescores the existing keys instead
+    // of re-lowercasing and re-keying the channel's text every character.
+    mutable ChannelSnapshot keySnapshot_;
+    mutable bool keySnapshotValid_ = false;
+    mutable LibrarySortOption keySnapshotSortOption_ = LibrarySortOption::RecentlyPlayed;
+
+    std::vector<std::string> recencyOrder_;
 };
 
 } // namespace colony::frontend::models
@@ -59,6 +59,17 @@ class Debouncer
         return pending_;
     }
 
+    // Seconds until the pending callback becomes due; zero or negative when
+    // it is already due, and zero when nothing is pending.
+    [[nodiscard]] double SecondsUntilDeadline(double nowSeconds) const noexcept
+    {
+        if (!pending_)
+        {
+            return 0.0;
+        }
+        return (scheduledAtSeconds_ + delaySeconds_) - nowSeconds;
+    }
+
   private:
     double delaySeconds_ = 0.0;
     double scheduledAtSeconds_ = 0.0;
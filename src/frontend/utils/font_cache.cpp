@@ -0,0 +1,40 @@
+#include "frontend/utils/font_cache.hpp"
+
+namespace colony::frontend::fonts
+{
+
+TTF_Font* FontCache::Acquire(const std::string& path, int scaledSize)
+{
+    if (path.empty() || scaledSize <= 0)
+    {
+        return nullptr;
+    }
+
+    Key key{path, scaledSize};
+    if (const auto it = fonts_.find(key); it != fonts_.end())
+    {
+        return it->second.get();
+    }
+
+    sdl::FontHandle handle{TTF_OpenFont(path.c_str(), scaledSize)};
+    if (!handle)
+    {
+        return nullptr;
+    }
+
+    TTF_Font* font = handle.get();
+    fonts_.emplace(std::move(key), std::move(handle));
+    return font;
+}
+
+void FontCache::Clear()
+{
+    fonts_.clear();
+}
+
+std::size_t FontCache::Size() const noexcept
+{
+    return fonts_.size();
+}
+
+} // namespace colony::frontend::fonts
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "utils/sdl_wrappers.hpp"
+
+#include <SDL2/SDL_ttf.h>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace colony::frontend::fonts
+{
+
+// Deduplicating cache of opened fonts keyed by (path, scaled point size).
+// Several UI roles and most native-language entries resolve to the same file
+// at the same size; the cache opens each distinct face once and hands out
+// non-owning pointers that stay valid until Clear(). The cache owns every
+// handle, so callers must never close the returned fonts.
+class FontCache
+{
+public:
+    // Returns the cached font for the path and size, opening it on first
+    // use. Returns nullptr if the font cannot be opened; failures are not
+    // cached so a transient error does not pin a missing face.
+    [[nodiscard]] TTF_Font* Acquire(const std::string& path, int scaledSize);
+
+    // Closes every cached font. Callers holding pointers from Acquire must
+    // drop them first.
+    void Clear();
+
+    [[nodiscard]] std::size_t Size() const noexcept;
+
+private:
+    struct Key
+    {
+        std::string path;
+        int size = 0;
+
+        bool operator==(const Key& other) const noexcept
+        {
+            return size == other.size && path == other.path;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const noexcept
+        {
+            std::size_t hash = std::hash<std::string>{}(key.path);
+            hash ^= std::hash<int>{}(key.size) + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    std::unordered_map<Key, sdl::FontHandle, KeyHash> fonts_;
+};
+
+} // namespace colony::frontend::fonts
@@ -0,0 +1,457 @@
+#include "frontend/utils/icon_pipeline.hpp"
+
+#include "utils/texture_accounting.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+namespace colony::frontend::icons
+{
+namespace
+{
+
+// One shelf-packed page; large enough that a full channel of tile art fits
+// in one or two textures, small enough to allocate lazily without a stall.
+constexpr int kAtlasPageSize = 1024;
+// A transparent gutter between packed rects so linear filtering never bleeds
+// a neighbour's edge pixels into a tile.
+constexpr int kAtlasPadding = 1;
+
+constexpr char kCacheMagic[4] = {'C', 'A', 'R', 'T'};
+constexpr std::uint32_t kCacheVersion = 1;
+
+struct CacheHeader
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t mipWidth;
+    std::uint32_t mipHeight;
+};
+
+// FNV-1a over everything that invalidates a cached downscale: the source
+// path, its size and mtime, and the requested tile size.
+std::uint64_t CacheFingerprint(const std::filesystem::path& source, int targetSize)
+{
+    constexpr std::uint64_t kPrime = 1099511628211ULL;
+    std::uint64_t state = 14695981039346656037ULL;
+    const auto mix = [&state](std::uint64_t value) {
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            state ^= (value >> shift) & 0xffULL;
+            state *= kPrime;
+        }
+    };
+
+    for (const char ch : source.string())
+    {
+        state ^= static_cast<unsigned char>(ch);
+        state *= kPrime;
+    }
+
+    std::error_code error;
+    mix(static_cast<std::uint64_t>(std::filesystem::file_size(source, error)));
+    mix(static_cast<std::uint64_t>(
+        std::filesystem::last_write_time(source, error).time_since_epoch().count()));
+    mix(static_cast<std::uint64_t>(targetSize));
+    return state;
+}
+
+std::filesystem::path CacheFileFor(
+    const std::filesystem::path& cacheDirectory, const std::filesystem::path& source, int targetSize)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.cart",
+        static_cast<unsigned long long>(CacheFingerprint(source, targetSize)));
+    return cacheDirectory / name;
+}
+
+bool ReadCachedArt(const std::filesystem::path& cacheFile, std::vector<std::uint32_t>& pixels,
+    std::vector<std::uint32_t>& mipPixels, int& width, int& height, int& mipWidth, int& mipHeight)
+{
+    std::ifstream input{cacheFile, std::ios::binary};
+    if (!input)
+    {
+        return false;
+    }
+
+    CacheHeader header{};
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!input || std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0
+        || header.version != kCacheVersion || header.width == 0 || header.height == 0
+        || header.width > kAtlasPageSize || header.height > kAtlasPageSize)
+    {
+        return false;
+    }
+
+    width = static_cast<int>(header.width);
+    height = static_cast<int>(header.height);
+    mipWidth = static_cast<int>(header.mipWidth);
+    mipHeight = static_cast<int>(header.mipHeight);
+    pixels.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    mipPixels.resize(static_cast<std::size_t>(mipWidth) * static_cast<std::size_t>(mipHeight));
+    input.read(reinterpret_cast<char*>(pixels.data()),
+        static_cast<std::streamsize>(pixels.size() * sizeof(std::uint32_t)));
+    input.read(reinterpret_cast<char*>(mipPixels.data()),
+        static_cast<std::streamsize>(mipPixels.size() * sizeof(std::uint32_t)));
+    return static_cast<bool>(input);
+}
+
+void WriteCachedArt(const std::filesystem::path& cacheFile, const std::vector<std::uint32_t>& pixels,
+    const std::vector<std::uint32_t>& mipPixels, int width, int height, int mipWidth, int mipHeight)
+{
+    std::error_code error;
+    std::filesystem::create_directories(cacheFile.parent_path(), error);
+
+    // Write-then-rename so a crash mid-write never leaves a torn cache file
+    // that a later start would trust.
+    std::filesystem::path temporary = cacheFile;
+    temporary += ".tmp";
+    {
+        std::ofstream output{temporary, std::ios::binary | std::ios::trunc};
+        if (!output)
+        {
+            return;
+        }
+        CacheHeader header{};
+        std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+        header.version = kCacheVersion;
+        header.width = static_cast<std::uint32_t>(width);
+        header.height = static_cast<std::uint32_t>(height);
+        header.mipWidth = static_cast<std::uint32_t>(mipWidth);
+        header.mipHeight = static_cast<std::uint32_t>(mipHeight);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(pixels.data()),
+            static_cast<std::streamsize>(pixels.size() * sizeof(std::uint32_t)));
+        output.write(reinterpret_cast<const char*>(mipPixels.data()),
+            static_cast<std::streamsize>(mipPixels.size() * sizeof(std::uint32_t)));
+        if (!output)
+        {
+            output.close();
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, cacheFile, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary, error);
+    }
+}
+
+// Area-average downscale: every output pixel averages its full source box,
+// so thin features survive where nearest-neighbour sampling would drop them.
+void DownscaleBox(const std::uint32_t* source, int sourceWidth, int sourceHeight,
+    std::vector<std::uint32_t>& out, int outWidth, int outHeight)
+{
+    out.resize(static_cast<std::size_t>(outWidth) * static_cast<std::size_t>(outHeight));
+    for (int y = 0; y < outHeight; ++y)
+    {
+        const int y0 = y * sourceHeight / outHeight;
+        const int y1 = std::max(y0 + 1, (y + 1) * sourceHeight / outHeight);
+        for (int x = 0; x < outWidth; ++x)
+        {
+            const int x0 = x * sourceWidth / outWidth;
+            const int x1 = std::max(x0 + 1, (x + 1) * sourceWidth / outWidth);
+
+            std::uint32_t sumR = 0;
+            std::uint32_t sumG = 0;
+            std::uint32_t sumB = 0;
+            std::uint32_t sumA = 0;
+            for (int sy = y0; sy < y1; ++sy)
+            {
+                const std::uint32_t* row = source + static_cast<std::size_t>(sy) * sourceWidth;
+                for (int sx = x0; sx < x1; ++sx)
+                {
+                    const std::uint32_t pixel = row[sx];
+                    sumR += pixel & 0xffu;
+                    sumG += (pixel >> 8) & 0xffu;
+                    sumB += (pixel >> 16) & 0xffu;
+                    sumA += (pixel >> 24) & 0xffu;
+                }
+            }
+
+            const std::uint32_t count = static_cast<std::uint32_t>((x1 - x0) * (y1 - y0));
+            out[static_cast<std::size_t>(y) * outWidth + x] = (sumR / count) | ((sumG / count) << 8)
+                | ((sumB / count) << 16) | ((sumA / count) << 24);
+        }
+    }
+}
+
+} // namespace
+
+IconArtPipeline::~IconArtPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable())
+    {
+        worker_.join();
+    }
+
+    for (const AtlasPage& page : pages_)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::IconAtlas, page.accountedBytes);
+    }
+}
+
+void IconArtPipeline::SetCacheDirectory(std::filesystem::path directory)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    cacheDirectory_ = std::move(directory);
+}
+
+void IconArtPipeline::Request(const std::string& key, const std::filesystem::path& source, int targetSize)
+{
+    if (key.empty() || targetSize <= 0)
+    {
+        return;
+    }
+    if (!requested_.insert(key).second)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    jobs_.push_back(Job{key, source, targetSize});
+    if (!worker_.joinable())
+    {
+        worker_ = std::thread{&IconArtPipeline::WorkerLoop, this};
+    }
+    wake_.notify_one();
+}
+
+void IconArtPipeline::WorkerLoop()
+{
+    for (;;)
+    {
+        Job job;
+        std::filesystem::path cacheDirectory;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            wake_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            if (stopping_)
+            {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+            cacheDirectory = cacheDirectory_;
+        }
+
+        DecodedArt art;
+        if (!Decode(job, cacheDirectory, art))
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock{mutex_};
+        ready_.push_back(std::move(art));
+    }
+}
+
+bool IconArtPipeline::Decode(const Job& job, const std::filesystem::path& cacheDirectory, DecodedArt& out)
+{
+    out.key = job.key;
+
+    std::error_code error;
+    if (!std::filesystem::exists(job.source, error))
+    {
+        return false;
+    }
+
+    const std::filesystem::path cacheFile =
+        cacheDirectory.empty() ? std::filesystem::path{} : CacheFileFor(cacheDirectory, job.source, job.targetSize);
+    if (!cacheFile.empty()
+        && ReadCachedArt(cacheFile, out.pixels, out.mipPixels, out.width, out.height, out.mipWidth, out.mipHeight))
+    {
+        return true;
+    }
+
+    SDL_Surface* loaded = SDL_LoadBMP(job.source.string().c_str());
+    if (loaded == nullptr)
+    {
+        return false;
+    }
+
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (converted == nullptr || converted->w <= 0 || converted->h <= 0)
+    {
+        SDL_FreeSurface(converted);
+        return false;
+    }
+
+    // Fit inside the tile without upscaling; tiny sources pack as-is.
+    const int largestEdge = std::max(converted->w, converted->h);
+    const int clampedTarget = std::min(job.targetSize, largestEdge);
+    const int width = std::max(1, converted->w * clampedTarget / largestEdge);
+    const int height = std::max(1, converted->h * clampedTarget / largestEdge);
+
+    // The surface pitch can exceed w * 4; repack into a tight buffer first.
+    std::vector<std::uint32_t> tight(static_cast<std::size_t>(converted->w) * converted->h);
+    const auto* sourceBytes = static_cast<const std::uint8_t*>(converted->pixels);
+    for (int y = 0; y < converted->h; ++y)
+    {
+        std::memcpy(tight.data() + static_cast<std::size_t>(y) * converted->w,
+            sourceBytes + static_cast<std::size_t>(y) * converted->pitch,
+            static_cast<std::size_t>(converted->w) * sizeof(std::uint32_t));
+    }
+    const int sourceWidth = converted->w;
+    const int sourceHeight = converted->h;
+    SDL_FreeSurface(converted);
+
+    DownscaleBox(tight.data(), sourceWidth, sourceHeight, out.pixels, width, height);
+    out.width = width;
+    out.height = height;
+
+    out.mipWidth = std::max(1, width / 2);
+    out.mipHeight = std::max(1, height / 2);
+    DownscaleBox(out.pixels.data(), width, height, out.mipPixels, out.mipWidth, out.mipHeight);
+
+    if (!cacheFile.empty())
+    {
+        WriteCachedArt(cacheFile, out.pixels, out.mipPixels, out.width, out.height, out.mipWidth, out.mipHeight);
+    }
+    return true;
+}
+
+std::size_t IconArtPipeline::PumpCompletions(SDL_Renderer* renderer, std::size_t budget)
+{
+    std::size_t packed = 0;
+    while (packed < budget)
+    {
+        DecodedArt art;
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (ready_.empty())
+            {
+                break;
+            }
+            art = std::move(ready_.front());
+            ready_.pop_front();
+        }
+
+        AtlasRegion region;
+        if (Pack(renderer, art, region))
+        {
+            regions_[art.key] = region;
+            ++packedVersion_;
+        }
+        ++packed;
+    }
+    return packed;
+}
+
+const AtlasRegion* IconArtPipeline::Find(const std::string& key) const
+{
+    const auto it = regions_.find(key);
+    return it != regions_.end() ? &it->second : nullptr;
+}
+
+void IconArtPipeline::ReleaseTextures()
+{
+    for (const AtlasPage& page : pages_)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::IconAtlas, page.accountedBytes);
+    }
+    pages_.clear();
+    regions_.clear();
+    // Allow everything to be requested again; decodes come straight from
+    // the disk cache, so a rebuild costs packing only.
+    requested_.clear();
+}
+
+bool IconArtPipeline::Pack(SDL_Renderer* renderer, const DecodedArt& art, AtlasRegion& outRegion)
+{
+    if (renderer == nullptr || art.width <= 0 || art.height <= 0)
+    {
+        return false;
+    }
+
+    std::size_t pageIndex = 0;
+    SDL_Rect rect{0, 0, 0, 0};
+    if (!PlaceRect(renderer, art.width, art.height, pageIndex, rect))
+    {
+        return false;
+    }
+    SDL_UpdateTexture(pages_[pageIndex].texture.get(), &rect, art.pixels.data(),
+        art.width * static_cast<int>(sizeof(std::uint32_t)));
+
+    outRegion.texture = pages_[pageIndex].texture.get();
+    outRegion.rect = rect;
+    outRegion.mipRect = SDL_Rect{0, 0, 0, 0};
+
+    // The mip must share the base's page so a tile can switch levels without
+    // changing textures mid-batch; if it happens to land elsewhere, drop it.
+    if (art.mipWidth > 0 && art.mipHeight > 0)
+    {
+        std::size_t mipPage = 0;
+        SDL_Rect mipRect{0, 0, 0, 0};
+        if (PlaceRect(renderer, art.mipWidth, art.mipHeight, mipPage, mipRect) && mipPage == pageIndex)
+        {
+            SDL_UpdateTexture(pages_[mipPage].texture.get(), &mipRect, art.mipPixels.data(),
+                art.mipWidth * static_cast<int>(sizeof(std::uint32_t)));
+            outRegion.mipRect = mipRect;
+        }
+    }
+    return true;
+}
+
+bool IconArtPipeline::PlaceRect(SDL_Renderer* renderer, int width, int height, std::size_t& outPage, SDL_Rect& outRect)
+{
+    if (width + kAtlasPadding > kAtlasPageSize || height + kAtlasPadding > kAtlasPageSize)
+    {
+        return false;
+    }
+
+    if (!pages_.empty())
+    {
+        AtlasPage& page = pages_.back();
+        if (page.shelfX + width + kAtlasPadding > kAtlasPageSize)
+        {
+            // Shelf full; open the next one below.
+            page.shelfY += page.shelfHeight + kAtlasPadding;
+            page.shelfX = 0;
+            page.shelfHeight = 0;
+        }
+        if (page.shelfY + height + kAtlasPadding <= kAtlasPageSize)
+        {
+            outPage = pages_.size() - 1;
+            outRect = SDL_Rect{page.shelfX, page.shelfY, width, height};
+            page.shelfX += width + kAtlasPadding;
+            page.shelfHeight = std::max(page.shelfHeight, height);
+            return true;
+        }
+    }
+
+    AtlasPage page;
+    page.texture.reset(SDL_CreateTexture(
+        renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kAtlasPageSize, kAtlasPageSize));
+    if (!page.texture)
+    {
+        return false;
+    }
+    SDL_SetTextureBlendMode(page.texture.get(), SDL_BLENDMODE_BLEND);
+    page.accountedBytes = TextureAccounting::EstimateBytes(kAtlasPageSize, kAtlasPageSize);
+    TextureAccounting::Shared().Add(TextureAccounting::Subsystem::IconAtlas, page.accountedBytes);
+    pages_.push_back(std::move(page));
+
+    AtlasPage& created = pages_.back();
+    outPage = pages_.size() - 1;
+    outRect = SDL_Rect{0, 0, width, height};
+    created.shelfX = width + kAtlasPadding;
+    created.shelfY = 0;
+    created.shelfHeight = height;
+    return true;
+}
+
+} // namespace colony::frontend::icons
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "utils/sdl_wrappers.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace colony::frontend::icons
+{
+
+// Atlas-resident artwork: a pixel source rect into one of the pipeline's
+// shared atlas pages plus a half-resolution mip packed alongside it. The
+// texture is owned by the pipeline; regions are invalidated wholesale by
+// ReleaseTextures.
+struct AtlasRegion
+{
+    SDL_Texture* texture = nullptr;
+    SDL_Rect rect{0, 0, 0, 0};
+    SDL_Rect mipRect{0, 0, 0, 0};
+
+    // Picks the half-resolution mip once the destination is small enough
+    // that sampling the full-size image would shimmer under minification.
+    [[nodiscard]] const SDL_Rect& SourceFor(int destinationSize) const noexcept
+    {
+        if (mipRect.w > 0 && destinationSize * 2 <= rect.w)
+        {
+            return mipRect;
+        }
+        return rect;
+    }
+};
+
+// Asynchronous cover-art pipeline. Request queues a decode on the worker
+// thread; the worker loads the source image, area-downscales it to the tile
+// size plus one mip, and persists the downscaled pixels in an on-disk cache
+// keyed by source path, size and mtime — a warm start skips the original
+// image entirely. PumpCompletions (UI thread) shelf-packs finished results
+// into shared 1024x1024 atlas textures, so two thousand tiles of art cost a
+// handful of textures instead of a texture-count explosion.
+//
+// Only the UI thread touches SDL textures; the worker works purely on
+// surfaces and pixel buffers.
+class IconArtPipeline
+{
+  public:
+    IconArtPipeline() = default;
+    ~IconArtPipeline();
+
+    IconArtPipeline(const IconArtPipeline&) = delete;
+    IconArtPipeline& operator=(const IconArtPipeline&) = delete;
+
+    // Directory for the downscaled-pixel cache; created on demand. Must be
+    // set before the first Request to take effect for it.
+    void SetCacheDirectory(std::filesystem::path directory);
+
+    // Queues decode + downscale of source (deduped by key; repeat calls are
+    // free). Results become visible through Find after a later
+    // PumpCompletions — a frame never waits on a decode.
+    void Request(const std::string& key, const std::filesystem::path& source, int targetSize);
+
+    // UI thread, once per frame: packs up to budget decoded results into the
+    // atlas pages. Returns how many were packed.
+    std::size_t PumpCompletions(SDL_Renderer* renderer, std::size_t budget);
+
+    // nullptr while the art is still decoding, failed to decode, or was
+    // never requested.
+    [[nodiscard]] const AtlasRegion* Find(const std::string& key) const;
+
+    // Grows whenever PumpCompletions packs new art; callers mix it into
+    // panel cache keys so cached tiles repaint when their art arrives.
+    [[nodiscard]] std::size_t PackedVersion() const noexcept
+    {
+        return packedVersion_;
+    }
+
+    // Drops atlas pages and regions (renderer or theme rebuild). Previously
+    // requested art re-queues from the disk cache on its next Request.
+    void ReleaseTextures();
+
+  private:
+    struct Job
+    {
+        std::string key;
+        std::filesystem::path source;
+        int targetSize = 0;
+    };
+
+    // Downscaled RGBA32 pixels handed from the worker to the UI thread.
+    struct DecodedArt
+    {
+        std::string key;
+        int width = 0;
+        int height = 0;
+        int mipWidth = 0;
+        int mipHeight = 0;
+        std::vector<std::uint32_t> pixels;
+        std::vector<std::uint32_t> mipPixels;
+    };
+
+    struct AtlasPage
+    {
+        sdl::TextureHandle texture;
+        std::size_t accountedBytes = 0;
+        int shelfX = 0;
+        int shelfY = 0;
+        int shelfHeight = 0;
+    };
+
+    void WorkerLoop();
+    static bool Decode(const Job& job, const std::filesystem::path& cacheDirectory, DecodedArt& out);
+    bool Pack(SDL_Renderer* renderer, const DecodedArt& art, AtlasRegion& outRegion);
+    bool PlaceRect(SDL_Renderer* renderer, int width, int height, std::size_t& outPage, SDL_Rect& outRect);
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<Job> jobs_;
+    std::deque<DecodedArt> ready_;
+    std::filesystem::path cacheDirectory_;
+    bool stopping_ = false;
+    std::thread worker_;
+
+    // UI thread only.
+    std::size_t packedVersion_ = 0;
+    std::unordered_set<std::string> requested_;
+    std::unordered_map<std::string, AtlasRegion> regions_;
+    std::vector<AtlasPage> pages_;
+};
+
+} // namespace colony::frontend::icons
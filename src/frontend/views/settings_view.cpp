@@ -64,6 +64,55 @@ frontend::components::ThemeSwatchText MakeThemeSampleText(std::string_view name)
     return frontend::components::ThemeSwatchText{name, "See controls, cards, and typography in context."};
 }
 
+// Renders one swatch into its own render target so the per-frame cost of the
+// appearance grid is a texture copy. The target keeps transparent corners,
+// so the card composites over whatever the panel draws beneath it.
+colony::TextTexture PrerenderSwatch(
+    SDL_Renderer* renderer,
+    const colony::ui::ThemeColors& colors,
+    int width,
+    int height,
+    TTF_Font* headingFont,
+    TTF_Font* bodyFont,
+    const frontend::components::ThemeSwatchText& text,
+    const frontend::components::ThemeSwatchStyle& style)
+{
+    colony::TextTexture result;
+    if (renderer == nullptr || width <= 0 || height <= 0)
+    {
+        return result;
+    }
+
+    colony::sdl::TextureHandle target{SDL_CreateTexture(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height)};
+    if (!target)
+    {
+        return result;
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, target.get()) != 0)
+    {
+        return result;
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    frontend::components::RenderThemeSwatch(
+        renderer, colors, SDL_Rect{0, 0, width, height}, headingFont, bodyFont, text, style);
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    SDL_SetTextureBlendMode(target.get(), SDL_BLENDMODE_BLEND);
+
+    result.texture = std::move(target);
+    result.width = width;
+    result.height = height;
+    return result;
+}
+
 } // namespace
 
 std::vector<SettingsView::ToggleRow> SettingsView::BuildToggleRows(
@@ -347,6 +396,61 @@ void SettingsView::Render(const colony::RenderContext& context, const SDL_Rect&
     const int maxColumns = contentWidth > ScaleValue(640) ? 3 : 2;
     const int columnSpacing = ScaleValue(14);
     const int columnWidth = maxColumns > 0 ? (contentWidth - columnSpacing * (maxColumns - 1)) / maxColumns : contentWidth;
+    const int languageSwatchHeight = ScaleValue(130);
+
+    // The preview cards are static for a given theme generation and column
+    // width, so they are pre-rendered once and blitted while the section
+    // scrolls. A live resize keeps the stale cards and stretch-blits them,
+    // same as the panel caches; the settled frame rebuilds at the final
+    // width.
+    const bool swatchCacheValid = swatchCacheGeneration_ == context.themeGeneration
+        && swatchCacheWidth_ == columnWidth && themeSwatchCache_.size() == schemes.size();
+    if (!swatchCacheValid && !context.interactiveResize)
+    {
+        themeSwatchCache_.clear();
+        themeSwatchCache_.reserve(schemes.size());
+        for (std::size_t index = 0; index < schemes.size(); ++index)
+        {
+            frontend::components::ThemeSwatchStyle swatchStyle{};
+            swatchStyle.accentPulse =
+                static_cast<float>((index % maxColumns) + 1) / static_cast<float>(maxColumns + 1);
+            themeSwatchCache_.push_back(PrerenderSwatch(
+                context.renderer,
+                schemes[index].colors,
+                columnWidth,
+                swatchHeight,
+                context.paragraphFont,
+                context.paragraphFont,
+                MakeThemeSampleText(schemes[index].name),
+                swatchStyle));
+        }
+
+        colony::ui::ThemeColors sampleTheme{};
+        if (!schemes.empty())
+        {
+            sampleTheme = schemes.front().colors;
+        }
+        const auto samples = BuildLanguageSamples();
+        const std::array<std::string, 6> order{"en", "fr", "de", "hi", "zh", "ar"};
+        languageSwatchCache_.clear();
+        languageSwatchCache_.reserve(order.size());
+        for (const auto& language : order)
+        {
+            const auto it = samples.find(language);
+            languageSwatchCache_.push_back(PrerenderSwatch(
+                context.renderer,
+                sampleTheme,
+                columnWidth,
+                languageSwatchHeight,
+                context.paragraphFont,
+                context.paragraphFont,
+                it != samples.end() ? it->second : frontend::components::ThemeSwatchText{"", ""},
+                {}));
+        }
+
+        swatchCacheWidth_ = columnWidth;
+        swatchCacheGeneration_ = context.themeGeneration;
+    }
 
     for (std::size_t index = 0; index < schemes.size(); ++index)
     {
@@ -356,6 +460,12 @@ void SettingsView::Render(const colony::RenderContext& context, const SDL_Rect&
         const int swatchY = cursorY + row * (swatchHeight + swatchSpacing);
         SDL_Rect swatchRect{swatchX, swatchY, columnWidth, swatchHeight};
 
+        if (index < themeSwatchCache_.size() && themeSwatchCache_[index].texture)
+        {
+            colony::RenderTexture(context.renderer, themeSwatchCache_[index], swatchRect);
+            continue;
+        }
+
         auto sampleText = MakeThemeSampleText(schemes[index].name);
         frontend::components::ThemeSwatchStyle swatchStyle{};
         swatchStyle.accentPulse = static_cast<float>((index % maxColumns) + 1) / static_cast<float>(maxColumns + 1);
@@ -379,7 +489,6 @@ void SettingsView::Render(const colony::RenderContext& context, const SDL_Rect&
     renderSectionHeader("language");
     const auto languageSamples = BuildLanguageSamples();
     const std::array<std::string, 6> languageOrder{"en", "fr", "de", "hi", "zh", "ar"};
-    const int languageSwatchHeight = ScaleValue(130);
 
     colony::ui::ThemeColors languageTheme{};
     if (!schemes.empty())
@@ -404,6 +513,12 @@ void SettingsView::Render(const colony::RenderContext& context, const SDL_Rect&
         const int swatchY = cursorY + row * (languageSwatchHeight + swatchSpacing);
         SDL_Rect swatchRect{swatchX, swatchY, columnWidth, languageSwatchHeight};
 
+        if (index < languageSwatchCache_.size() && languageSwatchCache_[index].texture)
+        {
+            colony::RenderTexture(context.renderer, languageSwatchCache_[index], swatchRect);
+            continue;
+        }
+
         auto it = languageSamples.find(languageOrder[index]);
         frontend::components::ThemeSwatchText text =
             it != languageSamples.end() ? it->second : frontend::components::ThemeSwatchText{"", ""};
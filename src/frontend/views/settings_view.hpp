@@ -2,6 +2,7 @@
 
 #include "views/view.hpp"
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -62,6 +63,14 @@ class SettingsView : public colony::View
     std::vector<ToggleRow> toggles_;
     std::optional<SDL_Rect> primaryActionRect_;
     int lastLayoutWidth_ = 0;
+    // Pre-rendered appearance and language preview cards. Rebuilt when the
+    // theme generation or the grid's column width changes; while valid,
+    // scrolling the section blits finished cards instead of re-plotting
+    // rounded corners and re-rasterizing sample text every frame.
+    std::vector<colony::TextTexture> themeSwatchCache_;
+    std::vector<colony::TextTexture> languageSwatchCache_;
+    int swatchCacheWidth_ = 0;
+    std::uint64_t swatchCacheGeneration_ = 0;
 
     static std::vector<NavLink> BuildNavLinks(
         SDL_Renderer* renderer,
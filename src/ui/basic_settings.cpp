@@ -0,0 +1,68 @@
+#include "ui/basic_settings.hpp"
+
+namespace colony::ui
+{
+
+BasicToggleSettings::BasicToggleSettings()
+{
+    for (const auto& descriptor : kBasicToggleTable)
+    {
+        values_[static_cast<std::size_t>(descriptor.toggle)] = descriptor.defaultValue;
+    }
+}
+
+bool BasicToggleSettings::Set(BasicToggle toggle, bool value)
+{
+    bool& slot = values_[static_cast<std::size_t>(toggle)];
+    if (slot == value)
+    {
+        return false;
+    }
+    slot = value;
+    if (observer_)
+    {
+        observer_(toggle, value);
+    }
+    return true;
+}
+
+bool BasicToggleSettings::SetByKey(std::string_view key, bool value)
+{
+    const auto toggle = FromKey(key);
+    if (!toggle.has_value())
+    {
+        return false;
+    }
+    Set(*toggle, value);
+    return true;
+}
+
+bool BasicToggleSettings::ToggleByKey(std::string_view key)
+{
+    const auto toggle = FromKey(key);
+    if (!toggle.has_value())
+    {
+        return false;
+    }
+    Set(*toggle, !Get(*toggle));
+    return true;
+}
+
+std::optional<BasicToggle> BasicToggleSettings::FromKey(std::string_view key) noexcept
+{
+    for (const auto& descriptor : kBasicToggleTable)
+    {
+        if (descriptor.key == key)
+        {
+            return descriptor.toggle;
+        }
+    }
+    return std::nullopt;
+}
+
+std::string_view BasicToggleSettings::Key(BasicToggle toggle) noexcept
+{
+    return kBasicToggleTable[static_cast<std::size_t>(toggle)].key;
+}
+
+} // namespace colony::ui
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+namespace colony::ui
+{
+
+// The basic on/off settings, typed. The string-keyed map this replaces was
+// probed by id every frame (reduce-motion gates the animation loop); here a
+// read is an array index and the string ids survive only at the edges —
+// settings-file serialization and the panel's interactive region ids.
+enum class BasicToggle : std::size_t
+{
+    Notifications,
+    Sound,
+    AutoUpdates,
+    ReducedMotion,
+};
+
+inline constexpr std::size_t kBasicToggleCount = 4;
+
+// The single source of truth for the toggle set: the enum index, the id used
+// in the settings file and the panel's localization keys, and the default.
+// Adding a toggle means adding one row here (and its enum entry).
+struct BasicToggleDescriptor
+{
+    BasicToggle toggle;
+    std::string_view key;
+    bool defaultValue;
+};
+
+inline constexpr std::array<BasicToggleDescriptor, kBasicToggleCount> kBasicToggleTable{{
+    {BasicToggle::Notifications, "notifications", true},
+    {BasicToggle::Sound, "sound", true},
+    {BasicToggle::AutoUpdates, "auto_updates", true},
+    {BasicToggle::ReducedMotion, "reduced_motion", false},
+}};
+
+class BasicToggleSettings
+{
+  public:
+    // Invoked after a value actually changes; loads and redundant writes do
+    // not fire it.
+    using ChangeObserver = std::function<void(BasicToggle toggle, bool value)>;
+
+    BasicToggleSettings();
+
+    [[nodiscard]] bool Get(BasicToggle toggle) const noexcept
+    {
+        return values_[static_cast<std::size_t>(toggle)];
+    }
+
+    // Returns true when the stored value changed; notifies the observer.
+    bool Set(BasicToggle toggle, bool value);
+
+    // Key-based access for the settings file and panel hit regions. Unknown
+    // keys are ignored and return false.
+    bool SetByKey(std::string_view key, bool value);
+    bool ToggleByKey(std::string_view key);
+
+    void OnChanged(ChangeObserver observer) { observer_ = std::move(observer); }
+
+    [[nodiscard]] static std::optional<BasicToggle> FromKey(std::string_view key) noexcept;
+    [[nodiscard]] static std::string_view Key(BasicToggle toggle) noexcept;
+
+  private:
+    std::array<bool, kBasicToggleCount> values_{};
+    ChangeObserver observer_;
+};
+
+} // namespace colony::ui
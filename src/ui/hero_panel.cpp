@@ -67,14 +67,9 @@ HeroRenderResult HeroPanelRenderer::RenderHero(
     RebuildHighlights(visuals, renderer, heroBodyFont, textColumnWidth, highlightColor);
     if (patchPanelWidth > 0)
     {
-        RebuildSections(
-            visuals,
-            renderer,
-            patchTitleFont,
-            patchBodyFont,
-            patchPanelWidth - Scale(24),
-            theme.heroTitle,
-            theme.heroBody);
+        // Measure-only: texture residency is decided by the window pass once
+        // the viewport and scroll offset are known below.
+        RebuildSections(visuals, patchTitleFont, patchBodyFont, patchPanelWidth - Scale(24));
     }
 
     if (visuals.availability.texture)
@@ -302,33 +297,20 @@ HeroRenderResult HeroPanelRenderer::RenderHero(
 
         const int contentPadding = Scale(20);
         const int viewportHeight = std::max(0, patchRect.h - contentPadding * 2);
-        int contentHeight = 0;
+        int firstSectionTop = 0;
 
         if (chrome_.updatesLabel.texture)
         {
-            contentHeight += chrome_.updatesLabel.height;
-            contentHeight += Scale(10);
+            firstSectionTop += chrome_.updatesLabel.height;
+            firstSectionTop += Scale(10);
         }
 
+        // Heights come from the measured layout, so the scroll range is
+        // identical whether or not a section's textures are resident.
+        int contentHeight = firstSectionTop;
         for (const auto& section : visuals.sections)
         {
-            if (section.title.texture)
-            {
-                contentHeight += section.title.height;
-                contentHeight += Scale(10);
-            }
-
-            for (const auto& optionLines : section.lines)
-            {
-                for (const auto& line : optionLines)
-                {
-                    contentHeight += line.texture.height;
-                    contentHeight += Scale(3);
-                }
-                contentHeight += Scale(8);
-            }
-
-            contentHeight += Scale(10);
+            contentHeight += SectionContentHeight(section);
         }
 
         const int maxScroll = std::max(0, contentHeight - viewportHeight);
@@ -337,6 +319,21 @@ HeroRenderResult HeroPanelRenderer::RenderHero(
         visuals.sectionsViewport = patchRect;
         visuals.sectionsScrollOffset = std::clamp(visuals.sectionsScrollOffset, 0, maxScroll);
 
+        // Keep textures resident for the viewport plus one viewport of
+        // margin each way; everything further is released and re-rasterized
+        // from the wrap cache when the scroll brings it back.
+        const int windowMargin = std::max(viewportHeight, Scale(200));
+        UpdateSectionWindow(
+            visuals,
+            renderer,
+            patchTitleFont,
+            patchBodyFont,
+            theme.heroTitle,
+            theme.heroBody,
+            firstSectionTop,
+            visuals.sectionsScrollOffset - windowMargin,
+            visuals.sectionsScrollOffset + viewportHeight + windowMargin);
+
         const bool hasPatchClip = patchRect.w > 0 && patchRect.h > 0;
         if (hasPatchClip)
         {
@@ -355,7 +352,9 @@ HeroRenderResult HeroPanelRenderer::RenderHero(
         const int bulletIndent = Scale(16);
         for (const auto& section : visuals.sections)
         {
-            if (section.title.texture)
+            // Advance by the measured height even when the texture is not
+            // resident, so released sections keep their place in the scroll.
+            if (section.title.height > 0)
             {
                 SDL_Rect titleRect{patchCursorX, patchCursorY, section.title.width, section.title.height};
                 colony::RenderTexture(renderer, section.title, titleRect);
@@ -448,7 +447,7 @@ void HeroPanelRenderer::RenderSettings(
     std::string_view activeLanguageId,
     const SettingsPanel::SectionStates& sectionStates,
     const std::unordered_map<std::string, float>& customizationValues,
-    const std::unordered_map<std::string, bool>& toggleStates,
+    const BasicToggleSettings& toggleStates,
     SettingsPanel::RenderResult& outResult,
     double timeSeconds) const
 {
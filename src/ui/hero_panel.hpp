@@ -48,7 +48,7 @@ class HeroPanelRenderer
         std::string_view activeLanguageId,
         const SettingsPanel::SectionStates& sectionStates,
         const std::unordered_map<std::string, float>& customizationValues,
-        const std::unordered_map<std::string, bool>& toggleStates,
+        const BasicToggleSettings& toggleStates,
         SettingsPanel::RenderResult& outResult,
         double timeSeconds) const;
 
@@ -0,0 +1,123 @@
+#include "ui/hit_test_index.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace colony::ui
+{
+namespace
+{
+
+bool RectContains(const SDL_Rect& rect, int x, int y)
+{
+    const SDL_Point point{x, y};
+    return SDL_PointInRect(&point, &rect) == SDL_TRUE;
+}
+
+} // namespace
+
+void HitTestIndex::Rebuild(const std::vector<SDL_Rect>& rects)
+{
+    rects_ = rects;
+    cells_.clear();
+    columns_ = 0;
+    rows_ = 0;
+
+    if (rects_.size() <= kLinearScanThreshold)
+    {
+        return;
+    }
+
+    int left = std::numeric_limits<int>::max();
+    int top = std::numeric_limits<int>::max();
+    int right = std::numeric_limits<int>::min();
+    int bottom = std::numeric_limits<int>::min();
+    for (const SDL_Rect& rect : rects_)
+    {
+        if (rect.w <= 0 || rect.h <= 0)
+        {
+            continue;
+        }
+        left = std::min(left, rect.x);
+        top = std::min(top, rect.y);
+        right = std::max(right, rect.x + rect.w);
+        bottom = std::max(bottom, rect.y + rect.h);
+    }
+    if (left >= right || top >= bottom)
+    {
+        return;
+    }
+
+    gridLeft_ = left;
+    gridTop_ = top;
+    columns_ = (right - left + kCellSize - 1) / kCellSize;
+    rows_ = (bottom - top + kCellSize - 1) / kCellSize;
+    cells_.assign(static_cast<std::size_t>(columns_) * static_cast<std::size_t>(rows_), {});
+
+    for (std::size_t i = 0; i < rects_.size(); ++i)
+    {
+        const SDL_Rect& rect = rects_[i];
+        if (rect.w <= 0 || rect.h <= 0)
+        {
+            continue;
+        }
+        const int firstColumn = (rect.x - gridLeft_) / kCellSize;
+        const int lastColumn = (rect.x + rect.w - 1 - gridLeft_) / kCellSize;
+        const int firstRow = (rect.y - gridTop_) / kCellSize;
+        const int lastRow = (rect.y + rect.h - 1 - gridTop_) / kCellSize;
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            for (int column = firstColumn; column <= lastColumn; ++column)
+            {
+                cells_[static_cast<std::size_t>(row) * static_cast<std::size_t>(columns_)
+                       + static_cast<std::size_t>(column)]
+                    .push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+}
+
+void HitTestIndex::Clear()
+{
+    rects_.clear();
+    cells_.clear();
+    columns_ = 0;
+    rows_ = 0;
+}
+
+int HitTestIndex::FindFirst(int x, int y) const
+{
+    if (cells_.empty())
+    {
+        for (std::size_t i = 0; i < rects_.size(); ++i)
+        {
+            if (RectContains(rects_[i], x, y))
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    const int column = (x - gridLeft_) / kCellSize;
+    const int row = (y - gridTop_) / kCellSize;
+    if (x < gridLeft_ || y < gridTop_ || column >= columns_ || row >= rows_)
+    {
+        return -1;
+    }
+
+    // Cell entries are appended in registration order, so the first hit is the
+    // same rect the old linear scan would have returned.
+    const auto& cell =
+        cells_[static_cast<std::size_t>(row) * static_cast<std::size_t>(columns_) + static_cast<std::size_t>(column)];
+    for (const std::uint32_t index : cell)
+    {
+        if (RectContains(rects_[index], x, y))
+        {
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
+} // namespace colony::ui
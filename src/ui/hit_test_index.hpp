@@ -0,0 +1,47 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace colony::ui
+{
+
+// Uniform screen-space grid over one frame's hit rects. Renderers that emit
+// large rect lists (the library tile grid can hold thousands of entries once
+// every program is laid out) rebuild the index when the list changes, and
+// mouse dispatch asks for the hit rect in O(1) instead of scanning the whole
+// list per event. Small fixed lists skip the grid entirely and fall back to a
+// linear scan, where building cells would cost more than it saves.
+class HitTestIndex
+{
+public:
+    // Replaces the indexed rects. Queries return indices into this vector.
+    void Rebuild(const std::vector<SDL_Rect>& rects);
+
+    void Clear();
+
+    // Index of the first registered rect containing (x, y), matching the
+    // iteration order of the linear scans this replaces, or -1 if none does.
+    [[nodiscard]] int FindFirst(int x, int y) const;
+
+    [[nodiscard]] bool Empty() const
+    {
+        return rects_.empty();
+    }
+
+private:
+    // Below this count a linear scan beats grid construction and lookup.
+    static constexpr std::size_t kLinearScanThreshold = 32;
+    static constexpr int kCellSize = 128;
+
+    std::vector<SDL_Rect> rects_;
+    std::vector<std::vector<std::uint32_t>> cells_;
+    int gridLeft_ = 0;
+    int gridTop_ = 0;
+    int columns_ = 0;
+    int rows_ = 0;
+};
+
+} // namespace colony::ui
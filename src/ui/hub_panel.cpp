@@ -5,6 +5,7 @@
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
 #include "utils/text_wrapping.hpp"
+#include "utils/texture_accounting.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -21,6 +22,65 @@ SDL_Color MixWithBackground(SDL_Color foreground, SDL_Color background, float fa
 }
 } // namespace
 
+HubPanelRenderer::DiscSprite::~DiscSprite()
+{
+    TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes);
+}
+
+void HubPanelRenderer::BlitAccentDisc(
+    SDL_Renderer* renderer, DiscSprite& disc, const SDL_Rect& destination, SDL_Color color, Uint8 alpha) const
+{
+    const int diameter = destination.w;
+    if (diameter <= 0)
+    {
+        return;
+    }
+
+    const bool upToDate = disc.texture && disc.diameter == diameter && disc.color.r == color.r
+        && disc.color.g == color.g && disc.color.b == color.b;
+    if (!upToDate)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, disc.accountedBytes);
+        disc.accountedBytes = 0;
+        disc.texture.reset(
+            SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, diameter, diameter));
+        if (disc.texture)
+        {
+            SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+            if (SDL_SetRenderTarget(renderer, disc.texture.get()) == 0)
+            {
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+                SDL_RenderClear(renderer);
+                SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, SDL_ALPHA_OPAQUE);
+                colony::drawing::RenderFilledRoundedRect(renderer, SDL_Rect{0, 0, diameter, diameter}, diameter / 2);
+                SDL_SetRenderTarget(renderer, previousTarget);
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+                disc.diameter = diameter;
+                disc.color = color;
+                disc.accountedBytes = TextureAccounting::EstimateBytes(diameter, diameter);
+                TextureAccounting::Shared().Add(TextureAccounting::Subsystem::PanelChrome, disc.accountedBytes);
+            }
+            else
+            {
+                disc.texture.reset();
+            }
+        }
+    }
+
+    if (!disc.texture)
+    {
+        // No render target support: fall back to the direct translucent fill.
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, alpha);
+        colony::drawing::RenderFilledRoundedRect(renderer, destination, diameter / 2);
+        return;
+    }
+
+    SDL_SetTextureBlendMode(disc.texture.get(), SDL_BLENDMODE_BLEND);
+    SDL_SetTextureAlphaMod(disc.texture.get(), alpha);
+    SDL_RenderCopy(renderer, disc.texture.get(), nullptr, &destination);
+}
+
 void HubPanelRenderer::Build(
     SDL_Renderer* renderer,
     const HubContent& content,
@@ -42,6 +102,8 @@ void HubPanelRenderer::Build(
     hero_.primaryActionDescription = content.primaryActionDescription;
     hero_.actionDescriptionWidth = 0;
     hero_.actionDescriptionLines.clear();
+    hero_.toggleExpandLabel = {};
+    hero_.toggleCollapseLabel = {};
 
     search_.placeholder = content.searchPlaceholder;
     search_.lastQuery.clear();
@@ -159,7 +221,7 @@ void HubPanelRenderer::Build(
     }
 }
 
-HubRenderResult HubPanelRenderer::Render(
+void HubPanelRenderer::Render(
     SDL_Renderer* renderer,
     const ThemeColors& theme,
     const SDL_Rect& bounds,
@@ -172,13 +234,23 @@ HubRenderResult HubPanelRenderer::Render(
     std::string_view searchQuery,
     bool searchFocused,
     int widgetPage,
-    int widgetsPerPage) const
+    int widgetsPerPage,
+    colony::FrameArena& frameArena,
+    HubRenderResult& result) const
 {
-    HubRenderResult result{};
+    // Reset the result in place while keeping the hitbox vectors' capacity,
+    // so steady-state frames do not reallocate them.
+    auto branchHitboxes = std::move(result.branchHitboxes);
+    auto widgetPagerHitboxes = std::move(result.widgetPagerHitboxes);
+    branchHitboxes.clear();
+    widgetPagerHitboxes.clear();
+    result = HubRenderResult{};
+    result.branchHitboxes = std::move(branchHitboxes);
+    result.widgetPagerHitboxes = std::move(widgetPagerHitboxes);
 
     if (!renderer)
     {
-        return result;
+        return;
     }
 
     widgetsPerPage = std::max(1, widgetsPerPage);
@@ -256,16 +328,14 @@ HubRenderResult HubPanelRenderer::Render(
                         accentDiameter,
                         accentDiameter};
     SDL_Color accentFill = colony::color::Mix(accentColor, gradientEnd, 0.35f);
-    SDL_SetRenderDrawColor(renderer, accentFill.r, accentFill.g, accentFill.b, 72);
-    colony::drawing::RenderFilledRoundedRect(renderer, accentDisc, accentDiameter / 2);
+    BlitAccentDisc(renderer, accentDiscLarge_, accentDisc, accentFill, 72);
 
     SDL_Rect accentDiscSmall = accentDisc;
     accentDiscSmall.x -= Scale(40);
     accentDiscSmall.y += Scale(60);
     accentDiscSmall.w = accentDiscSmall.h = accentDiameter / 2;
     SDL_Color accentFillSmall = colony::color::Mix(accentColor, theme.heroTitle, 0.2f);
-    SDL_SetRenderDrawColor(renderer, accentFillSmall.r, accentFillSmall.g, accentFillSmall.b, 64);
-    colony::drawing::RenderFilledRoundedRect(renderer, accentDiscSmall, accentDiscSmall.w / 2);
+    BlitAccentDisc(renderer, accentDiscSmall_, accentDiscSmall, accentFillSmall, 64);
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
     const int particleCount = 6;
     for (int i = 0; i < particleCount; ++i)
@@ -486,9 +556,14 @@ HubRenderResult HubPanelRenderer::Render(
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     if (tileBodyFont_)
     {
-        const char* toggleLabel = heroCollapsed ? "Expand hero" : "Collapse hero";
-        colony::TextTexture toggleTexture =
-            colony::CreateTextTexture(renderer, tileBodyFont_, toggleLabel, theme.heroTitle);
+        // Rasterized on first use and kept until the next Build; toggling the
+        // hero just swaps which cached label is blitted.
+        colony::TextTexture& toggleTexture = heroCollapsed ? hero_.toggleExpandLabel : hero_.toggleCollapseLabel;
+        if (!toggleTexture.texture)
+        {
+            toggleTexture = colony::CreateTextTexture(
+                renderer, tileBodyFont_, heroCollapsed ? "Expand hero" : "Collapse hero", theme.heroTitle);
+        }
         SDL_Rect toggleLabelRect{
             toggleRect.x + toggleRect.w / 2 - toggleTexture.width / 2,
             toggleRect.y + toggleRect.h / 2 - toggleTexture.height / 2,
@@ -650,14 +725,15 @@ HubRenderResult HubPanelRenderer::Render(
     const int sideColumnIndex = showSideColumn ? columns - 1 : -1;
     const int branchColumnCount = showSideColumn ? columns - 1 : columns;
 
-    std::vector<int> columnOffsets(static_cast<std::size_t>(columns), scrollTop + clampedScrollOffset);
-    std::vector<int> columnPositions(static_cast<std::size_t>(columns), 0);
+    std::pmr::vector<int> columnOffsets(
+        static_cast<std::size_t>(columns), scrollTop + clampedScrollOffset, frameArena.Resource());
+    std::pmr::vector<int> columnPositions(static_cast<std::size_t>(columns), 0, frameArena.Resource());
     for (int c = 0; c < columns; ++c)
     {
         columnPositions[static_cast<std::size_t>(c)] = bounds.x + gridPaddingX + c * (tileWidth + tileGap);
     }
 
-    std::vector<int> branchColumns;
+    std::pmr::vector<int> branchColumns(frameArena.Resource());
     branchColumns.reserve(static_cast<std::size_t>(std::max(branchColumnCount, 1)));
     for (int c = 0; c < columns; ++c)
     {
@@ -766,195 +842,207 @@ HubRenderResult HubPanelRenderer::Render(
         drawRect.w += expansion * 2;
         drawRect.h += expansion * 2;
 
-        SDL_Rect shadowRect = drawRect;
-        shadowRect.x += Scale(4);
-        shadowRect.y += Scale(8);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, 42);
-        colony::drawing::RenderFilledRoundedRect(renderer, shadowRect, Scale(26));
-
-        SDL_Color branchAccent = resolveAccent(branch);
-        SDL_Color baseFill = MixWithBackground(branchAccent, theme.libraryCard, isActive ? 0.5f : (isHovered ? 0.34f : 0.24f));
-        SDL_Color outline = colony::color::Mix(branchAccent, theme.heroTitle, isActive ? 0.55f : 0.32f);
-        SDL_Color hoverGlow = colony::color::Mix(branchAccent, theme.heroTitle, 0.4f);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-        SDL_SetRenderDrawColor(renderer, baseFill.r, baseFill.g, baseFill.b, baseFill.a);
-        colony::drawing::RenderFilledRoundedRect(renderer, drawRect, Scale(26));
-        SDL_SetRenderDrawColor(renderer, outline.r, outline.g, outline.b, outline.a);
-        colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(26));
-
-        SDL_Rect glowRect = drawRect;
-        glowRect.h = drawRect.h / 2;
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
-        SDL_SetRenderDrawColor(renderer, hoverGlow.r, hoverGlow.g, hoverGlow.b, static_cast<Uint8>(isHovered ? 110 : 70));
-        colony::drawing::RenderFilledRoundedRect(renderer, glowRect, Scale(26));
-        if (isActive)
+        // The whole card body, drop shadow included, renders into a retained
+        // per-card texture. The bob wave and the hover lift only change where
+        // that texture is blitted, so an idle hub re-composes from cached
+        // blits instead of re-tracing every card at 60Hz.
+        SDL_Rect cardRect{drawRect.x, drawRect.y, drawRect.w + Scale(4), drawRect.h + Scale(8)};
+        const std::uint64_t cardVersion =
+            PanelStateHash{}.Mix(isHovered).Mix(isActive).Mix(cardRect.w).Mix(cardRect.h).Value();
+        if (branch.cardCache.Begin(renderer, cardRect, cardVersion))
         {
-            colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(28));
-        }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_Rect shadowRect = drawRect;
+            shadowRect.x += Scale(4);
+            shadowRect.y += Scale(8);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, 42);
+            colony::drawing::RenderFilledRoundedRect(renderer, shadowRect, Scale(26));
 
-        SDL_Rect iconRect{drawRect.x + tilePadding, drawRect.y + tilePadding, iconSize, iconSize};
-        SDL_Color iconFill = MixWithBackground(branchAccent, theme.heroTitle, 0.28f);
-        SDL_Color iconOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.52f);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        colony::drawing::RenderFilledRoundedRect(renderer, iconRect, iconRect.w / 2);
-        SDL_SetRenderDrawColor(renderer, iconOutline.r, iconOutline.g, iconOutline.b, 220);
-        colony::drawing::RenderRoundedRect(renderer, iconRect, iconRect.w / 2);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-        if (branch.iconGlyph.texture)
-        {
-            SDL_Rect glyphRect{
-                iconRect.x + iconRect.w / 2 - branch.iconGlyph.width / 2,
-                iconRect.y + iconRect.h / 2 - branch.iconGlyph.height / 2,
-                branch.iconGlyph.width,
-                branch.iconGlyph.height};
-            colony::RenderTexture(renderer, branch.iconGlyph, glyphRect);
-        }
+            SDL_Color branchAccent = resolveAccent(branch);
+            SDL_Color baseFill = MixWithBackground(branchAccent, theme.libraryCard, isActive ? 0.5f : (isHovered ? 0.34f : 0.24f));
+            SDL_Color outline = colony::color::Mix(branchAccent, theme.heroTitle, isActive ? 0.55f : 0.32f);
+            SDL_Color hoverGlow = colony::color::Mix(branchAccent, theme.heroTitle, 0.4f);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_SetRenderDrawColor(renderer, baseFill.r, baseFill.g, baseFill.b, baseFill.a);
+            colony::drawing::RenderFilledRoundedRect(renderer, drawRect, Scale(26));
+            SDL_SetRenderDrawColor(renderer, outline.r, outline.g, outline.b, outline.a);
+            colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(26));
 
-        const int textStartX = iconRect.x + iconRect.w + iconSpacing;
-        int textCursorY = drawRect.y + tilePadding;
+            SDL_Rect glowRect = drawRect;
+            glowRect.h = drawRect.h / 2;
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
+            SDL_SetRenderDrawColor(renderer, hoverGlow.r, hoverGlow.g, hoverGlow.b, static_cast<Uint8>(isHovered ? 110 : 70));
+            colony::drawing::RenderFilledRoundedRect(renderer, glowRect, Scale(26));
+            if (isActive)
+            {
+                colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(28));
+            }
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-        SDL_Rect tileAccentBar{textStartX, textCursorY - Scale(14), Scale(48), Scale(6)};
-        SDL_Color barColor = colony::color::Mix(branchAccent, theme.heroTitle, 0.45f);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, barColor.r, barColor.g, barColor.b, 160);
-        colony::drawing::RenderFilledRoundedRect(renderer, tileAccentBar, tileAccentBar.h / 2);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_Rect iconRect{drawRect.x + tilePadding, drawRect.y + tilePadding, iconSize, iconSize};
+            SDL_Color iconFill = MixWithBackground(branchAccent, theme.heroTitle, 0.28f);
+            SDL_Color iconOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.52f);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            colony::drawing::RenderFilledRoundedRect(renderer, iconRect, iconRect.w / 2);
+            SDL_SetRenderDrawColor(renderer, iconOutline.r, iconOutline.g, iconOutline.b, 220);
+            colony::drawing::RenderRoundedRect(renderer, iconRect, iconRect.w / 2);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            if (branch.iconGlyph.texture)
+            {
+                SDL_Rect glyphRect{
+                    iconRect.x + iconRect.w / 2 - branch.iconGlyph.width / 2,
+                    iconRect.y + iconRect.h / 2 - branch.iconGlyph.height / 2,
+                    branch.iconGlyph.width,
+                    branch.iconGlyph.height};
+                colony::RenderTexture(renderer, branch.iconGlyph, glyphRect);
+            }
 
-        if (branch.title.texture)
-        {
-            SDL_Rect titleRect{textStartX, textCursorY, branch.title.width, branch.title.height};
-            colony::RenderTexture(renderer, branch.title, titleRect);
-            textCursorY += branch.title.height;
-        }
+            const int textStartX = iconRect.x + iconRect.w + iconSpacing;
+            int textCursorY = drawRect.y + tilePadding;
+
+            SDL_Rect tileAccentBar{textStartX, textCursorY - Scale(14), Scale(48), Scale(6)};
+            SDL_Color barColor = colony::color::Mix(branchAccent, theme.heroTitle, 0.45f);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            SDL_SetRenderDrawColor(renderer, barColor.r, barColor.g, barColor.b, 160);
+            colony::drawing::RenderFilledRoundedRect(renderer, tileAccentBar, tileAccentBar.h / 2);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-        if (!branch.tagChips.empty())
-        {
             if (branch.title.texture)
             {
-                textCursorY += Scale(10);
+                SDL_Rect titleRect{textStartX, textCursorY, branch.title.width, branch.title.height};
+                colony::RenderTexture(renderer, branch.title, titleRect);
+                textCursorY += branch.title.height;
             }
-            int chipCursorX = textStartX;
-            int chipCursorY = textCursorY;
-            int chipLineHeight = 0;
-            for (const auto& chip : branch.tagChips)
+
+            if (!branch.tagChips.empty())
             {
-                const int chipWidth = chip.width + tagPaddingX * 2;
-                const int chipHeight = chip.height + tagPaddingY * 2;
-                if (chipCursorX > textStartX && chipCursorX + chipWidth > textStartX + textWidth)
+                if (branch.title.texture)
                 {
-                    chipCursorX = textStartX;
-                    chipCursorY += chipLineHeight + tagGap;
-                    chipLineHeight = 0;
+                    textCursorY += Scale(10);
                 }
-                SDL_Rect chipRect{chipCursorX, chipCursorY, chipWidth, chipHeight};
-                SDL_Color chipFill = MixWithBackground(branchAccent, theme.heroTitle, 0.22f);
-                SDL_Color chipOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.38f);
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-                SDL_SetRenderDrawColor(renderer, chipFill.r, chipFill.g, chipFill.b, 200);
-                colony::drawing::RenderFilledRoundedRect(renderer, chipRect, chipRect.h / 2);
-                SDL_SetRenderDrawColor(renderer, chipOutline.r, chipOutline.g, chipOutline.b, 210);
-                colony::drawing::RenderRoundedRect(renderer, chipRect, chipRect.h / 2);
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-                SDL_Rect chipTextRect{chipRect.x + tagPaddingX, chipRect.y + tagPaddingY, chip.width, chip.height};
-                colony::RenderTexture(renderer, chip, chipTextRect);
-
-                chipCursorX += chipWidth + tagGap;
-                chipLineHeight = std::max(chipLineHeight, chipHeight);
+                int chipCursorX = textStartX;
+                int chipCursorY = textCursorY;
+                int chipLineHeight = 0;
+                for (const auto& chip : branch.tagChips)
+                {
+                    const int chipWidth = chip.width + tagPaddingX * 2;
+                    const int chipHeight = chip.height + tagPaddingY * 2;
+                    if (chipCursorX > textStartX && chipCursorX + chipWidth > textStartX + textWidth)
+                    {
+                        chipCursorX = textStartX;
+                        chipCursorY += chipLineHeight + tagGap;
+                        chipLineHeight = 0;
+                    }
+                    SDL_Rect chipRect{chipCursorX, chipCursorY, chipWidth, chipHeight};
+                    SDL_Color chipFill = MixWithBackground(branchAccent, theme.heroTitle, 0.22f);
+                    SDL_Color chipOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.38f);
+                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+                    SDL_SetRenderDrawColor(renderer, chipFill.r, chipFill.g, chipFill.b, 200);
+                    colony::drawing::RenderFilledRoundedRect(renderer, chipRect, chipRect.h / 2);
+                    SDL_SetRenderDrawColor(renderer, chipOutline.r, chipOutline.g, chipOutline.b, 210);
+                    colony::drawing::RenderRoundedRect(renderer, chipRect, chipRect.h / 2);
+                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+                    SDL_Rect chipTextRect{chipRect.x + tagPaddingX, chipRect.y + tagPaddingY, chip.width, chip.height};
+                    colony::RenderTexture(renderer, chip, chipTextRect);
+
+                    chipCursorX += chipWidth + tagGap;
+                    chipLineHeight = std::max(chipLineHeight, chipHeight);
+                }
+                textCursorY = chipCursorY + chipLineHeight;
             }
-            textCursorY = chipCursorY + chipLineHeight;
-        }
 
-        textCursorY = std::max(textCursorY, iconRect.y + iconRect.h);
-        if (!branch.bodyLines.empty())
-        {
-            textCursorY += Scale(14);
-        }
+            textCursorY = std::max(textCursorY, iconRect.y + iconRect.h);
+            if (!branch.bodyLines.empty())
+            {
+                textCursorY += Scale(14);
+            }
 
-        for (const auto& lineTexture : branch.bodyLines)
-        {
-            SDL_Rect bodyRect{textStartX, textCursorY, lineTexture.width, lineTexture.height};
-            colony::RenderTexture(renderer, lineTexture, bodyRect);
-            textCursorY += lineTexture.height;
-            if (&lineTexture != &branch.bodyLines.back())
+            for (const auto& lineTexture : branch.bodyLines)
             {
-                const int lineSkip = tileBodyFont_ ? TTF_FontLineSkip(tileBodyFont_) : 0;
-                if (lineSkip > 0)
-                {
-                    textCursorY += std::max(0, lineSkip - lineTexture.height);
-                }
-                else
+                SDL_Rect bodyRect{textStartX, textCursorY, lineTexture.width, lineTexture.height};
+                colony::RenderTexture(renderer, lineTexture, bodyRect);
+                textCursorY += lineTexture.height;
+                if (&lineTexture != &branch.bodyLines.back())
                 {
-                    textCursorY += Scale(6);
+                    const int lineSkip = tileBodyFont_ ? TTF_FontLineSkip(tileBodyFont_) : 0;
+                    if (lineSkip > 0)
+                    {
+                        textCursorY += std::max(0, lineSkip - lineTexture.height);
+                    }
+                    else
+                    {
+                        textCursorY += Scale(6);
+                    }
                 }
             }
-        }
 
-        if (branch.metricsLabel.texture)
-        {
-            textCursorY += Scale(18);
-            SDL_Rect metricsRect{textStartX, textCursorY, branch.metricsLabel.width, branch.metricsLabel.height};
-            colony::RenderTexture(renderer, branch.metricsLabel, metricsRect);
-            textCursorY += branch.metricsLabel.height;
-        }
+            if (branch.metricsLabel.texture)
+            {
+                textCursorY += Scale(18);
+                SDL_Rect metricsRect{textStartX, textCursorY, branch.metricsLabel.width, branch.metricsLabel.height};
+                colony::RenderTexture(renderer, branch.metricsLabel, metricsRect);
+                textCursorY += branch.metricsLabel.height;
+            }
 
-        const int buttonPaddingX = Scale(18);
-        const int buttonPaddingY = Scale(12);
-        const int buttonIconSize = Scale(16);
-        SDL_Rect actionRect{
-            drawRect.x + drawRect.w - buttonPaddingX * 2 - buttonIconSize - Scale(12)
-                - (branch.actionLabel.texture ? branch.actionLabel.width : Scale(120)),
-            drawRect.y + drawRect.h - (branch.actionLabel.texture ? branch.actionLabel.height + buttonPaddingY * 2 : Scale(42))
-                - tilePadding,
-            branch.actionLabel.texture ? branch.actionLabel.width + buttonPaddingX * 2 + buttonIconSize + Scale(12) : Scale(180),
-            branch.actionLabel.texture ? branch.actionLabel.height + buttonPaddingY * 2 : Scale(42)};
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_Color buttonFill = MixWithBackground(branchAccent, theme.heroTitle, 0.32f);
-        SDL_Color buttonOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.5f);
-        colony::drawing::RenderFilledRoundedRect(renderer, actionRect, actionRect.h / 2);
-        SDL_SetRenderDrawColor(renderer, buttonOutline.r, buttonOutline.g, buttonOutline.b, 220);
-        colony::drawing::RenderRoundedRect(renderer, actionRect, actionRect.h / 2);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            const int buttonPaddingX = Scale(18);
+            const int buttonPaddingY = Scale(12);
+            const int buttonIconSize = Scale(16);
+            SDL_Rect actionRect{
+                drawRect.x + drawRect.w - buttonPaddingX * 2 - buttonIconSize - Scale(12)
+                    - (branch.actionLabel.texture ? branch.actionLabel.width : Scale(120)),
+                drawRect.y + drawRect.h - (branch.actionLabel.texture ? branch.actionLabel.height + buttonPaddingY * 2 : Scale(42))
+                    - tilePadding,
+                branch.actionLabel.texture ? branch.actionLabel.width + buttonPaddingX * 2 + buttonIconSize + Scale(12) : Scale(180),
+                branch.actionLabel.texture ? branch.actionLabel.height + buttonPaddingY * 2 : Scale(42)};
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            SDL_Color buttonFill = MixWithBackground(branchAccent, theme.heroTitle, 0.32f);
+            SDL_Color buttonOutline = colony::color::Mix(branchAccent, theme.heroTitle, 0.5f);
+            colony::drawing::RenderFilledRoundedRect(renderer, actionRect, actionRect.h / 2);
+            SDL_SetRenderDrawColor(renderer, buttonOutline.r, buttonOutline.g, buttonOutline.b, 220);
+            colony::drawing::RenderRoundedRect(renderer, actionRect, actionRect.h / 2);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-        if (branch.actionLabel.texture)
-        {
-            SDL_Rect actionLabelRect{
-                actionRect.x + buttonPaddingX,
-                actionRect.y + buttonPaddingY,
-                branch.actionLabel.width,
-                branch.actionLabel.height};
-            colony::RenderTexture(renderer, branch.actionLabel, actionLabelRect);
-        }
+            if (branch.actionLabel.texture)
+            {
+                SDL_Rect actionLabelRect{
+                    actionRect.x + buttonPaddingX,
+                    actionRect.y + buttonPaddingY,
+                    branch.actionLabel.width,
+                    branch.actionLabel.height};
+                colony::RenderTexture(renderer, branch.actionLabel, actionLabelRect);
+            }
 
-        SDL_Rect buttonArrowRect{
-            actionRect.x + actionRect.w - buttonIconSize - buttonPaddingX,
-            actionRect.y + actionRect.h / 2 - buttonIconSize / 2,
-            buttonIconSize,
-            buttonIconSize};
-        SDL_SetRenderDrawColor(renderer, buttonOutline.r, buttonOutline.g, buttonOutline.b, SDL_ALPHA_OPAQUE);
-        SDL_RenderDrawLine(renderer, buttonArrowRect.x, buttonArrowRect.y + buttonArrowRect.h / 2, buttonArrowRect.x + buttonArrowRect.w, buttonArrowRect.y + buttonArrowRect.h / 2);
-        SDL_RenderDrawLine(
-            renderer,
-            buttonArrowRect.x + buttonArrowRect.w / 2,
-            buttonArrowRect.y,
-            buttonArrowRect.x + buttonArrowRect.w,
-            buttonArrowRect.y + buttonArrowRect.h / 2);
-        SDL_RenderDrawLine(
-            renderer,
-            buttonArrowRect.x + buttonArrowRect.w / 2,
-            buttonArrowRect.y + buttonArrowRect.h,
-            buttonArrowRect.x + buttonArrowRect.w,
-            buttonArrowRect.y + buttonArrowRect.h / 2);
+            SDL_Rect buttonArrowRect{
+                actionRect.x + actionRect.w - buttonIconSize - buttonPaddingX,
+                actionRect.y + actionRect.h / 2 - buttonIconSize / 2,
+                buttonIconSize,
+                buttonIconSize};
+            SDL_SetRenderDrawColor(renderer, buttonOutline.r, buttonOutline.g, buttonOutline.b, SDL_ALPHA_OPAQUE);
+            SDL_RenderDrawLine(renderer, buttonArrowRect.x, buttonArrowRect.y + buttonArrowRect.h / 2, buttonArrowRect.x + buttonArrowRect.w, buttonArrowRect.y + buttonArrowRect.h / 2);
+            SDL_RenderDrawLine(
+                renderer,
+                buttonArrowRect.x + buttonArrowRect.w / 2,
+                buttonArrowRect.y,
+                buttonArrowRect.x + buttonArrowRect.w,
+                buttonArrowRect.y + buttonArrowRect.h / 2);
+            SDL_RenderDrawLine(
+                renderer,
+                buttonArrowRect.x + buttonArrowRect.w / 2,
+                buttonArrowRect.y + buttonArrowRect.h,
+                buttonArrowRect.x + buttonArrowRect.w,
+                buttonArrowRect.y + buttonArrowRect.h / 2);
+
+            if (isHovered)
+            {
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
+                SDL_Color haloColor = colony::color::Mix(branchAccent, theme.heroTitle, 0.42f);
+                SDL_SetRenderDrawColor(renderer, haloColor.r, haloColor.g, haloColor.b, 120);
+                colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(30));
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            }
 
-        if (isHovered)
-        {
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
-            SDL_Color haloColor = colony::color::Mix(branchAccent, theme.heroTitle, 0.42f);
-            SDL_SetRenderDrawColor(renderer, haloColor.r, haloColor.g, haloColor.b, 120);
-            colony::drawing::RenderRoundedRect(renderer, drawRect, Scale(30));
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            branch.cardCache.End(renderer);
         }
 
         SDL_Rect screenRect = drawRect;
@@ -1021,63 +1109,71 @@ HubRenderResult HubPanelRenderer::Render(
         SDL_Rect widgetRect{widgetX, widgetCursorY, widgetWidth, widgetHeight};
         widgetCursorY = widgetRect.y + widgetRect.h + widgetSpacing;
 
-        SDL_Color widgetAccent = widget.accent.a == 0 ? theme.channelBadge : widget.accent;
-        SDL_Color widgetFill = MixWithBackground(widgetAccent, theme.libraryCard, 0.22f);
-        SDL_Color widgetOutline = colony::color::Mix(widgetAccent, theme.heroTitle, 0.35f);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, widgetFill.r, widgetFill.g, widgetFill.b, 220);
-        colony::drawing::RenderFilledRoundedRect(renderer, widgetRect, Scale(24));
-        SDL_SetRenderDrawColor(renderer, widgetOutline.r, widgetOutline.g, widgetOutline.b, 230);
-        colony::drawing::RenderRoundedRect(renderer, widgetRect, Scale(24));
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-        int widgetTextX = widgetRect.x + widgetPadding;
-        int widgetCursor = widgetRect.y + widgetPadding;
-        if (widget.title.texture)
+        // A widget's pixels only change when Build replaces its chrome, so
+        // the whole card is cached and keyed on size alone; scrolling and
+        // page flips replay one blit per widget.
+        const std::uint64_t widgetVersion = PanelStateHash{}.Mix(widgetRect.w).Mix(widgetRect.h).Value();
+        if (widget.cardCache.Begin(renderer, widgetRect, widgetVersion))
         {
-            SDL_Rect titleRect{widgetTextX, widgetCursor, widget.title.width, widget.title.height};
-            colony::RenderTexture(renderer, widget.title, titleRect);
-            widgetCursor += widget.title.height + Scale(12);
-        }
+            SDL_Color widgetAccent = widget.accent.a == 0 ? theme.channelBadge : widget.accent;
+            SDL_Color widgetFill = MixWithBackground(widgetAccent, theme.libraryCard, 0.22f);
+            SDL_Color widgetOutline = colony::color::Mix(widgetAccent, theme.heroTitle, 0.35f);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            SDL_SetRenderDrawColor(renderer, widgetFill.r, widgetFill.g, widgetFill.b, 220);
+            colony::drawing::RenderFilledRoundedRect(renderer, widgetRect, Scale(24));
+            SDL_SetRenderDrawColor(renderer, widgetOutline.r, widgetOutline.g, widgetOutline.b, 230);
+            colony::drawing::RenderRoundedRect(renderer, widgetRect, Scale(24));
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-        if (!widget.descriptionLines.empty())
-        {
-            for (const auto& line : widget.descriptionLines)
+            int widgetTextX = widgetRect.x + widgetPadding;
+            int widgetCursor = widgetRect.y + widgetPadding;
+            if (widget.title.texture)
             {
-                SDL_Rect lineRect{widgetTextX, widgetCursor, line.width, line.height};
-                colony::RenderTexture(renderer, line, lineRect);
-                widgetCursor += line.height;
+                SDL_Rect titleRect{widgetTextX, widgetCursor, widget.title.width, widget.title.height};
+                colony::RenderTexture(renderer, widget.title, titleRect);
+                widgetCursor += widget.title.height + Scale(12);
             }
-            widgetCursor += Scale(12);
-        }
 
-        if (!widget.itemLines.empty())
-        {
-            for (const auto& itemLines : widget.itemLines)
+            if (!widget.descriptionLines.empty())
             {
-                int bulletCenterY = widgetCursor;
-                if (!itemLines.empty())
+                for (const auto& line : widget.descriptionLines)
                 {
-                    bulletCenterY += itemLines.front().height / 2;
+                    SDL_Rect lineRect{widgetTextX, widgetCursor, line.width, line.height};
+                    colony::RenderTexture(renderer, line, lineRect);
+                    widgetCursor += line.height;
                 }
-                SDL_Rect bulletRect{widgetTextX, bulletCenterY - bulletSize / 2, bulletSize, bulletSize};
-                SDL_SetRenderDrawColor(renderer, widgetAccent.r, widgetAccent.g, widgetAccent.b, SDL_ALPHA_OPAQUE);
-                colony::drawing::RenderFilledRoundedRect(renderer, bulletRect, bulletRect.w / 2);
+                widgetCursor += Scale(12);
+            }
 
-                int itemCursorY = widgetCursor;
-                for (std::size_t lineIndex = 0; lineIndex < itemLines.size(); ++lineIndex)
+            if (!widget.itemLines.empty())
+            {
+                for (const auto& itemLines : widget.itemLines)
                 {
-                    const auto& line = itemLines[lineIndex];
-                    SDL_Rect lineRect{widgetTextX + bulletIndent, itemCursorY, line.width, line.height};
-                    colony::RenderTexture(renderer, line, lineRect);
-                    itemCursorY += line.height;
-                    if (lineIndex + 1 < itemLines.size())
+                    int bulletCenterY = widgetCursor;
+                    if (!itemLines.empty())
+                    {
+                        bulletCenterY += itemLines.front().height / 2;
+                    }
+                    SDL_Rect bulletRect{widgetTextX, bulletCenterY - bulletSize / 2, bulletSize, bulletSize};
+                    SDL_SetRenderDrawColor(renderer, widgetAccent.r, widgetAccent.g, widgetAccent.b, SDL_ALPHA_OPAQUE);
+                    colony::drawing::RenderFilledRoundedRect(renderer, bulletRect, bulletRect.w / 2);
+
+                    int itemCursorY = widgetCursor;
+                    for (std::size_t lineIndex = 0; lineIndex < itemLines.size(); ++lineIndex)
                     {
-                        itemCursorY += itemLineSkip > 0 ? std::max(0, itemLineSkip - line.height) : Scale(4);
+                        const auto& line = itemLines[lineIndex];
+                        SDL_Rect lineRect{widgetTextX + bulletIndent, itemCursorY, line.width, line.height};
+                        colony::RenderTexture(renderer, line, lineRect);
+                        itemCursorY += line.height;
+                        if (lineIndex + 1 < itemLines.size())
+                        {
+                            itemCursorY += itemLineSkip > 0 ? std::max(0, itemLineSkip - line.height) : Scale(4);
+                        }
                     }
+                    widgetCursor = itemCursorY + Scale(12);
                 }
-                widgetCursor = itemCursorY + Scale(12);
             }
+            widget.cardCache.End(renderer);
         }
     };
 
@@ -1343,8 +1439,6 @@ HubRenderResult HubPanelRenderer::Render(
 
     result.scrollableContentHeight = std::max(0, gridBottom - scrollTop);
     result.visibleContentHeight = std::max(0, scrollViewportHeight);
-
-    return result;
 }
 
 void HubPanelRenderer::RebuildHeroDescription(SDL_Renderer* renderer, int maxWidth, SDL_Color color) const
@@ -1360,6 +1454,10 @@ void HubPanelRenderer::RebuildHeroDescription(SDL_Renderer* renderer, int maxWid
     {
         return;
     }
+    if (interactiveResize_ && !hero_.descriptionLines.empty())
+    {
+        return;
+    }
 
     hero_.descriptionWidth = maxWidth;
     hero_.descriptionLines.clear();
@@ -1390,6 +1488,10 @@ void HubPanelRenderer::RebuildHeroActionDescription(SDL_Renderer* renderer, int
     {
         return;
     }
+    if (interactiveResize_ && !hero_.actionDescriptionLines.empty())
+    {
+        return;
+    }
 
     hero_.actionDescriptionWidth = maxWidth;
     hero_.actionDescriptionLines.clear();
@@ -1420,6 +1522,10 @@ void HubPanelRenderer::RebuildBranchDescription(SDL_Renderer* renderer, BranchCh
     {
         return;
     }
+    if (interactiveResize_ && !branch.bodyLines.empty())
+    {
+        return;
+    }
 
     branch.descriptionWidth = maxWidth;
     branch.bodyLines.clear();
@@ -1449,6 +1555,11 @@ void HubPanelRenderer::RebuildBranchDetailDescription(SDL_Renderer* renderer, Br
         return;
     }
 
+    if (interactiveResize_ && (!branch.detailBodyLines.empty() || !branch.detailBulletLines.empty()))
+    {
+        return;
+    }
+
     if (branch.detailBodyWidth != maxWidth)
     {
         branch.detailBodyWidth = maxWidth;
@@ -1505,6 +1616,10 @@ void HubPanelRenderer::RebuildWidgetDescription(SDL_Renderer* renderer, WidgetCh
     {
         return;
     }
+    if (interactiveResize_ && !widget.descriptionLines.empty())
+    {
+        return;
+    }
 
     widget.descriptionWidth = maxWidth;
     widget.descriptionLines.clear();
@@ -1535,6 +1650,10 @@ void HubPanelRenderer::RebuildWidgetItems(SDL_Renderer* renderer, WidgetChrome&
     {
         return;
     }
+    if (interactiveResize_ && !widget.itemLines.empty())
+    {
+        return;
+    }
 
     widget.itemsWidth = maxWidth;
     widget.itemLines.clear();
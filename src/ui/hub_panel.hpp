@@ -1,7 +1,9 @@
 #pragma once
 
+#include "ui/panel_cache.hpp"
 #include "ui/theme.hpp"
 
+#include "utils/frame_arena.hpp"
 #include "utils/text.hpp"
 
 #include <SDL2/SDL.h>
@@ -98,7 +100,10 @@ class HubPanelRenderer
         TTF_Font* tileBodyFont,
         const ThemeColors& theme);
 
-    [[nodiscard]] HubRenderResult Render(
+    // Fills the caller-owned result in place so its hitbox vectors keep
+    // their capacity across frames. Transient layout scratch is allocated
+    // from the frame arena.
+    void Render(
         SDL_Renderer* renderer,
         const ThemeColors& theme,
         const SDL_Rect& bounds,
@@ -111,7 +116,14 @@ class HubPanelRenderer
         std::string_view searchQuery,
         bool searchFocused,
         int widgetPage,
-        int widgetsPerPage) const;
+        int widgetsPerPage,
+        colony::FrameArena& frameArena,
+        HubRenderResult& result) const;
+
+    // While a live window resize is in flight the width-keyed wrap caches
+    // are frozen: existing lines render at their stale wrap width and the
+    // rewrap runs once when the resize settles and the flag clears.
+    void SetInteractiveResize(bool active) noexcept { interactiveResize_ = active; }
 
   private:
     struct HeroChrome
@@ -125,6 +137,8 @@ class HubPanelRenderer
         std::string primaryActionDescription;
         mutable int actionDescriptionWidth = 0;
         mutable std::vector<colony::TextTexture> actionDescriptionLines;
+        mutable colony::TextTexture toggleExpandLabel;
+        mutable colony::TextTexture toggleCollapseLabel;
     };
 
     struct BranchChrome
@@ -148,6 +162,9 @@ class HubPanelRenderer
         mutable int detailBodyWidth = 0;
         mutable std::vector<colony::TextTexture> detailBodyLines;
         mutable int detailBulletWidth = 0;
+        // Retained card texture; the ambient bob and hover lift move the
+        // blit position, they never force a redraw.
+        RowTargetCache cardCache;
     };
 
     struct WidgetChrome
@@ -161,6 +178,7 @@ class HubPanelRenderer
         mutable int itemsWidth = 0;
         mutable std::vector<std::vector<colony::TextTexture>> itemLines;
         SDL_Color accent{0, 0, 0, SDL_ALPHA_OPAQUE};
+        RowTargetCache cardCache;
     };
 
     struct SearchChrome
@@ -171,6 +189,26 @@ class HubPanelRenderer
         mutable colony::TextTexture queryTexture;
     };
 
+    // One of the hero's ambient glow discs, rasterized once per size and
+    // colour. The orbit animation becomes a blit offset and the translucency
+    // an alpha mod, instead of hundreds of scanline fills per frame.
+    struct DiscSprite
+    {
+        DiscSprite() = default;
+        ~DiscSprite();
+
+        DiscSprite(const DiscSprite&) = delete;
+        DiscSprite& operator=(const DiscSprite&) = delete;
+
+        sdl::TextureHandle texture;
+        std::size_t accountedBytes = 0;
+        int diameter = 0;
+        SDL_Color color{0, 0, 0, 0};
+    };
+
+    void BlitAccentDisc(
+        SDL_Renderer* renderer, DiscSprite& disc, const SDL_Rect& destination, SDL_Color color, Uint8 alpha) const;
+
     void RebuildHeroDescription(SDL_Renderer* renderer, int maxWidth, SDL_Color color) const;
     void RebuildHeroActionDescription(SDL_Renderer* renderer, int maxWidth, SDL_Color color) const;
     void RebuildBranchDescription(SDL_Renderer* renderer, BranchChrome& branch, int maxWidth, SDL_Color color) const;
@@ -182,9 +220,12 @@ class HubPanelRenderer
     mutable std::vector<BranchChrome> branches_;
     mutable std::vector<WidgetChrome> widgets_;
     mutable SearchChrome search_{};
+    mutable DiscSprite accentDiscLarge_;
+    mutable DiscSprite accentDiscSmall_;
 
     TTF_Font* heroBodyFont_ = nullptr;
     TTF_Font* tileBodyFont_ = nullptr;
+    bool interactiveResize_ = false;
 };
 
 } // namespace colony::ui
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "frontend/components/search_field.hpp"
@@ -12,22 +13,105 @@
 namespace colony::ui
 {
 
-inline float& UiScaleStorage()
+namespace detail
+{
+
+// The effective UI scale is the product of two factors that change on
+// different triggers: the density scale picked in settings and the DPI scale
+// of the display the window currently sits on. They are stored separately so
+// a monitor change does not clobber the user's density preference.
+inline float& UiBaseScaleStorage()
 {
     static float scale = 0.82f;
     return scale;
 }
 
+inline float& UiDpiScaleStorage()
+{
+    static float scale = 1.0f;
+    return scale;
+}
+
+inline float& UiEffectiveScaleStorage()
+{
+    static float scale = UiBaseScaleStorage() * UiDpiScaleStorage();
+    return scale;
+}
+
+// Scale(int) and ScaleDynamic(int) are called thousands of times per frame
+// with small metric constants, so values below this bound are served from
+// tables rebuilt once per scale change instead of a multiply-and-round per
+// call. Larger inputs (dynamic pixel widths, mostly) fall back to the exact
+// arithmetic.
+inline constexpr int kScaleTableEntries = 512;
+
+struct ScaleTables
+{
+    std::array<int, kScaleTableEntries> rounded{};
+    std::array<int, kScaleTableEntries> dynamic{};
+
+    explicit ScaleTables(float scale)
+    {
+        Rebuild(scale);
+    }
+
+    void Rebuild(float scale)
+    {
+        // Must stay bit-identical to the fallback paths in Scale(int) and
+        // ScaleDynamic(int) below so a value straddling the table bound never
+        // rounds differently.
+        rounded[0] = 0;
+        dynamic[0] = 0;
+        for (int value = 1; value < kScaleTableEntries; ++value)
+        {
+            const int roundedScaled = static_cast<int>(static_cast<float>(value) * scale + 0.5f);
+            rounded[value] = roundedScaled < 1 ? 1 : roundedScaled;
+            const int dynamicScaled = static_cast<int>(std::lround(static_cast<double>(value) * scale));
+            dynamic[value] = dynamicScaled < 1 ? 1 : dynamicScaled;
+        }
+    }
+};
+
+inline ScaleTables& UiScaleTables()
+{
+    static ScaleTables tables{UiEffectiveScaleStorage()};
+    return tables;
+}
+
+inline void RefreshEffectiveUiScale()
+{
+    UiEffectiveScaleStorage() = UiBaseScaleStorage() * UiDpiScaleStorage();
+    UiScaleTables().Rebuild(UiEffectiveScaleStorage());
+}
+
+} // namespace detail
+
 inline void SetUiScale(float scale)
 {
     constexpr float kMinScale = 0.6f;
     constexpr float kMaxScale = 1.1f;
-    UiScaleStorage() = std::clamp(scale, kMinScale, kMaxScale);
+    detail::UiBaseScaleStorage() = std::clamp(scale, kMinScale, kMaxScale);
+    detail::RefreshEffectiveUiScale();
+}
+
+inline void SetUiDpiScale(float scale)
+{
+    // 0.5–3.0 covers everything from halved "looks like" modes to 288 DPI
+    // panels; anything outside that range is a driver reporting nonsense.
+    constexpr float kMinScale = 0.5f;
+    constexpr float kMaxScale = 3.0f;
+    detail::UiDpiScaleStorage() = std::clamp(scale, kMinScale, kMaxScale);
+    detail::RefreshEffectiveUiScale();
 }
 
 inline float GetUiScale() noexcept
 {
-    return UiScaleStorage();
+    return detail::UiEffectiveScaleStorage();
+}
+
+inline float GetUiDpiScale() noexcept
+{
+    return detail::UiDpiScaleStorage();
 }
 
 inline int Scale(int value)
@@ -36,6 +120,10 @@ inline int Scale(int value)
     {
         return value;
     }
+    if (value < detail::kScaleTableEntries)
+    {
+        return detail::UiScaleTables().rounded[value];
+    }
 
     const float scale = GetUiScale();
     const int scaled = static_cast<int>(static_cast<float>(value) * scale + 0.5f);
@@ -53,6 +141,10 @@ inline int ScaleDynamic(int value)
     {
         return value;
     }
+    if (value < detail::kScaleTableEntries)
+    {
+        return detail::UiScaleTables().dynamic[value];
+    }
 
     const float scale = GetUiScale();
     const int scaled = static_cast<int>(std::lround(static_cast<double>(value) * scale));
@@ -10,11 +10,21 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
+#include <filesystem>
+#include <thread>
 
 namespace colony::ui
 {
 namespace
 {
+// Catalog lookups dominate the layout pass on big channels; below this many
+// entries per worker the striping overhead outweighs the lookups.
+constexpr std::size_t kMinEntriesPerLayoutWorker = 512;
+
+// The lookups are memory-bound; a few workers saturate them.
+constexpr std::size_t kMaxLayoutWorkers = 4;
+
 bool IsReadyState(std::string_view value)
 {
     std::string lowercase;
@@ -56,7 +66,94 @@ void LibraryPanelRenderer::Build(
     (void)localize;
 }
 
-LibraryRenderResult LibraryPanelRenderer::Render(
+void LibraryPanelRenderer::ComputeCardLayout(
+    const SDL_Rect& libraryRect,
+    int firstRowY,
+    const colony::AppContent& content,
+    const std::vector<colony::frontend::models::LibraryProgramEntry>& programs,
+    LibraryCardLayout& layout)
+{
+    layout.entryIndices.clear();
+    layout.views.clear();
+    layout.cardRects.clear();
+    layout.visible.clear();
+
+    const int padding = Scale(24);
+    const int cardWidth = Scale(320);
+    const int cardHeight = Scale(220);
+    const int gutter = Scale(20);
+    const int availableWidth = libraryRect.w - 2 * padding;
+    const int columns = std::max(1, availableWidth / (cardWidth + gutter));
+
+    // Phase one: resolve each entry against the catalog. The map is
+    // read-only here, so the lookups stripe cleanly across workers; small
+    // channels stay on the calling thread.
+    std::vector<const ViewContent*> resolved(programs.size(), nullptr);
+    const std::size_t workerCount = std::min(
+        {static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency())),
+         kMaxLayoutWorkers,
+         programs.size() / kMinEntriesPerLayoutWorker});
+    const auto resolveRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            if (const auto viewIt = content.views.find(programs[i].programId); viewIt != content.views.end())
+            {
+                resolved[i] = &viewIt->second;
+            }
+        }
+    };
+    if (workerCount >= 2)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        const std::size_t chunk = (programs.size() + workerCount - 1) / workerCount;
+        for (std::size_t worker = 0; worker < workerCount; ++worker)
+        {
+            const std::size_t begin = worker * chunk;
+            const std::size_t end = std::min(programs.size(), begin + chunk);
+            workers.emplace_back(resolveRange, begin, end);
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+    else
+    {
+        resolveRange(0, programs.size());
+    }
+
+    // Phase two: grid slots and culling are plain arithmetic over the
+    // survivors; sequential is already cheap.
+    int row = 0;
+    int column = 0;
+    for (std::size_t i = 0; i < programs.size(); ++i)
+    {
+        if (resolved[i] == nullptr)
+        {
+            continue;
+        }
+
+        const SDL_Rect cardRect{
+            libraryRect.x + padding + column * (cardWidth + gutter),
+            firstRowY + row * (cardHeight + gutter),
+            cardWidth,
+            cardHeight};
+        layout.entryIndices.push_back(i);
+        layout.views.push_back(resolved[i]);
+        layout.cardRects.push_back(cardRect);
+        layout.visible.push_back(SDL_HasIntersection(&cardRect, &libraryRect) == SDL_TRUE ? 1 : 0);
+
+        ++column;
+        if (column >= columns)
+        {
+            column = 0;
+            ++row;
+        }
+    }
+}
+
+void LibraryPanelRenderer::Render(
     SDL_Renderer* renderer,
     const ThemeColors& theme,
     const InteractionColors& interactions,
@@ -72,18 +169,20 @@ LibraryRenderResult LibraryPanelRenderer::Render(
     std::string_view filterText,
     bool filterFocused,
     const std::vector<colony::frontend::models::LibraryProgramEntry>& programs,
-    const std::vector<colony::frontend::models::LibrarySortChip>& sortChips) const
+    const std::vector<colony::frontend::models::LibrarySortChip>& sortChips,
+    frontend::icons::IconArtPipeline* artwork,
+    LibraryRenderResult& result) const
 {
     (void)deltaSeconds;
     (void)filterText;
     (void)filterFocused;
     (void)sortChips;
 
-    LibraryRenderResult result;
     result.addButtonRect.reset();
     result.filterInputRect.reset();
     result.sortChipHitboxes.clear();
     result.programIds.clear();
+    result.tileRects.clear();
 
     SDL_SetRenderDrawColor(renderer, theme.libraryBackground.r, theme.libraryBackground.g, theme.libraryBackground.b, theme.libraryBackground.a);
     SDL_RenderFillRect(renderer, &libraryRect);
@@ -108,55 +207,72 @@ LibraryRenderResult LibraryPanelRenderer::Render(
     const int availableWidth = libraryRect.w - 2 * padding;
     const int columns = std::max(1, availableWidth / (cardWidth + gutter));
 
-    int row = 0;
-    int column = 0;
+    // Slots, catalog resolution and culling come from the renderer-free
+    // layout pass (striped across workers on big channels); this loop only
+    // rasterizes the tiles the pass marked visible.
+    ComputeCardLayout(libraryRect, cursorY, content, programs, layoutScratch_);
 
-    for (const auto& entry : programs)
+    for (std::size_t slot = 0; slot < layoutScratch_.entryIndices.size(); ++slot)
     {
-        if (content.views.find(entry.programId) == content.views.end())
+        const auto& entry = programs[layoutScratch_.entryIndices[slot]];
+        SDL_Rect cardRect = layoutScratch_.cardRects[slot];
+
+        // Windowed rendering: tiles outside the panel viewport keep their
+        // layout slot for hit testing but never rasterize card textures, so
+        // a multi-thousand-program channel costs only its visible rows.
+        if (layoutScratch_.visible[slot] != 0)
         {
-            continue;
+            const auto& view = *layoutScratch_.views[slot];
+            frontend::components::BrandCard::Content cardContent;
+            cardContent.id = entry.programId;
+            cardContent.title = view.heading.empty() ? entry.programId : view.heading;
+            cardContent.subtitle = view.tagline;
+            cardContent.category = view.installState.empty() ? view.availability : view.installState;
+            cardContent.metric = view.lastLaunched.empty() ? view.version : view.lastLaunched;
+            cardContent.statusLabel = view.availability.empty() ? view.installState : view.availability;
+            cardContent.metricBadgeLabel = view.version;
+            cardContent.primaryActionLabel = view.primaryActionLabel.empty()
+                ? (view.installState == "Installed" ? "Launch" : "Preview")
+                : view.primaryActionLabel;
+            cardContent.secondaryActionLabel = view.installState == "Installed" ? "Manage" : "Install";
+            cardContent.highlights.assign(view.heroHighlights.begin(), view.heroHighlights.end());
+            cardContent.ready = IsReadyState(cardContent.statusLabel);
+            cardContent.accent = ResolveAccentColor(programVisuals, view, entry.programId);
+
+            if (artwork != nullptr)
+            {
+                // Request at twice the avatar size so the packed mip serves
+                // the tile exactly; repeat requests for decoded or in-flight
+                // art are deduped inside the pipeline.
+                const int avatarSize = Scale(48);
+                artwork->Request(
+                    entry.programId,
+                    std::filesystem::path{"assets/art"} / (entry.programId + ".bmp"),
+                    avatarSize * 2);
+                if (const auto* region = artwork->Find(entry.programId))
+                {
+                    cardContent.artworkTexture = region->texture;
+                    cardContent.artworkSourceRect = region->SourceFor(avatarSize);
+                }
+            }
+
+            frontend::components::BrandCard card;
+            card.Build(renderer, cardContent, channelFont, bodyFont, bodyFont, theme);
+
+            cardRect.h =
+                card.Render(renderer, theme, interactions, cardRect, bodyFont, bodyFont, false, entry.selected, timeSeconds)
+                    .h;
         }
-        const auto& view = content.views.at(entry.programId);
-        frontend::components::BrandCard::Content cardContent;
-        cardContent.id = entry.programId;
-        cardContent.title = view.heading.empty() ? entry.programId : view.heading;
-        cardContent.subtitle = view.tagline;
-        cardContent.category = view.installState.empty() ? view.availability : view.installState;
-        cardContent.metric = view.lastLaunched.empty() ? view.version : view.lastLaunched;
-        cardContent.statusLabel = view.availability.empty() ? view.installState : view.availability;
-        cardContent.metricBadgeLabel = view.version;
-        cardContent.primaryActionLabel = view.primaryActionLabel.empty()
-            ? (view.installState == "Installed" ? "Launch" : "Preview")
-            : view.primaryActionLabel;
-        cardContent.secondaryActionLabel = view.installState == "Installed" ? "Manage" : "Install";
-        cardContent.highlights.assign(view.heroHighlights.begin(), view.heroHighlights.end());
-        cardContent.ready = IsReadyState(cardContent.statusLabel);
-        cardContent.accent = ResolveAccentColor(programVisuals, view, entry.programId);
-
-        frontend::components::BrandCard card;
-        card.Build(renderer, cardContent, channelFont, bodyFont, bodyFont, theme);
-
-        SDL_Rect cardRect{
-            libraryRect.x + padding + column * (cardWidth + gutter),
-            cursorY + row * (cardHeight + gutter),
-            cardWidth,
-            cardHeight};
 
-        cardRect.h = card.Render(renderer, theme, interactions, cardRect, bodyFont, bodyFont, false, entry.selected, timeSeconds).h;
         result.tileRects.push_back(cardRect);
         result.programIds.push_back(entry.programId);
-
-        ++column;
-        if (column >= columns)
-        {
-            column = 0;
-            ++row;
-        }
     }
 
     if (showAddButton)
     {
+        const std::size_t slotCount = layoutScratch_.entryIndices.size();
+        const int column = static_cast<int>(slotCount % static_cast<std::size_t>(columns));
+        const int row = static_cast<int>(slotCount / static_cast<std::size_t>(columns));
         SDL_Rect addRect{
             libraryRect.x + padding + column * (cardWidth + gutter),
             cursorY + row * (cardHeight + gutter),
@@ -180,8 +296,6 @@ LibraryRenderResult LibraryPanelRenderer::Render(
             addRect.y + addRect.h / 2 + Scale(20));
         result.addButtonRect = addRect;
     }
-
-    return result;
 }
 
 } // namespace colony::ui
@@ -2,6 +2,7 @@
 
 #include "core/content.hpp"
 #include "frontend/models/library_view_model.hpp"
+#include "frontend/utils/icon_pipeline.hpp"
 #include "ui/program_visuals.hpp"
 #include "ui/theme.hpp"
 #include "utils/text.hpp"
@@ -18,6 +19,17 @@
 namespace colony::ui
 {
 
+// Renderer-free output of the card layout pass: one slot per program entry
+// that has a view, its grid rect, whether it intersects the viewport, and
+// the resolved view so the render pass skips a second catalog lookup.
+struct LibraryCardLayout
+{
+    std::vector<std::size_t> entryIndices;
+    std::vector<const ViewContent*> views;
+    std::vector<SDL_Rect> cardRects;
+    std::vector<std::uint8_t> visible;
+};
+
 struct LibraryRenderResult
 {
     std::vector<SDL_Rect> tileRects;
@@ -42,7 +54,10 @@ class LibraryPanelRenderer
         const ThemeColors& theme,
         const std::function<std::string(std::string_view)>& localize);
 
-    LibraryRenderResult Render(
+    // Fills the caller-owned result in place so its vectors keep their
+    // capacity across frames; steady-state rendering reuses the same
+    // storage instead of reallocating per frame.
+    void Render(
         SDL_Renderer* renderer,
         const ThemeColors& theme,
         const InteractionColors& interactions,
@@ -58,14 +73,29 @@ class LibraryPanelRenderer
         std::string_view filterText,
         bool filterFocused,
         const std::vector<colony::frontend::models::LibraryProgramEntry>& programs,
-        const std::vector<colony::frontend::models::LibrarySortChip>& sortChips) const;
+        const std::vector<colony::frontend::models::LibrarySortChip>& sortChips,
+        frontend::icons::IconArtPipeline* artwork,
+        LibraryRenderResult& result) const;
 
   private:
+    // The traversal half of Render — grid slots, catalog lookups, viewport
+    // culling — touches no renderer state, so large catalogs stripe the
+    // lookups across a worker pool; rendering consumes the result on the
+    // SDL thread.
+    static void ComputeCardLayout(
+        const SDL_Rect& libraryRect,
+        int firstRowY,
+        const colony::AppContent& content,
+        const std::vector<colony::frontend::models::LibraryProgramEntry>& programs,
+        LibraryCardLayout& layout);
+
     struct LibraryChrome
     {
     };
 
     LibraryChrome chrome_;
+    // Scratch reused across frames so steady-state layout does not allocate.
+    mutable LibraryCardLayout layoutScratch_;
 };
 
 } // namespace colony::ui
@@ -0,0 +1,296 @@
+#include "ui/panel_cache.hpp"
+
+#include "utils/texture_accounting.hpp"
+#include "utils/texture_pool.hpp"
+
+#include <utility>
+
+namespace colony::ui
+{
+namespace
+{
+
+constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+// Hands the cache's target back to the pool instead of destroying it; the
+// next cache that needs this size gets it without a driver round-trip.
+void ReleaseTargetToPool(sdl::TextureHandle& texture)
+{
+    if (texture)
+    {
+        TexturePool::Shared().Release(texture.release());
+    }
+}
+
+} // namespace
+
+PanelTargetCache::~PanelTargetCache()
+{
+    ReleaseTargetToPool(texture_);
+    TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+}
+
+PanelStateHash& PanelStateHash::Mix(std::uint64_t value) noexcept
+{
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        state_ ^= (value >> shift) & 0xffULL;
+        state_ *= kFnvPrime;
+    }
+    return *this;
+}
+
+PanelStateHash& PanelStateHash::Mix(int value) noexcept
+{
+    return Mix(static_cast<std::uint64_t>(static_cast<std::uint32_t>(value)));
+}
+
+PanelStateHash& PanelStateHash::Mix(bool value) noexcept
+{
+    return Mix(static_cast<std::uint64_t>(value ? 1 : 0));
+}
+
+PanelStateHash& PanelStateHash::Mix(std::string_view text) noexcept
+{
+    for (const char ch : text)
+    {
+        state_ ^= static_cast<unsigned char>(ch);
+        state_ *= kFnvPrime;
+    }
+    // Length terminator so adjacent strings cannot alias ("ab","c" vs "a","bc").
+    return Mix(static_cast<std::uint64_t>(text.size()));
+}
+
+bool PanelTargetCache::Begin(
+    SDL_Renderer* renderer,
+    const SDL_Rect& bounds,
+    SDL_Color clearColor,
+    std::uint64_t stateVersion)
+{
+    redirected_ = false;
+    previousTarget_ = nullptr;
+
+    if (renderer == nullptr || bounds.w <= 0 || bounds.h <= 0)
+    {
+        return true;
+    }
+
+    const bool boundsMatch =
+        bounds.x == bounds_.x && bounds.y == bounds_.y && bounds.w == width_ && bounds.h == height_;
+    if (valid_ && texture_ && boundsMatch && version_ == stateVersion)
+    {
+        const SDL_Rect source{0, 0, width_, height_};
+        SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_NONE);
+        SDL_RenderCopy(renderer, texture_.get(), &source, &bounds);
+        return false;
+    }
+
+    if (!texture_ || bounds.w != width_ || bounds.h != height_)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        // Pooled targets may be bucket-rounded larger than the panel, so
+        // every blit below uses the logical size as an explicit source rect.
+        ReleaseTargetToPool(texture_);
+        texture_.reset(TexturePool::Shared().AcquireTarget(renderer, bounds.w, bounds.h));
+        width_ = texture_ ? bounds.w : 0;
+        height_ = texture_ ? bounds.h : 0;
+        accountedBytes_ = TextureAccounting::EstimateBytes(width_, height_);
+        TextureAccounting::Shared().Add(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+    }
+
+    valid_ = false;
+    if (!texture_)
+    {
+        // No render target available; fall back to drawing straight to the
+        // backbuffer. End() becomes a no-op for this frame.
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        accountedBytes_ = 0;
+        return true;
+    }
+
+    previousTarget_ = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, texture_.get()) != 0)
+    {
+        texture_.reset();
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        accountedBytes_ = 0;
+        width_ = 0;
+        height_ = 0;
+        previousTarget_ = nullptr;
+        return true;
+    }
+
+    // Panels draw in absolute window coordinates; offset the viewport so the
+    // panel origin lands at the texture origin without touching their code.
+    const SDL_Rect viewport{-bounds.x, -bounds.y, bounds.x + bounds.w, bounds.y + bounds.h};
+    SDL_RenderSetViewport(renderer, &viewport);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, clearColor.r, clearColor.g, clearColor.b, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    bounds_ = bounds;
+    version_ = stateVersion;
+    redirected_ = true;
+    return true;
+}
+
+void PanelTargetCache::End(SDL_Renderer* renderer)
+{
+    if (!redirected_)
+    {
+        return;
+    }
+    redirected_ = false;
+
+    SDL_RenderSetViewport(renderer, nullptr);
+    SDL_SetRenderTarget(renderer, previousTarget_);
+    previousTarget_ = nullptr;
+
+    const SDL_Rect source{0, 0, width_, height_};
+    SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_NONE);
+    SDL_RenderCopy(renderer, texture_.get(), &source, &bounds_);
+    valid_ = true;
+}
+
+bool PanelTargetCache::BlitStretched(SDL_Renderer* renderer, const SDL_Rect& bounds) const
+{
+    if (renderer == nullptr || !valid_ || !texture_ || bounds.w <= 0 || bounds.h <= 0)
+    {
+        return false;
+    }
+
+    const SDL_Rect source{0, 0, width_, height_};
+    SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_NONE);
+    SDL_RenderCopy(renderer, texture_.get(), &source, &bounds);
+    return true;
+}
+
+RowTargetCache::~RowTargetCache()
+{
+    ReleaseTargetToPool(texture_);
+    TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+}
+
+RowTargetCache::RowTargetCache(RowTargetCache&& other) noexcept
+    : texture_(std::move(other.texture_)),
+      accountedBytes_(other.accountedBytes_),
+      width_(other.width_),
+      height_(other.height_),
+      bounds_(other.bounds_),
+      version_(other.version_),
+      valid_(other.valid_)
+{
+    other.accountedBytes_ = 0;
+    other.width_ = 0;
+    other.height_ = 0;
+    other.valid_ = false;
+}
+
+RowTargetCache& RowTargetCache::operator=(RowTargetCache&& other) noexcept
+{
+    if (this != &other)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        texture_ = std::move(other.texture_);
+        accountedBytes_ = other.accountedBytes_;
+        width_ = other.width_;
+        height_ = other.height_;
+        bounds_ = other.bounds_;
+        version_ = other.version_;
+        valid_ = other.valid_;
+        other.accountedBytes_ = 0;
+        other.width_ = 0;
+        other.height_ = 0;
+        other.valid_ = false;
+    }
+    return *this;
+}
+
+bool RowTargetCache::Begin(SDL_Renderer* renderer, const SDL_Rect& bounds, std::uint64_t stateVersion)
+{
+    redirected_ = false;
+    previousTarget_ = nullptr;
+
+    if (renderer == nullptr || bounds.w <= 0 || bounds.h <= 0)
+    {
+        return true;
+    }
+
+    if (valid_ && texture_ && bounds.w == width_ && bounds.h == height_ && version_ == stateVersion)
+    {
+        const SDL_Rect source{0, 0, width_, height_};
+        SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_BLEND);
+        SDL_RenderCopy(renderer, texture_.get(), &source, &bounds);
+        return false;
+    }
+
+    if (!texture_ || bounds.w != width_ || bounds.h != height_)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        // Pooled targets may be bucket-rounded larger than the panel, so
+        // every blit below uses the logical size as an explicit source rect.
+        ReleaseTargetToPool(texture_);
+        texture_.reset(TexturePool::Shared().AcquireTarget(renderer, bounds.w, bounds.h));
+        width_ = texture_ ? bounds.w : 0;
+        height_ = texture_ ? bounds.h : 0;
+        accountedBytes_ = TextureAccounting::EstimateBytes(width_, height_);
+        TextureAccounting::Shared().Add(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+    }
+
+    valid_ = false;
+    if (!texture_)
+    {
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        accountedBytes_ = 0;
+        return true;
+    }
+
+    previousTarget_ = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, texture_.get()) != 0)
+    {
+        texture_.reset();
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::PanelChrome, accountedBytes_);
+        accountedBytes_ = 0;
+        width_ = 0;
+        height_ = 0;
+        previousTarget_ = nullptr;
+        return true;
+    }
+
+    const SDL_Rect viewport{-bounds.x, -bounds.y, bounds.x + bounds.w, bounds.y + bounds.h};
+    SDL_RenderSetViewport(renderer, &viewport);
+
+    // Transparent clear: whatever the row leaves untouched (rounded corner
+    // cutouts) stays see-through when the texture is blended onto the frame.
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    bounds_ = bounds;
+    version_ = stateVersion;
+    redirected_ = true;
+    return true;
+}
+
+void RowTargetCache::End(SDL_Renderer* renderer)
+{
+    if (!redirected_)
+    {
+        return;
+    }
+    redirected_ = false;
+
+    SDL_RenderSetViewport(renderer, nullptr);
+    SDL_SetRenderTarget(renderer, previousTarget_);
+    previousTarget_ = nullptr;
+
+    const SDL_Rect source{0, 0, width_, height_};
+    SDL_SetTextureBlendMode(texture_.get(), SDL_BLENDMODE_BLEND);
+    SDL_RenderCopy(renderer, texture_.get(), &source, &bounds_);
+    valid_ = true;
+}
+
+} // namespace colony::ui
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "utils/sdl_wrappers.hpp"
+
+namespace colony::ui
+{
+
+// Order-sensitive FNV-1a accumulator for summarizing the inputs a panel was
+// rendered from. Callers mix every value that affects the panel's pixels and
+// hand the result to PanelTargetCache::Begin as the state version.
+class PanelStateHash
+{
+  public:
+    PanelStateHash& Mix(std::uint64_t value) noexcept;
+    PanelStateHash& Mix(int value) noexcept;
+    PanelStateHash& Mix(bool value) noexcept;
+    PanelStateHash& Mix(std::string_view text) noexcept;
+
+    [[nodiscard]] std::uint64_t Value() const noexcept { return state_; }
+
+  private:
+    std::uint64_t state_ = 14695981039346656037ULL;
+};
+
+// Offscreen render-target cache for a chrome panel. While the panel's state
+// version and bounds are unchanged the cached texture is blitted instead of
+// re-running the panel's draw traversal; any change redirects rendering into
+// the texture so the next clean frame hits the cache again.
+//
+// The cache relies on the render target support the renderer is created with
+// (SDL_RENDERER_TARGETTEXTURE) and degrades to plain direct rendering when a
+// target texture cannot be created.
+class PanelTargetCache
+{
+  public:
+    PanelTargetCache() = default;
+    ~PanelTargetCache();
+
+    PanelTargetCache(const PanelTargetCache&) = delete;
+    PanelTargetCache& operator=(const PanelTargetCache&) = delete;
+
+    // Prepares the cache for this frame. Returns true when the caller must
+    // draw the panel (rendering has been redirected into the cache texture
+    // when possible) and must call End afterwards; returns false when the
+    // cached texture was fresh and has already been blitted at bounds.
+    // clearColor is the pixel state underneath the panel, so translucent
+    // panel fills flatten exactly as they would on the backbuffer.
+    [[nodiscard]] bool Begin(
+        SDL_Renderer* renderer,
+        const SDL_Rect& bounds,
+        SDL_Color clearColor,
+        std::uint64_t stateVersion);
+
+    // Restores the previous render target and blits the freshly drawn panel.
+    // Only valid after a Begin that returned true.
+    void End(SDL_Renderer* renderer);
+
+    // Cheap live-resize path: stretches the last cached texture to bounds
+    // without validating the state version or re-rendering. Returns false
+    // when no cached texture exists (the caller must draw normally). The
+    // cache keeps its recorded bounds, so the first settled frame redraws.
+    [[nodiscard]] bool BlitStretched(SDL_Renderer* renderer, const SDL_Rect& bounds) const;
+
+    // Forces a redraw on the next Begin regardless of the state version.
+    void Invalidate() noexcept { valid_ = false; }
+
+  private:
+    sdl::TextureHandle texture_;
+    std::size_t accountedBytes_ = 0;
+    int width_ = 0;
+    int height_ = 0;
+    SDL_Rect bounds_{0, 0, 0, 0};
+    std::uint64_t version_ = 0;
+    bool valid_ = false;
+    bool redirected_ = false;
+    SDL_Texture* previousTarget_ = nullptr;
+};
+
+// Position-independent variant of PanelTargetCache for list rows. The cached
+// texture is keyed by size and state version only, so a row that merely
+// scrolls keeps hitting its cache and is blitted at the new position. Rows
+// are drawn onto a transparent target and blitted with alpha blending, which
+// lets their rounded corners compose over animated backdrops.
+class RowTargetCache
+{
+  public:
+    RowTargetCache() = default;
+    ~RowTargetCache();
+
+    RowTargetCache(const RowTargetCache&) = delete;
+    RowTargetCache& operator=(const RowTargetCache&) = delete;
+    RowTargetCache(RowTargetCache&& other) noexcept;
+    RowTargetCache& operator=(RowTargetCache&& other) noexcept;
+
+    // Same contract as PanelTargetCache::Begin: true means draw the row and
+    // call End, false means the cached texture was blitted at bounds.
+    [[nodiscard]] bool Begin(SDL_Renderer* renderer, const SDL_Rect& bounds, std::uint64_t stateVersion);
+    void End(SDL_Renderer* renderer);
+
+    void Invalidate() noexcept { valid_ = false; }
+
+  private:
+    sdl::TextureHandle texture_;
+    std::size_t accountedBytes_ = 0;
+    int width_ = 0;
+    int height_ = 0;
+    SDL_Rect bounds_{0, 0, 0, 0};
+    std::uint64_t version_ = 0;
+    bool valid_ = false;
+    bool redirected_ = false;
+    SDL_Texture* previousTarget_ = nullptr;
+};
+
+} // namespace colony::ui
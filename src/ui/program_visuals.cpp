@@ -1,13 +1,30 @@
 #include "ui/program_visuals.hpp"
 
+#include "ui/layout.hpp"
 #include "utils/color.hpp"
+#include "utils/text_raster_batch.hpp"
 #include "utils/text_wrapping.hpp"
+#include "utils/texture_accounting.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <string>
 
 namespace colony::ui
 {
+namespace
+{
+
+// Bullet prefix for the first wrapped line of an option, alignment spaces
+// for the rest; shared by the measure and rasterize passes so they always
+// agree on the exact text.
+[[nodiscard]] std::string DecorateSectionLine(std::string line, bool indent)
+{
+    line.insert(0, indent ? "  " : "\xE2\x80\xA2 ");
+    return line;
+}
+
+} // namespace
 
 ProgramVisuals BuildProgramVisuals(
     const colony::ViewContent& content,
@@ -32,36 +49,23 @@ ProgramVisuals BuildProgramVisuals(
 {
     ProgramVisuals visuals;
     visuals.content = &content;
-    visuals.heroTitle = colony::CreateTextTexture(renderer, heroTitleFont, content.heading, heroTitleColor);
-    if (!content.tagline.empty())
-    {
-        visuals.heroTagline = colony::CreateTextTexture(renderer, heroSubtitleFont, content.tagline, heroSubtitleColor);
-    }
-    if (!content.availability.empty())
-    {
-        visuals.availability = colony::CreateTextTexture(renderer, heroBodyFont, content.availability, heroBodyColor);
-    }
-    if (!content.version.empty())
-    {
-        visuals.version = colony::CreateTextTexture(renderer, tileMetaFont, content.version, mutedColor);
-    }
-    if (!content.installState.empty())
-    {
-        visuals.installState = colony::CreateTextTexture(renderer, tileMetaFont, content.installState, mutedColor);
-    }
-    if (!content.lastLaunched.empty())
-    {
-        visuals.lastLaunched = colony::CreateTextTexture(renderer, tileMetaFont, content.lastLaunched, mutedColor);
-    }
-    visuals.actionLabel = colony::CreateTextTexture(renderer, buttonFont, content.primaryActionLabel, heroTitleColor);
-    visuals.tileTitle = colony::CreateTextTexture(renderer, tileTitleFont, content.heading, heroTitleColor);
 
-    std::string subtitle = !content.tagline.empty() ? content.tagline
+    // All runs are staged first and uploaded in one burst at the end, so the
+    // rasterizer and the driver each see a coherent pass instead of
+    // alternating per string.
+    colony::TextRasterBatch batch;
+    batch.Stage(heroTitleFont, content.heading, heroTitleColor, visuals.heroTitle);
+    batch.Stage(heroSubtitleFont, content.tagline, heroSubtitleColor, visuals.heroTagline);
+    batch.Stage(heroBodyFont, content.availability, heroBodyColor, visuals.availability);
+    batch.Stage(tileMetaFont, content.version, mutedColor, visuals.version);
+    batch.Stage(tileMetaFont, content.installState, mutedColor, visuals.installState);
+    batch.Stage(tileMetaFont, content.lastLaunched, mutedColor, visuals.lastLaunched);
+    batch.Stage(buttonFont, content.primaryActionLabel, heroTitleColor, visuals.actionLabel);
+    batch.Stage(tileTitleFont, content.heading, heroTitleColor, visuals.tileTitle);
+
+    const std::string subtitle = !content.tagline.empty() ? content.tagline
         : (content.paragraphs.empty() ? std::string{} : content.paragraphs.front());
-    if (!subtitle.empty())
-    {
-        visuals.tileSubtitle = colony::CreateTextTexture(renderer, tileSubtitleFont, subtitle, mutedColor);
-    }
+    batch.Stage(tileSubtitleFont, subtitle, mutedColor, visuals.tileSubtitle);
 
     std::string meta;
     if (!content.version.empty())
@@ -76,28 +80,24 @@ ProgramVisuals BuildProgramVisuals(
         }
         meta.append(content.installState);
     }
-    if (!meta.empty())
-    {
-        visuals.tileMeta = colony::CreateTextTexture(renderer, tileMetaFont, meta, mutedColor);
-    }
+    batch.Stage(tileMetaFont, meta, mutedColor, visuals.tileMeta);
 
     if (!content.statusMessage.empty())
     {
-        visuals.statusBar = colony::CreateTextTexture(renderer, statusFont, content.statusMessage, statusBarTextColor);
+        batch.Stage(statusFont, content.statusMessage, statusBarTextColor, visuals.statusBar);
+        visuals.statusBarTextHash = std::hash<std::string>{}(content.statusMessage);
     }
 
     visuals.accent = colony::color::ParseHexColor(content.accentColor, SDL_Color{91, 150, 255, SDL_ALPHA_OPAQUE});
     visuals.gradientStart = colony::color::ParseHexColor(content.heroGradient[0], gradientFallbackStart);
     visuals.gradientEnd = colony::color::ParseHexColor(content.heroGradient[1], gradientFallbackEnd);
 
-    visuals.sections.reserve(content.sections.size());
-    for (const auto& section : content.sections)
-    {
-        ProgramVisuals::PatchSection patchSection;
-        patchSection.title = colony::CreateTextTexture(renderer, patchTitleFont, section.title, heroTitleColor);
-        visuals.sections.emplace_back(std::move(patchSection));
-    }
+    // Section text (titles included) rasterizes through the window pass with
+    // the rest of the section stream.
+    (void)patchTitleFont;
+    visuals.sections.resize(content.sections.size());
 
+    batch.Flush(renderer);
     return visuals;
 }
 
@@ -121,10 +121,12 @@ void RebuildDescription(
     visuals.descriptionLines.clear();
 
     const int lineSkip = TTF_FontLineSkip(font);
+    colony::TextRasterBatch batch;
     for (const auto& paragraph : visuals.content->paragraphs)
     {
         const auto wrappedLines = colony::WrapTextToWidth(font, paragraph, maxWidth);
         std::vector<colony::TextTexture> lineTextures;
+        // Reserved so the staged destinations stay put until the flush.
         lineTextures.reserve(wrappedLines.size());
         for (const auto& line : wrappedLines)
         {
@@ -136,13 +138,15 @@ void RebuildDescription(
                 lineTextures.emplace_back(std::move(placeholder));
                 continue;
             }
-            lineTextures.emplace_back(colony::CreateTextTexture(renderer, font, line, bodyColor));
+            lineTextures.emplace_back();
+            batch.Stage(font, line, bodyColor, lineTextures.back());
         }
         if (!lineTextures.empty())
         {
             visuals.descriptionLines.emplace_back(std::move(lineTextures));
         }
     }
+    batch.Flush(renderer);
 }
 
 void RebuildHighlights(
@@ -168,6 +172,7 @@ void RebuildHighlights(
     const int bulletIndent = 24;
     const int availableWidth = std::max(0, maxWidth - bulletIndent);
 
+    colony::TextRasterBatch batch;
     for (const auto& highlight : visuals.content->heroHighlights)
     {
         const auto wrappedLines = colony::WrapTextToWidth(font, highlight, availableWidth);
@@ -192,35 +197,33 @@ void RebuildHighlights(
             }
 
             WrappedLine line;
+            line.indent = indent;
+            lines.emplace_back(std::move(line));
             if (text.empty())
             {
-                line.texture.width = 0;
-                line.texture.height = std::max(lineSkip, 0);
+                lines.back().texture.width = 0;
+                lines.back().texture.height = std::max(lineSkip, 0);
             }
             else
             {
-                line.texture = colony::CreateTextTexture(renderer, font, text, textColor);
+                batch.Stage(font, text, textColor, lines.back().texture);
             }
-            line.indent = indent;
-            lines.emplace_back(std::move(line));
         }
         if (!lines.empty())
         {
             visuals.highlightLines.emplace_back(std::move(lines));
         }
     }
+    batch.Flush(renderer);
 }
 
 void RebuildSections(
     ProgramVisuals& visuals,
-    SDL_Renderer* renderer,
     TTF_Font* titleFont,
     TTF_Font* bodyFont,
-    int maxWidth,
-    SDL_Color titleColor,
-    SDL_Color bodyColor)
+    int maxWidth)
 {
-    if (renderer == nullptr || bodyFont == nullptr || maxWidth <= 0)
+    if (bodyFont == nullptr || maxWidth <= 0)
     {
         return;
     }
@@ -234,17 +237,21 @@ void RebuildSections(
         }
 
         sectionVisual.width = maxWidth;
+        sectionVisual.rasterized = false;
         sectionVisual.lines.clear();
 
-        if (titleFont != nullptr)
+        sectionVisual.title = colony::TextTexture{};
+        if (titleFont != nullptr && !visuals.content->sections[i].title.empty())
         {
-            const std::string& titleText = visuals.content->sections[i].title;
-            sectionVisual.title = colony::CreateTextTexture(renderer, titleFont, titleText, titleColor);
+            TTF_SizeUTF8(
+                titleFont,
+                visuals.content->sections[i].title.c_str(),
+                &sectionVisual.title.width,
+                &sectionVisual.title.height);
         }
 
         const int bulletIndent = 20;
         const int availableWidth = std::max(0, maxWidth - bulletIndent);
-        const int lineSkip = TTF_FontLineSkip(bodyFont);
 
         for (const auto& option : visuals.content->sections[i].options)
         {
@@ -257,36 +264,170 @@ void RebuildSections(
             optionLines.reserve(wrappedLines.size());
             for (std::size_t lineIndex = 0; lineIndex < wrappedLines.size(); ++lineIndex)
             {
-                bool indent = lineIndex != 0;
-                std::string lineText = wrappedLines[lineIndex];
-                if (!indent)
-                {
-                    lineText.insert(0, "\xE2\x80\xA2 ");
-                }
-                else
-                {
-                    lineText.insert(0, "  ");
-                }
-
                 WrappedLine line;
-                if (lineText.empty())
-                {
-                    line.texture.width = 0;
-                    line.texture.height = std::max(lineSkip, 0);
-                }
-                else
+                line.indent = lineIndex != 0;
+                const std::string lineText = DecorateSectionLine(wrappedLines[lineIndex], line.indent);
+                TTF_SizeUTF8(bodyFont, lineText.c_str(), &line.texture.width, &line.texture.height);
+                optionLines.emplace_back(std::move(line));
+            }
+            sectionVisual.lines.emplace_back(std::move(optionLines));
+        }
+    }
+}
+
+int SectionContentHeight(const ProgramVisuals::PatchSection& section)
+{
+    int height = 0;
+    if (section.title.height > 0)
+    {
+        height += section.title.height + Scale(10);
+    }
+    for (const auto& optionLines : section.lines)
+    {
+        for (const auto& line : optionLines)
+        {
+            height += line.texture.height + Scale(3);
+        }
+        height += Scale(8);
+    }
+    height += Scale(10);
+    return height;
+}
+
+void UpdateSectionWindow(
+    ProgramVisuals& visuals,
+    SDL_Renderer* renderer,
+    TTF_Font* titleFont,
+    TTF_Font* bodyFont,
+    SDL_Color titleColor,
+    SDL_Color bodyColor,
+    int firstSectionTop,
+    int windowTop,
+    int windowBottom)
+{
+    if (renderer == nullptr || bodyFont == nullptr)
+    {
+        return;
+    }
+
+    colony::TextRasterBatch batch;
+    int cursor = firstSectionTop;
+    for (std::size_t i = 0; i < visuals.sections.size(); ++i)
+    {
+        auto& sectionVisual = visuals.sections[i];
+        const int height = SectionContentHeight(sectionVisual);
+        const bool inWindow = cursor < windowBottom && cursor + height > windowTop;
+        cursor += height;
+
+        if (inWindow == sectionVisual.rasterized)
+        {
+            continue;
+        }
+
+        if (!inWindow)
+        {
+            // Scrolled far offscreen: drop the textures, keep the measured
+            // layout so the scroll range never shifts.
+            sectionVisual.title.texture.reset();
+            for (auto& optionLines : sectionVisual.lines)
+            {
+                for (auto& line : optionLines)
                 {
-                    line.texture = colony::CreateTextTexture(renderer, bodyFont, lineText, bodyColor);
+                    line.texture.texture.reset();
                 }
-                line.indent = indent;
-                optionLines.emplace_back(std::move(line));
             }
-            if (!optionLines.empty())
+            sectionVisual.rasterized = false;
+            continue;
+        }
+
+        // Entering the window: re-wrap (a cache hit after the measure pass)
+        // and stage the runs; the batch uploads the whole window in one
+        // burst.
+        if (titleFont != nullptr && !visuals.content->sections[i].title.empty())
+        {
+            batch.Stage(titleFont, visuals.content->sections[i].title, titleColor, sectionVisual.title);
+        }
+
+        const int bulletIndent = 20;
+        const int availableWidth = std::max(0, sectionVisual.width - bulletIndent);
+        std::size_t groupIndex = 0;
+        for (const auto& option : visuals.content->sections[i].options)
+        {
+            const auto wrappedLines = colony::WrapTextToWidth(bodyFont, option, availableWidth);
+            if (wrappedLines.empty() || groupIndex >= sectionVisual.lines.size())
+            {
+                continue;
+            }
+            auto& optionLines = sectionVisual.lines[groupIndex];
+            ++groupIndex;
+            const std::size_t lineCount = std::min(wrappedLines.size(), optionLines.size());
+            for (std::size_t lineIndex = 0; lineIndex < lineCount; ++lineIndex)
             {
-                sectionVisual.lines.emplace_back(std::move(optionLines));
+                batch.Stage(
+                    bodyFont,
+                    DecorateSectionLine(wrappedLines[lineIndex], lineIndex != 0),
+                    bodyColor,
+                    optionLines[lineIndex].texture);
+            }
+        }
+        sectionVisual.rasterized = true;
+    }
+    batch.Flush(renderer);
+}
+
+std::size_t EstimateProgramVisualsBytes(const ProgramVisuals& visuals)
+{
+    std::size_t bytes = 0;
+    const auto count = [&bytes](const colony::TextTexture& texture) {
+        bytes += TextureAccounting::EstimateBytes(texture.width, texture.height);
+    };
+
+    count(visuals.heroTitle);
+    count(visuals.heroTagline);
+    count(visuals.availability);
+    count(visuals.version);
+    count(visuals.installState);
+    count(visuals.lastLaunched);
+    count(visuals.actionLabel);
+    count(visuals.statusBar);
+    count(visuals.tileTitle);
+    count(visuals.tileSubtitle);
+    count(visuals.tileMeta);
+
+    for (const auto& paragraph : visuals.descriptionLines)
+    {
+        for (const auto& line : paragraph)
+        {
+            count(line);
+        }
+    }
+    for (const auto& highlight : visuals.highlightLines)
+    {
+        for (const auto& line : highlight)
+        {
+            count(line.texture);
+        }
+    }
+    for (const auto& section : visuals.sections)
+    {
+        // Section entries keep their measured sizes while released; only
+        // resident textures count against the budget.
+        if (section.title.texture)
+        {
+            count(section.title);
+        }
+        for (const auto& option : section.lines)
+        {
+            for (const auto& line : option)
+            {
+                if (line.texture.texture)
+                {
+                    count(line.texture);
+                }
             }
         }
     }
+    return bytes;
 }
 
 } // namespace colony::ui
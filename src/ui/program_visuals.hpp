@@ -6,6 +6,7 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace colony::ui
@@ -29,6 +30,9 @@ struct ProgramVisuals
     colony::TextTexture lastLaunched;
     colony::TextTexture actionLabel;
     colony::TextTexture statusBar;
+    // Hash of the string statusBar was rasterized from; lets a status
+    // update skip the rasterization when the text did not actually change.
+    std::size_t statusBarTextHash = 0;
 
     colony::TextTexture tileTitle;
     colony::TextTexture tileSubtitle;
@@ -44,10 +48,17 @@ struct ProgramVisuals
     int highlightsWidth = 0;
     std::vector<std::vector<WrappedLine>> highlightLines;
 
+    // Sections are a windowed stream: RebuildSections lays out and measures
+    // every section without rasterizing, and UpdateSectionWindow keeps
+    // textures resident only for the sections near the viewport. Line and
+    // title entries always carry their measured width/height so scrolling
+    // math never depends on which textures happen to be resident.
     struct PatchSection
     {
         colony::TextTexture title;
         int width = 0;
+        // True while the window pass holds textures for this section.
+        bool rasterized = false;
         std::vector<std::vector<WrappedLine>> lines;
     };
     std::vector<PatchSection> sections;
@@ -58,6 +69,11 @@ struct ProgramVisuals
     int sectionsViewportContentHeight = 0;
 };
 
+// Estimated texture bytes held by the visuals (width * height * 4 per run).
+// Recompute after lazy rebuilds — descriptions, highlights and patch sections
+// rasterize on first hero render, not at build time.
+[[nodiscard]] std::size_t EstimateProgramVisualsBytes(const ProgramVisuals& visuals);
+
 ProgramVisuals BuildProgramVisuals(
     const colony::ViewContent& content,
     SDL_Renderer* renderer,
@@ -93,13 +109,33 @@ void RebuildHighlights(
     int maxWidth,
     SDL_Color textColor);
 
+// Layout pass: wraps and measures every section at maxWidth without
+// rasterizing anything. Runs in full on a width change and is a no-op
+// afterwards; texture residency is handled by UpdateSectionWindow.
 void RebuildSections(
+    ProgramVisuals& visuals,
+    TTF_Font* titleFont,
+    TTF_Font* bodyFont,
+    int maxWidth);
+
+// Content height one section occupies, from its measured entries; matches
+// the hero panel's render spacing exactly.
+[[nodiscard]] int SectionContentHeight(const ProgramVisuals::PatchSection& section);
+
+// Residency pass: rasterizes the sections whose content span overlaps
+// [windowTop, windowBottom) and drops the textures of sections outside it,
+// keeping per-program texture memory bounded by the window rather than the
+// document length. firstSectionTop is the content offset of the first
+// section; the wrap cache makes re-entering a released section cheap.
+void UpdateSectionWindow(
     ProgramVisuals& visuals,
     SDL_Renderer* renderer,
     TTF_Font* titleFont,
     TTF_Font* bodyFont,
-    int maxWidth,
     SDL_Color titleColor,
-    SDL_Color bodyColor);
+    SDL_Color bodyColor,
+    int firstSectionTop,
+    int windowTop,
+    int windowBottom);
 
 } // namespace colony::ui
@@ -3,9 +3,11 @@
 #include "ui/layout.hpp"
 #include "utils/color.hpp"
 #include "utils/drawing.hpp"
+#include "utils/font_fallback.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 namespace colony::ui
 {
@@ -29,6 +31,7 @@ void SettingsPanel::Build(
     languages_.clear();
     toggles_.clear();
     appearanceCustomizations_.clear();
+    rowCaches_.clear();
 
     appearanceTitle_ = colony::CreateTextTexture(renderer, titleFont, localize("settings.appearance.title"), titleColor);
     appearanceSubtitle_ = colony::CreateTextTexture(renderer, bodyFont, localize("settings.appearance.subtitle"), bodyColor);
@@ -80,7 +83,13 @@ void SettingsPanel::Build(
                 nativeFont = providedFont;
             }
         }
-        option.nativeName = colony::CreateTextTexture(renderer, nativeFont, localize(nativeKey), secondaryColor);
+        // Native names mix scripts ("Français", "中文 (简体)") and no single
+        // face covers them all; segment across the native face with the body
+        // face as fallback instead of letting the gaps render tofu.
+        colony::FontFallbackChain nativeChain;
+        nativeChain.SetFonts({nativeFont, bodyFont});
+        option.nativeName =
+            colony::CreateFallbackTextTexture(renderer, nativeChain, localize(nativeKey), secondaryColor);
         languages_.emplace_back(std::move(option));
     };
 
@@ -133,7 +142,7 @@ SettingsPanel::RenderResult SettingsPanel::Render(
     std::string_view activeSchemeId,
     std::string_view activeLanguageId,
     const SectionStates& sectionStates,
-    const std::unordered_map<std::string, bool>& toggleStates,
+    const BasicToggleSettings& toggleStates,
     const std::unordered_map<std::string, float>& customizationValues) const
 {
     SettingsPanel::RenderResult result;
@@ -155,6 +164,30 @@ SettingsPanel::RenderResult SettingsPanel::Render(
         }
     };
 
+    // Rows scrolled out of the viewport are laid out (cursorY must advance so
+    // contentHeight and anchors stay exact) but never drawn.
+    const auto rowVisible = [&](const SDL_Rect& drawRect) {
+        SDL_Rect clipped{};
+        return SDL_IntersectRect(&drawRect, &bounds, &clipped) == SDL_TRUE;
+    };
+
+    // Culls the row against the viewport, then draws it through its retained
+    // texture: drawBody only runs when the row's version changed since the
+    // texture was last filled.
+    const auto drawCachedRow =
+        [&](const std::string& key, const SDL_Rect& drawRect, std::uint64_t version, auto&& drawBody) {
+            if (!rowVisible(drawRect))
+            {
+                return;
+            }
+            RowTargetCache& cache = rowCaches_[key];
+            if (cache.Begin(renderer, drawRect, version))
+            {
+                drawBody();
+                cache.End(renderer);
+            }
+        };
+
     int cursorY = bounds.y;
     const int horizontalPadding = Scale(26);
     const int availableWidth = bounds.w - horizontalPadding * 2;
@@ -256,11 +289,14 @@ SettingsPanel::RenderResult SettingsPanel::Render(
         if (rowContainerHeight > 0)
         {
             SDL_Rect drawMenuRect = offsetRect(menuRect);
-            SDL_Color menuBase = colony::color::Mix(theme.libraryCard, theme.background, 0.3f);
-            SDL_SetRenderDrawColor(renderer, menuBase.r, menuBase.g, menuBase.b, menuBase.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawMenuRect, 18);
-            SDL_SetRenderDrawColor(renderer, menuBorder.r, menuBorder.g, menuBorder.b, menuBorder.a);
-            colony::drawing::RenderRoundedRect(renderer, drawMenuRect, 18);
+            if (rowVisible(drawMenuRect))
+            {
+                SDL_Color menuBase = colony::color::Mix(theme.libraryCard, theme.background, 0.3f);
+                SDL_SetRenderDrawColor(renderer, menuBase.r, menuBase.g, menuBase.b, menuBase.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawMenuRect, 18);
+                SDL_SetRenderDrawColor(renderer, menuBorder.r, menuBorder.g, menuBorder.b, menuBorder.a);
+                colony::drawing::RenderRoundedRect(renderer, drawMenuRect, 18);
+            }
         }
 
         int optionY = menuRect.y + listPadding;
@@ -271,67 +307,75 @@ SettingsPanel::RenderResult SettingsPanel::Render(
             option.rect = optionRect;
             SDL_Rect drawOptionRect = offsetRect(optionRect);
             const bool isActive = option.id == activeSchemeId;
-            SDL_Color optionBase = isActive ? colony::color::Mix(theme.libraryCardActive, theme.heroTitle, 0.12f)
-                                            : colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
-            SDL_Color optionBorder = isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.45f);
-            SDL_SetRenderDrawColor(renderer, optionBase.r, optionBase.g, optionBase.b, optionBase.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawOptionRect, 14, kRightRoundedCorners);
-            SDL_SetRenderDrawColor(renderer, optionBorder.r, optionBorder.g, optionBorder.b, optionBorder.a);
-            colony::drawing::RenderRoundedRect(renderer, drawOptionRect, 14, kRightRoundedCorners);
-
-            const int indicatorWidth = Scale(6);
-            SDL_Rect indicatorRect{optionRect.x, optionRect.y, indicatorWidth, optionRect.h};
-            SDL_Rect drawIndicatorRect = offsetRect(indicatorRect);
-            SDL_Color indicatorColor = isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
-            SDL_SetRenderDrawColor(renderer, indicatorColor.r, indicatorColor.g, indicatorColor.b, indicatorColor.a);
-            SDL_RenderFillRect(renderer, &drawIndicatorRect);
-
-            const int optionPadding = Scale(20);
-            int optionContentX = optionRect.x + optionPadding + indicatorWidth;
-            int optionContentY = optionRect.y + optionPadding - Scale(4);
-            if (option.label.texture)
-            {
-                SDL_Rect labelRect{optionContentX, optionContentY, option.label.width, option.label.height};
-                colony::RenderTexture(renderer, option.label, offsetRect(labelRect));
-                optionContentY += option.label.height + Scale(10);
-            }
+            const std::uint64_t rowVersion =
+                PanelStateHash{}.Mix(isActive).Mix(optionRect.w).Mix(optionRect.h).Value();
+            drawCachedRow("theme." + option.id, drawOptionRect, rowVersion, [&] {
+                SDL_Color optionBase = isActive ? colony::color::Mix(theme.libraryCardActive, theme.heroTitle, 0.12f)
+                                                : colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
+                SDL_Color optionBorder =
+                    isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.45f);
+                SDL_SetRenderDrawColor(renderer, optionBase.r, optionBase.g, optionBase.b, optionBase.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawOptionRect, 14, kRightRoundedCorners);
+                SDL_SetRenderDrawColor(renderer, optionBorder.r, optionBorder.g, optionBorder.b, optionBorder.a);
+                colony::drawing::RenderRoundedRect(renderer, drawOptionRect, 14, kRightRoundedCorners);
+
+                const int indicatorWidth = Scale(6);
+                SDL_Rect indicatorRect{optionRect.x, optionRect.y, indicatorWidth, optionRect.h};
+                SDL_Rect drawIndicatorRect = offsetRect(indicatorRect);
+                SDL_Color indicatorColor =
+                    isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
+                SDL_SetRenderDrawColor(renderer, indicatorColor.r, indicatorColor.g, indicatorColor.b, indicatorColor.a);
+                SDL_RenderFillRect(renderer, &drawIndicatorRect);
+
+                const int optionPadding = Scale(20);
+                int optionContentX = optionRect.x + optionPadding + indicatorWidth;
+                int optionContentY = optionRect.y + optionPadding - Scale(4);
+                if (option.label.texture)
+                {
+                    SDL_Rect labelRect{optionContentX, optionContentY, option.label.width, option.label.height};
+                    colony::RenderTexture(renderer, option.label, offsetRect(labelRect));
+                    optionContentY += option.label.height + Scale(10);
+                }
 
-            int swatchX = optionRect.x + optionPadding + indicatorWidth;
-            const int swatchHeight = Scale(14);
-            const int swatchSpacing = Scale(8);
-            for (const SDL_Color& swatchColor : option.swatch)
-            {
-                SDL_Rect swatchRect{swatchX, optionContentY, Scale(34), swatchHeight};
-                SDL_Rect drawSwatchRect = offsetRect(swatchRect);
-                SDL_SetRenderDrawColor(renderer, swatchColor.r, swatchColor.g, swatchColor.b, swatchColor.a);
-                colony::drawing::RenderFilledRoundedRect(renderer, drawSwatchRect, swatchHeight / 2);
-                SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
-                colony::drawing::RenderRoundedRect(renderer, drawSwatchRect, swatchHeight / 2);
-                swatchX += Scale(34) + swatchSpacing;
-            }
+                int swatchX = optionRect.x + optionPadding + indicatorWidth;
+                const int swatchHeight = Scale(14);
+                const int swatchSpacing = Scale(8);
+                for (const SDL_Color& swatchColor : option.swatch)
+                {
+                    SDL_Rect swatchRect{swatchX, optionContentY, Scale(34), swatchHeight};
+                    SDL_Rect drawSwatchRect = offsetRect(swatchRect);
+                    SDL_SetRenderDrawColor(renderer, swatchColor.r, swatchColor.g, swatchColor.b, swatchColor.a);
+                    colony::drawing::RenderFilledRoundedRect(renderer, drawSwatchRect, swatchHeight / 2);
+                    SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
+                    colony::drawing::RenderRoundedRect(renderer, drawSwatchRect, swatchHeight / 2);
+                    swatchX += Scale(34) + swatchSpacing;
+                }
 
-            if (isActive)
-            {
-                const int badgeSize = Scale(26);
-                SDL_Rect badgeRect{
-                    optionRect.x + optionRect.w - badgeSize - optionPadding,
-                    optionRect.y + (optionRect.h - badgeSize) / 2,
-                    badgeSize,
-                    badgeSize};
-                SDL_Rect drawBadgeRect = offsetRect(badgeRect);
-                SDL_SetRenderDrawColor(renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
-                colony::drawing::RenderFilledRoundedRect(renderer, drawBadgeRect, badgeSize / 2);
-
-                SDL_SetRenderDrawColor(renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
-                const int checkStartX = drawBadgeRect.x + Scale(7);
-                const int checkStartY = drawBadgeRect.y + badgeRect.h / 2;
-                const int checkMidX = checkStartX + Scale(5);
-                const int checkMidY = checkStartY + Scale(4);
-                const int checkEndX = drawBadgeRect.x + badgeRect.w - Scale(5);
-                const int checkEndY = drawBadgeRect.y + Scale(8);
-                SDL_RenderDrawLine(renderer, checkStartX, checkStartY, checkMidX, checkMidY);
-                SDL_RenderDrawLine(renderer, checkMidX, checkMidY, checkEndX, checkEndY);
-            }
+                if (isActive)
+                {
+                    const int badgeSize = Scale(26);
+                    SDL_Rect badgeRect{
+                        optionRect.x + optionRect.w - badgeSize - optionPadding,
+                        optionRect.y + (optionRect.h - badgeSize) / 2,
+                        badgeSize,
+                        badgeSize};
+                    SDL_Rect drawBadgeRect = offsetRect(badgeRect);
+                    SDL_SetRenderDrawColor(
+                        renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
+                    colony::drawing::RenderFilledRoundedRect(renderer, drawBadgeRect, badgeSize / 2);
+
+                    SDL_SetRenderDrawColor(
+                        renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
+                    const int checkStartX = drawBadgeRect.x + Scale(7);
+                    const int checkStartY = drawBadgeRect.y + badgeRect.h / 2;
+                    const int checkMidX = checkStartX + Scale(5);
+                    const int checkMidY = checkStartY + Scale(4);
+                    const int checkEndX = drawBadgeRect.x + badgeRect.w - Scale(5);
+                    const int checkEndY = drawBadgeRect.y + Scale(8);
+                    SDL_RenderDrawLine(renderer, checkStartX, checkStartY, checkMidX, checkMidY);
+                    SDL_RenderDrawLine(renderer, checkMidX, checkMidY, checkEndX, checkEndY);
+                }
+            });
 
             addInteractiveRegion(option.id, RenderResult::InteractionType::ThemeSelection, offsetRect(optionRect));
 
@@ -356,57 +400,61 @@ SettingsPanel::RenderResult SettingsPanel::Render(
         addThemeButtonRect_ = addButtonRect;
 
         SDL_Rect drawAddButtonRect = offsetRect(addButtonRect);
-        SDL_Color addFill = colony::color::Mix(theme.libraryCardActive, theme.background, 0.35f);
-        SDL_Color addBorder = colony::color::Mix(theme.border, theme.libraryCardActive, 0.5f);
-        SDL_SetRenderDrawColor(renderer, addFill.r, addFill.g, addFill.b, addFill.a);
-        colony::drawing::RenderFilledRoundedRect(renderer, drawAddButtonRect, 16);
-        SDL_SetRenderDrawColor(renderer, addBorder.r, addBorder.g, addBorder.b, addBorder.a);
-        colony::drawing::RenderRoundedRect(renderer, drawAddButtonRect, 16);
-
-        SDL_Rect iconRect{
-            addButtonRect.x + Scale(22),
-            addButtonRect.y + (addButtonRect.h - iconSize) / 2,
-            iconSize,
-            iconSize};
-        SDL_Rect drawIconRect = offsetRect(iconRect);
-        SDL_Color iconColor = theme.heroTitle;
-        SDL_SetRenderDrawColor(renderer, iconColor.r, iconColor.g, iconColor.b, iconColor.a);
-        const int iconCenterX = drawIconRect.x + drawIconRect.w / 2;
-        const int iconCenterY = drawIconRect.y + drawIconRect.h / 2;
-        SDL_RenderDrawLine(
-            renderer,
-            iconCenterX - iconRect.w / 2 + Scale(4),
-            iconCenterY,
-            iconCenterX + iconRect.w / 2 - Scale(4),
-            iconCenterY);
-        SDL_RenderDrawLine(
-            renderer,
-            iconCenterX,
-            iconCenterY - iconRect.h / 2 + Scale(4),
-            iconCenterX,
-            iconCenterY + iconRect.h / 2 - Scale(4));
-
-        int buttonTextX = addButtonRect.x + Scale(22) + iconRect.w + Scale(18);
-        int buttonTextY = addButtonRect.y + addButtonPaddingY;
-        if (addThemeButtonLabel_.texture)
-        {
-            SDL_Rect labelRect{buttonTextX, buttonTextY, addThemeButtonLabel_.width, addThemeButtonLabel_.height};
-            colony::RenderTexture(renderer, addThemeButtonLabel_, offsetRect(labelRect));
-            buttonTextY += addThemeButtonLabel_.height;
+        const std::uint64_t addButtonVersion =
+            PanelStateHash{}.Mix(addButtonRect.w).Mix(addButtonRect.h).Value();
+        drawCachedRow("appearance.add_theme", drawAddButtonRect, addButtonVersion, [&] {
+            SDL_Color addFill = colony::color::Mix(theme.libraryCardActive, theme.background, 0.35f);
+            SDL_Color addBorder = colony::color::Mix(theme.border, theme.libraryCardActive, 0.5f);
+            SDL_SetRenderDrawColor(renderer, addFill.r, addFill.g, addFill.b, addFill.a);
+            colony::drawing::RenderFilledRoundedRect(renderer, drawAddButtonRect, 16);
+            SDL_SetRenderDrawColor(renderer, addBorder.r, addBorder.g, addBorder.b, addBorder.a);
+            colony::drawing::RenderRoundedRect(renderer, drawAddButtonRect, 16);
+
+            SDL_Rect iconRect{
+                addButtonRect.x + Scale(22),
+                addButtonRect.y + (addButtonRect.h - iconSize) / 2,
+                iconSize,
+                iconSize};
+            SDL_Rect drawIconRect = offsetRect(iconRect);
+            SDL_Color iconColor = theme.heroTitle;
+            SDL_SetRenderDrawColor(renderer, iconColor.r, iconColor.g, iconColor.b, iconColor.a);
+            const int iconCenterX = drawIconRect.x + drawIconRect.w / 2;
+            const int iconCenterY = drawIconRect.y + drawIconRect.h / 2;
+            SDL_RenderDrawLine(
+                renderer,
+                iconCenterX - iconRect.w / 2 + Scale(4),
+                iconCenterY,
+                iconCenterX + iconRect.w / 2 - Scale(4),
+                iconCenterY);
+            SDL_RenderDrawLine(
+                renderer,
+                iconCenterX,
+                iconCenterY - iconRect.h / 2 + Scale(4),
+                iconCenterX,
+                iconCenterY + iconRect.h / 2 - Scale(4));
+
+            int buttonTextX = addButtonRect.x + Scale(22) + iconRect.w + Scale(18);
+            int buttonTextY = addButtonRect.y + addButtonPaddingY;
+            if (addThemeButtonLabel_.texture)
+            {
+                SDL_Rect labelRect{buttonTextX, buttonTextY, addThemeButtonLabel_.width, addThemeButtonLabel_.height};
+                colony::RenderTexture(renderer, addThemeButtonLabel_, offsetRect(labelRect));
+                buttonTextY += addThemeButtonLabel_.height;
+                if (addThemeButtonDescription_.texture)
+                {
+                    buttonTextY += labelSpacing;
+                }
+            }
             if (addThemeButtonDescription_.texture)
             {
-                buttonTextY += labelSpacing;
+                SDL_Rect descriptionRect{
+                    buttonTextX,
+                    buttonTextY,
+                    addThemeButtonDescription_.width,
+                    addThemeButtonDescription_.height};
+                colony::RenderTexture(renderer, addThemeButtonDescription_, offsetRect(descriptionRect));
             }
-        }
-        if (addThemeButtonDescription_.texture)
-        {
-            SDL_Rect descriptionRect{
-                buttonTextX,
-                buttonTextY,
-                addThemeButtonDescription_.width,
-                addThemeButtonDescription_.height};
-            colony::RenderTexture(renderer, addThemeButtonDescription_, offsetRect(descriptionRect));
-        }
+        });
 
         addInteractiveRegion(
             "settings.appearance.custom_theme.create",
@@ -462,24 +510,15 @@ SettingsPanel::RenderResult SettingsPanel::Render(
 
             SDL_Rect cardRect{bounds.x + horizontalPadding, cursorY, availableWidth, cardHeight};
             SDL_Rect drawCardRect = offsetRect(cardRect);
-            SDL_Color cardBase = colony::color::Mix(theme.libraryCard, theme.background, 0.35f);
-            SDL_SetRenderDrawColor(renderer, cardBase.r, cardBase.g, cardBase.b, cardBase.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawCardRect, 18, kRightRoundedCorners);
-            SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
-            colony::drawing::RenderRoundedRect(renderer, drawCardRect, 18, kRightRoundedCorners);
-
-            SDL_Rect accentRect{cardRect.x, cardRect.y, accentWidth, cardRect.h};
-            SDL_Rect drawAccentRect = offsetRect(accentRect);
-            SDL_SetRenderDrawColor(renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
-            SDL_RenderFillRect(renderer, &drawAccentRect);
 
+            // Layout runs outside the cached draw so the slider hitbox is
+            // registered even when the row texture is reused unchanged.
             const int contentX = cardRect.x + contentPadding + accentWidth;
             int contentY = cardRect.y + topPadding;
+            const int labelY = contentY;
             if (customization.label.texture)
             {
-                SDL_Rect labelRect{contentX, contentY, customization.label.width, customization.label.height};
-                colony::RenderTexture(renderer, customization.label, offsetRect(labelRect));
-                contentY += labelRect.h;
+                contentY += customization.label.height;
                 if (customization.description.texture)
                 {
                     contentY += labelSpacing;
@@ -490,11 +529,10 @@ SettingsPanel::RenderResult SettingsPanel::Render(
                 }
             }
 
+            const int descriptionY = contentY;
             if (customization.description.texture)
             {
-                SDL_Rect descriptionRect{contentX, contentY, customization.description.width, customization.description.height};
-                colony::RenderTexture(renderer, customization.description, offsetRect(descriptionRect));
-                contentY += descriptionRect.h + descriptionSpacing;
+                contentY += customization.description.height + descriptionSpacing;
             }
             else if (!customization.label.texture)
             {
@@ -507,10 +545,6 @@ SettingsPanel::RenderResult SettingsPanel::Render(
                 contentY + (knobSize - sliderHeight) / 2,
                 sliderWidth,
                 sliderHeight};
-            SDL_Rect drawSliderRect = offsetRect(sliderRect);
-            SDL_Color trackColor = colony::color::Mix(theme.muted, theme.libraryCard, 0.5f);
-            SDL_SetRenderDrawColor(renderer, trackColor.r, trackColor.g, trackColor.b, trackColor.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawSliderRect, sliderHeight / 2);
 
             const int knobTravel = std::max(0, sliderRect.w - knobSize);
             float sliderValue = 0.5f;
@@ -527,11 +561,48 @@ SettingsPanel::RenderResult SettingsPanel::Render(
                 sliderRect.y - (knobSize - sliderHeight) / 2,
                 knobSize,
                 knobSize};
-            SDL_Rect drawKnobRect = offsetRect(knobRect);
-            SDL_SetRenderDrawColor(renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawKnobRect, knobSize / 2);
-            SDL_SetRenderDrawColor(renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
-            colony::drawing::RenderRoundedRect(renderer, drawKnobRect, knobSize / 2);
+
+            const std::uint64_t rowVersion =
+                PanelStateHash{}.Mix(cardRect.w).Mix(cardRect.h).Mix(knobOffset).Value();
+            drawCachedRow("customization." + customization.id, drawCardRect, rowVersion, [&] {
+                SDL_Color cardBase = colony::color::Mix(theme.libraryCard, theme.background, 0.35f);
+                SDL_SetRenderDrawColor(renderer, cardBase.r, cardBase.g, cardBase.b, cardBase.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawCardRect, 18, kRightRoundedCorners);
+                SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
+                colony::drawing::RenderRoundedRect(renderer, drawCardRect, 18, kRightRoundedCorners);
+
+                SDL_Rect accentRect{cardRect.x, cardRect.y, accentWidth, cardRect.h};
+                SDL_Rect drawAccentRect = offsetRect(accentRect);
+                SDL_SetRenderDrawColor(
+                    renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
+                SDL_RenderFillRect(renderer, &drawAccentRect);
+
+                if (customization.label.texture)
+                {
+                    SDL_Rect labelRect{contentX, labelY, customization.label.width, customization.label.height};
+                    colony::RenderTexture(renderer, customization.label, offsetRect(labelRect));
+                }
+
+                if (customization.description.texture)
+                {
+                    SDL_Rect descriptionRect{
+                        contentX, descriptionY, customization.description.width, customization.description.height};
+                    colony::RenderTexture(renderer, customization.description, offsetRect(descriptionRect));
+                }
+
+                SDL_Rect drawSliderRect = offsetRect(sliderRect);
+                SDL_Color trackColor = colony::color::Mix(theme.muted, theme.libraryCard, 0.5f);
+                SDL_SetRenderDrawColor(renderer, trackColor.r, trackColor.g, trackColor.b, trackColor.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawSliderRect, sliderHeight / 2);
+
+                SDL_Rect drawKnobRect = offsetRect(knobRect);
+                SDL_SetRenderDrawColor(
+                    renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawKnobRect, knobSize / 2);
+                SDL_SetRenderDrawColor(
+                    renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
+                colony::drawing::RenderRoundedRect(renderer, drawKnobRect, knobSize / 2);
+            });
 
             SDL_Rect interactionRect{
                 sliderRect.x,
@@ -563,59 +634,67 @@ SettingsPanel::RenderResult SettingsPanel::Render(
             SDL_Rect logicalCardRect{bounds.x + horizontalPadding, cursorY, availableWidth, languageCardHeight};
             SDL_Rect cardRect = offsetRect(logicalCardRect);
             const bool isActive = language.id == activeLanguageId;
-            const SDL_Color baseColor = isActive
-                ? colony::color::Mix(theme.libraryCardActive, theme.heroTitle, 0.08f)
-                : colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
-            const SDL_Color borderColor = isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.4f);
-
-            SDL_SetRenderDrawColor(renderer, baseColor.r, baseColor.g, baseColor.b, baseColor.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, cardRect, 18, kRightRoundedCorners);
-            SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-            colony::drawing::RenderRoundedRect(renderer, cardRect, 18, kRightRoundedCorners);
-
-            const int accentWidth = Scale(6);
-            SDL_Rect accentRect{logicalCardRect.x, logicalCardRect.y, accentWidth, logicalCardRect.h};
-            SDL_Rect drawAccentRect = offsetRect(accentRect);
-            const SDL_Color accentColor = isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
-            SDL_SetRenderDrawColor(renderer, accentColor.r, accentColor.g, accentColor.b, accentColor.a);
-            SDL_RenderFillRect(renderer, &drawAccentRect);
-
-            const int contentX = logicalCardRect.x + Scale(22);
-            int contentY = logicalCardRect.y + Scale(18);
-            if (language.name.texture)
-            {
-                SDL_Rect nameRect{contentX, contentY, language.name.width, language.name.height};
-                colony::RenderTexture(renderer, language.name, offsetRect(nameRect));
-                contentY += language.name.height + Scale(6);
-            }
+            const std::uint64_t rowVersion =
+                PanelStateHash{}.Mix(isActive).Mix(logicalCardRect.w).Mix(logicalCardRect.h).Value();
+            drawCachedRow("language." + language.id, cardRect, rowVersion, [&] {
+                const SDL_Color baseColor = isActive
+                    ? colony::color::Mix(theme.libraryCardActive, theme.heroTitle, 0.08f)
+                    : colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
+                const SDL_Color borderColor =
+                    isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.4f);
+
+                SDL_SetRenderDrawColor(renderer, baseColor.r, baseColor.g, baseColor.b, baseColor.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, cardRect, 18, kRightRoundedCorners);
+                SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+                colony::drawing::RenderRoundedRect(renderer, cardRect, 18, kRightRoundedCorners);
+
+                const int accentWidth = Scale(6);
+                SDL_Rect accentRect{logicalCardRect.x, logicalCardRect.y, accentWidth, logicalCardRect.h};
+                SDL_Rect drawAccentRect = offsetRect(accentRect);
+                const SDL_Color accentColor =
+                    isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
+                SDL_SetRenderDrawColor(renderer, accentColor.r, accentColor.g, accentColor.b, accentColor.a);
+                SDL_RenderFillRect(renderer, &drawAccentRect);
+
+                const int contentX = logicalCardRect.x + Scale(22);
+                int contentY = logicalCardRect.y + Scale(18);
+                if (language.name.texture)
+                {
+                    SDL_Rect nameRect{contentX, contentY, language.name.width, language.name.height};
+                    colony::RenderTexture(renderer, language.name, offsetRect(nameRect));
+                    contentY += language.name.height + Scale(6);
+                }
 
-            if (language.nativeName.texture)
-            {
-                SDL_Rect nativeRect{contentX, contentY, language.nativeName.width, language.nativeName.height};
-                colony::RenderTexture(renderer, language.nativeName, offsetRect(nativeRect));
-            }
+                if (language.nativeName.texture)
+                {
+                    SDL_Rect nativeRect{contentX, contentY, language.nativeName.width, language.nativeName.height};
+                    colony::RenderTexture(renderer, language.nativeName, offsetRect(nativeRect));
+                }
 
-            const int radioSize = Scale(28);
-            SDL_Rect radioRect{
-                logicalCardRect.x + logicalCardRect.w - radioSize - Scale(24),
-                logicalCardRect.y + (logicalCardRect.h - radioSize) / 2,
-                radioSize,
-                radioSize};
-            SDL_Rect drawRadioRect = offsetRect(radioRect);
-            const SDL_Color radioBorder = isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
-            SDL_SetRenderDrawColor(renderer, radioBorder.r, radioBorder.g, radioBorder.b, radioBorder.a);
-            colony::drawing::RenderRoundedRect(renderer, drawRadioRect, radioSize / 2);
-            if (isActive)
-            {
-                SDL_Rect innerRect{
-                    radioRect.x + Scale(6),
-                    radioRect.y + Scale(6),
-                    radioRect.w - Scale(12),
-                    radioRect.h - Scale(12)};
-                SDL_Rect drawInnerRect = offsetRect(innerRect);
-                SDL_SetRenderDrawColor(renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
-                colony::drawing::RenderFilledRoundedRect(renderer, drawInnerRect, drawInnerRect.w / 2);
-            }
+                const int radioSize = Scale(28);
+                SDL_Rect radioRect{
+                    logicalCardRect.x + logicalCardRect.w - radioSize - Scale(24),
+                    logicalCardRect.y + (logicalCardRect.h - radioSize) / 2,
+                    radioSize,
+                    radioSize};
+                SDL_Rect drawRadioRect = offsetRect(radioRect);
+                const SDL_Color radioBorder =
+                    isActive ? theme.heroTitle : colony::color::Mix(theme.border, theme.libraryCard, 0.5f);
+                SDL_SetRenderDrawColor(renderer, radioBorder.r, radioBorder.g, radioBorder.b, radioBorder.a);
+                colony::drawing::RenderRoundedRect(renderer, drawRadioRect, radioSize / 2);
+                if (isActive)
+                {
+                    SDL_Rect innerRect{
+                        radioRect.x + Scale(6),
+                        radioRect.y + Scale(6),
+                        radioRect.w - Scale(12),
+                        radioRect.h - Scale(12)};
+                    SDL_Rect drawInnerRect = offsetRect(innerRect);
+                    SDL_SetRenderDrawColor(
+                        renderer, theme.heroTitle.r, theme.heroTitle.g, theme.heroTitle.b, theme.heroTitle.a);
+                    colony::drawing::RenderFilledRoundedRect(renderer, drawInnerRect, drawInnerRect.w / 2);
+                }
+            });
 
             addInteractiveRegion(language.id, RenderResult::InteractionType::LanguageSelection, cardRect);
 
@@ -639,26 +718,6 @@ SettingsPanel::RenderResult SettingsPanel::Render(
         {
             SDL_Rect logicalCardRect{bounds.x + horizontalPadding, cursorY, availableWidth, toggleCardHeight};
             SDL_Rect cardRect = offsetRect(logicalCardRect);
-            SDL_Color toggleBase = colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
-            SDL_SetRenderDrawColor(renderer, toggleBase.r, toggleBase.g, toggleBase.b, toggleBase.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, cardRect, 20);
-            SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
-            colony::drawing::RenderRoundedRect(renderer, cardRect, 20);
-
-            const int contentX = logicalCardRect.x + Scale(22);
-            int contentY = logicalCardRect.y + Scale(18);
-            if (toggle.label.texture)
-            {
-                SDL_Rect labelRect{contentX, contentY, toggle.label.width, toggle.label.height};
-                colony::RenderTexture(renderer, toggle.label, offsetRect(labelRect));
-                contentY += toggle.label.height + Scale(6);
-            }
-
-            if (toggle.description.texture)
-            {
-                SDL_Rect descriptionRect{contentX, contentY, toggle.description.width, toggle.description.height};
-                colony::RenderTexture(renderer, toggle.description, offsetRect(descriptionRect));
-            }
 
             const int switchWidth = Scale(64);
             const int switchHeight = Scale(30);
@@ -668,25 +727,53 @@ SettingsPanel::RenderResult SettingsPanel::Render(
                 switchWidth,
                 switchHeight};
             SDL_Rect drawSwitchRect = offsetRect(switchRect);
+            const auto toggleId = BasicToggleSettings::FromKey(toggle.id);
+            const bool isEnabled = toggleId.has_value() && toggleStates.Get(*toggleId);
+
+            const std::uint64_t rowVersion =
+                PanelStateHash{}.Mix(isEnabled).Mix(logicalCardRect.w).Mix(logicalCardRect.h).Value();
+            drawCachedRow("toggle." + toggle.id, cardRect, rowVersion, [&] {
+                SDL_Color toggleBase = colony::color::Mix(theme.libraryCard, theme.background, 0.4f);
+                SDL_SetRenderDrawColor(renderer, toggleBase.r, toggleBase.g, toggleBase.b, toggleBase.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, cardRect, 20);
+                SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
+                colony::drawing::RenderRoundedRect(renderer, cardRect, 20);
 
-            const bool isEnabled = toggleStates.contains(toggle.id) ? toggleStates.at(toggle.id) : false;
-            SDL_Color trackColor = isEnabled ? theme.heroTitle : colony::color::Mix(theme.muted, theme.libraryCard, 0.55f);
-            SDL_SetRenderDrawColor(renderer, trackColor.r, trackColor.g, trackColor.b, trackColor.a);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawSwitchRect, switchHeight / 2);
-            SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
-            colony::drawing::RenderRoundedRect(renderer, drawSwitchRect, switchHeight / 2);
-
-            const int handleSize = switchHeight - Scale(8);
-            SDL_Rect handleRect{
-                isEnabled ? switchRect.x + switchRect.w - handleSize - Scale(4) : switchRect.x + Scale(4),
-                switchRect.y + Scale(4),
-                handleSize,
-                handleSize};
-            SDL_Rect drawHandleRect = offsetRect(handleRect);
-            SDL_SetRenderDrawColor(renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
-            colony::drawing::RenderFilledRoundedRect(renderer, drawHandleRect, handleSize / 2);
-            SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
-            colony::drawing::RenderRoundedRect(renderer, drawHandleRect, handleSize / 2);
+                const int contentX = logicalCardRect.x + Scale(22);
+                int contentY = logicalCardRect.y + Scale(18);
+                if (toggle.label.texture)
+                {
+                    SDL_Rect labelRect{contentX, contentY, toggle.label.width, toggle.label.height};
+                    colony::RenderTexture(renderer, toggle.label, offsetRect(labelRect));
+                    contentY += toggle.label.height + Scale(6);
+                }
+
+                if (toggle.description.texture)
+                {
+                    SDL_Rect descriptionRect{contentX, contentY, toggle.description.width, toggle.description.height};
+                    colony::RenderTexture(renderer, toggle.description, offsetRect(descriptionRect));
+                }
+
+                SDL_Color trackColor =
+                    isEnabled ? theme.heroTitle : colony::color::Mix(theme.muted, theme.libraryCard, 0.55f);
+                SDL_SetRenderDrawColor(renderer, trackColor.r, trackColor.g, trackColor.b, trackColor.a);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawSwitchRect, switchHeight / 2);
+                SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
+                colony::drawing::RenderRoundedRect(renderer, drawSwitchRect, switchHeight / 2);
+
+                const int handleSize = switchHeight - Scale(8);
+                SDL_Rect handleRect{
+                    isEnabled ? switchRect.x + switchRect.w - handleSize - Scale(4) : switchRect.x + Scale(4),
+                    switchRect.y + Scale(4),
+                    handleSize,
+                    handleSize};
+                SDL_Rect drawHandleRect = offsetRect(handleRect);
+                SDL_SetRenderDrawColor(
+                    renderer, theme.background.r, theme.background.g, theme.background.b, SDL_ALPHA_OPAQUE);
+                colony::drawing::RenderFilledRoundedRect(renderer, drawHandleRect, handleSize / 2);
+                SDL_SetRenderDrawColor(renderer, theme.border.r, theme.border.g, theme.border.b, theme.border.a);
+                colony::drawing::RenderRoundedRect(renderer, drawHandleRect, handleSize / 2);
+            });
 
             addInteractiveRegion(toggle.id, RenderResult::InteractionType::Toggle, drawSwitchRect);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ui/panel_cache.hpp"
 #include "ui/theme.hpp"
 #include "utils/text.hpp"
 
@@ -12,6 +13,8 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+
+#include "ui/basic_settings.hpp"
 #include <utility>
 #include <vector>
 
@@ -81,7 +84,7 @@ class SettingsPanel
         std::string_view activeSchemeId,
         std::string_view activeLanguageId,
         const SectionStates& sectionStates,
-        const std::unordered_map<std::string, bool>& toggleStates,
+        const BasicToggleSettings& toggleStates,
         const std::unordered_map<std::string, float>& customizationValues) const;
 
   private:
@@ -129,6 +132,12 @@ class SettingsPanel
     std::vector<LanguageOption> languages_;
     std::vector<ToggleOption> toggles_;
     std::vector<CustomizationOption> appearanceCustomizations_;
+
+    // Retained row textures keyed by row id. Build() clears the map, which
+    // covers theme and language rebuilds; per-row state (active selection,
+    // toggle position, slider value) is folded into each row's version hash,
+    // so flipping one toggle re-rasterizes just that row.
+    mutable std::unordered_map<std::string, RowTargetCache> rowCaches_;
 };
 
 } // namespace colony::ui
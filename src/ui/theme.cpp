@@ -1,15 +1,76 @@
 #include "ui/theme.hpp"
 
-#include "utils/color.hpp"
-
 #include <algorithm>
-#include <cmath>
+#include <array>
+#include <string_view>
 
 namespace colony::ui
 {
 namespace
 {
-ThemeColors MakeTheme(
+// The built-in schemes are fully known at compile time, so every color below
+// is parsed and mixed by constexpr mirrors of the colony::color helpers and
+// the resulting tables live in .rodata: startup does no hex parsing and no
+// per-scheme color math, and the pages are shared across processes.
+//
+// MixColor must stay in lockstep with colony::color::Mix so custom schemes
+// (which still go through ApplyDefaults at runtime) derive identical
+// interaction colors.
+
+constexpr int HexDigitToInt(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return 10 + (c - 'a');
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return 10 + (c - 'A');
+    }
+    return -1;
+}
+
+// Compile-time parse of the "#RRGGBB" literals used by the tables below.
+// Anything else (which would be a typo in this file) yields opaque white,
+// matching colony::color::ParseHexColor's fallback.
+constexpr SDL_Color Hex(std::string_view hex)
+{
+    if (!hex.empty() && hex.front() == '#')
+    {
+        hex.remove_prefix(1);
+    }
+    if (hex.size() != 6)
+    {
+        return SDL_Color{255, 255, 255, SDL_ALPHA_OPAQUE};
+    }
+    Uint8 channels[3] = {};
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        const int high = HexDigitToInt(hex[static_cast<std::size_t>(channel) * 2]);
+        const int low = HexDigitToInt(hex[static_cast<std::size_t>(channel) * 2 + 1]);
+        if (high < 0 || low < 0)
+        {
+            return SDL_Color{255, 255, 255, SDL_ALPHA_OPAQUE};
+        }
+        channels[channel] = static_cast<Uint8>((high << 4) | low);
+    }
+    return SDL_Color{channels[0], channels[1], channels[2], SDL_ALPHA_OPAQUE};
+}
+
+constexpr SDL_Color MixColor(const SDL_Color& a, const SDL_Color& b, float t)
+{
+    t = std::clamp(t, 0.0f, 1.0f);
+    const auto blend = [&](Uint8 componentA, Uint8 componentB) {
+        return static_cast<Uint8>(componentA + static_cast<int>((componentB - componentA) * t));
+    };
+    return SDL_Color{blend(a.r, b.r), blend(a.g, b.g), blend(a.b, b.b), blend(a.a, b.a)};
+}
+
+constexpr ThemeColors MakeTheme(
     std::string_view background,
     std::string_view nav,
     std::string_view library,
@@ -29,34 +90,34 @@ ThemeColors MakeTheme(
 {
     ThemeColors colors{};
 
-    const SDL_Color backgroundColor = colony::color::ParseHexColor(background);
-    const SDL_Color navColor = colony::color::ParseHexColor(nav);
-    const SDL_Color libraryColor = colony::color::ParseHexColor(library);
-    const SDL_Color cardColor = colony::color::ParseHexColor(card);
-    const SDL_Color cardHoverColor = colony::color::ParseHexColor(cardHover);
-    const SDL_Color cardActiveColor = colony::color::ParseHexColor(cardActive);
-    const SDL_Color navTextColor = colony::color::ParseHexColor(navText);
-    const SDL_Color heroTitleColor = colony::color::ParseHexColor(heroTitle);
-    const SDL_Color heroBodyColor = colony::color::ParseHexColor(heroBody);
-    const SDL_Color mutedColor = colony::color::ParseHexColor(muted);
-    const SDL_Color borderColor = colony::color::ParseHexColor(border);
-    const SDL_Color statusBarColor = colony::color::ParseHexColor(statusBar);
-    const SDL_Color statusBarTextColor = colony::color::ParseHexColor(statusBarText);
-    const SDL_Color channelBadgeColor = colony::color::ParseHexColor(channelBadge);
-    const SDL_Color gradientStartColor = colony::color::ParseHexColor(gradientStart);
-    const SDL_Color gradientEndColor = colony::color::ParseHexColor(gradientEnd);
+    const SDL_Color backgroundColor = Hex(background);
+    const SDL_Color navColor = Hex(nav);
+    const SDL_Color libraryColor = Hex(library);
+    const SDL_Color cardColor = Hex(card);
+    const SDL_Color cardHoverColor = Hex(cardHover);
+    const SDL_Color cardActiveColor = Hex(cardActive);
+    const SDL_Color navTextColor = Hex(navText);
+    const SDL_Color heroTitleColor = Hex(heroTitle);
+    const SDL_Color heroBodyColor = Hex(heroBody);
+    const SDL_Color mutedColor = Hex(muted);
+    const SDL_Color borderColor = Hex(border);
+    const SDL_Color statusBarColor = Hex(statusBar);
+    const SDL_Color statusBarTextColor = Hex(statusBarText);
+    const SDL_Color channelBadgeColor = Hex(channelBadge);
+    const SDL_Color gradientStartColor = Hex(gradientStart);
+    const SDL_Color gradientEndColor = Hex(gradientEnd);
 
     colors.background = backgroundColor;
     colors.navRail = navColor;
-    colors.surface = colony::color::Mix(libraryColor, backgroundColor, 0.55f);
-    colors.surfaceAlt = colony::color::Mix(navColor, backgroundColor, 0.4f);
-    colors.elevatedSurface = colony::color::Mix(cardActiveColor, backgroundColor, 0.35f);
+    colors.surface = MixColor(libraryColor, backgroundColor, 0.55f);
+    colors.surfaceAlt = MixColor(navColor, backgroundColor, 0.4f);
+    colors.elevatedSurface = MixColor(cardActiveColor, backgroundColor, 0.35f);
     colors.card = cardColor;
     colors.cardHover = cardHoverColor;
     colors.cardActive = cardActiveColor;
-    colors.divider = colony::color::Mix(borderColor, backgroundColor, 0.45f);
+    colors.divider = MixColor(borderColor, backgroundColor, 0.45f);
     colors.navText = navTextColor;
-    colors.navTextMuted = colony::color::Mix(navTextColor, mutedColor, 0.6f);
+    colors.navTextMuted = MixColor(navTextColor, mutedColor, 0.6f);
     colors.heroTitle = heroTitleColor;
     colors.heroBody = heroBodyColor;
     colors.muted = mutedColor;
@@ -64,20 +125,20 @@ ThemeColors MakeTheme(
     colors.statusBar = statusBarColor;
     colors.statusBarText = statusBarTextColor;
     colors.channelBadge = channelBadgeColor;
-    colors.chipBackground = colony::color::Mix(cardHoverColor, backgroundColor, 0.65f);
-    colors.inputBackground = colony::color::Mix(cardColor, libraryColor, 0.6f);
-    colors.inputBorder = colony::color::Mix(borderColor, cardActiveColor, 0.45f);
-    colors.inputPlaceholder = colony::color::Mix(mutedColor, heroBodyColor, 0.55f);
-    colors.buttonPrimary = colony::color::Mix(channelBadgeColor, heroTitleColor, 0.1f);
-    colors.buttonPrimaryHover = colony::color::Mix(colors.buttonPrimary, heroTitleColor, 0.28f);
-    colors.buttonPrimaryActive = colony::color::Mix(colors.buttonPrimary, heroBodyColor, 0.35f);
-    colors.buttonGhost = colony::color::Mix(cardColor, backgroundColor, 0.38f);
-    colors.buttonGhostHover = colony::color::Mix(cardHoverColor, backgroundColor, 0.38f);
-    colors.focusRing = colony::color::Mix(channelBadgeColor, heroTitleColor, 0.28f);
-    colors.success = colony::color::Mix(channelBadgeColor, SDL_Color{68, 214, 163, SDL_ALPHA_OPAQUE}, 0.55f);
-    colors.warning = colony::color::Mix(channelBadgeColor, SDL_Color{255, 190, 118, SDL_ALPHA_OPAQUE}, 0.65f);
-    colors.info = colony::color::Mix(channelBadgeColor, SDL_Color{109, 207, 246, SDL_ALPHA_OPAQUE}, 0.45f);
-    colors.overlay = colony::color::Mix(backgroundColor, heroTitleColor, 0.82f);
+    colors.chipBackground = MixColor(cardHoverColor, backgroundColor, 0.65f);
+    colors.inputBackground = MixColor(cardColor, libraryColor, 0.6f);
+    colors.inputBorder = MixColor(borderColor, cardActiveColor, 0.45f);
+    colors.inputPlaceholder = MixColor(mutedColor, heroBodyColor, 0.55f);
+    colors.buttonPrimary = MixColor(channelBadgeColor, heroTitleColor, 0.1f);
+    colors.buttonPrimaryHover = MixColor(colors.buttonPrimary, heroTitleColor, 0.28f);
+    colors.buttonPrimaryActive = MixColor(colors.buttonPrimary, heroBodyColor, 0.35f);
+    colors.buttonGhost = MixColor(cardColor, backgroundColor, 0.38f);
+    colors.buttonGhostHover = MixColor(cardHoverColor, backgroundColor, 0.38f);
+    colors.focusRing = MixColor(channelBadgeColor, heroTitleColor, 0.28f);
+    colors.success = MixColor(channelBadgeColor, SDL_Color{68, 214, 163, SDL_ALPHA_OPAQUE}, 0.55f);
+    colors.warning = MixColor(channelBadgeColor, SDL_Color{255, 190, 118, SDL_ALPHA_OPAQUE}, 0.65f);
+    colors.info = MixColor(channelBadgeColor, SDL_Color{109, 207, 246, SDL_ALPHA_OPAQUE}, 0.45f);
+    colors.overlay = MixColor(backgroundColor, heroTitleColor, 0.82f);
     colors.overlay.a = 208;
 
     colors.libraryBackground = libraryColor;
@@ -90,18 +151,18 @@ ThemeColors MakeTheme(
     return colors;
 }
 
-InteractionColors BuildDefaultInteractions(const ThemeColors& colors)
+constexpr InteractionColors BuildDefaultInteractions(const ThemeColors& colors)
 {
     InteractionColors interactions{};
-    interactions.hover = colony::color::Mix(colors.cardHover, colors.card, 0.5f);
-    interactions.active = colony::color::Mix(colors.cardActive, colors.cardHover, 0.55f);
+    interactions.hover = MixColor(colors.cardHover, colors.card, 0.5f);
+    interactions.active = MixColor(colors.cardActive, colors.cardHover, 0.55f);
     interactions.focus = colors.focusRing;
-    interactions.subtleGlow = colony::color::Mix(colors.channelBadge, colors.buttonGhost, 0.35f);
+    interactions.subtleGlow = MixColor(colors.channelBadge, colors.buttonGhost, 0.35f);
     interactions.subtleGlow.a = 90;
     return interactions;
 }
 
-Typography BuildDefaultTypography(const ThemeColors& colors)
+constexpr Typography BuildDefaultTypography(const ThemeColors& colors)
 {
     Typography typography{};
     typography.display = TypographyStyle{48, 1.16f, colors.heroTitle};
@@ -114,7 +175,7 @@ Typography BuildDefaultTypography(const ThemeColors& colors)
     return typography;
 }
 
-MotionTimings BuildDefaultMotionTimings()
+constexpr MotionTimings BuildDefaultMotionTimings()
 {
     MotionTimings motion{};
     motion.fast = 0.14f;
@@ -143,291 +204,273 @@ void ApplyDefaults(ColorScheme& scheme)
     }
 }
 
-void AddColonySignature(std::vector<ColorScheme>& schemes)
+// A built-in scheme: ColorScheme minus the owning strings and the isCustom
+// flag, so the whole table can sit in .rodata.
+struct BuiltinScheme
 {
-    ColorScheme scheme{
-        .id = "colony_aurora",
-        .name = "Colony Aurora",
-        .colors = MakeTheme(
-            "#1E1E2A",
-            "#171824",
-            "#222437",
-            "#282B40",
-            "#2D3248",
-            "#353B55",
-            "#F6F7FF",
-            "#FFFFFF",
-            "#D5D7E6",
-            "#9CA2C6",
-            "#31364A",
-            "#181B2A",
-            "#F1F4FF",
-            "#FF9F43",
-            "#242A40",
-            "#181D30")};
-
-    scheme.colors.buttonPrimary = colony::color::ParseHexColor("#FF9F43");
-    scheme.colors.buttonPrimaryHover = colony::color::ParseHexColor("#FFB15E");
-    scheme.colors.buttonPrimaryActive = colony::color::ParseHexColor("#E9831F");
-    scheme.colors.channelBadge = scheme.colors.buttonPrimary;
-    scheme.colors.focusRing = colony::color::ParseHexColor("#FFB56A");
-    scheme.colors.success = colony::color::ParseHexColor("#53DFAD");
-    scheme.colors.warning = colony::color::ParseHexColor("#FFC878");
-    scheme.colors.info = colony::color::ParseHexColor("#6DCFF6");
-
-    scheme.typography.display = TypographyStyle{48, 1.16f, scheme.colors.heroTitle};
-    scheme.typography.headline = TypographyStyle{34, 1.18f, scheme.colors.heroTitle};
-    scheme.typography.title = TypographyStyle{26, 1.22f, scheme.colors.heroTitle};
-    scheme.typography.subtitle = TypographyStyle{20, 1.26f, scheme.colors.heroBody};
-    scheme.typography.body = TypographyStyle{17, 1.34f, scheme.colors.heroBody};
-    scheme.typography.label = TypographyStyle{15, 1.28f, scheme.colors.navText};
-    scheme.typography.caption = TypographyStyle{13, 1.32f, scheme.colors.muted};
-
-    scheme.motion = BuildDefaultMotionTimings();
-    scheme.interactions = BuildDefaultInteractions(scheme.colors);
-
-    schemes.push_back(std::move(scheme));
-}
-
-void AddCatppuccin(std::vector<ColorScheme>& schemes)
+    std::string_view id;
+    std::string_view name;
+    ThemeColors colors;
+    InteractionColors interactions;
+    Typography typography;
+    MotionTimings motion;
+};
+
+// Motion is per scheme: only the signature scheme opts into the springier
+// timings; the ports keep the struct defaults they always shipped with.
+constexpr BuiltinScheme MakeBuiltin(
+    std::string_view id, std::string_view name, ThemeColors colors, MotionTimings motion = MotionTimings{})
 {
-    {
-        ColorScheme scheme{
-            .id = "catppuccin_latte",
-            .name = "Catppuccin Latte",
-            .colors = MakeTheme(
-                "#eff1f5",
-                "#dce0e8",
-                "#e6e9ef",
-                "#ccd0da",
-                "#bcc0cc",
-                "#acb0be",
-                "#4c4f69",
-                "#1e66f5",
-                "#5c5f77",
-                "#6c6f85",
-                "#acb0be",
-                "#dce0e8",
-                "#4c4f69",
-                "#ccd0da",
-                "#e5e9f3",
-                "#dce1ec")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "catppuccin_frappe",
-            .name = "Catppuccin Frappé",
-            .colors = MakeTheme(
-                "#303446",
-                "#292c3c",
-                "#414559",
-                "#51576d",
-                "#626880",
-                "#737994",
-                "#c6d0f5",
-                "#c6d0f5",
-                "#a5adce",
-                "#949cbb",
-                "#51576d",
-                "#232634",
-                "#c6d0f5",
-                "#414559",
-                "#2f3144",
-                "#1f2233")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "catppuccin_macchiato",
-            .name = "Catppuccin Macchiato",
-            .colors = MakeTheme(
-                "#24273a",
-                "#1e2030",
-                "#2f3349",
-                "#363a4f",
-                "#494d64",
-                "#5b6078",
-                "#cad3f5",
-                "#cad3f5",
-                "#a5adcb",
-                "#939ab7",
-                "#494d64",
-                "#181926",
-                "#cad3f5",
-                "#2f3349",
-                "#1a1d2c",
-                "#111320")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "catppuccin_mocha",
-            .name = "Catppuccin Mocha",
-            .colors = MakeTheme(
-                "#11111b",
-                "#181825",
-                "#1e1e2e",
-                "#313244",
-                "#45475a",
-                "#585b70",
-                "#cdd6f4",
-                "#cdd6f4",
-                "#a6adc8",
-                "#9399b2",
-                "#45475a",
-                "#181825",
-                "#cdd6f4",
-                "#2c2f40",
-                "#161925",
-                "#0f111a")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
+    return BuiltinScheme{
+        id,
+        name,
+        colors,
+        BuildDefaultInteractions(colors),
+        BuildDefaultTypography(colors),
+        motion};
 }
 
-void AddClassicSchemes(std::vector<ColorScheme>& schemes)
+constexpr BuiltinScheme MakeColonySignature()
 {
-    {
-        ColorScheme scheme{
-            .id = "gruvbox_dark",
-            .name = "Gruvbox Dark",
-            .colors = MakeTheme(
-                "#1d2021",
-                "#282828",
-                "#32302f",
-                "#3c3836",
-                "#504945",
-                "#665c54",
-                "#ebdbb2",
-                "#fbf1c7",
-                "#d5c4a1",
-                "#bdae93",
-                "#504945",
-                "#282828",
-                "#ebdbb2",
-                "#3c3836",
-                "#252525",
-                "#1a1a1a")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "solarized_dark",
-            .name = "Solarized Dark",
-            .colors = MakeTheme(
-                "#002b36",
-                "#073642",
-                "#0b3948",
-                "#114857",
-                "#1b5b6a",
-                "#256d7d",
-                "#93a1a1",
-                "#eee8d5",
-                "#93a1a1",
-                "#839496",
-                "#1b5b6a",
-                "#002b36",
-                "#93a1a1",
-                "#114857",
-                "#0a2f3a",
-                "#041f27")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "everblush",
-            .name = "Everblush",
-            .colors = MakeTheme(
-                "#141b1e",
-                "#0f1417",
-                "#1b2225",
-                "#232a2d",
-                "#2d3437",
-                "#383f42",
-                "#e5c76b",
-                "#e5c76b",
-                "#b3cfa7",
-                "#9da9ad",
-                "#2d3437",
-                "#0f1417",
-                "#e5c76b",
-                "#20272a",
-                "#141b1e",
-                "#0c1214")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "cyberdream",
-            .name = "Cyberdream",
-            .colors = MakeTheme(
-                "#05060a",
-                "#0a0c12",
-                "#10131c",
-                "#181c28",
-                "#202534",
-                "#2a3040",
-                "#f8f8ff",
-                "#9aafff",
-                "#c3c9ff",
-                "#a1a8d9",
-                "#2a3040",
-                "#0a0c12",
-                "#f8f8ff",
-                "#1c2130",
-                "#10131c",
-                "#080a10")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
-
-    {
-        ColorScheme scheme{
-            .id = "onedark",
-            .name = "One Dark",
-            .colors = MakeTheme(
-                "#0f1419",
-                "#171b24",
-                "#1f2430",
-                "#232834",
-                "#303643",
-                "#3b4252",
-                "#abb2bf",
-                "#e5c07b",
-                "#abb2bf",
-                "#9da5b4",
-                "#303643",
-                "#171b24",
-                "#d0d7e2",
-                "#262c39",
-                "#151a21",
-                "#0e1117")};
-        ApplyDefaults(scheme);
-        schemes.push_back(std::move(scheme));
-    }
+    ThemeColors colors = MakeTheme(
+        "#1E1E2A",
+        "#171824",
+        "#222437",
+        "#282B40",
+        "#2D3248",
+        "#353B55",
+        "#F6F7FF",
+        "#FFFFFF",
+        "#D5D7E6",
+        "#9CA2C6",
+        "#31364A",
+        "#181B2A",
+        "#F1F4FF",
+        "#FF9F43",
+        "#242A40",
+        "#181D30");
+
+    colors.buttonPrimary = Hex("#FF9F43");
+    colors.buttonPrimaryHover = Hex("#FFB15E");
+    colors.buttonPrimaryActive = Hex("#E9831F");
+    colors.channelBadge = colors.buttonPrimary;
+    colors.focusRing = Hex("#FFB56A");
+    colors.success = Hex("#53DFAD");
+    colors.warning = Hex("#FFC878");
+    colors.info = Hex("#6DCFF6");
+
+    BuiltinScheme scheme = MakeBuiltin("colony_aurora", "Colony Aurora", colors, BuildDefaultMotionTimings());
+    // The signature scheme uses slightly airier text than the defaults.
+    scheme.typography.title = TypographyStyle{26, 1.22f, colors.heroTitle};
+    scheme.typography.subtitle = TypographyStyle{20, 1.26f, colors.heroBody};
+    scheme.typography.body = TypographyStyle{17, 1.34f, colors.heroBody};
+    return scheme;
 }
 
+constexpr std::array<BuiltinScheme, 10> kBuiltinSchemes = {
+    MakeColonySignature(),
+    MakeBuiltin(
+        "catppuccin_latte",
+        "Catppuccin Latte",
+        MakeTheme(
+            "#eff1f5",
+            "#dce0e8",
+            "#e6e9ef",
+            "#ccd0da",
+            "#bcc0cc",
+            "#acb0be",
+            "#4c4f69",
+            "#1e66f5",
+            "#5c5f77",
+            "#6c6f85",
+            "#acb0be",
+            "#dce0e8",
+            "#4c4f69",
+            "#ccd0da",
+            "#e5e9f3",
+            "#dce1ec")),
+    MakeBuiltin(
+        "catppuccin_frappe",
+        "Catppuccin Frappé",
+        MakeTheme(
+            "#303446",
+            "#292c3c",
+            "#414559",
+            "#51576d",
+            "#626880",
+            "#737994",
+            "#c6d0f5",
+            "#c6d0f5",
+            "#a5adce",
+            "#949cbb",
+            "#51576d",
+            "#232634",
+            "#c6d0f5",
+            "#414559",
+            "#2f3144",
+            "#1f2233")),
+    MakeBuiltin(
+        "catppuccin_macchiato",
+        "Catppuccin Macchiato",
+        MakeTheme(
+            "#24273a",
+            "#1e2030",
+            "#2f3349",
+            "#363a4f",
+            "#494d64",
+            "#5b6078",
+            "#cad3f5",
+            "#cad3f5",
+            "#a5adcb",
+            "#939ab7",
+            "#494d64",
+            "#181926",
+            "#cad3f5",
+            "#2f3349",
+            "#1a1d2c",
+            "#111320")),
+    MakeBuiltin(
+        "catppuccin_mocha",
+        "Catppuccin Mocha",
+        MakeTheme(
+            "#11111b",
+            "#181825",
+            "#1e1e2e",
+            "#313244",
+            "#45475a",
+            "#585b70",
+            "#cdd6f4",
+            "#cdd6f4",
+            "#a6adc8",
+            "#9399b2",
+            "#45475a",
+            "#181825",
+            "#cdd6f4",
+            "#2c2f40",
+            "#161925",
+            "#0f111a")),
+    MakeBuiltin(
+        "gruvbox_dark",
+        "Gruvbox Dark",
+        MakeTheme(
+            "#1d2021",
+            "#282828",
+            "#32302f",
+            "#3c3836",
+            "#504945",
+            "#665c54",
+            "#ebdbb2",
+            "#fbf1c7",
+            "#d5c4a1",
+            "#bdae93",
+            "#504945",
+            "#282828",
+            "#ebdbb2",
+            "#3c3836",
+            "#252525",
+            "#1a1a1a")),
+    MakeBuiltin(
+        "solarized_dark",
+        "Solarized Dark",
+        MakeTheme(
+            "#002b36",
+            "#073642",
+            "#0b3948",
+            "#114857",
+            "#1b5b6a",
+            "#256d7d",
+            "#93a1a1",
+            "#eee8d5",
+            "#93a1a1",
+            "#839496",
+            "#1b5b6a",
+            "#002b36",
+            "#93a1a1",
+            "#114857",
+            "#0a2f3a",
+            "#041f27")),
+    MakeBuiltin(
+        "everblush",
+        "Everblush",
+        MakeTheme(
+            "#141b1e",
+            "#0f1417",
+            "#1b2225",
+            "#232a2d",
+            "#2d3437",
+            "#383f42",
+            "#e5c76b",
+            "#e5c76b",
+            "#b3cfa7",
+            "#9da9ad",
+            "#2d3437",
+            "#0f1417",
+            "#e5c76b",
+            "#20272a",
+            "#141b1e",
+            "#0c1214")),
+    MakeBuiltin(
+        "cyberdream",
+        "Cyberdream",
+        MakeTheme(
+            "#05060a",
+            "#0a0c12",
+            "#10131c",
+            "#181c28",
+            "#202534",
+            "#2a3040",
+            "#f8f8ff",
+            "#9aafff",
+            "#c3c9ff",
+            "#a1a8d9",
+            "#2a3040",
+            "#0a0c12",
+            "#f8f8ff",
+            "#1c2130",
+            "#10131c",
+            "#080a10")),
+    MakeBuiltin(
+        "onedark",
+        "One Dark",
+        MakeTheme(
+            "#0f1419",
+            "#171b24",
+            "#1f2430",
+            "#232834",
+            "#303643",
+            "#3b4252",
+            "#abb2bf",
+            "#e5c07b",
+            "#abb2bf",
+            "#9da5b4",
+            "#303643",
+            "#171b24",
+            "#d0d7e2",
+            "#262c39",
+            "#151a21",
+            "#0e1117")),
+};
+
 } // namespace
 
 ThemeManager::ThemeManager()
 {
-    schemes_.reserve(10);
-    AddColonySignature(schemes_);
-    AddCatppuccin(schemes_);
-    AddClassicSchemes(schemes_);
+    // Custom schemes (and Schemes() consumers) need the owning ColorScheme
+    // shape, so built-ins are materialized from the table — a POD copy plus
+    // the two id/name strings each; all the color derivation already happened
+    // at compile time.
+    schemes_.reserve(kBuiltinSchemes.size());
+    for (const BuiltinScheme& builtin : kBuiltinSchemes)
+    {
+        ColorScheme scheme{};
+        scheme.id = builtin.id;
+        scheme.name = builtin.name;
+        scheme.colors = builtin.colors;
+        scheme.interactions = builtin.interactions;
+        scheme.typography = builtin.typography;
+        scheme.motion = builtin.motion;
+        schemes_.push_back(std::move(scheme));
+    }
     if (!schemes_.empty())
     {
         active_ = &schemes_.front();
@@ -2,7 +2,18 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define COLONY_COLOR_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define COLONY_COLOR_NEON 1
+#include <arm_neon.h>
+#endif
 
 namespace colony::color
 {
@@ -57,6 +68,94 @@ bool ParseChannelPair(const std::string& value, std::size_t index, Uint8& out)
     out = static_cast<Uint8>((high << 4) | low);
     return true;
 }
+
+// Shared fixed-point batch kernel: pixel + (((target - pixel) * weight) >> 7)
+// per channel, weight in [0, 128]. The alpha channel gets its own weight so
+// the same kernel serves palette mixing (alpha follows) and pixel tinting
+// (alpha preserved, weight 0).
+void MixSpanFixed(
+    std::uint8_t* rgba,
+    std::size_t pixelCount,
+    const SDL_Color& target,
+    int weight,
+    int alphaWeight)
+{
+    std::size_t pixel = 0;
+
+#if defined(COLONY_COLOR_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weights = _mm_setr_epi16(
+        static_cast<short>(weight), static_cast<short>(weight), static_cast<short>(weight),
+        static_cast<short>(alphaWeight),
+        static_cast<short>(weight), static_cast<short>(weight), static_cast<short>(weight),
+        static_cast<short>(alphaWeight));
+    const __m128i targetBytes = _mm_setr_epi8(
+        static_cast<char>(target.r), static_cast<char>(target.g), static_cast<char>(target.b),
+        static_cast<char>(target.a),
+        static_cast<char>(target.r), static_cast<char>(target.g), static_cast<char>(target.b),
+        static_cast<char>(target.a),
+        static_cast<char>(target.r), static_cast<char>(target.g), static_cast<char>(target.b),
+        static_cast<char>(target.a),
+        static_cast<char>(target.r), static_cast<char>(target.g), static_cast<char>(target.b),
+        static_cast<char>(target.a));
+    const __m128i targetLo = _mm_unpacklo_epi8(targetBytes, zero);
+    const __m128i targetHi = _mm_unpackhi_epi8(targetBytes, zero);
+
+    for (; pixel + 4 <= pixelCount; pixel += 4)
+    {
+        const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + pixel * 4));
+        const __m128i srcLo = _mm_unpacklo_epi8(src, zero);
+        const __m128i srcHi = _mm_unpackhi_epi8(src, zero);
+        // (target - src) stays in [-255, 255]; times a 7-bit weight it fits
+        // 16-bit signed arithmetic, so no widening to 32 bits is needed.
+        const __m128i mixedLo =
+            _mm_add_epi16(srcLo, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(targetLo, srcLo), weights), 7));
+        const __m128i mixedHi =
+            _mm_add_epi16(srcHi, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(targetHi, srcHi), weights), 7));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + pixel * 4), _mm_packus_epi16(mixedLo, mixedHi));
+    }
+#elif defined(COLONY_COLOR_NEON)
+    const std::uint8_t targetPattern[8] = {target.r, target.g, target.b, target.a,
+                                           target.r, target.g, target.b, target.a};
+    const int16x8_t targetWide = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(targetPattern)));
+    const std::int16_t weightPattern[8] = {
+        static_cast<std::int16_t>(weight), static_cast<std::int16_t>(weight),
+        static_cast<std::int16_t>(weight), static_cast<std::int16_t>(alphaWeight),
+        static_cast<std::int16_t>(weight), static_cast<std::int16_t>(weight),
+        static_cast<std::int16_t>(weight), static_cast<std::int16_t>(alphaWeight)};
+    const int16x8_t weights = vld1q_s16(weightPattern);
+
+    for (; pixel + 4 <= pixelCount; pixel += 4)
+    {
+        const uint8x16_t src = vld1q_u8(rgba + pixel * 4);
+        const int16x8_t srcLo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(src)));
+        const int16x8_t srcHi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(src)));
+        const int16x8_t mixedLo = vaddq_s16(srcLo, vshrq_n_s16(vmulq_s16(vsubq_s16(targetWide, srcLo), weights), 7));
+        const int16x8_t mixedHi = vaddq_s16(srcHi, vshrq_n_s16(vmulq_s16(vsubq_s16(targetWide, srcHi), weights), 7));
+        vst1q_u8(
+            rgba + pixel * 4,
+            vcombine_u8(vqmovun_s16(mixedLo), vqmovun_s16(mixedHi)));
+    }
+#endif
+
+    for (; pixel < pixelCount; ++pixel)
+    {
+        std::uint8_t* channels = rgba + pixel * 4;
+        const int targetChannels[4] = {target.r, target.g, target.b, target.a};
+        const int channelWeights[4] = {weight, weight, weight, alphaWeight};
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            const int value = channels[channel];
+            channels[channel] =
+                static_cast<std::uint8_t>(value + (((targetChannels[channel] - value) * channelWeights[channel]) >> 7));
+        }
+    }
+}
+
+int FixedWeight(float t)
+{
+    return std::clamp(static_cast<int>(std::lround(std::clamp(t, 0.0f, 1.0f) * 128.0f)), 0, 128);
+}
 } // namespace
 
 SDL_Color ParseHexColor(std::string_view hex, SDL_Color fallback)
@@ -116,6 +215,104 @@ SDL_Color Mix(const SDL_Color& a, const SDL_Color& b, float t)
     return SDL_Color{blend(a.r, b.r), blend(a.g, b.g), blend(a.b, b.b), blend(a.a, b.a)};
 }
 
+void MixInPlace(SDL_Color* colors, std::size_t count, SDL_Color target, float t)
+{
+    if (colors == nullptr || count == 0)
+    {
+        return;
+    }
+    const int weight = FixedWeight(t);
+    // SDL_Color is four contiguous bytes in r,g,b,a order, so a palette is
+    // just an RGBA8 span with the alpha channel mixed like the others.
+    MixSpanFixed(reinterpret_cast<std::uint8_t*>(colors), count, target, weight, weight);
+}
+
+void MixPixelsInPlace(std::uint8_t* rgba, std::size_t byteCount, SDL_Color target, float t)
+{
+    if (rgba == nullptr || byteCount < 4)
+    {
+        return;
+    }
+    MixSpanFixed(rgba, byteCount / 4, target, FixedWeight(t), 0);
+}
+
+void LightenInPlace(SDL_Color* colors, std::size_t count, float amount)
+{
+    MixInPlace(colors, count, SDL_Color{255, 255, 255, 255}, amount);
+}
+
+void DarkenInPlace(SDL_Color* colors, std::size_t count, float amount)
+{
+    MixInPlace(colors, count, SDL_Color{0, 0, 0, 255}, amount);
+}
+
+namespace
+{
+
+// Side of the tiled dither texture. Large enough that its repeat period is
+// invisible across a hero-sized gradient, small enough to build once in
+// microseconds.
+constexpr int kDitherTextureSize = 256;
+
+// Peak alpha of a dither texel. The overlay only needs to straddle the one
+// quantization level the GPU's 8-bit interpolation bands on.
+constexpr std::uint8_t kDitherMaxAlpha = 6;
+
+// One faint noise texture per renderer, blended over gradients to break up
+// banding on low-quality panels. SDL destroys a renderer's textures with the
+// renderer and the app keeps one renderer for its lifetime, so entries are
+// never invalidated.
+std::unordered_map<SDL_Renderer*, SDL_Texture*>& DitherCache()
+{
+    static std::unordered_map<SDL_Renderer*, SDL_Texture*> cache;
+    return cache;
+}
+
+SDL_Texture* AcquireDitherTexture(SDL_Renderer* renderer)
+{
+    auto& cache = DitherCache();
+    if (const auto it = cache.find(renderer); it != cache.end())
+    {
+        return it->second;
+    }
+
+    SDL_Texture* texture = SDL_CreateTexture(
+        renderer,
+        SDL_PIXELFORMAT_RGBA32,
+        SDL_TEXTUREACCESS_STATIC,
+        kDitherTextureSize,
+        kDitherTextureSize);
+    if (texture == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Deterministic white noise: half the texels nudge up toward white, half
+    // down toward black, each by at most kDitherMaxAlpha levels.
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(kDitherTextureSize) * kDitherTextureSize * 4);
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (std::size_t texel = 0; texel < pixels.size(); texel += 4)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const std::uint8_t noise = static_cast<std::uint8_t>(state & 0xFFu);
+        const bool lighten = (noise & 1u) != 0;
+        const std::uint8_t level = lighten ? 255 : 0;
+        pixels[texel + 0] = level;
+        pixels[texel + 1] = level;
+        pixels[texel + 2] = level;
+        pixels[texel + 3] = static_cast<std::uint8_t>((noise >> 1) % (kDitherMaxAlpha + 1));
+    }
+    SDL_UpdateTexture(texture, nullptr, pixels.data(), kDitherTextureSize * 4);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    cache.emplace(renderer, texture);
+    return texture;
+}
+
+} // namespace
+
 void RenderVerticalGradient(SDL_Renderer* renderer, const SDL_Rect& area, SDL_Color top, SDL_Color bottom)
 {
     if (renderer == nullptr || area.h <= 0 || area.w <= 0)
@@ -123,13 +320,46 @@ void RenderVerticalGradient(SDL_Renderer* renderer, const SDL_Rect& area, SDL_Co
         return;
     }
 
-    for (int offset = 0; offset < area.h; ++offset)
+    // One two-triangle draw with per-vertex color; the GPU interpolates the
+    // ramp, replacing the per-scanline fill this used to do on the CPU.
+    const float left = static_cast<float>(area.x);
+    const float right = static_cast<float>(area.x + area.w);
+    const float topY = static_cast<float>(area.y);
+    const float bottomY = static_cast<float>(area.y + area.h);
+    const SDL_Vertex vertices[4] = {
+        {{left, topY}, top, {0.0f, 0.0f}},
+        {{right, topY}, top, {0.0f, 0.0f}},
+        {{left, bottomY}, bottom, {0.0f, 0.0f}},
+        {{right, bottomY}, bottom, {0.0f, 0.0f}},
+    };
+    const int indices[6] = {0, 1, 2, 2, 1, 3};
+    SDL_RenderGeometry(renderer, nullptr, vertices, 4, indices, 6);
+
+    // Tile the noise overlay across the area; without it an 8-bit ramp over
+    // a few hundred pixels shows visible steps on cheap panels.
+    if (SDL_Texture* dither = AcquireDitherTexture(renderer))
+    {
+        for (int y = area.y; y < area.y + area.h; y += kDitherTextureSize)
+        {
+            for (int x = area.x; x < area.x + area.w; x += kDitherTextureSize)
+            {
+                const int tileWidth = std::min(kDitherTextureSize, area.x + area.w - x);
+                const int tileHeight = std::min(kDitherTextureSize, area.y + area.h - y);
+                const SDL_Rect source{0, 0, tileWidth, tileHeight};
+                const SDL_Rect destination{x, y, tileWidth, tileHeight};
+                SDL_RenderCopy(renderer, dither, &source, &destination);
+            }
+        }
+    }
+}
+
+void ClearGradientDitherCache()
+{
+    for (auto& [renderer, texture] : DitherCache())
     {
-        const float t = area.h > 1 ? static_cast<float>(offset) / static_cast<float>(area.h - 1) : 0.0f;
-        const SDL_Color color = Mix(top, bottom, t);
-        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-        SDL_RenderDrawLine(renderer, area.x, area.y + offset, area.x + area.w - 1, area.y + offset);
+        SDL_DestroyTexture(texture);
     }
+    DitherCache().clear();
 }
 
 } // namespace colony::color
@@ -2,6 +2,8 @@
 
 #include <SDL2/SDL.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
 namespace colony::color
@@ -11,6 +13,31 @@ SDL_Color ParseHexColor(std::string_view hex, SDL_Color fallback = {255, 255, 25
 
 SDL_Color Mix(const SDL_Color& a, const SDL_Color& b, float t);
 
+// Batch variants for palettes and RGBA8 pixel buffers. The weight is applied
+// in 1.7 fixed point (128 steps), so results can differ from per-color Mix by
+// at most one level per channel, but all platforms produce identical bytes.
+// SSE2 and NEON kernels process four pixels per step; other targets fall back
+// to the scalar loop.
+
+// Mixes every color toward the target, alpha included, like Mix does.
+void MixInPlace(SDL_Color* colors, std::size_t count, SDL_Color target, float t);
+
+// Tints every RGBA8 pixel toward the target color, preserving each pixel's
+// alpha. byteCount must be a multiple of 4.
+void MixPixelsInPlace(std::uint8_t* rgba, std::size_t byteCount, SDL_Color target, float t);
+
+// Mixes toward white / toward black; amount follows the Mix convention.
+void LightenInPlace(SDL_Color* colors, std::size_t count, float amount);
+void DarkenInPlace(SDL_Color* colors, std::size_t count, float amount);
+
+// Fills the area with a top-to-bottom ramp as one two-triangle
+// SDL_RenderGeometry draw, then tiles a faint cached noise texture over it
+// so the 8-bit interpolation does not band on cheap panels.
 void RenderVerticalGradient(SDL_Renderer* renderer, const SDL_Rect& area, SDL_Color top, SDL_Color bottom);
 
+// Destroys the per-renderer dither textures. Only needed when a renderer is
+// torn down while the process keeps running (tests, the arcade handoff); the
+// app's own renderer lives for the whole session.
+void ClearGradientDitherCache();
+
 } // namespace colony::color
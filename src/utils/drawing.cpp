@@ -1,12 +1,18 @@
 #include "utils/drawing.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
 
 namespace colony::drawing
 {
 namespace
 {
+constexpr float kPi = 3.14159265358979323846f;
+
 int ClampRadius(const SDL_Rect& rect, int radius)
 {
     const int maxRadius = std::min(rect.w, rect.h) / 2;
@@ -17,91 +23,121 @@ int ClampRadius(const SDL_Rect& rect, int radius)
     return std::clamp(radius, 0, maxRadius);
 }
 
-void DrawCornerPoints(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, bool filled, int cornerMask)
+int ArcSegmentCount(int radius)
+{
+    // Enough segments that the chord error stays well under a pixel at the
+    // radii the UI uses, without ballooning vertex counts for big panels.
+    return std::clamp(radius / 2 + 4, 4, 24);
+}
+
+struct CornerArc
+{
+    // Arc center in pixel space and the starting angle of the quarter turn.
+    float centerX;
+    float centerY;
+    float startAngle;
+    bool rounded;
+};
+
+std::array<CornerArc, 4> BuildCornerArcs(const SDL_Rect& rect, int radius, int cornerMask)
+{
+    const float r = static_cast<float>(radius);
+    const float left = static_cast<float>(rect.x);
+    const float top = static_cast<float>(rect.y);
+    const float right = static_cast<float>(rect.x + rect.w);
+    const float bottom = static_cast<float>(rect.y + rect.h);
+
+    return {
+        CornerArc{left + r, top + r, kPi, (cornerMask & CornerTopLeft) != 0},
+        CornerArc{right - r, top + r, 1.5f * kPi, (cornerMask & CornerTopRight) != 0},
+        CornerArc{right - r, bottom - r, 0.0f, (cornerMask & CornerBottomRight) != 0},
+        CornerArc{left + r, bottom - r, 0.5f * kPi, (cornerMask & CornerBottomLeft) != 0}};
+}
+
+// Appends the rounded corners of rect as triangle fans, one per covered
+// corner, into a caller-owned vertex/index stream.
+void AppendCornerFans(
+    std::vector<SDL_Vertex>& vertices,
+    std::vector<int>& indices,
+    const SDL_Rect& rect,
+    int radius,
+    int cornerMask,
+    SDL_Color color)
 {
     if (radius <= 0 || cornerMask == CornerNone)
     {
         return;
     }
 
-    const float centerOffset = static_cast<float>(radius) - 0.5f;
-    const int xMax = rect.x + rect.w - 1;
-    const int yMax = rect.y + rect.h - 1;
-
-    const bool roundTopLeft = (cornerMask & CornerTopLeft) != 0;
-    const bool roundTopRight = (cornerMask & CornerTopRight) != 0;
-    const bool roundBottomLeft = (cornerMask & CornerBottomLeft) != 0;
-    const bool roundBottomRight = (cornerMask & CornerBottomRight) != 0;
+    const int segments = ArcSegmentCount(radius);
+    const float r = static_cast<float>(radius);
 
-    for (int dy = 0; dy < radius; ++dy)
+    for (const CornerArc& arc : BuildCornerArcs(rect, radius, cornerMask))
     {
-        for (int dx = 0; dx < radius; ++dx)
+        if (!arc.rounded)
         {
-            const float distance = std::hypot(dx - centerOffset, dy - centerOffset);
-            if (filled)
-            {
-                if (distance <= static_cast<float>(radius))
-                {
-                    if (roundTopLeft)
-                    {
-                        SDL_RenderDrawPoint(renderer, rect.x + dx, rect.y + dy);
-                    }
-                    if (roundTopRight)
-                    {
-                        SDL_RenderDrawPoint(renderer, xMax - dx, rect.y + dy);
-                    }
-                    if (roundBottomLeft)
-                    {
-                        SDL_RenderDrawPoint(renderer, rect.x + dx, yMax - dy);
-                    }
-                    if (roundBottomRight)
-                    {
-                        SDL_RenderDrawPoint(renderer, xMax - dx, yMax - dy);
-                    }
-                }
-            }
-            else
-            {
-                if (distance >= static_cast<float>(radius) - 1.0f && distance <= static_cast<float>(radius))
-                {
-                    if (roundTopLeft)
-                    {
-                        SDL_RenderDrawPoint(renderer, rect.x + dx, rect.y + dy);
-                    }
-                    if (roundTopRight)
-                    {
-                        SDL_RenderDrawPoint(renderer, xMax - dx, rect.y + dy);
-                    }
-                    if (roundBottomLeft)
-                    {
-                        SDL_RenderDrawPoint(renderer, rect.x + dx, yMax - dy);
-                    }
-                    if (roundBottomRight)
-                    {
-                        SDL_RenderDrawPoint(renderer, xMax - dx, yMax - dy);
-                    }
-                }
-            }
+            continue;
+        }
+
+        const int centerIndex = static_cast<int>(vertices.size());
+        vertices.push_back(SDL_Vertex{SDL_FPoint{arc.centerX, arc.centerY}, color, SDL_FPoint{0.0f, 0.0f}});
+
+        for (int segment = 0; segment <= segments; ++segment)
+        {
+            const float angle = arc.startAngle
+                + (0.5f * kPi) * (static_cast<float>(segment) / static_cast<float>(segments));
+            vertices.push_back(SDL_Vertex{
+                SDL_FPoint{arc.centerX + r * std::cos(angle), arc.centerY + r * std::sin(angle)},
+                color,
+                SDL_FPoint{0.0f, 0.0f}});
+        }
+
+        for (int segment = 0; segment < segments; ++segment)
+        {
+            indices.push_back(centerIndex);
+            indices.push_back(centerIndex + 1 + segment);
+            indices.push_back(centerIndex + 2 + segment);
         }
     }
 }
 
-} // namespace
-
-void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask)
+// Appends an axis-aligned quad as two indexed triangles. The UV range is
+// meaningful only when the quad ends up in a textured batch.
+void AppendQuad(
+    std::vector<SDL_Vertex>& vertices,
+    std::vector<int>& indices,
+    const SDL_Rect& rect,
+    SDL_Color color,
+    float u0 = 0.0f,
+    float v0 = 0.0f,
+    float u1 = 0.0f,
+    float v1 = 0.0f)
 {
-    if (renderer == nullptr || rect.w <= 0 || rect.h <= 0)
-    {
-        return;
-    }
+    const float left = static_cast<float>(rect.x);
+    const float top = static_cast<float>(rect.y);
+    const float right = static_cast<float>(rect.x + rect.w);
+    const float bottom = static_cast<float>(rect.y + rect.h);
 
-    radius = ClampRadius(rect, radius);
-    if (radius == 0 || cornerMask == CornerNone)
-    {
-        SDL_RenderFillRect(renderer, &rect);
-        return;
-    }
+    const int baseIndex = static_cast<int>(vertices.size());
+    vertices.push_back(SDL_Vertex{SDL_FPoint{left, top}, color, SDL_FPoint{u0, v0}});
+    vertices.push_back(SDL_Vertex{SDL_FPoint{right, top}, color, SDL_FPoint{u1, v0}});
+    vertices.push_back(SDL_Vertex{SDL_FPoint{right, bottom}, color, SDL_FPoint{u1, v1}});
+    vertices.push_back(SDL_Vertex{SDL_FPoint{left, bottom}, color, SDL_FPoint{u0, v1}});
+
+    indices.push_back(baseIndex);
+    indices.push_back(baseIndex + 1);
+    indices.push_back(baseIndex + 2);
+    indices.push_back(baseIndex);
+    indices.push_back(baseIndex + 2);
+    indices.push_back(baseIndex + 3);
+}
 
+// Invokes fill(rect) for the center and edge rectangles of a rounded rect —
+// everything except the corner fans. Shared by the immediate path and
+// DrawList so the two can never disagree about coverage.
+template <typename FillFn>
+void ForEachRoundedRectFill(const SDL_Rect& rect, int radius, int cornerMask, FillFn&& fill)
+{
     const int radiusTopLeft = (cornerMask & CornerTopLeft) != 0 ? radius : 0;
     const int radiusTopRight = (cornerMask & CornerTopRight) != 0 ? radius : 0;
     const int radiusBottomLeft = (cornerMask & CornerBottomLeft) != 0 ? radius : 0;
@@ -119,7 +155,7 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
         rect.h - topRadius - bottomRadius};
     if (centerRect.w > 0 && centerRect.h > 0)
     {
-        SDL_RenderFillRect(renderer, &centerRect);
+        fill(centerRect);
     }
 
     if (topRadius > 0)
@@ -127,7 +163,7 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
         SDL_Rect topRect{rect.x + radiusTopLeft, rect.y, rect.w - radiusTopLeft - radiusTopRight, topRadius};
         if (topRect.w > 0 && topRect.h > 0)
         {
-            SDL_RenderFillRect(renderer, &topRect);
+            fill(topRect);
         }
     }
 
@@ -140,7 +176,7 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
             bottomRadius};
         if (bottomRect.w > 0 && bottomRect.h > 0)
         {
-            SDL_RenderFillRect(renderer, &bottomRect);
+            fill(bottomRect);
         }
     }
 
@@ -149,7 +185,7 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
         SDL_Rect leftRect{rect.x, rect.y + radiusTopLeft, leftRadius, rect.h - radiusTopLeft - radiusBottomLeft};
         if (leftRect.w > 0 && leftRect.h > 0)
         {
-            SDL_RenderFillRect(renderer, &leftRect);
+            fill(leftRect);
         }
     }
 
@@ -162,11 +198,100 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
             rect.h - radiusTopRight - radiusBottomRight};
         if (rightRect.w > 0 && rightRect.h > 0)
         {
-            SDL_RenderFillRect(renderer, &rightRect);
+            fill(rightRect);
         }
     }
+}
 
-    DrawCornerPoints(renderer, rect, radius, true, cornerMask);
+// Fills the rounded corners of rect with triangle fans submitted through
+// SDL_RenderGeometry — one draw call for all four corners instead of one
+// SDL_RenderDrawPoint per covered pixel.
+void RenderFilledCorners(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask)
+{
+    if (radius <= 0 || cornerMask == CornerNone)
+    {
+        return;
+    }
+
+    SDL_Color color{255, 255, 255, SDL_ALPHA_OPAQUE};
+    SDL_GetRenderDrawColor(renderer, &color.r, &color.g, &color.b, &color.a);
+
+    const int segments = ArcSegmentCount(radius);
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    vertices.reserve(static_cast<std::size_t>(segments + 2) * 4);
+    indices.reserve(static_cast<std::size_t>(segments) * 3 * 4);
+
+    AppendCornerFans(vertices, indices, rect, radius, cornerMask, color);
+
+    if (!indices.empty())
+    {
+        SDL_RenderGeometry(
+            renderer,
+            nullptr,
+            vertices.data(),
+            static_cast<int>(vertices.size()),
+            indices.data(),
+            static_cast<int>(indices.size()));
+    }
+}
+
+// Strokes the rounded corners of rect as short polylines along each arc.
+void RenderCornerOutlines(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask)
+{
+    if (radius <= 0 || cornerMask == CornerNone)
+    {
+        return;
+    }
+
+    const int segments = ArcSegmentCount(radius);
+    const float r = static_cast<float>(radius) - 0.5f;
+
+    std::vector<SDL_Point> points;
+    points.reserve(static_cast<std::size_t>(segments) + 1);
+
+    for (const CornerArc& arc : BuildCornerArcs(rect, radius, cornerMask))
+    {
+        if (!arc.rounded)
+        {
+            continue;
+        }
+
+        points.clear();
+        for (int segment = 0; segment <= segments; ++segment)
+        {
+            const float angle = arc.startAngle
+                + (0.5f * kPi) * (static_cast<float>(segment) / static_cast<float>(segments));
+            points.push_back(SDL_Point{
+                static_cast<int>(std::lround(arc.centerX + r * std::cos(angle) - 0.5f)),
+                static_cast<int>(std::lround(arc.centerY + r * std::sin(angle) - 0.5f))});
+        }
+        SDL_RenderDrawLines(renderer, points.data(), static_cast<int>(points.size()));
+    }
+}
+
+} // namespace
+
+void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask)
+{
+    if (renderer == nullptr || rect.w <= 0 || rect.h <= 0)
+    {
+        return;
+    }
+
+    radius = ClampRadius(rect, radius);
+    if (radius == 0 || cornerMask == CornerNone)
+    {
+        SDL_RenderFillRect(renderer, &rect);
+        return;
+    }
+
+    ForEachRoundedRectFill(rect, radius, cornerMask, [renderer](const SDL_Rect& fillRect) {
+        SDL_RenderFillRect(renderer, &fillRect);
+    });
+
+    RenderFilledCorners(renderer, rect, radius, cornerMask);
 }
 
 void RenderRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask)
@@ -221,7 +346,192 @@ void RenderRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius,
         SDL_RenderDrawLine(renderer, x2, rightStart, x2, rightEnd);
     }
 
-    DrawCornerPoints(renderer, rect, radius, false, cornerMask);
+    RenderCornerOutlines(renderer, rect, radius, cornerMask);
+}
+
+int DrawList::PushLayer() noexcept
+{
+    return ++currentLayer_;
+}
+
+void DrawList::FillRect(const SDL_Rect& rect, SDL_Color color)
+{
+    if (rect.w <= 0 || rect.h <= 0)
+    {
+        return;
+    }
+
+    Command command;
+    command.kind = Command::Kind::FillRect;
+    command.layer = currentLayer_;
+    command.dst = rect;
+    command.color = color;
+    commands_.push_back(command);
+}
+
+void DrawList::FillRoundedRect(const SDL_Rect& rect, int radius, SDL_Color color, int cornerMask)
+{
+    if (rect.w <= 0 || rect.h <= 0)
+    {
+        return;
+    }
+
+    Command command;
+    command.kind = Command::Kind::FillRoundedRect;
+    command.layer = currentLayer_;
+    command.dst = rect;
+    command.color = color;
+    command.radius = radius;
+    command.cornerMask = cornerMask;
+    commands_.push_back(command);
+}
+
+void DrawList::CopyTexture(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst, SDL_Color color)
+{
+    if (texture == nullptr || dst.w <= 0 || dst.h <= 0)
+    {
+        return;
+    }
+
+    Command command;
+    command.kind = Command::Kind::CopyTexture;
+    command.layer = currentLayer_;
+    command.texture = texture;
+    command.dst = dst;
+    command.src = src;
+    command.color = color;
+    commands_.push_back(command);
+}
+
+bool DrawList::Empty() const noexcept
+{
+    return commands_.empty();
+}
+
+void DrawList::Clear() noexcept
+{
+    commands_.clear();
+    order_.clear();
+    vertices_.clear();
+    indices_.clear();
+    currentLayer_ = 0;
+}
+
+void DrawList::AppendCommandGeometry(const Command& command)
+{
+    switch (command.kind)
+    {
+    case Command::Kind::FillRect:
+        AppendQuad(vertices_, indices_, command.dst, command.color);
+        break;
+    case Command::Kind::FillRoundedRect:
+    {
+        const int radius = ClampRadius(command.dst, command.radius);
+        if (radius == 0 || command.cornerMask == CornerNone)
+        {
+            AppendQuad(vertices_, indices_, command.dst, command.color);
+            break;
+        }
+        ForEachRoundedRectFill(command.dst, radius, command.cornerMask, [&](const SDL_Rect& fillRect) {
+            AppendQuad(vertices_, indices_, fillRect, command.color);
+        });
+        AppendCornerFans(vertices_, indices_, command.dst, radius, command.cornerMask, command.color);
+        break;
+    }
+    case Command::Kind::CopyTexture:
+    {
+        float u0 = 0.0f;
+        float v0 = 0.0f;
+        float u1 = 1.0f;
+        float v1 = 1.0f;
+        if (command.src.w > 0 && command.src.h > 0)
+        {
+            int textureWidth = 0;
+            int textureHeight = 0;
+            SDL_QueryTexture(command.texture, nullptr, nullptr, &textureWidth, &textureHeight);
+            if (textureWidth > 0 && textureHeight > 0)
+            {
+                u0 = static_cast<float>(command.src.x) / static_cast<float>(textureWidth);
+                v0 = static_cast<float>(command.src.y) / static_cast<float>(textureHeight);
+                u1 = static_cast<float>(command.src.x + command.src.w) / static_cast<float>(textureWidth);
+                v1 = static_cast<float>(command.src.y + command.src.h) / static_cast<float>(textureHeight);
+            }
+        }
+        AppendQuad(vertices_, indices_, command.dst, command.color, u0, v0, u1, v1);
+        break;
+    }
+    }
+}
+
+void DrawList::FlushBatch(SDL_Renderer* renderer, SDL_Texture* texture)
+{
+    if (indices_.empty())
+    {
+        return;
+    }
+
+    SDL_RenderGeometry(
+        renderer,
+        texture,
+        vertices_.data(),
+        static_cast<int>(vertices_.size()),
+        indices_.data(),
+        static_cast<int>(indices_.size()));
+    vertices_.clear();
+    indices_.clear();
+}
+
+void DrawList::Submit(SDL_Renderer* renderer)
+{
+    if (renderer == nullptr || commands_.empty())
+    {
+        Clear();
+        return;
+    }
+
+    order_.resize(commands_.size());
+    for (std::size_t i = 0; i < order_.size(); ++i)
+    {
+        order_[i] = i;
+    }
+
+    // Stable so commands sharing a layer and texture keep record order:
+    // the emitted frame is deterministic and same-texture overlaps (row
+    // background under row highlight) still paint in the order recorded.
+    std::stable_sort(order_.begin(), order_.end(), [this](std::size_t lhs, std::size_t rhs) {
+        const Command& a = commands_[lhs];
+        const Command& b = commands_[rhs];
+        if (a.layer != b.layer)
+        {
+            return a.layer < b.layer;
+        }
+        return std::less<SDL_Texture*>{}(a.texture, b.texture);
+    });
+
+    SDL_Texture* batchTexture = nullptr;
+    bool batchOpen = false;
+    for (const std::size_t index : order_)
+    {
+        const Command& command = commands_[index];
+        if (!batchOpen || command.texture != batchTexture)
+        {
+            if (batchOpen)
+            {
+                FlushBatch(renderer, batchTexture);
+            }
+            batchTexture = command.texture;
+            batchOpen = true;
+        }
+        AppendCommandGeometry(command);
+    }
+    if (batchOpen)
+    {
+        FlushBatch(renderer, batchTexture);
+    }
+
+    commands_.clear();
+    order_.clear();
+    currentLayer_ = 0;
 }
 
 } // namespace colony::drawing
@@ -2,6 +2,9 @@
 
 #include <SDL2/SDL.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace colony::drawing
 {
 
@@ -19,4 +22,80 @@ void RenderFilledRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int r
 
 void RenderRoundedRect(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int cornerMask = CornerAll);
 
+// Retained draw-command buffer. Renderers record fills and texture copies,
+// Submit sorts them by texture within layer order and emits one
+// SDL_RenderGeometry call per (layer, texture) run instead of an
+// SDL_SetRenderDrawColor/SDL_RenderFillRect/SDL_RenderCopy per op, so the
+// backend driver sees a handful of batched draws where it used to see an
+// interleaved stream.
+//
+// Ordering contract: commands inside one layer may be reordered relative to
+// each other (fills carry their own vertex color, so color never forces a
+// flush); call PushLayer() before recording anything that must paint on top
+// of what was recorded earlier. Layers always submit in push order.
+//
+// The list assumes the draw blend mode set on the renderer at Submit time;
+// textured commands blend with whatever mode their texture carries, exactly
+// as SDL_RenderCopy would.
+class DrawList
+{
+  public:
+    // Commands in subsequent calls draw strictly after everything already
+    // recorded. Returns the new layer index (useful only for debugging).
+    int PushLayer() noexcept;
+
+    void FillRect(const SDL_Rect& rect, SDL_Color color);
+
+    // Records the same decomposition RenderFilledRoundedRect draws
+    // immediately: edge/center quads plus corner triangle fans, all in one
+    // untextured batch.
+    void FillRoundedRect(const SDL_Rect& rect, int radius, SDL_Color color, int cornerMask = CornerAll);
+
+    // src with w <= 0 copies the whole texture. color modulates the texture
+    // per vertex; pass opaque white for a plain copy.
+    void CopyTexture(
+        SDL_Texture* texture,
+        const SDL_Rect& src,
+        const SDL_Rect& dst,
+        SDL_Color color = SDL_Color{255, 255, 255, SDL_ALPHA_OPAQUE});
+
+    [[nodiscard]] bool Empty() const noexcept;
+
+    // Sorts, emits the batches and resets the list for the next frame. The
+    // scratch vectors keep their capacity, so a list reused across frames
+    // stops allocating after the first submit.
+    void Submit(SDL_Renderer* renderer);
+
+    void Clear() noexcept;
+
+  private:
+    struct Command
+    {
+        enum class Kind : std::uint8_t
+        {
+            FillRect,
+            FillRoundedRect,
+            CopyTexture
+        };
+
+        Kind kind = Kind::FillRect;
+        int layer = 0;
+        SDL_Texture* texture = nullptr;
+        SDL_Rect dst{0, 0, 0, 0};
+        SDL_Rect src{0, 0, 0, 0};
+        SDL_Color color{255, 255, 255, SDL_ALPHA_OPAQUE};
+        int radius = 0;
+        int cornerMask = CornerAll;
+    };
+
+    void AppendCommandGeometry(const Command& command);
+    void FlushBatch(SDL_Renderer* renderer, SDL_Texture* texture);
+
+    std::vector<Command> commands_;
+    std::vector<std::size_t> order_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+    int currentLayer_ = 0;
+};
+
 } // namespace colony::drawing
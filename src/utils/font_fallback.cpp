@@ -0,0 +1,168 @@
+#include "utils/font_fallback.hpp"
+
+#include "utils/surface_pool.hpp"
+#include "utils/text_wrapping.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace colony
+{
+namespace
+{
+
+constexpr std::size_t kMaxCachedSegmentations = 512;
+
+// First face in the chain that provides the code point; the chain's primary
+// face when none does, so missing glyphs tofu in the face the surrounding
+// text uses instead of shifting mid-string.
+TTF_Font* ResolveFace(const std::vector<TTF_Font*>& fonts, std::uint32_t codepoint)
+{
+    for (TTF_Font* font : fonts)
+    {
+        if (font != nullptr && TTF_GlyphIsProvided32(font, codepoint) != 0)
+        {
+            return font;
+        }
+    }
+    return fonts.empty() ? nullptr : fonts.front();
+}
+
+} // namespace
+
+void FontFallbackChain::SetFonts(std::vector<TTF_Font*> fonts)
+{
+    fonts_ = std::move(fonts);
+    segmentCache_.clear();
+}
+
+const std::vector<FontFallbackChain::Run>& FontFallbackChain::Segment(std::string_view text) const
+{
+    const std::string key{text};
+    if (const auto it = segmentCache_.find(key); it != segmentCache_.end())
+    {
+        return it->second;
+    }
+    if (segmentCache_.size() >= kMaxCachedSegmentations)
+    {
+        segmentCache_.clear();
+    }
+
+    std::vector<Run> runs;
+    std::size_t index = 0;
+    std::size_t runStart = 0;
+    TTF_Font* runFont = nullptr;
+    while (index < text.size())
+    {
+        const std::size_t glyphStart = index;
+        const std::uint32_t codepoint = DecodeUtf8(text, index);
+
+        TTF_Font* face = runFont;
+        // Sticky run face: only re-resolve when the current face cannot
+        // render this code point, so shared glyphs (spaces, digits) never
+        // split a run.
+        if (face == nullptr || TTF_GlyphIsProvided32(face, codepoint) == 0)
+        {
+            face = ResolveFace(fonts_, codepoint);
+        }
+
+        if (face != runFont)
+        {
+            if (runFont != nullptr && glyphStart > runStart)
+            {
+                runs.push_back(Run{std::string{text.substr(runStart, glyphStart - runStart)}, runFont});
+            }
+            runStart = glyphStart;
+            runFont = face;
+        }
+    }
+    if (runFont != nullptr && text.size() > runStart)
+    {
+        runs.push_back(Run{std::string{text.substr(runStart)}, runFont});
+    }
+
+    return segmentCache_.emplace(key, std::move(runs)).first->second;
+}
+
+TextTexture CreateFallbackTextTexture(
+    SDL_Renderer* renderer, const FontFallbackChain& chain, std::string_view text, SDL_Color color)
+{
+    if (chain.Empty() || text.empty())
+    {
+        return {};
+    }
+
+    const std::vector<FontFallbackChain::Run>& runs = chain.Segment(text);
+    if (runs.empty())
+    {
+        return {};
+    }
+    if (runs.size() == 1)
+    {
+        return CreateTextTexture(renderer, runs.front().font, runs.front().text, color);
+    }
+
+    // Rasterize each run and composite on a shared baseline: faces in the
+    // chain come in different metrics, and top-aligning them makes the
+    // smaller script float.
+    struct RunSurface
+    {
+        SDL_Surface* surface = nullptr;
+        int ascent = 0;
+    };
+    std::vector<RunSurface> surfaces;
+    surfaces.reserve(runs.size());
+
+    int totalWidth = 0;
+    int maxAscent = 0;
+    int maxDescent = 0;
+    for (const FontFallbackChain::Run& run : runs)
+    {
+        SDL_Surface* surface = TTF_RenderUTF8_Blended(run.font, run.text.c_str(), color);
+        if (surface == nullptr)
+        {
+            continue;
+        }
+        const int ascent = TTF_FontAscent(run.font);
+        surfaces.push_back(RunSurface{surface, ascent});
+        totalWidth += surface->w;
+        maxAscent = std::max(maxAscent, ascent);
+        maxDescent = std::max(maxDescent, surface->h - ascent);
+    }
+    if (surfaces.empty())
+    {
+        return {};
+    }
+
+    // The composite comes from the surface pool and can be bucket-larger
+    // than the text; the region upload below only reads the logical extent.
+    const int totalHeight = maxAscent + maxDescent;
+    SDL_Surface* composite = SurfacePool::Shared().Acquire(totalWidth, totalHeight);
+    if (composite == nullptr)
+    {
+        for (RunSurface& runSurface : surfaces)
+        {
+            SDL_FreeSurface(runSurface.surface);
+        }
+        return {};
+    }
+
+    int cursorX = 0;
+    for (RunSurface& runSurface : surfaces)
+    {
+        SDL_Rect destination{cursorX, maxAscent - runSurface.ascent, runSurface.surface->w, runSurface.surface->h};
+        // Copy the run's pixels as-is; blending against the transparent
+        // composite would thin the antialiased edges.
+        SDL_SetSurfaceBlendMode(runSurface.surface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(runSurface.surface, nullptr, composite, &destination);
+        cursorX += runSurface.surface->w;
+        SDL_FreeSurface(runSurface.surface);
+    }
+
+    TextTexture result = CreateTextureFromSurfaceRegion(renderer, composite, totalWidth, totalHeight);
+    SurfacePool::Shared().Release(composite);
+    return result;
+}
+
+} // namespace colony
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "utils/text.hpp"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// A prioritized list of faces for rendering mixed-script text. A single
+// face covers one script well; catalog strings mix them (a Japanese program
+// title with Latin version tags), which renders tofu through any one font.
+// The chain segments a string into runs by glyph coverage — each run uses
+// the first face that provides its code points — and memoizes the
+// segmentation per string, so repeated strings segment once.
+//
+// Fonts are not owned; whoever reopens them must call SetFonts again, which
+// also drops the memoized runs (a new font can land at a recycled address).
+class FontFallbackChain
+{
+  public:
+    struct Run
+    {
+        std::string text;
+        TTF_Font* font = nullptr;
+    };
+
+    void SetFonts(std::vector<TTF_Font*> fonts);
+    [[nodiscard]] const std::vector<TTF_Font*>& Fonts() const noexcept { return fonts_; }
+    [[nodiscard]] bool Empty() const noexcept { return fonts_.empty(); }
+
+    // Splits text into maximal single-face runs. A code point the current
+    // run's face also provides stays in that run, so spaces and shared
+    // punctuation never force a split on their own.
+    [[nodiscard]] const std::vector<Run>& Segment(std::string_view text) const;
+
+  private:
+    std::vector<TTF_Font*> fonts_;
+
+    // Memoized segmentations; cleared wholesale when full and on SetFonts,
+    // mirroring the wrap cache's policy.
+    mutable std::unordered_map<std::string, std::vector<Run>> segmentCache_;
+};
+
+// Rasterizes text through the chain: one surface per run, baseline-aligned
+// and composited into a single texture. Falls back to the plain single-font
+// path when the whole string fits the first face, which is the overwhelming
+// common case and costs exactly what CreateTextTexture does today.
+[[nodiscard]] TextTexture CreateFallbackTextTexture(
+    SDL_Renderer* renderer, const FontFallbackChain& chain, std::string_view text, SDL_Color color);
+
+} // namespace colony
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <string_view>
 #include <system_error>
 #include <vector>
@@ -257,6 +258,73 @@ bool DownloadToFile(const std::string& url, const std::filesystem::path& destina
     return output.good();
 }
 
+// A cached path is only trusted while the file still exists with content;
+// anything else falls back to a fresh probe.
+bool IsValidFontFile(const std::filesystem::path& path)
+{
+    std::error_code error;
+    if (path.empty() || !std::filesystem::is_regular_file(path, error))
+    {
+        return false;
+    }
+    const auto size = std::filesystem::file_size(path, error);
+    return !error && size > 0;
+}
+
+std::unordered_map<std::string, std::string> LoadResolutionCache(const std::filesystem::path& cachePath)
+{
+    std::unordered_map<std::string, std::string> entries;
+    if (cachePath.empty())
+    {
+        return entries;
+    }
+
+    std::ifstream stream{cachePath};
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        const auto separator = line.find('\t');
+        if (separator == std::string::npos || separator == 0 || separator + 1 >= line.size())
+        {
+            continue;
+        }
+        entries.emplace(line.substr(0, separator), line.substr(separator + 1));
+    }
+    return entries;
+}
+
+void SaveResolutionCache(
+    const std::filesystem::path& cachePath,
+    const std::unordered_map<std::string, std::string>& entries)
+{
+    if (cachePath.empty())
+    {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(cachePath.parent_path(), error);
+
+    // Write-then-rename so a crash mid-write cannot leave a torn cache.
+    const std::filesystem::path tempPath = cachePath.string() + ".tmp";
+    {
+        std::ofstream stream{tempPath, std::ios::trunc};
+        if (!stream.is_open())
+        {
+            return;
+        }
+        for (const auto& [key, value] : entries)
+        {
+            stream << key << '\t' << value << '\n';
+        }
+        if (!stream.good())
+        {
+            return;
+        }
+    }
+    std::filesystem::rename(tempPath, cachePath, error);
+}
+
 } // namespace
 
 std::filesystem::path GetBundledFontPath()
@@ -296,6 +364,18 @@ bool EnsureBundledFontAvailable()
         }
     }
 
+    return false;
+}
+
+bool DownloadBundledFont()
+{
+    const std::filesystem::path bundledPath = BundledFontDestination();
+    std::error_code error;
+    if (std::filesystem::exists(bundledPath, error))
+    {
+        return true;
+    }
+
     if (!DownloadToFile(kFontDownloadUrl, bundledPath))
     {
         std::cerr << "Unable to download font from " << kFontDownloadUrl << "." << std::endl;
@@ -305,10 +385,39 @@ bool EnsureBundledFontAvailable()
     return std::filesystem::exists(bundledPath, error);
 }
 
-FontConfiguration BuildFontConfiguration(std::string_view activeLanguageId)
+FontConfiguration BuildFontConfiguration(
+    std::string_view activeLanguageId,
+    const std::filesystem::path& resolutionCachePath)
 {
     FontConfiguration configuration{};
 
+    auto cache = LoadResolutionCache(resolutionCachePath);
+    bool cacheDirty = false;
+
+    // Resolves through the persisted cache first; fresh probes are recorded
+    // for the next startup.
+    const auto resolveCached = [&](const std::string& cacheKey, std::string_view relativePath) -> std::string {
+        if (const auto it = cache.find(cacheKey); it != cache.end())
+        {
+            if (IsValidFontFile(it->second))
+            {
+                return it->second;
+            }
+            cache.erase(it);
+            cacheDirty = true;
+        }
+
+        const std::filesystem::path path = ResolveBundledFont(relativePath);
+        if (path.empty())
+        {
+            return {};
+        }
+
+        cache[cacheKey] = path.string();
+        cacheDirty = true;
+        return path.string();
+    };
+
     if (const char* envFontPath = std::getenv("COLONY_FONT_PATH"); envFontPath != nullptr)
     {
         std::filesystem::path envPath{envFontPath};
@@ -326,14 +435,11 @@ FontConfiguration BuildFontConfiguration(std::string_view activeLanguageId)
 
     if (configuration.primaryFontPath.empty())
     {
-        EnsureBundledFontAvailable();
+        configuration.bundledFontMissing = !EnsureBundledFontAvailable();
 
         const auto resolvePrimary = [&](std::string_view relativePath) {
-            const std::filesystem::path path = ResolveBundledFont(relativePath);
-            if (!path.empty())
-            {
-                configuration.primaryFontPath = path.string();
-            }
+            configuration.primaryFontPath =
+                resolveCached(std::string{"primary/"} + std::string{relativePath}, relativePath);
         };
 
         if (activeLanguageId == "hi")
@@ -353,13 +459,26 @@ FontConfiguration BuildFontConfiguration(std::string_view activeLanguageId)
         {
             resolvePrimary(kPrimaryFontRelativePath);
         }
+
+        if (configuration.primaryFontPath.empty() && configuration.bundledFontMissing)
+        {
+            // First run on a seat with no local face at all: nothing can be
+            // rendered without a font, so this one case still blocks on the
+            // download. Every other startup comes up with whatever face is
+            // available while the preferred one arrives in the background.
+            if (DownloadBundledFont())
+            {
+                configuration.bundledFontMissing = false;
+                resolvePrimary(kPrimaryFontRelativePath);
+            }
+        }
     }
 
     const auto addNativeFont = [&](std::string_view languageId, std::string_view relativePath) {
-        const std::filesystem::path path = ResolveBundledFont(relativePath);
+        const std::string path = resolveCached(std::string{"native/"} + std::string{languageId}, relativePath);
         if (!path.empty())
         {
-            configuration.nativeLanguageFonts.emplace(languageId, path.string());
+            configuration.nativeLanguageFonts.emplace(languageId, path);
         }
     };
 
@@ -367,7 +486,47 @@ FontConfiguration BuildFontConfiguration(std::string_view activeLanguageId)
     addNativeFont("hi", kDevanagariFontRelativePath);
     addNativeFont("ar", kArabicFontRelativePath);
 
+    if (cacheDirty)
+    {
+        SaveResolutionCache(resolutionCachePath, cache);
+    }
+
     return configuration;
 }
 
+void FontDownloadTask::Start()
+{
+    if (Active())
+    {
+        return;
+    }
+
+    auto state = std::make_shared<State>();
+    state_ = state;
+    drainedFinish_ = false;
+
+    std::thread worker{[state]() {
+        state->succeeded.store(DownloadBundledFont(), std::memory_order_release);
+        state->finished.store(true, std::memory_order_release);
+    }};
+    worker.detach();
+}
+
+bool FontDownloadTask::Active() const noexcept
+{
+    return state_ != nullptr && !state_->finished.load(std::memory_order_acquire);
+}
+
+bool FontDownloadTask::Drain(bool& outSucceeded)
+{
+    if (state_ == nullptr || drainedFinish_ || !state_->finished.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    drainedFinish_ = true;
+    outSucceeded = state_->succeeded.load(std::memory_order_acquire);
+    return true;
+}
+
 } // namespace colony::fonts
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -10,14 +12,57 @@ namespace colony::fonts
 
 std::filesystem::path GetBundledFontPath();
 
+// Makes the bundled primary face available by copying a legacy or system
+// font into place. Never touches the network; a missing face is reported
+// through FontConfiguration::bundledFontMissing so the caller can fetch it
+// in the background.
 bool EnsureBundledFontAvailable();
 
+// Blocking download of the bundled primary face. Returns true once the file
+// is in place. Safe to call from a worker thread.
+bool DownloadBundledFont();
+
 struct FontConfiguration
 {
     std::string primaryFontPath;
     std::unordered_map<std::string, std::string> nativeLanguageFonts;
+
+    // The preferred bundled face is absent and could not be copied from a
+    // local source; a background download can supply it later.
+    bool bundledFontMissing = false;
 };
 
-FontConfiguration BuildFontConfiguration(std::string_view activeLanguageId);
+// Resolves the font set for the language. When resolutionCachePath is
+// non-empty, previously resolved paths are reused (validated by existence
+// and non-zero size) so warm starts skip the directory probing, and fresh
+// resolutions are persisted back.
+FontConfiguration BuildFontConfiguration(
+    std::string_view activeLanguageId,
+    const std::filesystem::path& resolutionCachePath = {});
+
+// Detached background download of the bundled primary face, following the
+// same start/drain shape as the other worker threads: poll Drain from the
+// main loop and hot-swap the font set when it reports success.
+class FontDownloadTask
+{
+public:
+    void Start();
+
+    [[nodiscard]] bool Active() const noexcept;
+
+    // Returns true exactly once, when the worker has finished since the
+    // last call; outSucceeded reports whether the font is now in place.
+    bool Drain(bool& outSucceeded);
+
+private:
+    struct State
+    {
+        std::atomic<bool> finished{false};
+        std::atomic<bool> succeeded{false};
+    };
+
+    std::shared_ptr<State> state_;
+    bool drainedFinish_ = false;
+};
 
 } // namespace colony::fonts
@@ -0,0 +1,82 @@
+#include "utils/frame_arena.hpp"
+
+namespace colony
+{
+
+void* FrameArena::CountingUpstream::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    ++allocationCount;
+    bytesAllocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void FrameArena::CountingUpstream::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool FrameArena::CountingUpstream::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void* FrameArena::TrackingResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    owner_.bytesUsed_ += bytes;
+    return owner_.monotonic_->allocate(bytes, alignment);
+}
+
+void FrameArena::TrackingResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+{
+    // Monotonic storage is reclaimed wholesale in Reset().
+    (void)pointer;
+    (void)bytes;
+    (void)alignment;
+}
+
+bool FrameArena::TrackingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+FrameArena::FrameArena()
+    : buffer_(kInitialCapacity)
+    , tracking_(*this)
+{
+    monotonic_.emplace(buffer_.data(), buffer_.size(), &upstream_);
+}
+
+void FrameArena::Reset()
+{
+    const std::size_t spilledBytes = upstream_.bytesAllocated;
+
+    // Destroying the monotonic resource returns any spilled blocks to the
+    // upstream heap before the buffer is regrown to cover them next frame.
+    monotonic_.reset();
+    if (spilledBytes > 0)
+    {
+        buffer_.resize(buffer_.size() + spilledBytes);
+    }
+
+    upstream_.allocationCount = 0;
+    upstream_.bytesAllocated = 0;
+    bytesUsed_ = 0;
+    monotonic_.emplace(buffer_.data(), buffer_.size(), &upstream_);
+}
+
+std::pmr::memory_resource* FrameArena::Resource() noexcept
+{
+    return &tracking_;
+}
+
+std::size_t FrameArena::BytesUsed() const noexcept
+{
+    return bytesUsed_;
+}
+
+std::size_t FrameArena::HeapAllocationCount() const noexcept
+{
+    return upstream_.allocationCount;
+}
+
+} // namespace colony
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+namespace colony
+{
+
+// Frame-scoped bump allocator. Reset() at the start of each rendered frame
+// rewinds the arena instead of freeing, and the backing buffer is grown to
+// the high-water mark of the previous frame, so steady-state frames serve
+// every transient allocation from memory that is already resident. Overflow
+// falls back to the heap and is counted, which makes allocation regressions
+// visible without a profiler.
+class FrameArena
+{
+public:
+    FrameArena();
+
+    // Rewinds the arena. Anything allocated from it in the previous frame is
+    // invalid after this call; callers must not retain arena-backed
+    // containers across frames.
+    void Reset();
+
+    // Memory resource for std::pmr containers scoped to the current frame.
+    [[nodiscard]] std::pmr::memory_resource* Resource() noexcept;
+
+    // Bytes handed out since the last Reset().
+    [[nodiscard]] std::size_t BytesUsed() const noexcept;
+
+    // Heap allocations since the last Reset(); zero once the buffer has
+    // warmed up to the frame's working set.
+    [[nodiscard]] std::size_t HeapAllocationCount() const noexcept;
+
+private:
+    // Counts allocations that spill past the retained buffer so the next
+    // Reset() can grow it.
+    class CountingUpstream : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocationCount = 0;
+        std::size_t bytesAllocated = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    // Forwards to the monotonic resource while keeping a per-frame byte
+    // count, which the monotonic resource itself does not expose.
+    class TrackingResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit TrackingResource(FrameArena& owner) noexcept
+            : owner_(owner)
+        {
+        }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        FrameArena& owner_;
+    };
+
+    static constexpr std::size_t kInitialCapacity = 16 * 1024;
+
+    std::vector<std::byte> buffer_;
+    CountingUpstream upstream_;
+    std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+    TrackingResource tracking_;
+    std::size_t bytesUsed_ = 0;
+};
+
+} // namespace colony
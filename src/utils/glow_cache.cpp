@@ -0,0 +1,173 @@
+#include "utils/glow_cache.hpp"
+
+#include "utils/texture_accounting.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace colony::drawing
+{
+namespace
+{
+
+// Quadratic falloff reads as a softer, more photographic shadow than a
+// linear ramp and costs the same single multiply per texel.
+std::uint8_t FalloffAlpha(float distance, float blur)
+{
+    if (distance <= 0.0f)
+    {
+        return 255;
+    }
+    if (distance >= blur)
+    {
+        return 0;
+    }
+    const float t = 1.0f - distance / blur;
+    return static_cast<std::uint8_t>(t * t * 255.0f + 0.5f);
+}
+
+} // namespace
+
+GlowCache& GlowCache::Shared()
+{
+    static GlowCache cache;
+    return cache;
+}
+
+GlowCache::Patch* GlowCache::AcquirePatch(SDL_Renderer* renderer, int radius, int blur)
+{
+    const std::uint64_t key =
+        (static_cast<std::uint64_t>(static_cast<std::uint32_t>(radius)) << 32u) | static_cast<std::uint32_t>(blur);
+    if (const auto it = patches_.find(key); it != patches_.end())
+    {
+        return &it->second;
+    }
+
+    const int cornerSize = radius + blur;
+    const int size = 2 * cornerSize + 1;
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, size, size);
+    if (texture == nullptr)
+    {
+        return nullptr;
+    }
+
+    // White with the computed alpha: the corner quadrants hold a quarter of
+    // the blurred disc, and the 1px middle row/column stretch into the edge
+    // and center regions with the correct one-dimensional falloff.
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size) * size * 4, 255);
+    const float blurF = static_cast<float>(std::max(blur, 1));
+    for (int y = 0; y < size; ++y)
+    {
+        for (int x = 0; x < size; ++x)
+        {
+            const float dx = static_cast<float>(std::abs(x - cornerSize));
+            const float dy = static_cast<float>(std::abs(y - cornerSize));
+            const float distance = std::sqrt(dx * dx + dy * dy) - static_cast<float>(radius);
+            pixels[(static_cast<std::size_t>(y) * size + x) * 4 + 3] = FalloffAlpha(distance, blurF);
+        }
+    }
+    SDL_UpdateTexture(texture, nullptr, pixels.data(), size * 4);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    TextureAccounting::Shared().Add(
+        TextureAccounting::Subsystem::PanelChrome, TextureAccounting::EstimateBytes(size, size));
+
+    return &patches_.emplace(key, Patch{texture, cornerSize}).first->second;
+}
+
+void GlowCache::Render(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int blur, SDL_Color color)
+{
+    if (renderer == nullptr || rect.w <= 0 || rect.h <= 0 || color.a == 0)
+    {
+        return;
+    }
+    radius = std::max(radius, 0);
+    blur = std::max(blur, 1);
+
+    Patch* patch = AcquirePatch(renderer, radius, blur);
+    if (patch == nullptr)
+    {
+        return;
+    }
+
+    SDL_SetTextureColorMod(patch->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(patch->texture, color.a);
+
+    const int c = patch->cornerSize;
+    const SDL_Rect destination{rect.x - blur, rect.y - blur, rect.w + 2 * blur, rect.h + 2 * blur};
+
+    if (destination.w < 2 * c || destination.h < 2 * c)
+    {
+        // Too small for the nine-patch split; stretching the whole patch
+        // compresses the falloff evenly, which is visually fine at sizes
+        // this close to the corner span.
+        SDL_RenderCopy(renderer, patch->texture, nullptr, &destination);
+        return;
+    }
+
+    const int innerWidth = destination.w - 2 * c;
+    const int innerHeight = destination.h - 2 * c;
+    const int right = destination.x + destination.w - c;
+    const int bottom = destination.y + destination.h - c;
+
+    const SDL_Rect srcCorner[4] = {
+        {0, 0, c, c},
+        {c + 1, 0, c, c},
+        {0, c + 1, c, c},
+        {c + 1, c + 1, c, c},
+    };
+    const SDL_Rect dstCorner[4] = {
+        {destination.x, destination.y, c, c},
+        {right, destination.y, c, c},
+        {destination.x, bottom, c, c},
+        {right, bottom, c, c},
+    };
+    for (int corner = 0; corner < 4; ++corner)
+    {
+        SDL_RenderCopy(renderer, patch->texture, &srcCorner[corner], &dstCorner[corner]);
+    }
+
+    if (innerWidth > 0)
+    {
+        const SDL_Rect srcTop{c, 0, 1, c};
+        const SDL_Rect dstTop{destination.x + c, destination.y, innerWidth, c};
+        SDL_RenderCopy(renderer, patch->texture, &srcTop, &dstTop);
+        const SDL_Rect srcBottom{c, c + 1, 1, c};
+        const SDL_Rect dstBottom{destination.x + c, bottom, innerWidth, c};
+        SDL_RenderCopy(renderer, patch->texture, &srcBottom, &dstBottom);
+    }
+    if (innerHeight > 0)
+    {
+        const SDL_Rect srcLeft{0, c, c, 1};
+        const SDL_Rect dstLeft{destination.x, destination.y + c, c, innerHeight};
+        SDL_RenderCopy(renderer, patch->texture, &srcLeft, &dstLeft);
+        const SDL_Rect srcRight{c + 1, c, c, 1};
+        const SDL_Rect dstRight{right, destination.y + c, c, innerHeight};
+        SDL_RenderCopy(renderer, patch->texture, &srcRight, &dstRight);
+    }
+    if (innerWidth > 0 && innerHeight > 0)
+    {
+        const SDL_Rect srcCenter{c, c, 1, 1};
+        const SDL_Rect dstCenter{destination.x + c, destination.y + c, innerWidth, innerHeight};
+        SDL_RenderCopy(renderer, patch->texture, &srcCenter, &dstCenter);
+    }
+}
+
+void GlowCache::ReleaseTextures()
+{
+    for (auto& [key, patch] : patches_)
+    {
+        if (patch.texture != nullptr)
+        {
+            const int size = 2 * patch.cornerSize + 1;
+            TextureAccounting::Shared().Remove(
+                TextureAccounting::Subsystem::PanelChrome, TextureAccounting::EstimateBytes(size, size));
+            SDL_DestroyTexture(patch.texture);
+        }
+    }
+    patches_.clear();
+}
+
+} // namespace colony::drawing
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace colony::drawing
+{
+
+// Cache of soft rounded glow/shadow patches. The translucent halos behind
+// cards, nav items and dialog panels used to be layered rounded-rect fills —
+// per-pixel corner rasterization every frame, impossible to batch. Each
+// distinct (corner radius, blur) pair is instead rendered once into a small
+// white nine-patch texture whose alpha falls off over the blur band; a draw
+// is then nine blits of that patch, tinted to any color via texture
+// modulation, so the color never multiplies the cache.
+//
+// Patches scale with the UI scale through their pixel parameters, so a DPI
+// change simply populates new keys; ReleaseTextures drops everything when
+// the renderer's textures are being torn down wholesale.
+class GlowCache
+{
+  public:
+    [[nodiscard]] static GlowCache& Shared();
+
+    // Draws a glow whose solid core covers rect (with the given corner
+    // radius) and whose alpha fades to zero over blur pixels beyond every
+    // edge. color supplies the tint and peak alpha.
+    void Render(SDL_Renderer* renderer, const SDL_Rect& rect, int radius, int blur, SDL_Color color);
+
+    void ReleaseTextures();
+
+  private:
+    struct Patch
+    {
+        SDL_Texture* texture = nullptr;
+        // radius + blur: the corner span of the nine-patch; the texture is
+        // (2 * cornerSize + 1) pixels square with a 1px stretchable cross.
+        int cornerSize = 0;
+    };
+
+    [[nodiscard]] Patch* AcquirePatch(SDL_Renderer* renderer, int radius, int blur);
+
+    std::unordered_map<std::uint64_t, Patch> patches_;
+};
+
+} // namespace colony::drawing
@@ -0,0 +1,218 @@
+#include "utils/glyph_atlas.hpp"
+
+#include "utils/surface_pool.hpp"
+#include "utils/text_wrapping.hpp"
+#include "utils/texture_accounting.hpp"
+
+#include <algorithm>
+
+namespace colony
+{
+namespace
+{
+
+// Page side. A page holds a few hundred glyphs at UI sizes; the editing
+// fields this serves rarely need more than one page per font.
+constexpr int kPageSize = 512;
+
+// One transparent pixel of padding between packed glyphs so linear sampling
+// never bleeds a neighbor in.
+constexpr int kGlyphPadding = 1;
+
+} // namespace
+
+GlyphAtlas& GlyphAtlas::Shared()
+{
+    static GlyphAtlas atlas;
+    return atlas;
+}
+
+GlyphAtlas::Glyph* GlyphAtlas::AcquireGlyph(
+    SDL_Renderer* renderer, FontAtlas& atlas, TTF_Font* font, std::uint32_t codepoint)
+{
+    auto it = atlas.glyphs.find(codepoint);
+    if (it != atlas.glyphs.end() && it->second.rasterized)
+    {
+        return &it->second;
+    }
+
+    int minX = 0;
+    int maxX = 0;
+    int minY = 0;
+    int maxY = 0;
+    int advance = 0;
+    if (TTF_GlyphMetrics32(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0)
+    {
+        advance = 0;
+    }
+
+    Glyph glyph;
+    glyph.advance = advance;
+    glyph.offsetX = minX;
+    glyph.offsetY = atlas.ascent - maxY;
+    glyph.rasterized = true;
+
+    // White so draw-time vertex color supplies the tint; the surface arrives
+    // in whatever format the library picked and is normalized to the pages'
+    // RGBA32 before upload.
+    SDL_Surface* rendered = TTF_RenderGlyph32_Blended(font, codepoint, SDL_Color{255, 255, 255, 255});
+    if (rendered != nullptr && rendered->w > 0 && rendered->h > 0)
+    {
+        // Pooled normalization surface; it can be bucket-larger than the
+        // glyph, and the packed-rect upload below only reads the glyph.
+        SDL_Surface* converted = SurfacePool::Shared().Acquire(rendered->w, rendered->h);
+        if (converted != nullptr)
+        {
+            SDL_SetSurfaceBlendMode(rendered, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(rendered, nullptr, converted, nullptr);
+
+            const int width = rendered->w;
+            const int height = rendered->h;
+            if (atlas.pages.empty() || atlas.packX + width + kGlyphPadding > kPageSize)
+            {
+                // New shelf; new page when the shelf would fall off the
+                // bottom.
+                atlas.packX = 0;
+                atlas.packY += atlas.shelfHeight + kGlyphPadding;
+                atlas.shelfHeight = 0;
+            }
+            if (atlas.pages.empty() || atlas.packY + height + kGlyphPadding > kPageSize)
+            {
+                SDL_Texture* page = SDL_CreateTexture(
+                    renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+                if (page == nullptr)
+                {
+                    SurfacePool::Shared().Release(converted);
+                    SDL_FreeSurface(rendered);
+                    return nullptr;
+                }
+                SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+                TextureAccounting::Shared().Add(
+                    TextureAccounting::Subsystem::TextCache,
+                    TextureAccounting::EstimateBytes(kPageSize, kPageSize));
+                atlas.pages.push_back(page);
+                atlas.packX = 0;
+                atlas.packY = 0;
+                atlas.shelfHeight = 0;
+            }
+
+            glyph.page = atlas.pages.back();
+            glyph.rect = SDL_Rect{atlas.packX, atlas.packY, width, height};
+            SDL_UpdateTexture(glyph.page, &glyph.rect, converted->pixels, converted->pitch);
+            atlas.packX += width + kGlyphPadding;
+            atlas.shelfHeight = std::max(atlas.shelfHeight, height);
+
+            SurfacePool::Shared().Release(converted);
+        }
+    }
+    if (rendered != nullptr)
+    {
+        SDL_FreeSurface(rendered);
+    }
+
+    return &(atlas.glyphs[codepoint] = glyph);
+}
+
+int GlyphAtlas::AppendText(
+    drawing::DrawList& list,
+    SDL_Renderer* renderer,
+    TTF_Font* font,
+    std::string_view text,
+    int x,
+    int y,
+    SDL_Color color)
+{
+    if (renderer == nullptr || font == nullptr || text.empty())
+    {
+        return 0;
+    }
+
+    auto [atlasIt, inserted] = fonts_.try_emplace(font);
+    FontAtlas& atlas = atlasIt->second;
+    if (inserted)
+    {
+        atlas.ascent = TTF_FontAscent(font);
+    }
+
+    int penX = 0;
+    std::size_t index = 0;
+    while (index < text.size())
+    {
+        const std::uint32_t codepoint = DecodeUtf8(text, index);
+        const Glyph* glyph = AcquireGlyph(renderer, atlas, font, codepoint);
+        if (glyph == nullptr)
+        {
+            continue;
+        }
+        if (glyph->page != nullptr)
+        {
+            const SDL_Rect destination{
+                x + penX + glyph->offsetX, y + glyph->offsetY, glyph->rect.w, glyph->rect.h};
+            list.CopyTexture(glyph->page, glyph->rect, destination, color);
+        }
+        penX += glyph->advance;
+    }
+    return penX;
+}
+
+int GlyphAtlas::RenderText(SDL_Renderer* renderer, TTF_Font* font, std::string_view text, int x, int y, SDL_Color color)
+{
+    const int width = AppendText(immediateList_, renderer, font, text, x, y, color);
+    if (!immediateList_.Empty())
+    {
+        immediateList_.Submit(renderer);
+    }
+    return width;
+}
+
+int GlyphAtlas::MeasureWidth(TTF_Font* font, std::string_view text)
+{
+    if (font == nullptr || text.empty())
+    {
+        return 0;
+    }
+
+    FontAtlas& atlas = fonts_[font];
+    int width = 0;
+    std::size_t index = 0;
+    while (index < text.size())
+    {
+        const std::uint32_t codepoint = DecodeUtf8(text, index);
+        auto it = atlas.glyphs.find(codepoint);
+        if (it == atlas.glyphs.end())
+        {
+            // Metrics-only entry; pixels arrive if the glyph is ever drawn.
+            int minX = 0;
+            int maxX = 0;
+            int minY = 0;
+            int maxY = 0;
+            int advance = 0;
+            if (TTF_GlyphMetrics32(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0)
+            {
+                advance = 0;
+            }
+            Glyph glyph;
+            glyph.advance = advance;
+            it = atlas.glyphs.emplace(codepoint, glyph).first;
+        }
+        width += it->second.advance;
+    }
+    return width;
+}
+
+void GlyphAtlas::ReleaseTextures()
+{
+    for (auto& [font, atlas] : fonts_)
+    {
+        for (SDL_Texture* page : atlas.pages)
+        {
+            TextureAccounting::Shared().Remove(
+                TextureAccounting::Subsystem::TextCache, TextureAccounting::EstimateBytes(kPageSize, kPageSize));
+            SDL_DestroyTexture(page);
+        }
+    }
+    fonts_.clear();
+    immediateList_.Clear();
+}
+
+} // namespace colony
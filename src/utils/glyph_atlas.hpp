@@ -0,0 +1,86 @@
+#pragma once
+
+#include "utils/drawing.hpp"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// Glyph-level text renderer for strings that change every keystroke — the
+// search and filter drafts, the hex fields in the custom theme dialog. The
+// whole-string caches are the right tool for stable labels, but an editing
+// field invalidates on every character, paying a full surface render and
+// texture upload per keypress. Here each (font, code point) is rasterized
+// once into a shared atlas page and a string is just one batched quad run
+// through the draw-command layer, so a keystroke uploads at most the few
+// glyphs never seen before.
+//
+// Glyphs are stored white and tinted per vertex at draw time; advances come
+// from the same per-glyph metrics the wrapper uses, so kerning is ignored
+// with the same one-glyph-early tradeoff. Fonts are not owned — call
+// ReleaseTextures whenever fonts are reopened, alongside the other text
+// caches.
+class GlyphAtlas
+{
+  public:
+    [[nodiscard]] static GlyphAtlas& Shared();
+
+    // Appends one tinted quad per glyph; the caller submits the list.
+    // Returns the advance width of the appended text.
+    int AppendText(
+        drawing::DrawList& list,
+        SDL_Renderer* renderer,
+        TTF_Font* font,
+        std::string_view text,
+        int x,
+        int y,
+        SDL_Color color);
+
+    // Immediate convenience for call sites without a draw list of their own:
+    // records into an internal list and submits it, which still collapses
+    // the string into one geometry batch per atlas page.
+    int RenderText(SDL_Renderer* renderer, TTF_Font* font, std::string_view text, int x, int y, SDL_Color color);
+
+    // Advance width without touching any texture; only metrics are cached.
+    [[nodiscard]] int MeasureWidth(TTF_Font* font, std::string_view text);
+
+    void ReleaseTextures();
+
+  private:
+    struct Glyph
+    {
+        SDL_Texture* page = nullptr;
+        SDL_Rect rect{0, 0, 0, 0};
+        // Placement relative to the pen position and the font's ascent.
+        int offsetX = 0;
+        int offsetY = 0;
+        int advance = 0;
+        // Metrics-only entries (from MeasureWidth) have no pixels yet.
+        bool rasterized = false;
+    };
+
+    struct FontAtlas
+    {
+        std::vector<SDL_Texture*> pages;
+        std::unordered_map<std::uint32_t, Glyph> glyphs;
+        // Shelf-packing cursor into the newest page.
+        int packX = 0;
+        int packY = 0;
+        int shelfHeight = 0;
+        int ascent = 0;
+    };
+
+    Glyph* AcquireGlyph(SDL_Renderer* renderer, FontAtlas& atlas, TTF_Font* font, std::uint32_t codepoint);
+
+    std::unordered_map<TTF_Font*, FontAtlas> fonts_;
+    drawing::DrawList immediateList_;
+};
+
+} // namespace colony
@@ -0,0 +1,122 @@
+#include "utils/surface_pool.hpp"
+
+namespace colony
+{
+namespace
+{
+
+// Bucket granularity. Text runs cluster tightly by height (one per font
+// size) and loosely by width, so a coarse step keeps the bucket count low
+// while the slack stays a fraction of a run's own footprint.
+constexpr int kBucketGranularity = 64;
+
+// Idle surfaces kept per bucket. A rebuild stages runs one at a time per
+// size, so a short stack covers the overlap between release and reacquire.
+constexpr std::size_t kMaxIdleSurfacesPerBucket = 8;
+
+[[nodiscard]] int BucketDimension(int value)
+{
+    const int buckets = (value + kBucketGranularity - 1) / kBucketGranularity;
+    return buckets * kBucketGranularity;
+}
+
+[[nodiscard]] std::uint64_t BucketKey(int bucketWidth, int bucketHeight)
+{
+    return (static_cast<std::uint64_t>(bucketWidth) << 32) | static_cast<std::uint32_t>(bucketHeight);
+}
+
+} // namespace
+
+SurfacePool& SurfacePool::Shared()
+{
+    static SurfacePool pool;
+    return pool;
+}
+
+SDL_Surface* SurfacePool::Acquire(int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return nullptr;
+    }
+
+    const int bucketWidth = BucketDimension(width);
+    const int bucketHeight = BucketDimension(height);
+    const std::uint64_t key = BucketKey(bucketWidth, bucketHeight);
+
+    if (auto it = idle_.find(key); it != idle_.end() && !it->second.empty())
+    {
+        SDL_Surface* surface = it->second.back();
+        it->second.pop_back();
+        // Reused surfaces hold the previous tenant's pixels; callers blit
+        // with BLENDMODE_NONE into sub-rects and expect transparency around
+        // them, so hand the surface back fully cleared.
+        SDL_FillRect(surface, nullptr, 0);
+        return surface;
+    }
+
+    return SDL_CreateRGBSurfaceWithFormat(0, bucketWidth, bucketHeight, 32, SDL_PIXELFORMAT_RGBA32);
+}
+
+void SurfacePool::Release(SDL_Surface* surface)
+{
+    if (surface == nullptr)
+    {
+        return;
+    }
+
+    // Only exact bucket-sized RGBA32 surfaces can have come from Acquire;
+    // anything else (a TTF output surface, say) is simply freed.
+    if (surface->format->format != SDL_PIXELFORMAT_RGBA32
+        || surface->w != BucketDimension(surface->w) || surface->h != BucketDimension(surface->h))
+    {
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    auto& bucket = idle_[BucketKey(surface->w, surface->h)];
+    if (bucket.size() >= kMaxIdleSurfacesPerBucket)
+    {
+        SDL_FreeSurface(surface);
+        return;
+    }
+    bucket.push_back(surface);
+}
+
+void SurfacePool::Clear()
+{
+    for (auto& [key, bucket] : idle_)
+    {
+        for (SDL_Surface* surface : bucket)
+        {
+            SDL_FreeSurface(surface);
+        }
+    }
+    idle_.clear();
+}
+
+TextTexture CreateTextureFromSurfaceRegion(
+    SDL_Renderer* renderer, SDL_Surface* surface, int width, int height)
+{
+    if (renderer == nullptr || surface == nullptr || width <= 0 || height <= 0)
+    {
+        return {};
+    }
+
+    sdl::TextureHandle texture{SDL_CreateTexture(
+        renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height)};
+    if (!texture)
+    {
+        return {};
+    }
+    SDL_SetTextureBlendMode(texture.get(), SDL_BLENDMODE_BLEND);
+    // UpdateTexture reads width pixels per row at the surface's own pitch,
+    // so a bucket-padded surface uploads only its logical region.
+    if (SDL_UpdateTexture(texture.get(), nullptr, surface->pixels, surface->pitch) != 0)
+    {
+        return {};
+    }
+    return TextTexture{std::move(texture), width, height};
+}
+
+} // namespace colony
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "utils/text.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// Recycler for the RGBA32 staging surfaces the rasterization paths allocate
+// themselves — fallback-chain composites, glyph format normalization. A
+// theme rebuild walks hundreds of strings, and without the pool each one
+// malloc/frees a fresh surface; with it the allocator sees a handful of
+// stable buckets instead.
+//
+// Like the texture pool, dimensions round up to a bucket granularity, so a
+// handed-out surface can be larger than requested: callers must blit with
+// explicit rects and upload with CreateTextureFromSurfaceRegion rather than
+// SDL_CreateTextureFromSurface, which would capture the padding. Acquired
+// surfaces come back zeroed.
+//
+// Single-threaded, like the texture caches: everything here runs on the SDL
+// thread. Surfaces are plain CPU memory, so the pool stays outside the
+// texture accounting.
+class SurfacePool
+{
+  public:
+    [[nodiscard]] static SurfacePool& Shared();
+
+    // Returns a zeroed RGBA32 surface at least width x height pixels, or
+    // nullptr when allocation fails. The caller owns it until Release.
+    [[nodiscard]] SDL_Surface* Acquire(int width, int height);
+
+    // Returns a surface obtained from Acquire to its free list. Beyond the
+    // per-bucket idle cap (or for surfaces the pool did not create) the
+    // surface is freed instead.
+    void Release(SDL_Surface* surface);
+
+    // Frees the idle inventory; part of the resident-memory trim.
+    void Clear();
+
+  private:
+    std::unordered_map<std::uint64_t, std::vector<SDL_Surface*>> idle_;
+};
+
+// Uploads the top-left width x height region of a surface into a fresh
+// static texture with blending enabled. Safe for pooled surfaces, whose
+// full extent can exceed the logical region.
+[[nodiscard]] TextTexture CreateTextureFromSurfaceRegion(
+    SDL_Renderer* renderer, SDL_Surface* surface, int width, int height);
+
+} // namespace colony
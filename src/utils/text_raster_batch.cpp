@@ -0,0 +1,53 @@
+#include "utils/text_raster_batch.hpp"
+
+#include <string>
+
+namespace colony
+{
+
+TextRasterBatch::~TextRasterBatch()
+{
+    for (Pending& pending : pending_)
+    {
+        SDL_FreeSurface(pending.surface);
+    }
+}
+
+void TextRasterBatch::Stage(TTF_Font* font, std::string_view text, SDL_Color color, TextTexture& destination)
+{
+    if (font == nullptr || text.empty())
+    {
+        destination = {};
+        return;
+    }
+
+    const std::string textString{text};
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, textString.c_str(), color);
+    if (surface == nullptr)
+    {
+        destination = {};
+        return;
+    }
+    pending_.push_back(Pending{surface, &destination});
+}
+
+void TextRasterBatch::Flush(SDL_Renderer* renderer)
+{
+    for (Pending& pending : pending_)
+    {
+        sdl::TextureHandle texture{SDL_CreateTextureFromSurface(renderer, pending.surface)};
+        if (texture)
+        {
+            *pending.destination = TextTexture{std::move(texture), pending.surface->w, pending.surface->h};
+        }
+        else
+        {
+            *pending.destination = {};
+        }
+        SDL_FreeSurface(pending.surface);
+        pending.surface = nullptr;
+    }
+    pending_.clear();
+}
+
+} // namespace colony
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "utils/text.hpp"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <string_view>
+#include <vector>
+
+namespace colony
+{
+
+// Staging layer for bulk text rasterization. CreateTextTexture alternates
+// CPU rasterization, driver upload and surface free per string; a program
+// visuals rebuild does that hundreds of times. The batch splits the work
+// into two coherent phases instead: Stage rasterizes the surface now, Flush
+// uploads every pending surface back-to-back and frees them in one pass, so
+// the driver sees a burst of uploads rather than an interleaved trickle.
+//
+// Destinations are written at Flush time and must stay at stable addresses
+// until then — reserve containers before staging into their elements. A
+// batch that is destroyed without flushing frees its surfaces and leaves
+// the destinations untouched.
+class TextRasterBatch
+{
+  public:
+    TextRasterBatch() = default;
+    TextRasterBatch(const TextRasterBatch&) = delete;
+    TextRasterBatch& operator=(const TextRasterBatch&) = delete;
+    ~TextRasterBatch();
+
+    // Rasterizes the run now and queues its upload into destination. An
+    // empty text, missing font or failed rasterization clears destination
+    // immediately, matching CreateTextTexture's empty result.
+    void Stage(TTF_Font* font, std::string_view text, SDL_Color color, TextTexture& destination);
+
+    // Uploads all staged surfaces and frees them.
+    void Flush(SDL_Renderer* renderer);
+
+  private:
+    struct Pending
+    {
+        SDL_Surface* surface = nullptr;
+        TextTexture* destination = nullptr;
+    };
+
+    std::vector<Pending> pending_;
+};
+
+} // namespace colony
@@ -0,0 +1,97 @@
+#include "utils/text_texture_cache.hpp"
+
+#include "utils/texture_accounting.hpp"
+
+#include <functional>
+
+namespace colony
+{
+namespace
+{
+void CombineHash(std::size_t& seed, std::size_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+} // namespace
+
+std::size_t TextTextureCache::KeyHash::operator()(const Key& key) const noexcept
+{
+    std::size_t seed = std::hash<const void*>{}(key.font);
+    CombineHash(seed, std::hash<std::string>{}(key.text));
+    CombineHash(
+        seed,
+        (static_cast<std::size_t>(key.color.r) << 24) | (static_cast<std::size_t>(key.color.g) << 16)
+            | (static_cast<std::size_t>(key.color.b) << 8) | static_cast<std::size_t>(key.color.a));
+    CombineHash(seed, static_cast<std::size_t>(key.wrapWidth));
+    return seed;
+}
+
+TextTextureCache& TextTextureCache::Shared()
+{
+    static TextTextureCache cache;
+    return cache;
+}
+
+const TextTexture& TextTextureCache::Acquire(
+    SDL_Renderer* renderer,
+    TTF_Font* font,
+    std::string_view text,
+    SDL_Color color,
+    int wrapWidth)
+{
+    Key key{font, std::string{text}, color, wrapWidth};
+
+    if (auto it = entries_.find(key); it != entries_.end())
+    {
+        ++hits_;
+        lruOrder_.splice(lruOrder_.begin(), lruOrder_, it->second.lruIterator);
+        return it->second.texture;
+    }
+
+    ++misses_;
+    TextTexture texture = CreateTextTexture(renderer, font, text, color);
+    const std::size_t bytes =
+        static_cast<std::size_t>(texture.width) * static_cast<std::size_t>(texture.height) * 4u;
+
+    lruOrder_.push_front(key);
+    auto [it, inserted] = entries_.emplace(std::move(key), Entry{std::move(texture), bytes, lruOrder_.begin()});
+    totalBytes_ += bytes;
+    TextureAccounting::Shared().Add(TextureAccounting::Subsystem::TextCache, bytes);
+
+    EvictUntilWithinBudget();
+    return it->second.texture;
+}
+
+void TextTextureCache::Clear()
+{
+    TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::TextCache, totalBytes_);
+    entries_.clear();
+    lruOrder_.clear();
+    totalBytes_ = 0;
+}
+
+void TextTextureCache::SetBudgetBytes(std::size_t budgetBytes)
+{
+    budgetBytes_ = budgetBytes;
+    EvictUntilWithinBudget();
+}
+
+void TextTextureCache::EvictUntilWithinBudget()
+{
+    // Keep at least the most recent entry alive so the reference returned by
+    // Acquire is never invalidated by its own insertion.
+    while (totalBytes_ > budgetBytes_ && lruOrder_.size() > 1)
+    {
+        auto it = entries_.find(lruOrder_.back());
+        if (it != entries_.end())
+        {
+            totalBytes_ -= it->second.bytes;
+            TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::TextCache, it->second.bytes);
+            entries_.erase(it);
+        }
+        lruOrder_.pop_back();
+    }
+}
+
+} // namespace colony
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "utils/text.hpp"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace colony
+{
+
+// Process-wide cache of rasterized text runs keyed by (font, text, color,
+// wrap width). Renderers that draw the same strings every frame — dialog
+// chrome, status text, repeated channel labels — acquire textures from here
+// instead of calling CreateTextTexture, so a string is rasterized once and
+// re-rasterized only when one of its inputs actually changes.
+//
+// Entries are evicted least-recently-used once the texture-memory budget is
+// exceeded. Returned references stay valid until the next Acquire or Clear,
+// which matches the draw-immediately usage pattern of the callers.
+class TextTextureCache
+{
+  public:
+    // Shared instance used by the application's render paths.
+    [[nodiscard]] static TextTextureCache& Shared();
+
+    // Returns the cached texture for the run, rasterizing it on a miss.
+    // wrapWidth participates in the key only; wrapping itself is handled by
+    // the callers (they cache per-line runs).
+    const TextTexture& Acquire(
+        SDL_Renderer* renderer,
+        TTF_Font* font,
+        std::string_view text,
+        SDL_Color color,
+        int wrapWidth = 0);
+
+    void Clear();
+
+    void SetBudgetBytes(std::size_t budgetBytes);
+    [[nodiscard]] std::size_t TotalBytes() const noexcept { return totalBytes_; }
+    [[nodiscard]] std::size_t EntryCount() const noexcept { return entries_.size(); }
+    [[nodiscard]] std::size_t HitCount() const noexcept { return hits_; }
+    [[nodiscard]] std::size_t MissCount() const noexcept { return misses_; }
+
+  private:
+    struct Key
+    {
+        TTF_Font* font = nullptr;
+        std::string text;
+        SDL_Color color{0, 0, 0, SDL_ALPHA_OPAQUE};
+        int wrapWidth = 0;
+
+        [[nodiscard]] bool operator==(const Key& other) const noexcept
+        {
+            return font == other.font && wrapWidth == other.wrapWidth && color.r == other.color.r
+                && color.g == other.color.g && color.b == other.color.b && color.a == other.color.a
+                && text == other.text;
+        }
+    };
+
+    struct KeyHash
+    {
+        [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry
+    {
+        TextTexture texture;
+        std::size_t bytes = 0;
+        std::list<Key>::iterator lruIterator;
+    };
+
+    void EvictUntilWithinBudget();
+
+    static constexpr std::size_t kDefaultBudgetBytes = 64u * 1024u * 1024u;
+
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    std::list<Key> lruOrder_; // Front is most recently used.
+    std::size_t totalBytes_ = 0;
+    std::size_t budgetBytes_ = kDefaultBudgetBytes;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+};
+
+} // namespace colony
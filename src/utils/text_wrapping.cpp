@@ -1,7 +1,9 @@
 #include "utils/text_wrapping.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -9,6 +11,12 @@ namespace colony
 {
 namespace
 {
+// Wrap results are memoized per (font, width, text); live panel resizing
+// re-wraps the same paragraphs at a handful of widths, so the cache turns
+// repeat calls into a single lookup. Cleared wholesale when it fills and on
+// ClearWrapCaches (fonts reopened).
+constexpr std::size_t kMaxCachedWraps = 512;
+
 std::size_t Utf8CharLength(unsigned char lead)
 {
     if (lead < 0x80)
@@ -30,44 +38,104 @@ std::size_t Utf8CharLength(unsigned char lead)
     return 1;
 }
 
-int MeasureWidth(TTF_Font* font, const std::string& text)
+} // namespace
+
+std::uint32_t DecodeUtf8(std::string_view text, std::size_t& index)
+{
+    const unsigned char lead = static_cast<unsigned char>(text[index]);
+    std::size_t length = Utf8CharLength(lead);
+    length = std::min(length, text.size() - index);
+
+    std::uint32_t codepoint = lead;
+    switch (length)
+    {
+    case 2:
+        codepoint = lead & 0x1Fu;
+        break;
+    case 3:
+        codepoint = lead & 0x0Fu;
+        break;
+    case 4:
+        codepoint = lead & 0x07u;
+        break;
+    default:
+        index += length;
+        return codepoint;
+    }
+
+    for (std::size_t i = 1; i < length; ++i)
+    {
+        const unsigned char continuation = static_cast<unsigned char>(text[index + i]);
+        codepoint = (codepoint << 6) | (continuation & 0x3Fu);
+    }
+
+    index += length;
+    return codepoint;
+}
+
+namespace
+{
+
+using AdvanceTable = std::unordered_map<std::uint32_t, int>;
+
+std::unordered_map<TTF_Font*, AdvanceTable>& AdvanceCache()
+{
+    static std::unordered_map<TTF_Font*, AdvanceTable> cache;
+    return cache;
+}
+
+// Horizontal advance of a single glyph, cached per font. Advances ignore
+// kerning, which at worst wraps a line one glyph early — an acceptable trade
+// for replacing a TTF_SizeUTF8 call per candidate with a table lookup.
+int GlyphAdvance(TTF_Font* font, std::uint32_t codepoint)
 {
-    if (text.empty())
+    AdvanceTable& table = AdvanceCache()[font];
+    if (const auto it = table.find(codepoint); it != table.end())
     {
-        return 0;
+        return it->second;
     }
 
+    int minX = 0;
+    int maxX = 0;
+    int minY = 0;
+    int maxY = 0;
+    int advance = 0;
+    if (TTF_GlyphMetrics32(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0)
+    {
+        advance = 0;
+    }
+    table.emplace(codepoint, advance);
+    return advance;
+}
+
+int MeasureAdvanceWidth(TTF_Font* font, std::string_view text)
+{
     int width = 0;
-    int height = 0;
-    if (TTF_SizeUTF8(font, text.c_str(), &width, &height) != 0)
+    std::size_t index = 0;
+    while (index < text.size())
     {
-        return -1;
+        width += GlyphAdvance(font, DecodeUtf8(text, index));
     }
     return width;
 }
 
 std::size_t FindFittingPrefix(TTF_Font* font, std::string_view text, int maxWidth)
 {
-    std::size_t best = 0;
     std::size_t index = 0;
+    int width = 0;
     while (index < text.size())
     {
-        std::size_t charLength = Utf8CharLength(static_cast<unsigned char>(text[index]));
-        charLength = std::min(charLength, text.size() - index);
-        std::string candidate{text.substr(0, index + charLength)};
-        const int width = MeasureWidth(font, candidate);
-        if (width < 0)
-        {
-            return text.size();
-        }
-        if (width > maxWidth)
+        std::size_t next = index;
+        const std::uint32_t codepoint = DecodeUtf8(text, next);
+        const int advance = GlyphAdvance(font, codepoint);
+        if (width + advance > maxWidth)
         {
             break;
         }
-        best = index + charLength;
-        index += charLength;
+        width += advance;
+        index = next;
     }
-    return best;
+    return index;
 }
 
 std::vector<std::string> BreakLongWord(TTF_Font* font, const std::string& word, int maxWidth)
@@ -89,6 +157,35 @@ std::vector<std::string> BreakLongWord(TTF_Font* font, const std::string& word,
     return chunks;
 }
 
+struct WrapKey
+{
+    TTF_Font* font = nullptr;
+    int maxWidth = 0;
+    std::string text;
+
+    bool operator==(const WrapKey& other) const noexcept
+    {
+        return font == other.font && maxWidth == other.maxWidth && text == other.text;
+    }
+};
+
+struct WrapKeyHash
+{
+    std::size_t operator()(const WrapKey& key) const noexcept
+    {
+        std::size_t hash = std::hash<const void*>{}(key.font);
+        hash ^= std::hash<int>{}(key.maxWidth) + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<std::string>{}(key.text) + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+std::unordered_map<WrapKey, std::vector<std::string>, WrapKeyHash>& WrapCache()
+{
+    static std::unordered_map<WrapKey, std::vector<std::string>, WrapKeyHash> cache;
+    return cache;
+}
+
 } // namespace
 
 std::vector<std::string> WrapTextToWidth(TTF_Font* font, std::string_view text, int maxWidth)
@@ -112,14 +209,46 @@ std::vector<std::string> WrapTextToWidth(TTF_Font* font, std::string_view text,
         return lines;
     }
 
-    const std::string source{text};
+    WrapKey key{font, maxWidth, std::string{text}};
+    auto& cache = WrapCache();
+    if (const auto it = cache.find(key); it != cache.end())
+    {
+        return it->second;
+    }
+
+    const std::string& source = key.text;
     std::string currentLine;
+    int currentLineWidth = 0;
+    const int spaceAdvance = GlyphAdvance(font, ' ');
 
     auto pushLine = [&](bool forceEmpty = false) {
         if (!currentLine.empty() || forceEmpty)
         {
             lines.emplace_back(std::move(currentLine));
             currentLine.clear();
+            currentLineWidth = 0;
+        }
+    };
+
+    auto startLineWithWord = [&](std::string word, int wordWidth) {
+        if (wordWidth > maxWidth)
+        {
+            auto chunks = BreakLongWord(font, word, maxWidth);
+            if (!chunks.empty())
+            {
+                std::string trailingSegment = std::move(chunks.back());
+                for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
+                {
+                    lines.emplace_back(std::move(chunks[i]));
+                }
+                currentLineWidth = MeasureAdvanceWidth(font, trailingSegment);
+                currentLine = std::move(trailingSegment);
+            }
+        }
+        else
+        {
+            currentLine = std::move(word);
+            currentLineWidth = wordWidth;
         }
     };
 
@@ -132,66 +261,21 @@ std::vector<std::string> WrapTextToWidth(TTF_Font* font, std::string_view text,
 
         if (!word.empty())
         {
-            std::string candidate;
+            const int wordWidth = MeasureAdvanceWidth(font, word);
             if (currentLine.empty())
             {
-                candidate = word;
+                startLineWithWord(std::move(word), wordWidth);
             }
-            else
+            else if (currentLineWidth + spaceAdvance + wordWidth <= maxWidth)
             {
-                candidate.reserve(currentLine.size() + 1 + word.size());
-                candidate.append(currentLine);
-                candidate.push_back(' ');
-                candidate.append(word);
-            }
-
-            const int candidateWidth = MeasureWidth(font, candidate.empty() ? word : candidate);
-            if (!candidate.empty() && candidateWidth >= 0 && candidateWidth <= maxWidth)
-            {
-                currentLine = std::move(candidate);
-            }
-            else if (currentLine.empty())
-            {
-                const int wordWidth = MeasureWidth(font, word);
-                if (wordWidth > maxWidth && wordWidth >= 0)
-                {
-                    const auto chunks = BreakLongWord(font, word, maxWidth);
-                    if (!chunks.empty())
-                    {
-                        std::string trailingSegment = std::move(chunks.back());
-                        for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
-                        {
-                            lines.emplace_back(std::move(chunks[i]));
-                        }
-                        currentLine = std::move(trailingSegment);
-                    }
-                }
-                else
-                {
-                    currentLine = std::move(word);
-                }
+                currentLine.push_back(' ');
+                currentLine.append(word);
+                currentLineWidth += spaceAdvance + wordWidth;
             }
             else
             {
                 pushLine();
-                const int wordWidth = MeasureWidth(font, word);
-                if (wordWidth > maxWidth && wordWidth >= 0)
-                {
-                    const auto chunks = BreakLongWord(font, word, maxWidth);
-                    if (!chunks.empty())
-                    {
-                        std::string trailingSegment = std::move(chunks.back());
-                        for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
-                        {
-                            lines.emplace_back(std::move(chunks[i]));
-                        }
-                        currentLine = std::move(trailingSegment);
-                    }
-                }
-                else
-                {
-                    currentLine = std::move(word);
-                }
+                startLineWithWord(std::move(word), wordWidth);
             }
         }
 
@@ -212,8 +296,18 @@ std::vector<std::string> WrapTextToWidth(TTF_Font* font, std::string_view text,
         lines.emplace_back(std::move(currentLine));
     }
 
-    return lines;
+    if (cache.size() >= kMaxCachedWraps)
+    {
+        cache.clear();
+    }
+    const auto [it, inserted] = cache.emplace(std::move(key), std::move(lines));
+    return it->second;
 }
 
-} // namespace colony
+void ClearWrapCaches()
+{
+    WrapCache().clear();
+    AdvanceCache().clear();
+}
 
+} // namespace colony
@@ -2,6 +2,8 @@
 
 #include <SDL2/SDL_ttf.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -9,10 +11,20 @@
 namespace colony
 {
 
+// Decodes the UTF-8 code point starting at index and advances index past
+// it. Malformed sequences decode as their lead byte so callers can keep
+// going. Shared by wrapping and the font fallback segmenter.
+[[nodiscard]] std::uint32_t DecodeUtf8(std::string_view text, std::size_t& index);
+
 // Wraps UTF-8 text to fit within maxWidth pixels using the provided font.
 // Returns a vector of lines preserving explicit line breaks present in the
 // source text.
 std::vector<std::string> WrapTextToWidth(TTF_Font* font, std::string_view text, int maxWidth);
 
+// Drops the memoized wrap results and per-font glyph-advance tables. Must be
+// called whenever fonts are closed or reopened, since a new font can be
+// allocated at an address a table still refers to.
+void ClearWrapCaches();
+
 } // namespace colony
 
@@ -0,0 +1,56 @@
+#include "utils/texture_accounting.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace colony
+{
+
+TextureAccounting& TextureAccounting::Shared()
+{
+    static TextureAccounting accounting;
+    return accounting;
+}
+
+void TextureAccounting::Add(Subsystem subsystem, std::size_t bytes) noexcept
+{
+    bytes_[static_cast<std::size_t>(subsystem)] += bytes;
+}
+
+void TextureAccounting::Remove(Subsystem subsystem, std::size_t bytes) noexcept
+{
+    std::size_t& tally = bytes_[static_cast<std::size_t>(subsystem)];
+    tally -= std::min(tally, bytes);
+}
+
+std::size_t TextureAccounting::Bytes(Subsystem subsystem) const noexcept
+{
+    return bytes_[static_cast<std::size_t>(subsystem)];
+}
+
+std::size_t TextureAccounting::TotalBytes() const noexcept
+{
+    return std::accumulate(bytes_.begin(), bytes_.end(), std::size_t{0});
+}
+
+std::string_view TextureAccounting::SubsystemLabel(Subsystem subsystem) noexcept
+{
+    switch (subsystem)
+    {
+    case Subsystem::TextCache:
+        return "text cache";
+    case Subsystem::ProgramVisuals:
+        return "program visuals";
+    case Subsystem::PanelChrome:
+        return "panel chrome";
+    case Subsystem::IconAtlas:
+        return "icon atlas";
+    case Subsystem::Other:
+        return "other";
+    case Subsystem::Count:
+        break;
+    }
+    return "?";
+}
+
+} // namespace colony
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace colony
+{
+
+// Process-wide tally of texture memory by owning subsystem. Owners report
+// creation and destruction; the profiler HUD reads the totals, and the
+// program-visuals cache enforces its byte budget against its own tally.
+//
+// Sizes are estimates (width * height * 4 for the RGBA formats every caller
+// uses) — SDL does not expose the driver-side allocation, but the estimate
+// tracks real usage closely enough to steer eviction.
+//
+// All texture owners live on the UI thread, so the counters are plain.
+class TextureAccounting
+{
+  public:
+    enum class Subsystem : std::size_t
+    {
+        TextCache,
+        ProgramVisuals,
+        PanelChrome,
+        IconAtlas,
+        Other,
+        Count
+    };
+
+    [[nodiscard]] static TextureAccounting& Shared();
+
+    void Add(Subsystem subsystem, std::size_t bytes) noexcept;
+    void Remove(Subsystem subsystem, std::size_t bytes) noexcept;
+
+    [[nodiscard]] std::size_t Bytes(Subsystem subsystem) const noexcept;
+    [[nodiscard]] std::size_t TotalBytes() const noexcept;
+
+    [[nodiscard]] static std::size_t EstimateBytes(int width, int height) noexcept
+    {
+        if (width <= 0 || height <= 0)
+        {
+            return 0;
+        }
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4;
+    }
+
+    [[nodiscard]] static std::string_view SubsystemLabel(Subsystem subsystem) noexcept;
+
+  private:
+    std::array<std::size_t, static_cast<std::size_t>(Subsystem::Count)> bytes_{};
+};
+
+} // namespace colony
@@ -0,0 +1,126 @@
+#include "utils/texture_pool.hpp"
+
+#include "utils/texture_accounting.hpp"
+
+namespace colony
+{
+namespace
+{
+
+// Bucket granularity. Coarse enough that a live resize walks through few
+// distinct buckets; fine enough that the slack per texture stays small
+// relative to panel sizes.
+constexpr int kBucketGranularity = 64;
+
+// Idle textures kept per bucket. The frame uses a handful of panel targets
+// plus the visible dialog rows; more idle copies of one size are waste.
+constexpr std::size_t kMaxIdleTexturesPerBucket = 8;
+
+[[nodiscard]] int BucketDimension(int value)
+{
+    const int buckets = (value + kBucketGranularity - 1) / kBucketGranularity;
+    return buckets * kBucketGranularity;
+}
+
+[[nodiscard]] std::uint64_t BucketKey(SDL_Renderer* renderer, int bucketWidth, int bucketHeight)
+{
+    // FNV-1a over the renderer identity and the bucket dimensions.
+    std::uint64_t key = 14695981039346656037ULL;
+    const auto mix = [&key](std::uint64_t value) {
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            key ^= (value >> shift) & 0xffULL;
+            key *= 1099511628211ULL;
+        }
+    };
+    mix(reinterpret_cast<std::uintptr_t>(renderer));
+    mix(static_cast<std::uint64_t>(bucketWidth));
+    mix(static_cast<std::uint64_t>(bucketHeight));
+    return key;
+}
+
+} // namespace
+
+TexturePool& TexturePool::Shared()
+{
+    static TexturePool pool;
+    return pool;
+}
+
+SDL_Texture* TexturePool::AcquireTarget(SDL_Renderer* renderer, int width, int height)
+{
+    if (renderer == nullptr || width <= 0 || height <= 0)
+    {
+        return nullptr;
+    }
+
+    const int bucketWidth = BucketDimension(width);
+    const int bucketHeight = BucketDimension(height);
+    const std::uint64_t key = BucketKey(renderer, bucketWidth, bucketHeight);
+    const std::size_t bytes = TextureAccounting::EstimateBytes(bucketWidth, bucketHeight);
+
+    if (auto it = idle_.find(key); it != idle_.end() && !it->second.empty())
+    {
+        SDL_Texture* texture = it->second.back();
+        it->second.pop_back();
+        TextureAccounting::Shared().Remove(TextureAccounting::Subsystem::Other, bytes);
+        live_.emplace(texture, LiveEntry{key, bytes});
+        return texture;
+    }
+
+    SDL_Texture* texture = SDL_CreateTexture(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, bucketWidth, bucketHeight);
+    if (texture == nullptr)
+    {
+        return nullptr;
+    }
+    live_.emplace(texture, LiveEntry{key, bytes});
+    return texture;
+}
+
+void TexturePool::Release(SDL_Texture* texture)
+{
+    if (texture == nullptr)
+    {
+        return;
+    }
+
+    const auto it = live_.find(texture);
+    if (it == live_.end())
+    {
+        // Not ours; destroying is the only safe disposition.
+        SDL_DestroyTexture(texture);
+        return;
+    }
+
+    const LiveEntry entry = it->second;
+    live_.erase(it);
+
+    auto& bucket = idle_[entry.bucketKey];
+    if (bucket.size() >= kMaxIdleTexturesPerBucket)
+    {
+        SDL_DestroyTexture(texture);
+        return;
+    }
+    bucket.push_back(texture);
+    TextureAccounting::Shared().Add(TextureAccounting::Subsystem::Other, entry.bytes);
+}
+
+void TexturePool::ReleaseTextures()
+{
+    for (auto& [key, bucket] : idle_)
+    {
+        for (SDL_Texture* texture : bucket)
+        {
+            int width = 0;
+            int height = 0;
+            SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+            TextureAccounting::Shared().Remove(
+                TextureAccounting::Subsystem::Other, TextureAccounting::EstimateBytes(width, height));
+            SDL_DestroyTexture(texture);
+        }
+    }
+    idle_.clear();
+}
+
+} // namespace colony
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace colony
+{
+
+// Recycler for render-target textures. Texture creation is a driver
+// round-trip, and the panel and row caches destroy and recreate dozens of
+// targets on every window resize, theme change and dialog open. The pool
+// keeps released targets on size-bucketed free lists instead: an acquire
+// that fits an idle bucket is a map lookup, and the driver is only asked
+// for genuinely new sizes.
+//
+// Dimensions round up to the bucket granularity, so a handed-out texture
+// can be larger than requested — callers must blit with an explicit source
+// rect rather than passing nullptr. Pooled textures belong to the renderer
+// they were created with and are only ever handed back to it.
+//
+// Single-threaded like the other texture caches: everything here runs on
+// the SDL thread.
+class TexturePool
+{
+  public:
+    [[nodiscard]] static TexturePool& Shared();
+
+    // Returns a target texture at least width x height texels, reusing an
+    // idle one when the bucket has it. Returns nullptr when creation fails;
+    // the caller owns the result until Release.
+    SDL_Texture* AcquireTarget(SDL_Renderer* renderer, int width, int height);
+
+    // Returns a texture obtained from AcquireTarget to its free list.
+    // Beyond the per-bucket idle cap the texture is destroyed instead, so
+    // a burst of odd sizes cannot pin memory forever.
+    void Release(SDL_Texture* texture);
+
+    // Destroys the idle inventory. Textures still handed out are untouched;
+    // they return (and are destroyed) through Release as usual.
+    void ReleaseTextures();
+
+  private:
+    struct LiveEntry
+    {
+        std::uint64_t bucketKey = 0;
+        std::size_t bytes = 0;
+    };
+
+    // Handed-out textures, so Release can find the bucket without the
+    // caller carrying it around.
+    std::unordered_map<SDL_Texture*, LiveEntry> live_;
+    std::unordered_map<std::uint64_t, std::vector<SDL_Texture*>> idle_;
+};
+
+} // namespace colony
@@ -0,0 +1,267 @@
+#include "utils/utf8.hpp"
+
+#include <array>
+#include <cstdint>
+
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define COLONY_TEXT_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define COLONY_TEXT_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace colony::text
+{
+namespace
+{
+// Byte -> folded search character; 0 marks a separator. ASCII digits and
+// lowercase letters map to themselves, uppercase folds, and everything else
+// (including all multibyte lead/continuation bytes) separates, matching the
+// std::isalnum/std::tolower behavior of the loops this replaces.
+constexpr std::array<char, 256> BuildSearchFoldTable()
+{
+    std::array<char, 256> table{};
+    for (int value = '0'; value <= '9'; ++value)
+    {
+        table[static_cast<std::size_t>(value)] = static_cast<char>(value);
+    }
+    for (int value = 'a'; value <= 'z'; ++value)
+    {
+        table[static_cast<std::size_t>(value)] = static_cast<char>(value);
+    }
+    for (int value = 'A'; value <= 'Z'; ++value)
+    {
+        table[static_cast<std::size_t>(value)] = static_cast<char>(value - 'A' + 'a');
+    }
+    return table;
+}
+
+constexpr std::array<char, 256> kSearchFoldTable = BuildSearchFoldTable();
+
+[[nodiscard]] constexpr bool IsContinuationByte(unsigned char byte) noexcept
+{
+    return (byte & 0xC0) == 0x80;
+}
+} // namespace
+
+void ToLowerAsciiInPlace(char* data, std::size_t size) noexcept
+{
+    std::size_t index = 0;
+
+#if defined(COLONY_TEXT_SSE2)
+    // Signed compares exclude bytes >= 0x80 automatically, so multibyte
+    // sequences never pick up the case bit.
+    const __m128i beforeA = _mm_set1_epi8('A' - 1);
+    const __m128i afterZ = _mm_set1_epi8('Z' + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    for (; index + 16 <= size; index += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const __m128i isUpper =
+            _mm_and_si128(_mm_cmpgt_epi8(bytes, beforeA), _mm_cmplt_epi8(bytes, afterZ));
+        bytes = _mm_or_si128(bytes, _mm_and_si128(isUpper, caseBit));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + index), bytes);
+    }
+#elif defined(COLONY_TEXT_NEON)
+    const uint8x16_t letterA = vdupq_n_u8('A');
+    const uint8x16_t letterZ = vdupq_n_u8('Z');
+    const uint8x16_t caseBit = vdupq_n_u8(0x20);
+    for (; index + 16 <= size; index += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(data + index));
+        const uint8x16_t isUpper = vandq_u8(vcgeq_u8(bytes, letterA), vcleq_u8(bytes, letterZ));
+        bytes = vorrq_u8(bytes, vandq_u8(isUpper, caseBit));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(data + index), bytes);
+    }
+#endif
+
+    for (; index < size; ++index)
+    {
+        const char value = data[index];
+        if (value >= 'A' && value <= 'Z')
+        {
+            data[index] = static_cast<char>(value | 0x20);
+        }
+    }
+}
+
+bool IsValidUtf8(std::string_view value) noexcept
+{
+    const char* data = value.data();
+    const std::size_t size = value.size();
+    std::size_t index = 0;
+
+    while (index < size)
+    {
+#if defined(COLONY_TEXT_SSE2)
+        while (index + 16 <= size)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            if (_mm_movemask_epi8(bytes) != 0)
+            {
+                break;
+            }
+            index += 16;
+        }
+        if (index >= size)
+        {
+            break;
+        }
+#elif defined(COLONY_TEXT_NEON)
+        while (index + 16 <= size)
+        {
+            const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(data + index));
+            if (vmaxvq_u8(bytes) >= 0x80)
+            {
+                break;
+            }
+            index += 16;
+        }
+        if (index >= size)
+        {
+            break;
+        }
+#endif
+
+        const unsigned char lead = static_cast<unsigned char>(data[index]);
+        if (lead < 0x80)
+        {
+            ++index;
+            continue;
+        }
+
+        std::size_t length = 0;
+        std::uint32_t codepoint = 0;
+        if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            codepoint = lead & 0x1Fu;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            codepoint = lead & 0x0Fu;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            codepoint = lead & 0x07u;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (index + length > size)
+        {
+            return false;
+        }
+        for (std::size_t offset = 1; offset < length; ++offset)
+        {
+            const unsigned char continuation = static_cast<unsigned char>(data[index + offset]);
+            if (!IsContinuationByte(continuation))
+            {
+                return false;
+            }
+            codepoint = (codepoint << 6) | (continuation & 0x3Fu);
+        }
+
+        constexpr std::uint32_t kMinimumForLength[] = {0, 0, 0x80, 0x800, 0x10000};
+        if (codepoint < kMinimumForLength[length] || codepoint > 0x10FFFF
+            || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+        {
+            return false;
+        }
+        index += length;
+    }
+
+    return true;
+}
+
+std::size_t LastCodepointStart(std::string_view value) noexcept
+{
+    if (value.empty())
+    {
+        return std::string_view::npos;
+    }
+
+    std::size_t index = value.size() - 1;
+    while (index > 0 && IsContinuationByte(static_cast<unsigned char>(value[index])))
+    {
+        --index;
+    }
+    return index;
+}
+
+void RemoveLastCodepoint(std::string& value) noexcept
+{
+    const std::size_t start = LastCodepointStart(value);
+    if (start != std::string_view::npos)
+    {
+        value.erase(start);
+    }
+}
+
+std::string NormalizeForSearch(std::string_view value)
+{
+    std::string normalized;
+    normalized.reserve(value.size());
+
+    const char* data = value.data();
+    const std::size_t size = value.size();
+    std::size_t index = 0;
+    bool previousSpace = false;
+
+    while (index < size)
+    {
+#if defined(COLONY_TEXT_SSE2)
+        // Blocks that are already lowercase alphanumerics copy through
+        // wholesale; typical queries and program ids are exactly that.
+        const __m128i beforeZero = _mm_set1_epi8('0' - 1);
+        const __m128i afterNine = _mm_set1_epi8('9' + 1);
+        const __m128i beforeLowerA = _mm_set1_epi8('a' - 1);
+        const __m128i afterLowerZ = _mm_set1_epi8('z' + 1);
+        while (index + 16 <= size)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+            const __m128i isDigit =
+                _mm_and_si128(_mm_cmpgt_epi8(bytes, beforeZero), _mm_cmplt_epi8(bytes, afterNine));
+            const __m128i isLower =
+                _mm_and_si128(_mm_cmpgt_epi8(bytes, beforeLowerA), _mm_cmplt_epi8(bytes, afterLowerZ));
+            if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLower)) != 0xFFFF)
+            {
+                break;
+            }
+            normalized.append(data + index, 16);
+            previousSpace = false;
+            index += 16;
+        }
+        if (index >= size)
+        {
+            break;
+        }
+#endif
+
+        const char folded = kSearchFoldTable[static_cast<unsigned char>(data[index])];
+        if (folded != 0)
+        {
+            normalized.push_back(folded);
+            previousSpace = false;
+        }
+        else if (!previousSpace && !normalized.empty())
+        {
+            normalized.push_back(' ');
+            previousSpace = true;
+        }
+        ++index;
+    }
+
+    if (!normalized.empty() && normalized.back() == ' ')
+    {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+} // namespace colony::text
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace colony::text
+{
+
+// UTF-8/ASCII helpers shared by hub search, library filtering and the
+// dialogs. Case folding is ASCII-only — multibyte sequences pass through
+// untouched, which is exactly what the per-byte std::tolower loops these
+// replace did. The hot loops take 16-byte SSE2/NEON fast paths and fall
+// back to scalar tails elsewhere, mirroring the kernels in utils/color.cpp.
+
+// Folds 'A'-'Z' to lowercase in place; all other bytes are left alone.
+void ToLowerAsciiInPlace(char* data, std::size_t size) noexcept;
+
+inline void ToLowerAsciiInPlace(std::string& value) noexcept
+{
+    ToLowerAsciiInPlace(value.data(), value.size());
+}
+
+[[nodiscard]] inline std::string ToLowerAscii(std::string value)
+{
+    ToLowerAsciiInPlace(value);
+    return value;
+}
+
+// Structural UTF-8 validation: rejects bad continuation bytes, overlong
+// encodings, surrogates and codepoints above U+10FFFF. Pure-ASCII spans are
+// skipped a block at a time.
+[[nodiscard]] bool IsValidUtf8(std::string_view value) noexcept;
+
+// Offset of the start byte of the last codepoint; npos for an empty view.
+// A trailing sequence of only continuation bytes yields the earliest of
+// them, so malformed input still shrinks byte by byte.
+[[nodiscard]] std::size_t LastCodepointStart(std::string_view value) noexcept;
+
+// Drops the final codepoint (the backspace operation for text inputs).
+void RemoveLastCodepoint(std::string& value) noexcept;
+
+// Search normalization: ASCII alphanumerics lowercased, every other run of
+// bytes collapsed to a single separator space, no leading/trailing space.
+// Runs of already-normalized text are copied 16 bytes at a time.
+[[nodiscard]] std::string NormalizeForSearch(std::string_view value);
+
+} // namespace colony::text
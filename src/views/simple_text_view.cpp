@@ -91,11 +91,26 @@ std::string_view SimpleTextView::Id() const noexcept
 
 void SimpleTextView::BindContent(const ViewContent& content)
 {
+    // Retained textures show the old text if the content changed underneath
+    // them (hot reload); identical rebinds keep the warm set.
+    if (!(content_ == content))
+    {
+        ReleaseTextures();
+    }
     content_ = content;
 }
 
 void SimpleTextView::Activate(const RenderContext& context)
 {
+    // A warm re-activation under the same theme reuses every texture from
+    // the last visit; flipping between two programs costs no rasterization.
+    // The wrap-width keys (lastLayoutWidth_ and friends) survive too, so
+    // Render will not rewrap either unless the bounds changed.
+    if (texturesBuilt_ && builtThemeGeneration_ == context.themeGeneration)
+    {
+        return;
+    }
+
     headingTexture_ = CreateTextTexture(context.renderer, context.headingFont, content_.heading, context.primaryColor);
     paragraphLines_.clear();
     lastLayoutWidth_ = 0;
@@ -107,9 +122,19 @@ void SimpleTextView::Activate(const RenderContext& context)
         context.buttonFont,
         content_.primaryActionLabel,
         context.accentColor);
+
+    texturesBuilt_ = true;
+    builtThemeGeneration_ = context.themeGeneration;
 }
 
 void SimpleTextView::Deactivate()
+{
+    // Textures stay resident; the registry's warm pool calls ReleaseTextures
+    // when this view is evicted. Only the per-activation hitbox is stale.
+    lastActionRect_.reset();
+}
+
+void SimpleTextView::ReleaseTextures()
 {
     headingTexture_ = {};
     paragraphLines_.clear();
@@ -118,16 +143,22 @@ void SimpleTextView::Deactivate()
     lastActionRect_.reset();
     lastLayoutWidth_ = 0;
     lastSectionLayoutWidth_ = 0;
+    texturesBuilt_ = false;
 }
 
 void SimpleTextView::Render(const RenderContext& context, const SDL_Rect& bounds)
 {
-    if (bounds.w > 0 && bounds.w != lastLayoutWidth_)
+    // During a live resize a stale wrap width is acceptable for a few frames;
+    // rewrapping here on every size event is what makes resizing lag. A view
+    // that has never wrapped (width 0) still builds immediately.
+    const bool deferRewrap = context.interactiveResize && lastLayoutWidth_ > 0;
+    if (bounds.w > 0 && bounds.w != lastLayoutWidth_ && !deferRewrap)
     {
         RebuildParagraphTextures(context, bounds.w);
     }
 
-    if (!content_.sections.empty() && bounds.w > 0 && bounds.w != lastSectionLayoutWidth_)
+    const bool deferSectionRewrap = context.interactiveResize && lastSectionLayoutWidth_ > 0;
+    if (!content_.sections.empty() && bounds.w > 0 && bounds.w != lastSectionLayoutWidth_ && !deferSectionRewrap)
     {
         RebuildSectionTextures(context, bounds.w);
     }
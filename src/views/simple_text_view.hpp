@@ -14,6 +14,7 @@ class SimpleTextView : public View
     void BindContent(const ViewContent& content) override;
     void Activate(const RenderContext& context) override;
     void Deactivate() override;
+    void ReleaseTextures() override;
     void Render(const RenderContext& context, const SDL_Rect& bounds) override;
     void OnPrimaryAction(std::string& statusBuffer) override;
     [[nodiscard]] std::optional<SDL_Rect> PrimaryActionRect() const override;
@@ -41,6 +42,10 @@ class SimpleTextView : public View
     mutable std::optional<SDL_Rect> lastActionRect_;
     mutable int lastLayoutWidth_ = 0;
     mutable int lastSectionLayoutWidth_ = 0;
+    // Whether the current textures are usable and the theme generation they
+    // were rasterized under; together they decide if Activate can skip work.
+    bool texturesBuilt_ = false;
+    std::uint64_t builtThemeGeneration_ = 0;
 };
 
 } // namespace colony
@@ -6,6 +6,7 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -23,6 +24,15 @@ struct RenderContext
     SDL_Color primaryColor{};
     SDL_Color mutedColor{};
     SDL_Color accentColor{};
+    // Bumped whenever the theme, fonts or renderer change; views compare it
+    // against the generation their textures were rasterized under, so a warm
+    // re-activation can skip rebuilding entirely.
+    std::uint64_t themeGeneration = 0;
+    // True while the user is live-resizing the window. Views keep rendering
+    // textures wrapped for the previous width instead of rewrapping on every
+    // size event; the settled frame arrives with this cleared and rebuilds
+    // once at the final width.
+    bool interactiveResize = false;
 };
 
 class View
@@ -33,7 +43,11 @@ class View
     virtual std::string_view Id() const noexcept = 0;
     virtual void BindContent(const ViewContent& content) = 0;
     virtual void Activate(const RenderContext& context) = 0;
+    // Deactivate is a cheap handoff: views keep their rasterized textures so
+    // re-activating a recently visited program costs nothing. The registry's
+    // warm pool calls ReleaseTextures once a view falls out of it.
     virtual void Deactivate() = 0;
+    virtual void ReleaseTextures() {}
     virtual void Render(const RenderContext& context, const SDL_Rect& bounds) = 0;
     virtual void OnPrimaryAction(std::string& statusBuffer) = 0;
     [[nodiscard]] virtual std::optional<SDL_Rect> PrimaryActionRect() const = 0;
@@ -1,10 +1,32 @@
 #include "views/view_registry.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace colony
 {
 
+namespace
+{
+// Warm-pool depth. Two covers the flip-between-two-programs case the pool
+// exists for; a few more keep short browsing loops cheap as well.
+constexpr std::size_t kMaxWarmViews = 6;
+} // namespace
+
+void ViewRegistry::ReleaseSlot(Slot& slot)
+{
+    if (slot.view)
+    {
+        warmViews_.remove(slot.view.get());
+        if (active_ == slot.view.get())
+        {
+            active_ = nullptr;
+        }
+    }
+    slot.view.reset();
+    slot.factory = nullptr;
+}
+
 void ViewRegistry::Register(ViewPtr view)
 {
     if (!view)
@@ -12,19 +34,35 @@ void ViewRegistry::Register(ViewPtr view)
         throw std::invalid_argument("Cannot register null view");
     }
     const std::string id{view->Id()};
-    views_[id] = std::move(view);
+    auto& slot = views_[id];
+    ReleaseSlot(slot);
+    slot.view = std::move(view);
+}
+
+void ViewRegistry::RegisterLazy(std::string id, ViewFactoryFn factory)
+{
+    if (!factory)
+    {
+        throw std::invalid_argument("Cannot register null view factory");
+    }
+    auto& slot = views_[std::move(id)];
+    ReleaseSlot(slot);
+    slot.factory = std::move(factory);
 }
 
 void ViewRegistry::BindContent(const AppContent& content)
 {
+    boundContent_ = &content;
     for (const auto& [id, viewContent] : content.views)
     {
         auto it = views_.find(id);
-        if (it == views_.end())
+        if (it == views_.end() || !it->second.view)
         {
+            // Unregistered, or reserved but not yet materialized; a lazy
+            // view binds against boundContent_ when it is first activated.
             continue;
         }
-        it->second->BindContent(viewContent);
+        it->second.view->BindContent(viewContent);
     }
 }
 
@@ -40,8 +78,28 @@ View* ViewRegistry::Activate(std::string_view id, const RenderContext& context)
         return nullptr;
     }
 
-    it->second->Activate(context);
-    active_ = it->second.get();
+    Slot& slot = it->second;
+    if (!slot.view && slot.factory)
+    {
+        slot.view = slot.factory(key);
+        slot.factory = nullptr;
+        if (slot.view && boundContent_ != nullptr)
+        {
+            if (auto contentIt = boundContent_->views.find(key); contentIt != boundContent_->views.end())
+            {
+                slot.view->BindContent(contentIt->second);
+            }
+        }
+    }
+    if (!slot.view)
+    {
+        active_ = nullptr;
+        return nullptr;
+    }
+
+    warmViews_.remove(slot.view.get());
+    slot.view->Activate(context);
+    active_ = slot.view.get();
     return active_;
 }
 
@@ -50,7 +108,17 @@ void ViewRegistry::DeactivateActive()
     if (active_ != nullptr)
     {
         active_->Deactivate();
+        // Park the view in the warm pool instead of tearing it down; the
+        // eviction below is what finally releases textures.
+        warmViews_.remove(active_);
+        warmViews_.push_front(active_);
         active_ = nullptr;
+
+        while (warmViews_.size() > kMaxWarmViews)
+        {
+            warmViews_.back()->ReleaseTextures();
+            warmViews_.pop_back();
+        }
     }
 }
 
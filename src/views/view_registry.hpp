@@ -3,6 +3,8 @@
 #include "core/content.hpp"
 #include "views/view.hpp"
 
+#include <functional>
+#include <list>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -10,10 +12,26 @@
 namespace colony
 {
 
+// Owns the registered views and keeps a small LRU pool of recently
+// deactivated ones "warm": their textures stay resident, so flipping back
+// and forth between two programs re-activates on cached rasterizations.
+// Views falling out of the pool get ReleaseTextures, which bounds the
+// retained texture memory to a handful of text views.
 class ViewRegistry
 {
   public:
+    // Builds a view for the given program id; invoked at most once per
+    // registration, on the first Activate of that id.
+    using ViewFactoryFn = std::function<ViewPtr(const std::string& id)>;
+
     void Register(ViewPtr view);
+
+    // Reserves a handle for the id without constructing anything. The view
+    // is materialized (and bound against the last BindContent catalog) the
+    // first time it is activated, so registering a whole catalog is one map
+    // insert per id instead of one heap object per id.
+    void RegisterLazy(std::string id, ViewFactoryFn factory);
+
     void BindContent(const AppContent& content);
 
     View* Activate(std::string_view id, const RenderContext& context);
@@ -25,8 +43,22 @@ class ViewRegistry
     [[nodiscard]] std::optional<SDL_Rect> PrimaryActionRect() const;
 
   private:
-    std::unordered_map<std::string, ViewPtr> views_;
+    struct Slot
+    {
+        ViewPtr view;
+        // Present only while the view has not been materialized yet.
+        ViewFactoryFn factory;
+    };
+
+    void ReleaseSlot(Slot& slot);
+
+    std::unordered_map<std::string, Slot> views_;
+    // The catalog from the last BindContent; lazily materialized views bind
+    // against it. Refreshed on every content change, so it never outlives
+    // the application's content.
+    const AppContent* boundContent_ = nullptr;
     View* active_ = nullptr;
+    std::list<View*> warmViews_; // Front is most recently deactivated.
 };
 
 } // namespace colony
@@ -0,0 +1,38 @@
+// Headless replay driver for frame-time regression testing. Takes a session
+// captured with COLONY_RECORD_EVENTS and re-runs it at maximum speed on the
+// dummy video driver with the software renderer, printing per-frame times
+// and work counters. Not registered with ctest — it needs a recording file:
+//
+//     COLONY_RECORD_EVENTS=session.events ./ecosystem_app   (capture once)
+//     ./colony_replay session.events                        (every build)
+//
+// Run from the repository root so the bundled assets resolve. Compare the
+// report across revisions; a regression shows up as a p95/p99 shift against
+// the same canonical recording.
+
+#include "app/application.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "usage: %s <recording>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // The dummy driver renders nowhere and never blocks on a display; the
+    // software renderer keeps the frame work deterministic across GPUs. Both
+    // are set before SDL initializes, and only if the caller has not chosen
+    // otherwise (SDL reads hints from the environment).
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    setenv("SDL_RENDER_DRIVER", "software", 0);
+    setenv("COLONY_REPLAY_EVENTS", argv[1], 1);
+
+    colony::Application app;
+    return app.Run();
+}
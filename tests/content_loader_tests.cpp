@@ -1,14 +1,23 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest/doctest.h"
 
+#include "core/content_cache.hpp"
 #include "core/content_loader.hpp"
 #include "core/localization_manager.hpp"
 #define private public
 #include "app/application.hpp"
+#include "app/async_task.hpp"
+#include "app/launch_history.hpp"
 #undef private
+#include "frontend/models/fuzzy_matcher.hpp"
+#include "ui/program_visuals.hpp"
 #include "utils/color.hpp"
+#include "utils/surface_pool.hpp"
+#include "utils/utf8.hpp"
+#include "views/view_registry.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -18,6 +27,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <vector>
 #include <SDL2/SDL.h>
 
@@ -156,6 +167,151 @@ TEST_CASE("LoadContentFromFile parses minimal valid document")
     CHECK(content.views.at("PROGRAM").heading == "Program Heading");
 }
 
+TEST_CASE("Content cache round-trips and invalidates when the source changes")
+{
+    const auto path = WriteTempContent(
+        "colony_cache_source.json",
+        R"({
+            "brand": "Test Colony",
+            "channels": [
+                {"id": "alpha", "label": "Alpha", "programs": ["PROGRAM"]}
+            ],
+            "views": {
+                "PROGRAM": {
+                    "heading": "Program Heading",
+                    "primaryActionLabel": "Launch",
+                    "paragraphs": ["Paragraph"],
+                    "statusMessage": "Ready"
+                }
+            }
+        })");
+    std::filesystem::remove(colony::ContentCachePathFor(path));
+
+    CHECK_FALSE(colony::TryLoadContentCache(path).has_value());
+
+    const auto content = colony::LoadContentFromFile(path.string());
+    REQUIRE(colony::WriteContentCache(path, content));
+
+    const auto cached = colony::TryLoadContentCache(path);
+    REQUIRE(cached.has_value());
+    CHECK(cached->brandName == content.brandName);
+    CHECK(cached->user.name == content.user.name);
+    REQUIRE(cached->channels.size() == content.channels.size());
+    CHECK(cached->channels[0].programs == content.channels[0].programs);
+    REQUIRE(cached->views.contains("PROGRAM"));
+    CHECK(cached->views.at("PROGRAM").heading == content.views.at("PROGRAM").heading);
+    CHECK(cached->views.at("PROGRAM").statusMessage == content.views.at("PROGRAM").statusMessage);
+
+    // A truncated cache must fail the bounds checks, not read past the
+    // mapping.
+    {
+        std::error_code error;
+        const auto cachePath = colony::ContentCachePathFor(path);
+        const auto cacheSize = std::filesystem::file_size(cachePath, error);
+        REQUIRE_FALSE(error);
+        std::filesystem::resize_file(cachePath, cacheSize / 2, error);
+        REQUIRE_FALSE(error);
+    }
+    CHECK_FALSE(colony::TryLoadContentCache(path).has_value());
+    REQUIRE(colony::WriteContentCache(path, content));
+    CHECK(colony::TryLoadContentCache(path).has_value());
+
+    // Touching the source bytes must invalidate the cache.
+    {
+        std::ofstream output{path, std::ios::app};
+        REQUIRE(output.is_open());
+        output << '\n';
+    }
+    CHECK_FALSE(colony::TryLoadContentCache(path).has_value());
+
+    std::filesystem::remove(colony::ContentCachePathFor(path));
+}
+
+TEST_CASE("Streaming parse matches the DOM parse and keeps its validation")
+{
+    const auto path = WriteTempContent(
+        "colony_streaming.json",
+        R"({
+            "brand": "Streamed Colony",
+            "user": {"name": "Avery", "status": "Online"},
+            "channels": [
+                {"id": "alpha", "label": "Alpha", "programs": ["PROGRAM"]}
+            ],
+            "views": {
+                "PROGRAM": {
+                    "heading": "Program Heading",
+                    "primaryActionLabel": "Launch",
+                    "paragraphs": ["One", "Two"]
+                }
+            }
+        })");
+
+    const colony::ContentValidator validator;
+    const auto streamed = validator.LoadFromFileStreaming(path.string());
+    const auto parsed = colony::LoadContentFromFile(path.string());
+
+    CHECK(streamed.brandName == parsed.brandName);
+    CHECK(streamed.user.name == parsed.user.name);
+    REQUIRE(streamed.channels.size() == parsed.channels.size());
+    CHECK(streamed.channels[0].programs == parsed.channels[0].programs);
+    REQUIRE(streamed.views.contains("PROGRAM"));
+    CHECK(streamed.views.at("PROGRAM").paragraphs == parsed.views.at("PROGRAM").paragraphs);
+
+    const auto badPath = WriteTempContent(
+        "colony_streaming_bad.json",
+        R"({
+            "channels": [
+                {"id": "alpha", "label": "Alpha", "programs": ["MISSING"]}
+            ],
+            "views": {
+                "PROGRAM": {"heading": "H", "primaryActionLabel": "Launch"}
+            }
+        })");
+    CHECK_THROWS_WITH_AS(
+        validator.LoadFromFileStreaming(badPath.string()),
+        doctest::Contains("references unknown program id"),
+        std::runtime_error);
+}
+
+TEST_CASE("Parallel view parsing matches the sequential path and keeps validation")
+{
+    // Enough views to cross the per-worker threshold so the striped path
+    // actually runs; small documents elsewhere in this file cover the
+    // sequential fallback.
+    const auto buildCatalog = [](int viewCount, std::string_view referencedProgram) {
+        std::ostringstream builder;
+        builder << R"({"brand": "Big Colony", "user": {"name": "Avery"}, "views": {)";
+        for (int i = 0; i < viewCount; ++i)
+        {
+            if (i > 0)
+            {
+                builder << ",";
+            }
+            builder << "\"P" << i << R"(": {"heading": "Heading )" << i
+                    << R"(", "primaryActionLabel": "Launch", "paragraphs": ["Body )" << i << R"("]})";
+        }
+        builder << R"(}, "channels": [{"id": "alpha", "label": "Alpha", "programs": [")" << referencedProgram
+                << R"("]}]})";
+        return builder.str();
+    };
+
+    const auto path = WriteTempContent("colony_parallel.json", buildCatalog(400, "P399"));
+    const auto content = colony::LoadContentFromFile(path.string());
+    CHECK(content.brandName == "Big Colony");
+    CHECK(content.user.name == "Avery");
+    REQUIRE(content.views.size() == 400);
+    CHECK(content.views.at("P0").heading == "Heading 0");
+    CHECK(content.views.at("P399").paragraphs.front() == "Body 399");
+
+    // Channel references are validated only after the worker shards merge;
+    // a dangling one must still surface as the same error.
+    const auto badPath = WriteTempContent("colony_parallel_bad.json", buildCatalog(400, "MISSING"));
+    CHECK_THROWS_WITH_AS(
+        colony::LoadContentFromFile(badPath.string()),
+        doctest::Contains("references unknown program id"),
+        std::runtime_error);
+}
+
 TEST_CASE("LoadContentFromFile detects invalid view heading")
 {
     const auto path = WriteTempContent(
@@ -196,6 +352,194 @@ TEST_CASE("Application PointInRect honors exclusive bounds and dimensions")
     CHECK_FALSE(app.PointInRect(emptyHeight, 0, 0));
 }
 
+namespace
+{
+
+// Minimal view that records lifecycle calls; keeps the registry test free
+// of SDL rendering.
+class ProbeView final : public colony::View
+{
+  public:
+    ProbeView(std::string id, int& bindCount) : id_{std::move(id)}, bindCount_{&bindCount} {}
+
+    std::string_view Id() const noexcept override { return id_; }
+    void BindContent(const colony::ViewContent& content) override
+    {
+        ++*bindCount_;
+        heading_ = content.heading;
+    }
+    void Activate(const colony::RenderContext&) override {}
+    void Deactivate() override {}
+    void Render(const colony::RenderContext&, const SDL_Rect&) override {}
+    void OnPrimaryAction(std::string&) override {}
+    std::optional<SDL_Rect> PrimaryActionRect() const override { return std::nullopt; }
+
+    [[nodiscard]] const std::string& Heading() const noexcept { return heading_; }
+
+  private:
+    std::string id_;
+    int* bindCount_;
+    std::string heading_;
+};
+
+} // namespace
+
+TEST_CASE("ViewRegistry materializes lazy registrations on first activation")
+{
+    colony::AppContent content;
+    content.views["P1"].heading = "First";
+    content.views["P2"].heading = "Second";
+
+    int factoryCalls = 0;
+    int bindCalls = 0;
+    colony::ViewRegistry registry;
+    const auto factory = [&](const std::string& id) -> colony::ViewPtr {
+        ++factoryCalls;
+        return std::make_unique<ProbeView>(id, bindCalls);
+    };
+    registry.RegisterLazy("P1", factory);
+    registry.RegisterLazy("P2", factory);
+
+    // Bulk registration and binding construct nothing.
+    registry.BindContent(content);
+    CHECK(factoryCalls == 0);
+    CHECK(bindCalls == 0);
+
+    // First activation materializes exactly the requested view and binds it
+    // against the catalog from BindContent.
+    colony::RenderContext context;
+    colony::View* view = registry.Activate("P1", context);
+    REQUIRE(view != nullptr);
+    CHECK(factoryCalls == 1);
+    CHECK(bindCalls == 1);
+    CHECK(static_cast<ProbeView*>(view)->Heading() == "First");
+
+    // Re-activation reuses the materialized instance.
+    registry.DeactivateActive();
+    CHECK(registry.Activate("P1", context) == view);
+    CHECK(factoryCalls == 1);
+
+    // Unknown ids still resolve to nothing without invoking the factory.
+    CHECK(registry.Activate("P404", context) == nullptr);
+    CHECK(factoryCalls == 1);
+}
+
+TEST_CASE("BasicToggleSettings exposes table defaults and notifies on change only")
+{
+    colony::ui::BasicToggleSettings settings;
+    CHECK(settings.Get(colony::ui::BasicToggle::Notifications));
+    CHECK_FALSE(settings.Get(colony::ui::BasicToggle::ReducedMotion));
+
+    int notifications = 0;
+    settings.OnChanged([&](colony::ui::BasicToggle, bool) { ++notifications; });
+
+    // Redundant writes and unknown keys are silent.
+    CHECK_FALSE(settings.Set(colony::ui::BasicToggle::Sound, true));
+    CHECK_FALSE(settings.SetByKey("no_such_toggle", true));
+    CHECK(notifications == 0);
+
+    CHECK(settings.ToggleByKey("reduced_motion"));
+    CHECK(settings.Get(colony::ui::BasicToggle::ReducedMotion));
+    CHECK(notifications == 1);
+}
+
+TEST_CASE("EventRecorder round-trips a session and rejects incompatible recordings")
+{
+    const auto path = std::filesystem::temp_directory_path() / "colony_event_recording.events";
+
+#if !defined(_WIN32)
+    setenv("COLONY_RECORD_EVENTS", path.string().c_str(), 1);
+    {
+        colony::EventRecorder recorder;
+        recorder.StartFromEnvironment();
+        REQUIRE(recorder.Enabled());
+
+        SDL_Event click{};
+        click.type = SDL_MOUSEBUTTONDOWN;
+        click.button.button = SDL_BUTTON_LEFT;
+        click.button.x = 120;
+        click.button.y = 45;
+        recorder.Record(click);
+
+        recorder.AdvanceFrame();
+        SDL_Event key{};
+        key.type = SDL_KEYDOWN;
+        key.key.keysym.sym = SDLK_RETURN;
+        recorder.Record(key);
+    }
+    unsetenv("COLONY_RECORD_EVENTS");
+
+    const auto events = colony::EventRecorder::Load(path);
+    REQUIRE(events.has_value());
+    REQUIRE(events->size() == 2);
+    CHECK((*events)[0].frameIndex == 0);
+    CHECK((*events)[0].event.type == SDL_MOUSEBUTTONDOWN);
+    CHECK((*events)[0].event.button.x == 120);
+    CHECK((*events)[0].event.button.y == 45);
+    CHECK((*events)[1].frameIndex == 1);
+    CHECK((*events)[1].event.type == SDL_KEYDOWN);
+    CHECK((*events)[1].event.key.keysym.sym == SDLK_RETURN);
+#endif
+
+    // A recording whose event size differs was captured by another SDL
+    // build; replay must refuse it rather than reinterpret the union.
+    {
+        std::ofstream out{path, std::ios::trunc};
+        out << "colony-events 1 " << (sizeof(SDL_Event) + 8) << "\n";
+    }
+    CHECK_FALSE(colony::EventRecorder::Load(path).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Async tasks run pool work and resume through the completion drain")
+{
+    colony::WorkScheduler scheduler{1};
+    colony::AsyncScope scope;
+
+    const auto path = std::filesystem::temp_directory_path() / "colony_async_read.txt";
+    {
+        std::ofstream out{path, std::ios::trunc};
+        out << "payload";
+    }
+
+    auto makeTask = [&scheduler, &path](
+                        colony::CancellationToken token,
+                        std::optional<std::string>& target) -> colony::Task<void> {
+        auto bytes = co_await colony::ReadFileAsync(scheduler, path, token);
+        co_await colony::ResumeOnMain(scheduler);
+        target = std::move(bytes);
+    };
+
+    std::optional<std::string> loaded;
+    scope.Launch(makeTask(colony::CancellationToken{}, loaded));
+
+    colony::CancellationSource cancelSource;
+    cancelSource.RequestCancel();
+    std::optional<std::string> cancelled{std::string{"sentinel"}};
+    scope.Launch(makeTask(cancelSource.Token(), cancelled));
+
+    // Pump the drain the way RenderFrame does until both tasks retire.
+    for (int attempt = 0; attempt < 1000 && scope.ActiveCount() != 0; ++attempt)
+    {
+        scheduler.DrainCompletions(16);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(scope.ActiveCount() == 0);
+    REQUIRE(loaded.has_value());
+    CHECK(*loaded == "payload");
+    CHECK_FALSE(cancelled.has_value());
+
+    // A deadline reads as cancellation through the same token.
+    colony::CancellationSource timeoutSource;
+    CHECK_FALSE(timeoutSource.Token().IsCancelled());
+    timeoutSource.CancelAfter(std::chrono::milliseconds(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    CHECK(timeoutSource.Token().IsCancelled());
+
+    std::filesystem::remove(path);
+}
+
 TEST_CASE("Default content defines navigation channels for programs, addons, and games")
 {
     const auto appContentPath = ResolveDefaultContentPath();
@@ -290,6 +634,7 @@ TEST_CASE("RenderVerticalGradient draws within bounds")
     SDL_RenderPresent(renderer);
     CHECK(getPixel(0, 0) == clearedPixel);
 
+    colony::color::ClearGradientDitherCache();
     SDL_DestroyRenderer(renderer);
     SDL_FreeSurface(surface);
     SDL_Quit();
@@ -380,6 +725,82 @@ TEST_CASE("LocalizationManager loads translations with fallback and YAML support
     std::filesystem::remove_all(tempRoot);
 }
 
+TEST_CASE("UTF-8 toolkit folds, validates and trims codepoints")
+{
+    using namespace colony::text;
+
+    CHECK(ToLowerAscii("Hello WORLD ABCDEFGHIJKLMNOPQRSTUVWXYZ!") == "hello world abcdefghijklmnopqrstuvwxyz!");
+    // Multibyte sequences never pick up the case bit, even inside a SIMD block.
+    CHECK(ToLowerAscii("Caf\xC3\x89") == "caf\xC3\x89");
+
+    CHECK(IsValidUtf8("plain ascii, long enough to cover the vectorized skip"));
+    CHECK(IsValidUtf8("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x9A\x80"));
+    CHECK(!IsValidUtf8("\xC3"));             // truncated sequence
+    CHECK(!IsValidUtf8("\x80"));             // stray continuation byte
+    CHECK(!IsValidUtf8("\xC0\xAF"));         // overlong encoding
+    CHECK(!IsValidUtf8("\xED\xA0\x80"));     // UTF-16 surrogate
+    CHECK(!IsValidUtf8("\xF4\x90\x80\x80")); // above U+10FFFF
+
+    std::string value = "a\xC3\xA9";
+    CHECK(LastCodepointStart(value) == 1);
+    RemoveLastCodepoint(value);
+    CHECK(value == "a");
+    RemoveLastCodepoint(value);
+    CHECK(value.empty());
+    RemoveLastCodepoint(value);
+    CHECK(value.empty());
+
+    CHECK(NormalizeForSearch("  Hello,   WORLD!! 42 ") == "hello world 42");
+    CHECK(NormalizeForSearch("---") == "");
+    CHECK(NormalizeForSearch("abcdefghijklmnop0123456789qrstuvwxyz") == "abcdefghijklmnop0123456789qrstuvwxyz");
+}
+
+TEST_CASE("LocalizationManager serves languages from a compiled bundle and recompiles stale bundles")
+{
+    const std::filesystem::path tempRoot = GenerateUniqueTempPath("colony_localization_bundle_test");
+    REQUIRE(std::filesystem::create_directories(tempRoot));
+
+    auto writeFile = [&](std::string_view name, std::string_view contents) {
+        std::ofstream output{tempRoot / std::string{name}};
+        REQUIRE(output.is_open());
+        output << contents;
+    };
+
+    writeFile("en.json", R"({"messages": {"greeting": "Hello", "farewell": "Goodbye"}})");
+    writeFile("fr.json", R"({"messages": {"greeting": "Bonjour"}})");
+
+    const std::filesystem::path bundlePath = tempRoot / "localization.bundle";
+
+    colony::LocalizationManager manager;
+    manager.SetResourceDirectory(tempRoot);
+    manager.SetFallbackLanguage("en");
+    REQUIRE(manager.UseCompiledBundle(bundlePath));
+    REQUIRE(std::filesystem::exists(bundlePath));
+
+    REQUIRE(manager.LoadLanguage("fr"));
+    CHECK(manager.GetString("messages.greeting") == "Bonjour");
+    CHECK(manager.GetString("messages.farewell") == "Goodbye");
+
+    // Switching must not touch the source files: lookups come from the
+    // mapping, so deleting a source after compilation changes nothing.
+    std::filesystem::remove(tempRoot / "fr.json");
+    REQUIRE(manager.LoadLanguage("en"));
+    CHECK(manager.GetString("messages.greeting") == "Hello");
+    REQUIRE(manager.LoadLanguage("fr"));
+    CHECK(manager.GetString("messages.greeting") == "Bonjour");
+
+    // A newer source forces a recompile on the next UseCompiledBundle.
+    const auto staleTime = std::filesystem::last_write_time(bundlePath);
+    writeFile("en.json", R"({"messages": {"greeting": "Hi"}})");
+    std::filesystem::last_write_time(tempRoot / "en.json", staleTime + std::chrono::seconds{2});
+    manager.SetResourceDirectory(tempRoot);
+    REQUIRE(manager.UseCompiledBundle(bundlePath));
+    REQUIRE(manager.LoadLanguage("en"));
+    CHECK(manager.GetString("messages.greeting") == "Hi");
+
+    std::filesystem::remove_all(tempRoot);
+}
+
 TEST_CASE("LoadContentFromFile validates view sections")
 {
     SUBCASE("views object must not be empty")
@@ -762,3 +1183,129 @@ TEST_CASE("LoadContentFromFile validates channels")
             std::runtime_error);
     }
 }
+
+TEST_CASE("LaunchHistory maintains recency order and round-trips through its file")
+{
+    colony::LaunchHistory history;
+    history.RecordLaunch("alpha");
+    history.RecordLaunch("beta");
+    history.RecordLaunch("gamma");
+    history.RecordLaunch("alpha");
+
+    // Most recent first, one entry per program.
+    REQUIRE(history.RecencyOrder().size() == 3);
+    CHECK(history.RecencyOrder()[0] == "alpha");
+    CHECK(history.RecencyOrder()[1] == "gamma");
+    CHECK(history.RecencyOrder()[2] == "beta");
+
+    const auto path = std::filesystem::temp_directory_path() / "colony_launch_history.json";
+    {
+        std::ofstream output{path};
+        REQUIRE(output.is_open());
+        output << history.Serialize();
+    }
+
+    colony::LaunchHistory restored;
+    REQUIRE(restored.LoadFromFile(path));
+    CHECK(restored.RecencyOrder() == history.RecencyOrder());
+
+    // The ring bounds retention: flooding it with one program evicts the
+    // others once their last event is overwritten.
+    for (std::size_t i = 0; i < colony::LaunchHistory::kRingCapacity; ++i)
+    {
+        history.RecordLaunch("delta");
+    }
+    REQUIRE(history.RecencyOrder().size() == 1);
+    CHECK(history.RecencyOrder()[0] == "delta");
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Fuzzy match keys prune and rank library filter candidates")
+{
+    namespace fuzzy = colony::frontend::models::fuzzy;
+
+    const auto score = [](std::string_view candidate, std::string_view query) {
+        return fuzzy::ScoreMatch(fuzzy::BuildKey(candidate), fuzzy::BuildKey(query));
+    };
+
+    // The character mask rejects candidates missing a query letter outright,
+    // and a scattered subsequence that does exist still matches.
+    CHECK_FALSE(score("terminal", "xyz").has_value());
+    CHECK(score("terminal", "tml").has_value());
+    CHECK_FALSE(score("terminal", "tmz").has_value());
+
+    // An exact substring outranks a subsequence of the same query.
+    const auto substring = score("file manager", "man");
+    const auto subsequence = score("media scanner", "man");
+    REQUIRE(substring.has_value());
+    REQUIRE(subsequence.has_value());
+    CHECK(*substring > *subsequence);
+
+    // Word-boundary and earlier matches outrank buried ones.
+    const auto boundary = score("code editor", "edit");
+    const auto buried = score("spreadsheet editing", "edit");
+    REQUIRE(boundary.has_value());
+    REQUIRE(buried.has_value());
+    CHECK(*boundary > *buried);
+
+    // Matching is case-insensitive on both sides, and an empty query keeps
+    // everything (the unfiltered list).
+    CHECK(score("Terminal", "TERM").has_value());
+    CHECK(score("anything", "").has_value());
+}
+
+TEST_CASE("SurfacePool buckets, zeroes and recycles staging surfaces")
+{
+    auto& pool = colony::SurfacePool::Shared();
+    pool.Clear();
+
+    // Surfaces round up to the bucket granularity and arrive zeroed.
+    SDL_Surface* first = pool.Acquire(70, 20);
+    REQUIRE(first != nullptr);
+    CHECK(first->w == 128);
+    CHECK(first->h == 64);
+    CHECK(first->format->format == SDL_PIXELFORMAT_RGBA32);
+
+    // Dirty the surface, release it and reacquire the same bucket: the pool
+    // hands the identical surface back, cleared.
+    SDL_FillRect(first, nullptr, SDL_MapRGBA(first->format, 255, 0, 0, 255));
+    pool.Release(first);
+    SDL_Surface* second = pool.Acquire(100, 40);
+    REQUIRE(second == first);
+    const auto* pixels = static_cast<const std::uint32_t*>(second->pixels);
+    CHECK(pixels[0] == 0);
+
+    pool.Release(second);
+    pool.Clear();
+}
+
+TEST_CASE("SectionContentHeight follows measured layout, resident or not")
+{
+    colony::ui::ProgramVisuals::PatchSection section;
+    section.title.width = 120;
+    section.title.height = 24;
+
+    colony::ui::WrappedLine first;
+    first.texture.width = 200;
+    first.texture.height = 18;
+    colony::ui::WrappedLine second;
+    second.indent = true;
+    second.texture.width = 180;
+    second.texture.height = 18;
+    std::vector<colony::ui::WrappedLine> option;
+    option.emplace_back(std::move(first));
+    option.emplace_back(std::move(second));
+    section.lines.emplace_back(std::move(option));
+
+    // title + gap, two lines with per-line gaps, group gap, trailing gap —
+    // the scroll range only reads the measured sizes, so the height must be
+    // identical whether the textures are resident or released.
+    const int expected = 24 + colony::ui::Scale(10) + (18 + colony::ui::Scale(3)) * 2
+        + colony::ui::Scale(8) + colony::ui::Scale(10);
+    CHECK(colony::ui::SectionContentHeight(section) == expected);
+
+    section.rasterized = false;
+    section.title.texture.reset();
+    CHECK(colony::ui::SectionContentHeight(section) == expected);
+}